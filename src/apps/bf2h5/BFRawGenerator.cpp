@@ -0,0 +1,520 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include <cmath>
+#include <cstring>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <core/dalCommon.h>
+#include "BFRawGenerator.h"
+
+namespace DAL { // Namespace DAL -- begin
+
+  // ============================================================================
+  //
+  //  Construction
+  //
+  // ============================================================================
+
+  /*!
+    \param nofSubbands          -- Number of subbands.
+    \param nofSamplesPerSubband -- Number of samples per subband and block.
+    \param signal               -- Type of signal filled into the samples.
+  */
+  BFRawGenerator::BFRawGenerator (uint16_t const &nofSubbands,
+				  uint32_t const &nofSamplesPerSubband,
+				  SignalType const &signal)
+  {
+    init ();
+
+    if (nofSubbands > BFRawFormat::maxNrSubbands) {
+      std::cerr << "[BFRawGenerator] Number of subbands limited to "
+		<< BFRawFormat::maxNrSubbands
+		<< std::endl;
+      itsNofSubbands = BFRawFormat::maxNrSubbands;
+    } else {
+      itsNofSubbands = nofSubbands;
+    }
+
+    itsNofSamplesPerSubband = nofSamplesPerSubband;
+    itsSignalType           = signal;
+    itsSamples              = new BFRawFormat::Sample [nofSamplesPerBlock()];
+
+    setSamples ();
+  }
+
+  // ============================================================================
+  //
+  //  Destruction
+  //
+  // ============================================================================
+
+  BFRawGenerator::~BFRawGenerator ()
+  {
+    close ();
+
+    if (itsSamples != NULL) {
+      delete [] itsSamples;
+      itsSamples = NULL;
+    }
+  }
+
+  // ============================================================================
+  //
+  //  Parameters
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                setSignalType
+
+  void BFRawGenerator::setSignalType (SignalType const &signal)
+  {
+    itsSignalType = signal;
+    setSamples ();
+  }
+
+  //_____________________________________________________________________________
+  //                                                                 setAmplitude
+
+  /*!
+    \param amplitude -- Amplitude of the signal; the Ramp and Noise signals
+           are defined for positive amplitudes only.
+    \return status   -- Returns \e false if the amplitude is not positive, in
+            which case the previous amplitude is kept.
+  */
+  bool BFRawGenerator::setAmplitude (int16_t const &amplitude)
+  {
+    if (amplitude < 1) {
+      std::cerr << "[BFRawGenerator::setAmplitude] Amplitude must be positive!"
+		<< std::endl;
+      return false;
+    }
+
+    itsAmplitude = amplitude;
+    setSamples ();
+
+    return true;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                      summary
+
+  /*!
+    \param os -- Output stream to which the summary is written.
+  */
+  void BFRawGenerator::summary (std::ostream &os)
+  {
+    os << "[BFRawGenerator] Summary of internal parameters." << std::endl;
+    os << "-- nof. subbands            = " << itsNofSubbands             << std::endl;
+    os << "-- nof. samples per subband = " << itsNofSamplesPerSubband    << std::endl;
+    os << "-- nof. samples per block   = " << nofSamplesPerBlock()       << std::endl;
+    os << "-- Block size [Bytes]       = " << blockSize()                << std::endl;
+    os << "-- Signal type              = " << signalName(itsSignalType)  << std::endl;
+    os << "-- Signal amplitude         = " << itsAmplitude               << std::endl;
+    os << "-- Sample rate [Hz]         = " << itsSampleRate              << std::endl;
+    os << "-- Station                  = " << itsStation                 << std::endl;
+    os << "-- Socket mode              = " << itsSocketMode              << std::endl;
+    os << "-- Bytes written            = " << itsBytesWritten            << std::endl;
+  }
+
+  // ============================================================================
+  //
+  //  Methods
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                         init
+
+  void BFRawGenerator::init ()
+  {
+    itsNofSubbands          = 0;
+    itsNofSamplesPerSubband = 0;
+    itsSignalType           = BFRawGenerator::Noise;
+    itsAmplitude            = 100;
+    itsSampleRate           = 156250.0;
+    itsStation              = "CS001";
+    itsStartTime            = 1300000000;
+    itsSocketMode           = false;
+    itsSocket               = -1;
+    itsFile                 = NULL;
+    itsSamples              = NULL;
+    itsBytesWritten         = 0;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                   setSamples
+
+  void BFRawGenerator::setSamples ()
+  {
+    if (itsSamples == NULL) {
+      return;
+    }
+
+    uint64_t n       = 0;
+    uint32_t random  = 12345;
+    double amplitude = itsAmplitude;
+
+    for (uint16_t subband=0; subband<itsNofSubbands; ++subband) {
+      for (uint32_t sample=0; sample<itsNofSamplesPerSubband; ++sample, ++n) {
+	switch (itsSignalType) {
+	case Zero:
+	  itsSamples[n].xx = std::complex<int16_t>(0,0);
+	  itsSamples[n].yy = std::complex<int16_t>(0,0);
+	  break;
+	case Constant:
+	  itsSamples[n].xx = std::complex<int16_t>(itsAmplitude,0);
+	  itsSamples[n].yy = std::complex<int16_t>(itsAmplitude,0);
+	  break;
+	case Ramp:
+	  {
+	    int16_t value = int16_t(sample%(itsAmplitude+1));
+	    itsSamples[n].xx = std::complex<int16_t>(value,-value);
+	    itsSamples[n].yy = std::complex<int16_t>(-value,value);
+	  }
+	  break;
+	case Noise:
+	  {
+	    int16_t values[4];
+	    for (int k=0; k<4; ++k) {
+	      /* Linear congruential generator; keeps the stream reproducible */
+	      random    = 1103515245u*random + 12345u;
+	      values[k] = int16_t(int((random>>16)%(2*itsAmplitude+1)) - itsAmplitude);
+	    }
+	    itsSamples[n].xx = std::complex<int16_t>(values[0],values[1]);
+	    itsSamples[n].yy = std::complex<int16_t>(values[2],values[3]);
+	  }
+	  break;
+	case Tone:
+	  {
+	    double phase = 2*M_PI*(subband+1)*sample/itsNofSamplesPerSubband;
+	    int16_t re   = int16_t(amplitude*cos(phase));
+	    int16_t im   = int16_t(amplitude*sin(phase));
+	    itsSamples[n].xx = std::complex<int16_t>(re,im);
+	    itsSamples[n].yy = std::complex<int16_t>(im,re);
+	  }
+	  break;
+	};
+      }
+    }
+  }
+
+  //_____________________________________________________________________________
+  //                                                                  setFileMode
+
+  /*!
+    \param filename -- Name of the file to which the stream is written.
+    \return status  -- Status of the operation; returns \e false in case the
+            file could not be opened.
+  */
+  bool BFRawGenerator::setFileMode (std::string const &filename)
+  {
+    close ();
+
+    itsSocketMode = false;
+    itsFile       = new std::ofstream (filename.c_str(),
+				       std::ios::binary|std::ios::out|std::ios::trunc);
+
+    if (!itsFile->is_open()) {
+      std::cerr << "[BFRawGenerator::setFileMode] Failed to open file "
+		<< filename << std::endl;
+      return false;
+    }
+
+    return true;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                setSocketMode
+
+  /*!
+    \param port       -- Port number to connect to.
+    \param host       -- Address of the host to connect to.
+    \param nofRetries -- Number of attempts to connect, separated by 100 ms;
+           this allows the receiving end to be started after the generator.
+    \return status    -- Status of the operation; returns \e false in case no
+            connection could be established.
+  */
+  bool BFRawGenerator::setSocketMode (unsigned int const &port,
+				      std::string const &host,
+				      unsigned int const &nofRetries)
+  {
+    struct sockaddr_in address;
+
+    close ();
+
+    itsSocketMode = true;
+
+    memset (&address, 0, sizeof(address));
+    address.sin_family      = AF_INET;
+    address.sin_port        = htons(port);
+    address.sin_addr.s_addr = inet_addr(host.c_str());
+
+    for (unsigned int n=0; n<=nofRetries; ++n) {
+      itsSocket = socket (PF_INET, SOCK_STREAM, IPPROTO_TCP);
+      if (itsSocket < 0) {
+	std::cerr << "[BFRawGenerator::setSocketMode] Socket creation failed!"
+		  << std::endl;
+	return false;
+      }
+      if (connect (itsSocket, (sockaddr *) &address, sizeof(address)) == 0) {
+	return true;
+      }
+      ::close (itsSocket);
+      itsSocket = -1;
+      usleep (100000);
+    }
+
+    std::cerr << "[BFRawGenerator::setSocketMode] Failed to connect to "
+	      << host << ":" << port << std::endl;
+
+    return false;
+  }
+
+  //_____________________________________________________________________________
+  //                                                              writeMainHeader
+
+  bool BFRawGenerator::writeMainHeader ()
+  {
+    BFRawFormat::BFRaw_Header header;
+
+    memset (&header, 0, sizeof(header));
+
+    header.magic               = 0x3F8304EC;
+    header.bitsPerSample       = 16;
+    header.nrPolarizations     = 2;
+    header.nrSubbands          = itsNofSubbands;
+    header.nrSamplesPerSubband = itsNofSamplesPerSubband;
+    header.sampleRate          = itsSampleRate;
+    strncpy (header.station, itsStation.c_str(), sizeof(header.station)-1);
+
+    for (uint16_t n=0; n<itsNofSubbands; ++n) {
+      header.subbandFrequencies[n]   = (300+n)*itsSampleRate;
+      header.subbandToBeamMapping[n] = 0;
+    }
+
+    for (int beam=0; beam<8; ++beam) {
+      header.beamDirections[beam][0] = 0.1*beam;
+      header.beamDirections[beam][1] = 0.5;
+    }
+
+    /* Header fields are transmitted in big-endian byte order; the swapped
+       fields are the same as handled by StationBeamReader::swapHeaderEndians */
+    if (!BigEndian()) {
+      for (int n=0; n<BFRawFormat::maxNrSubbands; ++n) {
+	swapbytes ((char *)&header.subbandFrequencies[n],8);
+      }
+      for (int beam=0; beam<8; ++beam) {
+	swapbytes ((char *)&header.beamDirections[beam][0],8);
+	swapbytes ((char *)&header.beamDirections[beam][1],8);
+      }
+      swapbytes ((char *)&header.nrSubbands,2);
+      swapbytes ((char *)&header.nrSamplesPerSubband,4);
+      swapbytes ((char *)&header.sampleRate,8);
+      swapbytes ((char *)&header.magic,4);
+    }
+
+    return sendBytes (&header, sizeof(header));
+  }
+
+  //_____________________________________________________________________________
+  //                                                               writeDataBlock
+
+  /*!
+    \param blockNr -- Sequence number of the block; used to compute the time
+           stamps stored in the block header.
+    \return status -- Status of the operation; returns \e false in case an
+            error was encountered.
+  */
+  bool BFRawGenerator::writeDataBlock (uint64_t const &blockNr)
+  {
+    BFRawFormat::BlockHeader header;
+    int64_t time = int64_t(itsStartTime*itsSampleRate)
+      + int64_t(blockNr*itsNofSamplesPerSubband);
+
+    memset (&header, 0, sizeof(header));
+
+    header.magic = 0x2913D852;
+    for (int n=0; n<8; ++n) {
+      header.time[n] = time;
+    }
+
+    if (!BigEndian()) {
+      swapbytes ((char *)&header.magic,4);
+      for (int n=0; n<8; ++n) {
+	swapbytes ((char *)&header.time[n],8);
+      }
+    }
+
+    if (sendBytes (&header, sizeof(header))) {
+      return sendBytes (itsSamples,
+			nofSamplesPerBlock()*sizeof(BFRawFormat::Sample));
+    } else {
+      return false;
+    }
+  }
+
+  //_____________________________________________________________________________
+  //                                                                     generate
+
+  /*!
+    \param nofBlocks -- Number of data blocks to write after the main header.
+    \return status   -- Status of the operation; returns \e false in case an
+            error was encountered.
+  */
+  bool BFRawGenerator::generate (unsigned int const &nofBlocks)
+  {
+    if (!writeMainHeader()) {
+      return false;
+    }
+
+    for (unsigned int n=0; n<nofBlocks; ++n) {
+      if (!writeDataBlock(n)) {
+	std::cerr << "[BFRawGenerator::generate] Failed to write block "
+		  << n << std::endl;
+	return false;
+      }
+    }
+
+    close ();
+
+    return true;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                        close
+
+  void BFRawGenerator::close ()
+  {
+    if (itsSocket >= 0) {
+      shutdown (itsSocket, SHUT_RDWR);
+      ::close (itsSocket);
+      itsSocket = -1;
+    }
+
+    if (itsFile != NULL) {
+      if (itsFile->is_open()) {
+	itsFile->close();
+      }
+      delete itsFile;
+      itsFile = NULL;
+    }
+  }
+
+  //_____________________________________________________________________________
+  //                                                                    sendBytes
+
+  bool BFRawGenerator::sendBytes (void const *storage,
+				  size_t nofBytes)
+  {
+    char const *bytepointer = reinterpret_cast<char const *>(storage);
+
+    if (itsSocketMode) {
+      if (itsSocket < 0) {
+	return false;
+      }
+      while (nofBytes > 0) {
+	ssize_t sent = send (itsSocket, bytepointer, nofBytes, MSG_NOSIGNAL);
+	if (sent <= 0) {
+	  std::cerr << "[BFRawGenerator::sendBytes] Error sending data!"
+		    << std::endl;
+	  return false;
+	}
+	nofBytes        -= sent;
+	bytepointer     += sent;
+	itsBytesWritten += sent;
+      }
+    } else {
+      if (itsFile == NULL || !itsFile->is_open()) {
+	return false;
+      }
+      itsFile->write (bytepointer, nofBytes);
+      if (!itsFile->good()) {
+	return false;
+      }
+      itsBytesWritten += nofBytes;
+    }
+
+    return true;
+  }
+
+  // ============================================================================
+  //
+  //  Static methods
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                   signalType
+
+  /*!
+    \retval signal -- Signal type matching \c name.
+    \param name    -- Name of the signal type: \e zero, \e constant, \e ramp,
+           \e noise or \e tone.
+    \return status -- Returns \e false if \c name did not match any of the
+            known signal types.
+  */
+  bool BFRawGenerator::signalType (SignalType &signal,
+				   std::string const &name)
+  {
+    if (name == "zero") {
+      signal = Zero;
+    } else if (name == "constant") {
+      signal = Constant;
+    } else if (name == "ramp") {
+      signal = Ramp;
+    } else if (name == "noise") {
+      signal = Noise;
+    } else if (name == "tone") {
+      signal = Tone;
+    } else {
+      return false;
+    }
+
+    return true;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                   signalName
+
+  std::string BFRawGenerator::signalName (SignalType const &signal)
+  {
+    switch (signal) {
+    case Zero:
+      return "zero";
+    case Constant:
+      return "constant";
+    case Ramp:
+      return "ramp";
+    case Noise:
+      return "noise";
+    case Tone:
+      return "tone";
+    };
+
+    return "unknown";
+  }
+
+} // Namespace DAL -- end
@@ -0,0 +1,273 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#ifndef BFRAWGENERATOR_H
+#define BFRAWGENERATOR_H
+
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <data_hl/BFRawFormat.h>
+
+namespace DAL { // Namespace DAL -- begin
+
+  /*!
+    \class BFRawGenerator
+
+    \ingroup DAL
+    \ingroup dal_apps
+
+    \brief Generator for a synthetic stream of beam-formed raw data
+
+    \author agent
+
+    \date 2026/10/18
+
+    <h3>Prerequisite</h3>
+
+    <ul type="square">
+      <li>BFRawFormat -- Definition of the raw data format
+      <li>DAL::StationBeamReader -- Consumer of the generated stream
+    </ul>
+
+    <h3>Synopsis</h3>
+
+    Creates a valid stream of beam-formed raw data, as it is consumed by the
+    DAL::StationBeamReader: a single BFRawFormat::BFRaw_Header, followed by a
+    sequence of data blocks, each of which consists of a
+    BFRawFormat::BlockHeader and <tt>nofSubbands*nofSamplesPerSubband</tt>
+    samples of type BFRawFormat::Sample (stored subband by subband). The
+    stream either is written to a file or sent to a TCP socket, e.g. on the
+    loopback interface to feed a running instance of \e bf2h5.
+
+    The header fields are written in big-endian byte order, the samples
+    themselves in native byte order -- this matches the conversions carried
+    out by StationBeamReader::readMainHeader and
+    StationBeamReader::readFirstDataBlock.
+
+    The content of the samples is selected via BFRawGenerator::SignalType;
+    the sample buffer is computed once and sent for every block, such that the
+    generator itself does not become the bottleneck when streaming.
+
+    <h3>Example(s)</h3>
+
+    <ol>
+      <li>Write 10 blocks of noise for 4 subbands to a file:
+      \code
+      DAL::BFRawGenerator gen (4, 16384, DAL::BFRawGenerator::Noise);
+
+      gen.setFileMode ("bfraw.dat");
+      gen.generate (10);
+      \endcode
+      <li>Send the data to a running instance of \e bf2h5 listening on port
+      4346 of the local host:
+      \code
+      gen.setSocketMode (4346);
+      gen.generate (10);
+      \endcode
+    </ol>
+
+  */
+  class BFRawGenerator {
+
+  public:
+
+    //! Type of signal with which the samples are filled
+    enum SignalType {
+      //! All samples set to zero
+      Zero,
+      //! All samples set to the amplitude
+      Constant,
+      //! Linear ramp along the samples of each subband
+      Ramp,
+      //! Uniformly distributed random numbers
+      Noise,
+      //! Complex sinusoid, with a frequency depending on the subband
+      Tone
+    };
+
+  private:
+
+    //! Number of subbands
+    uint16_t itsNofSubbands;
+    //! Number of samples per subband
+    uint32_t itsNofSamplesPerSubband;
+    //! Type of signal to fill into the samples
+    SignalType itsSignalType;
+    //! Amplitude of the signal
+    int16_t itsAmplitude;
+    //! Sample rate, [Hz]
+    double itsSampleRate;
+    //! Name of the station
+    std::string itsStation;
+    //! Start time of the observation, [s] since 1970
+    int64_t itsStartTime;
+    //! Write to socket (true) or to file (false)?
+    bool itsSocketMode;
+    //! Socket descriptor
+    int itsSocket;
+    //! Output file stream
+    std::ofstream *itsFile;
+    //! Buffer for the samples of a single block
+    BFRawFormat::Sample *itsSamples;
+    //! Number of bytes written so far
+    uint64_t itsBytesWritten;
+
+  public:
+
+    // === Construction =========================================================
+
+    //! Argumented constructor
+    BFRawGenerator (uint16_t const &nofSubbands=BFRawFormat::maxNrSubbands,
+		    uint32_t const &nofSamplesPerSubband=155648,
+		    SignalType const &signal=BFRawGenerator::Noise);
+
+    // === Destruction ==========================================================
+
+    //! Destructor
+    ~BFRawGenerator ();
+
+    // === Parameter access =====================================================
+
+    //! Get the number of subbands
+    inline uint16_t nofSubbands () const {
+      return itsNofSubbands;
+    }
+
+    //! Get the number of samples per subband
+    inline uint32_t nofSamplesPerSubband () const {
+      return itsNofSamplesPerSubband;
+    }
+
+    //! Get the type of signal filled into the samples
+    inline SignalType signalType () const {
+      return itsSignalType;
+    }
+
+    //! Set the type of signal filled into the samples
+    void setSignalType (SignalType const &signal);
+
+    //! Get the amplitude of the signal
+    inline int16_t amplitude () const {
+      return itsAmplitude;
+    }
+
+    //! Set the amplitude of the signal; must be positive
+    bool setAmplitude (int16_t const &amplitude);
+
+    //! Get the sample rate, [Hz]
+    inline double sampleRate () const {
+      return itsSampleRate;
+    }
+
+    //! Set the sample rate, [Hz]
+    inline void setSampleRate (double const &sampleRate) {
+      itsSampleRate = sampleRate;
+    }
+
+    //! Get the name of the station
+    inline std::string station () const {
+      return itsStation;
+    }
+
+    //! Set the name of the station
+    inline void setStation (std::string const &station) {
+      itsStation = station;
+    }
+
+    //! Get the number of samples (all subbands) within a single block
+    inline uint64_t nofSamplesPerBlock () const {
+      return uint64_t(itsNofSubbands)*itsNofSamplesPerSubband;
+    }
+
+    //! Get the size of a single block (header and samples), [Bytes]
+    inline uint64_t blockSize () const {
+      return sizeof(BFRawFormat::BlockHeader)
+	+ nofSamplesPerBlock()*sizeof(BFRawFormat::Sample);
+    }
+
+    //! Get the number of bytes written so far
+    inline uint64_t bytesWritten () const {
+      return itsBytesWritten;
+    }
+
+    /*!
+      \brief Get the name of the class
+      \return className -- The name of the class, BFRawGenerator.
+    */
+    inline std::string className () const {
+      return "BFRawGenerator";
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    inline void summary () {
+      summary (std::cout);
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    void summary (std::ostream &os);
+
+    // === Methods ==============================================================
+
+    //! Write the generated stream to a file
+    bool setFileMode (std::string const &filename);
+
+    //! Send the generated stream to a TCP socket
+    bool setSocketMode (unsigned int const &port,
+			std::string const &host="127.0.0.1",
+			unsigned int const &nofRetries=50);
+
+    //! Write the main header of the stream
+    bool writeMainHeader ();
+
+    //! Write a single block of data (block header and samples)
+    bool writeDataBlock (uint64_t const &blockNr);
+
+    //! Write the main header, followed by \c nofBlocks blocks of data
+    bool generate (unsigned int const &nofBlocks);
+
+    //! Close the file or socket connection
+    void close ();
+
+    // === Static methods =======================================================
+
+    //! Get the signal type matching a name
+    static bool signalType (SignalType &signal,
+			    std::string const &name);
+
+    //! Get the name of a signal type
+    static std::string signalName (SignalType const &signal);
+
+  private:
+
+    //! Initialize the object's internal parameters
+    void init ();
+    //! Fill the buffer with the samples for a single block
+    void setSamples ();
+    //! Send a number of bytes to the file or socket
+    bool sendBytes (void const *storage,
+		    size_t nofBytes);
+
+  }; // Class BFRawGenerator -- end
+
+} // Namespace DAL -- end
+
+#endif /* BFRAWGENERATOR_H */
@@ -19,6 +19,7 @@
  ***************************************************************************/
 
 #include <iostream>
+#include <sys/time.h>
 #include "Bf2h5Calculator.h"
 #include "bf2h5.h"
 
@@ -50,7 +51,7 @@ namespace DAL { // Namespace DAL -- begin
       itsParent(its_parent),
       nrOfSubbands(nofSubbands), 
       nrSamplesPerSubband(nr_samples_subband),
-      checking_completeness(false),
+      itsCalculationTime(0),
       itsStopProcessing(false),
       currentBlockNr(0)
   {
@@ -293,6 +294,9 @@ namespace DAL { // Namespace DAL -- begin
 void * Bf2h5Calculator::doDownSampleSingleSubband (void *threaddata)
 {
   thread_data *tdata(0);
+  struct timeval start;
+  struct timeval end;
+  long int completedBlock (0);
   
   while(!itsStopProcessing) {
     
@@ -313,19 +317,21 @@ void * Bf2h5Calculator::doDownSampleSingleSubband (void *threaddata)
 	tdata->subband_output_data = dataBlockOutput[tdata->subbandNr];
 	blockDeque.pop_front();
 	if (blockDeque.empty()) {
-	  itsData.erase(itsData.begin());
+	  itsData.erase(firstBlock);
 	}
 	--level;
 	pthread_mutex_unlock(&calculationMapMutex);
 	
 	// do the actual processing of the data (mutex is unlocked)
 	uint32_t xx_intensity(0), yy_intensity(0);
-	uint64_t start(0);
+	uint64_t start_idx(0);
+
+	gettimeofday (&start, NULL);
 	
 	for ( uint32_t count = 0; count < itsSingleSubbandNrOutputSamples; ++count ) // count loops over all output samples
 	  {
 	    tdata->subband_output_data[count] = 0;
-	    for ( uint64_t idx = start; idx < (start + itsDownSampleFactor); ++idx ) // loop over nr of samples defined by downsampling factor
+	    for ( uint64_t idx = start_idx; idx < (start_idx + itsDownSampleFactor); ++idx ) // loop over nr of samples defined by downsampling factor
 	      {
 		xx_intensity = (uint32_t)(real(tdata->input_data[ idx ].xx) * real(tdata->input_data[ idx ].xx) +
 					  imag(tdata->input_data[ idx ].xx) * imag(tdata->input_data[ idx ].xx) ); // this will be max 33 bits integer
@@ -334,18 +340,31 @@ void * Bf2h5Calculator::doDownSampleSingleSubband (void *threaddata)
 		tdata->subband_output_data[count] += (float)xx_intensity + (float)yy_intensity;
 		//TODO: check if this intensity data needs to be divided by itsDownSampleFactor to get averaged value
 	      }
-	    start += itsDownSampleFactor;
+	    start_idx += itsDownSampleFactor;
 	  }
+
+	gettimeofday (&end, NULL);
 	
 	//  keep track of finished subbands
 	itsParent->calculatorDataReady(tdata->blockNr, tdata->subbandNr, tdata->subband_output_data); // signal itsParent app to write the data
+
+	pthread_mutex_lock(&calculationMapMutex);
+	itsCalculationTime += (end.tv_sec-start.tv_sec) + 1e-6*(end.tv_usec-start.tv_usec);
 	subbandReady[tdata->subbandNr] = true;
-	checkIfBlockComplete(); // TODO: do this somewhere else?
+	completedBlock = currentBlockNr;
+	bool blockDone = checkIfBlockComplete();
+	pthread_mutex_unlock(&calculationMapMutex);
+
+	if (blockDone) {
+	  itsParent->blockComplete(completedBlock); // signal parent
+	}
 	tdata->busy = false;
       }
-      else { // didn't find data for current block
+      else {
+	/* All subbands of the current block have been handed out, but not yet
+	   completed; wait until the block is done before picking up the next. */
+        pthread_cond_wait(&condition, &calculationMapMutex);
         pthread_mutex_unlock(&calculationMapMutex);
-        return 0;
       }
     }
     else {
@@ -359,28 +378,38 @@ void * Bf2h5Calculator::doDownSampleSingleSubband (void *threaddata)
 //_______________________________________________________________________________
 //                                                           checkIfBlockComplete
 
-void Bf2h5Calculator::checkIfBlockComplete (void) {
-  while (1) {
-    if (!checking_completeness) { // added for thread safety (it could be that a thread becomes ready when just checking completeness for another thread, then we have to wait for the first check to complete before doing the next check
-      checking_completeness = true;
-      for (uint8_t i=0; i < nrOfSubbands; ++i) {
-	if (subbandReady[i] == false) {
-	  checking_completeness = false;
-	  return; // we are not ready with the current block
-	}
-      }
-      
-      // apparently all subbands for this block are done
-      for (uint8_t i=0; i < nrOfSubbands; ++i) { // set subbandReady array to all false for next data block
-	subbandReady[i] = false;
-      }
-      //lastReadyBlock = currentBlockNr++;
-      itsParent->blockComplete(++currentBlockNr); // signal parent
-      checking_completeness = false;
-      return;
+/*!
+  Must be called with the calculationMapMutex locked.
+
+  \return done -- Returns \e true if all subbands of the current block have
+          been calculated; in that case the calculator moves on to the next block.
+*/
+bool Bf2h5Calculator::checkIfBlockComplete (void)
+{
+  for (uint8_t i=0; i < nrOfSubbands; ++i) {
+    if (subbandReady[i] == false) {
+      return false; // we are not ready with the current block
     }
-    usleep(100);
   }
+  
+  // apparently all subbands for this block are done
+  for (uint8_t i=0; i < nrOfSubbands; ++i) { // set subbandReady array to all false for next data block
+    subbandReady[i] = false;
+  }
+  ++currentBlockNr;
+  pthread_cond_broadcast(&condition);
+  return true;
+}
+
+//_______________________________________________________________________________
+//                                                                calculationTime
+
+double Bf2h5Calculator::calculationTime (void)
+{
+  pthread_mutex_lock (&calculationMapMutex);
+  double result = itsCalculationTime;
+  pthread_mutex_unlock (&calculationMapMutex);
+  return result;
 }
 
 //_______________________________________________________________________________
@@ -90,12 +90,15 @@ namespace DAL { // Namespace DAL -- begin
     
     //! Show the status of the calculator
     void showStatus(void);
+
+    //! Get the time spent computing, summed over all threads, [s]
+    double calculationTime (void);
     
   private:
     //		bool unscheduledDataLeft(void); // checks if there are still data blocks that need to be scheduled for processing
     
     //! Check if a complete block of subbands has been calculated
-    void checkIfBlockComplete (void);
+    bool checkIfBlockComplete (void);
     
     //! Each calculation thread uses one of these structs
     struct thread_data
@@ -130,7 +133,8 @@ namespace DAL { // Namespace DAL -- begin
     uint32_t nrSamplesPerSubband;
     //! Points to array of flags marking subbands that have been written
     bool * subbandReady;
-    bool checking_completeness;
+    //! Time spent computing, summed over all threads, [s]
+    double itsCalculationTime;
     // the parallel threads for calculation
     pthread_t itsCalculationThread[NUM_CALCULATION_THREADS]; // the calculation threads
     // the tread_data_array contain input, settings and output data for that tread
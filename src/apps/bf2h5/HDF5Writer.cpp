@@ -21,6 +21,7 @@
 #include "bf2h5.h"
 #include "HDF5Writer.h"
 #include <data_hl/BFRawFormat.h>
+#include <sys/time.h>
 
 using namespace DAL;
 using std::vector;
@@ -39,33 +40,32 @@ HDF5Writer::HDF5Writer (BF2H5 *parent,
 			size_t output_block_size,
 			uint8_t nr_subbands)
   : itsParent(parent),
-    rawfile(0), 
-    table(0),
-    stopWriting(false),
-    itsOutputFile(output_file), 
-    waitForDataTimeOut(0),
-    foundDataForCurrentBlock(false),
-    outputBlockSize(output_block_size),
-    creation_mode("TCP"),
-    nrOfBlocks(0),
-    currentBlockNr(0), 
-    nrOfSubbands(nr_subbands),
-    file_byte_size(0)
+    itsOutputFile(output_file)
 {
-  subbandReady = new bool [nrOfSubbands];
-  for (uint8_t i=0; i < nrOfSubbands; ++i) {
-    subbandReady[i] = false;
-  }
-  
-  pthread_mutex_init(&writeMapMutex, NULL);
-  
-  zeroBlock = new float [outputBlockSize];
-  memset(zeroBlock, 0, outputBlockSize * sizeof(float));
+  init (output_block_size, nr_subbands);
   // create output file
   createHDF5File(ps);
 }
 #endif
 
+/*!
+  \param parent            -- Pointer to the parent application.
+  \param output_file       -- Name of the output HDF5 file.
+  \param output_block_size -- Number of output samples per subband and block.
+  \param nr_subbands       -- Number of subbands.
+*/
+HDF5Writer::HDF5Writer (BF2H5 *parent,
+			const string &output_file,
+			size_t output_block_size,
+			uint8_t nr_subbands)
+  : itsParent(parent),
+    itsOutputFile(output_file)
+{
+  init (output_block_size, nr_subbands);
+  // create output file
+  createHDF5File();
+}
+
 // ==============================================================================
 //
 //  Destruction
@@ -77,10 +77,14 @@ HDF5Writer::~HDF5Writer()
   pthread_mutex_destroy(&writeMapMutex);
   delete [] zeroBlock;
   delete [] subbandReady;
-  for (uint8_t i = 0; i < nrOfSubbands; ++i) {
-    delete table[i];
+  if (table) {
+    for (uint8_t i = 0; i < nrOfSubbands; ++i) {
+      delete table[i];
+    }
+    delete [] table;
   }
-  delete table;
+  delete dataset;
+  delete rawfile;
 }
 
 // ==============================================================================
@@ -89,16 +93,49 @@ HDF5Writer::~HDF5Writer()
 //
 // ==============================================================================
 
+//_______________________________________________________________________________
+//                                                                           init
+
+void HDF5Writer::init (size_t output_block_size,
+		       uint8_t nr_subbands)
+{
+  rawfile                  = 0;
+  table                    = 0;
+  dataset                  = 0;
+  stopWriting              = false;
+  waitForDataTimeOut       = 0;
+  foundDataForCurrentBlock = false;
+  outputBlockSize          = output_block_size;
+  creation_mode            = "TCP";
+  nrOfBlocks               = 0;
+  currentBlockNr           = 0;
+  nrOfSubbands             = nr_subbands;
+  file_byte_size           = 0;
+  itsWriteTime             = 0;
+  itsBytesWritten          = 0;
+
+  subbandReady = new bool [nrOfSubbands];
+  for (uint8_t i=0; i < nrOfSubbands; ++i) {
+    subbandReady[i] = false;
+  }
+  
+  pthread_mutex_init(&writeMapMutex, NULL);
+  
+  zeroBlock = new float [outputBlockSize];
+  memset(zeroBlock, 0, outputBlockSize * sizeof(float));
+}
+
 #ifdef DAL_WITH_LOFAR
 
+//_______________________________________________________________________________
+//                                                                 createHDF5File
+
 void HDF5Writer::createHDF5File (const LOFAR::RTCP::Parset *ps)
 {
   std::stringstream sstr; // used for type conversion
   std::string strValue;
 
-  dataset = dalDataset( itsOutputFile.c_str(), "HDF5" );
-
-  const BFRawFormat::BFRaw_Header & header = itsParent->getMainHeader();
+  dataset = new dalDataset (itsOutputFile, "HDF5", IO_Mode(IO_Mode::Create));
 
   // root-level headers
   //	int n_stations = 1;
@@ -122,7 +159,7 @@ void HDF5Writer::createHDF5File (const LOFAR::RTCP::Parset *ps)
   uint downsample_factor = itsParent->getDownSampleFactor();
   
   // write headers using above
-  dataset.setAttribute( "ANTENNA_SET", ps->antennaSet() );
+  dataset->setAttribute( "ANTENNA_SET", ps->antennaSet() );
   /*
   // station clock frequency
   if (header.nrSamplesPerSubband == 155648) strValue = "160MHz";
@@ -136,12 +173,12 @@ void HDF5Writer::createHDF5File (const LOFAR::RTCP::Parset *ps)
   sstr.clear();
   sstr << clock_speed;
   strValue = sstr.str();
-  dataset.setAttribute( "CLOCK_FREQUENCY", strValue);
-  dataset.setAttribute( "CLOCK_FREQUENCY_UNIT", string("Hz") );
-  dataset.setAttribute( "CREATION_MODE", creation_mode );
-  dataset.setAttribute( "DOWNSAMPLE_RATE", &downsample_factor );
-  dataset.setAttribute( "FILENAME", itsOutputFile );
-  dataset.setAttribute( "FILETYPE", string("bfstation") );
+  dataset->setAttribute( "CLOCK_FREQUENCY", strValue);
+  dataset->setAttribute( "CLOCK_FREQUENCY_UNIT", string("Hz") );
+  dataset->setAttribute( "CREATION_MODE", creation_mode );
+  dataset->setAttribute( "DOWNSAMPLE_RATE", &downsample_factor );
+  dataset->setAttribute( "FILENAME", itsOutputFile );
+  dataset->setAttribute( "FILETYPE", string("bfstation") );
   // get current time = file creation time
   time_t rawtime;
   struct tm * timeinfo;
@@ -149,11 +186,11 @@ void HDF5Writer::createHDF5File (const LOFAR::RTCP::Parset *ps)
   time ( &rawtime );
   timeinfo = localtime ( &rawtime );
   strftime (timestr,80,"%Y-%m-%dT%X",timeinfo );
-  dataset.setAttribute( "FILEDATE",  string(timestr) );
+  dataset->setAttribute( "FILEDATE",  string(timestr) );
   
-  dataset.setAttribute( "FILTER_SELECTION", ps->bandFilter() );
-  dataset.setAttribute( "GROUPTYPE", string("Root") );
-  dataset.setAttribute( "INPUT_FILESIZE", &file_byte_size );
+  dataset->setAttribute( "FILTER_SELECTION", ps->bandFilter() );
+  dataset->setAttribute( "GROUPTYPE", string("Root") );
+  dataset->setAttribute( "INPUT_FILESIZE", &file_byte_size );
   
   // number of stations
   unsigned int nrOfStations = ps->nrStations();
@@ -161,15 +198,15 @@ void HDF5Writer::createHDF5File (const LOFAR::RTCP::Parset *ps)
   sstr.clear();
   sstr << nrOfStations;
   strValue = sstr.str();
-  dataset.setAttribute( "NOF_STATIONS", strValue            );
-  dataset.setAttribute( "NOTES",        string("UNDEFINED") );
+  dataset->setAttribute( "NOF_STATIONS", strValue            );
+  dataset->setAttribute( "NOTES",        string("UNDEFINED") );
   
   // observationID
   sstr.str("");
   sstr.clear();
   sstr << ps->observationID();
   strValue = sstr.str();
-  dataset.setAttribute( "OBSERVATION_ID", strValue );
+  dataset->setAttribute( "OBSERVATION_ID", strValue );
   
   // observation start time
   time_t obsStartTime = ps->startTime() / 86400 + 40587; // convert from unix time to MJD
@@ -177,12 +214,12 @@ void HDF5Writer::createHDF5File (const LOFAR::RTCP::Parset *ps)
   sstr.clear();
   sstr << obsStartTime;
   strValue = sstr.str();
-  dataset.setAttribute( "OBSERVATION_START_MJD", strValue );
+  dataset->setAttribute( "OBSERVATION_START_MJD", strValue );
   time ( &obsStartTime );
   tm * ptm = gmtime ( &obsStartTime );
   strftime (timestr,80,"%Y-%m-%dT%X",ptm);
-  dataset.setAttribute( "OBSERVATION_START_UTC", string(timestr) );
-  dataset.setAttribute( "OBSERVATION_START_TAI", string("") );
+  dataset->setAttribute( "OBSERVATION_START_UTC", string(timestr) );
+  dataset->setAttribute( "OBSERVATION_START_TAI", string("") );
   
   // observation start time
   time_t obsStopTime = ps->stopTime()  / 86400 + 40587; // convert from unix time to MJD
@@ -190,21 +227,21 @@ void HDF5Writer::createHDF5File (const LOFAR::RTCP::Parset *ps)
   sstr.clear();
   sstr << obsStopTime;
   strValue = sstr.str();
-  dataset.setAttribute( "OBSERVATION_END_MJD",strValue );
+  dataset->setAttribute( "OBSERVATION_END_MJD",strValue );
   time ( &obsStopTime );
   ptm = gmtime ( &obsStopTime );
   strftime (timestr,80,"%Y-%m-%dT%X", ptm);
-  dataset.setAttribute( "OBSERVATION_END_UTC", string(timestr) );
-  dataset.setAttribute( "OBSERVATION_END_TAI", string("") );
-  dataset.setAttribute( "OBSERVER", ps->observerName() );
-  dataset.setAttribute( "PIPELINE_NAME", string("") );
-  dataset.setAttribute( "PIPELINE_VERSION", string("") );
-  dataset.setAttribute( "PROJECT_ID", string("") );
-  dataset.setAttribute( "PROJECT_TITLE", ps->projectName() );
-  dataset.setAttribute( "PROJECT_PI", string("") );
-  dataset.setAttribute( "PROJECT_CO_I", string("") );
-  dataset.setAttribute( "PROJECT_CONTACT", ps->contactName() );
-  dataset.setAttribute( "PROJECT_DESCRIPTION", string("") );
+  dataset->setAttribute( "OBSERVATION_END_UTC", string(timestr) );
+  dataset->setAttribute( "OBSERVATION_END_TAI", string("") );
+  dataset->setAttribute( "OBSERVER", ps->observerName() );
+  dataset->setAttribute( "PIPELINE_NAME", string("") );
+  dataset->setAttribute( "PIPELINE_VERSION", string("") );
+  dataset->setAttribute( "PROJECT_ID", string("") );
+  dataset->setAttribute( "PROJECT_TITLE", ps->projectName() );
+  dataset->setAttribute( "PROJECT_PI", string("") );
+  dataset->setAttribute( "PROJECT_CO_I", string("") );
+  dataset->setAttribute( "PROJECT_CONTACT", ps->contactName() );
+  dataset->setAttribute( "PROJECT_DESCRIPTION", string("") );
   // station list
   if (nrOfStations > 0) {
     std::string stations;
@@ -213,31 +250,75 @@ void HDF5Writer::createHDF5File (const LOFAR::RTCP::Parset *ps)
       stations += ps->stationName(station_idx) + ",";
     }
     stations += ps->stationName(station_idx);
-    dataset.setAttribute( "STATIONS_LIST", stations );
+    dataset->setAttribute( "STATIONS_LIST", stations );
   }
   else {
-    dataset.setAttribute( "STATIONS_LIST",  string("no stations defined") );
+    dataset->setAttribute( "STATIONS_LIST",  string("no stations defined") );
   }
-  dataset.setAttribute( "SYSTEM_VERSION",  string("") );
-  dataset.setAttribute( "TARGET", string("") );
-  dataset.setAttribute( "TELESCOPE", string("LOFAR") );
+  dataset->setAttribute( "SYSTEM_VERSION",  string("") );
+  dataset->setAttribute( "TARGET", string("") );
+  dataset->setAttribute( "TELESCOPE", string("LOFAR") );
   /*
-    dataset.setAttribute( "NUMBER_OF_STATIONS", &n_stations );
-    dataset.setAttribute( "STATION_LIST", string(header.station) );
-    //		dataset.setAttribute_string( "SOURCE", srcvec ); // replaced by TARGET
-    dataset.setAttribute( "MAIN_BEAM_DIAM", &main_beam_diam );
-    dataset.setAttribute( "BANDWIDTH", &bandwidth );
-    dataset.setAttribute( "BREAKS_IN_DATA", &breaks_in_data );
-    dataset.setAttribute( "DISPERSION_MEASURE", &dispersion_measure );
-    // 	dataset.setAttribute( "SECONDS_OF_DATA", &nrOfBlocks );
-    dataset.setAttribute( "SAMPLE_RATE", &header.sampleRate );
-    dataset.setAttribute( "NOF_SAMPLES_PER_SUBBAND", &header.nrSamplesPerSubband );
-    dataset.setAttribute( "TOTAL_NUMBER_OF_SAMPLES", &total_number_of_samples );
-    dataset.setAttribute( "NUMBER_OF_BEAMS", &number_of_beams );
-    dataset.setAttribute( "SUB_BEAM_DIAMETER", &sub_beam_diameter );
-    dataset.setAttribute( "WEATHER_TEMPERATURE", &weather_temperature );
-    dataset.setAttribute( "WEATHER_HUMIDITY", &weather_humidity );
+    dataset->setAttribute( "NUMBER_OF_STATIONS", &n_stations );
+    dataset->setAttribute( "STATION_LIST", string(header.station) );
+    //		dataset->setAttribute_string( "SOURCE", srcvec ); // replaced by TARGET
+    dataset->setAttribute( "MAIN_BEAM_DIAM", &main_beam_diam );
+    dataset->setAttribute( "BANDWIDTH", &bandwidth );
+    dataset->setAttribute( "BREAKS_IN_DATA", &breaks_in_data );
+    dataset->setAttribute( "DISPERSION_MEASURE", &dispersion_measure );
+    // 	dataset->setAttribute( "SECONDS_OF_DATA", &nrOfBlocks );
+    dataset->setAttribute( "SAMPLE_RATE", &header.sampleRate );
+    dataset->setAttribute( "NOF_SAMPLES_PER_SUBBAND", &header.nrSamplesPerSubband );
+    dataset->setAttribute( "TOTAL_NUMBER_OF_SAMPLES", &total_number_of_samples );
+    dataset->setAttribute( "NUMBER_OF_BEAMS", &number_of_beams );
+    dataset->setAttribute( "SUB_BEAM_DIAMETER", &sub_beam_diameter );
+    dataset->setAttribute( "WEATHER_TEMPERATURE", &weather_temperature );
+    dataset->setAttribute( "WEATHER_HUMIDITY", &weather_humidity );
   */
+  createBeamGroup();
+}
+
+#endif
+
+//_______________________________________________________________________________
+//                                                                 createHDF5File
+
+/*!
+  Create the output dataset without a parameter set; the root attributes are
+  derived from the main header of the raw data stream.
+*/
+void HDF5Writer::createHDF5File (void)
+{
+  const BFRawFormat::BFRaw_Header & header = itsParent->getMainHeader();
+  uint downsample_factor = itsParent->getDownSampleFactor();
+  char timestr [80];
+  time_t rawtime;
+
+  dataset = new dalDataset (itsOutputFile, "HDF5", IO_Mode(IO_Mode::Create));
+
+  time ( &rawtime );
+  strftime (timestr,80,"%Y-%m-%dT%X",localtime ( &rawtime ));
+
+  dataset->setAttribute( "CREATION_MODE", creation_mode );
+  dataset->setAttribute( "DOWNSAMPLE_RATE", downsample_factor );
+  dataset->setAttribute( "FILENAME", itsOutputFile );
+  dataset->setAttribute( "FILETYPE", string("bfstation") );
+  dataset->setAttribute( "FILEDATE",  string(timestr) );
+  dataset->setAttribute( "GROUPTYPE", string("Root") );
+  dataset->setAttribute( "INPUT_FILESIZE", file_byte_size );
+  dataset->setAttribute( "STATIONS_LIST", string(header.station) );
+  dataset->setAttribute( "TELESCOPE", string("LOFAR") );
+
+  createBeamGroup();
+}
+
+//_______________________________________________________________________________
+//                                                                createBeamGroup
+
+void HDF5Writer::createBeamGroup (void)
+{
+  const BFRawFormat::BFRaw_Header & header = itsParent->getMainHeader();
+
   dalGroup * beamGroup;
   
   char * beamstr = new char[10];
@@ -246,7 +327,7 @@ void HDF5Writer::createHDF5File (const LOFAR::RTCP::Parset *ps)
   
   beam_number = 0;
   sprintf( beamstr, "beam%03d", beam_number );
-  beamGroup = dataset.createGroup( beamstr );
+  beamGroup = dataset->createGroup( beamstr );
   
   float ra_val  = header.beamDirections[beam_number+1][0];
   float dec_val = header.beamDirections[beam_number+1][1];
@@ -258,14 +339,13 @@ void HDF5Writer::createHDF5File (const LOFAR::RTCP::Parset *ps)
   
   // write the center frequencies of the subbands
   int * center_frequency = new int[header.nrSubbands];
-  char * cfName = new char[22];
+  char cfName[32];
   for (unsigned int idx=0; idx < header.nrSubbands; idx++)
     {
       center_frequency[idx] = (int)header.subbandFrequencies[ idx ];
-      sprintf( cfName, "CENTER_FREQUENCY_SB%03d", idx );
+      snprintf( cfName, sizeof(cfName), "CENTER_FREQUENCY_SB%03d", idx );
       beamGroup->setAttribute( cfName, &center_frequency[idx] );
     }
-  delete [] cfName;
   delete beamGroup;
   
 #ifdef DAL_DEBUGGING_MESSAGES
@@ -280,7 +360,7 @@ void HDF5Writer::createHDF5File (const LOFAR::RTCP::Parset *ps)
   for (unsigned int idx=0; idx<header.nrSubbands; idx++)
     {
       sprintf( sbName, "SB%03d", idx );
-      table[idx] = dataset.createTable( sbName, beamstr );
+      table[idx] = dataset->createTable( sbName, beamstr );
     }
   
   for (unsigned int idx=0; idx<header.nrSubbands; idx++)
@@ -304,8 +384,6 @@ void HDF5Writer::createHDF5File (const LOFAR::RTCP::Parset *ps)
   beamstr = 0;
 }
 
-#endif
-
 //_______________________________________________________________________________
 //                                                                          start
 
@@ -316,8 +394,8 @@ bool HDF5Writer::start(void)
   cout << "setting attribute EPOCH_UTC to " << itsParent->getEpochUTC() << endl;
   cout << "setting attribute EPOCH_DATE to " << itsParent->getEpochDate() << endl;	
 #endif
-  dataset.setAttribute( "EPOCH_UTC", itsParent->getEpochUTC() );
-  dataset.setAttribute( "EPOCH_DATE", itsParent->getEpochDate() );
+  dataset->setAttribute( "EPOCH_UTC", itsParent->getEpochUTC() );
+  dataset->setAttribute( "EPOCH_DATE", itsParent->getEpochDate() );
   
   if (pthread_create(&itsWriteThread, NULL, StartInternalThread, (void *) this) == 0) {
     return true;
@@ -376,9 +454,11 @@ bool HDF5Writer::dataLeft (void)
 
   for (writeMap::const_iterator it = itsData.begin(); it != itsData.end(); ++it) {
     if (!(it->second.empty())) {
+#ifdef DAL_DEBUGGING_MESSAGES
       cout << "data left, subband: ";
       cout << static_cast<int>(it->second.front().first);
       cout << ", block: " << currentBlockNr << endl;
+#endif
       pthread_mutex_unlock(&writeMapMutex);
       return true;
     }
@@ -429,7 +509,9 @@ void HDF5Writer::checkIfBlockComplete (void)
 
 void HDF5Writer::startNextBlock (void)
 {
+#ifdef DAL_DEBUGGING_MESSAGES
   cout << "block " << currentBlockNr << " is done." << endl;
+#endif
   for (uint8_t i=0; i < nrOfSubbands; ++i) {
     subbandReady[i] = false;
   }
@@ -451,7 +533,13 @@ void HDF5Writer::writeData (void)
 {
   while (!stopWriting) {
     if (getDataForCurrentBlock()) {
+      struct timeval start;
+      struct timeval end;
+      gettimeofday (&start, NULL);
       table[dataPair.first]->appendRows( dataPair.second, outputBlockSize );
+      gettimeofday (&end, NULL);
+      itsWriteTime    += (end.tv_sec-start.tv_sec) + 1e-6*(end.tv_usec-start.tv_usec);
+      itsBytesWritten += outputBlockSize*sizeof(float);
       subbandReady[dataPair.first] = true;
       /*#ifdef DAL_DEBUGGING_MESSAGES
 	cout << "HDF5Writer:Wrote subband " << static_cast<int>(dataPair.first) << " for data block " << currentBlockNr << endl;
@@ -76,6 +76,12 @@ public:
 	      size_t output_block_size,
 	      uint8_t nr_subbands);
 #endif
+
+  //! Argumented constructor, using the information from the main header only
+  HDF5Writer (BF2H5 *parent,
+	      const std::string &output_file,
+	      size_t output_block_size,
+	      uint8_t nr_subbands);
   
   // === Destruction ============================================================
 
@@ -87,6 +93,8 @@ public:
   //! Create HDF5 output dataset
   void createHDF5File (const LOFAR::RTCP::Parset *ps);
 #endif
+  //! Create HDF5 output dataset, using the information from the main header
+  void createHDF5File (void);
 
   //! Start the separate writing thread
   bool start(void);
@@ -98,9 +106,23 @@ public:
   //! Stop the writing thread
   bool stop(void);
   void showStatus(void);
+  //! Get the time spent appending rows to the output tables, [s]
+  inline double writeTime (void) const {
+    return itsWriteTime;
+  }
+  //! Get the number of bytes appended to the output tables
+  inline uint64_t bytesWritten (void) const {
+    return itsBytesWritten;
+  }
   
  private:
 
+  //! Initialize the object's internal parameters
+  void init (size_t output_block_size,
+	     uint8_t nr_subbands);
+  //! Create the beam group and the subband tables inside the output dataset
+  void createBeamGroup (void);
+
   //! Get the data for the currently processed block
   bool getDataForCurrentBlock(void);
   //! Check if the currently processed block is complete
@@ -120,7 +142,7 @@ public:
   BF2H5 * itsParent;
   std::fstream * rawfile;
   DAL::dalTable ** table;
-  DAL::dalDataset dataset;
+  DAL::dalDataset * dataset;
   bool stopWriting;
   std::string itsOutputFile;
   uint8_t waitForDataTimeOut;
@@ -137,6 +159,10 @@ public:
   uint8_t nrOfSubbands;
   int64_t file_byte_size;
   pthread_t itsWriteThread;
+  //! Time spent appending rows to the output tables, [s]
+  double itsWriteTime;
+  //! Number of bytes appended to the output tables
+  uint64_t itsBytesWritten;
 };
 
 
@@ -21,6 +21,7 @@
 #include <iostream> // for cout,cerr etc.
 #include <fstream> // for file mode
 #include <signal.h> // for time-out on socket
+#include <sys/time.h> // for gettimeofday
 
 #include "bf2h5.h"
 #include "StationBeamReader.h"
@@ -45,12 +46,15 @@ namespace DAL { // Namespace DAL -- begin
   
   StationBeamReader::StationBeamReader (BF2H5 *parent,
 					bool socket_mode)
-    : socklen(sizeof(incoming_addr)),
+    : finished_reading(false),
+      socklen(sizeof(incoming_addr)),
       rawfile(0),
       itsParent(parent),
       socketmode(socket_mode), 
       memAllocOK(true),
-      blockHeaderSize(sizeof(BFRawFormat::BlockHeader))
+      blockHeaderSize(sizeof(BFRawFormat::BlockHeader)),
+      itsReadTime(0),
+      itsBytesRead(0)
   {
     bigendian = BigEndian();
   }
@@ -204,7 +208,8 @@ namespace DAL { // Namespace DAL -- begin
   bool StationBeamReader::readMainHeader (BFRawFormat::BFRaw_Header &header)
   {
     if (socketmode) {
-      if (recvfrom(server_socket, reinterpret_cast<char *>(&header), sizeof(header),0,  (sockaddr *) &incoming_addr, &socklen) < static_cast<int>(sizeof(header))) {
+      /* A TCP stream may deliver the header in several pieces */
+      if (receiveBytes(reinterpret_cast<char *>(&header), sizeof(header)) <= 0) {
 #ifdef DAL_DEBUGGING_MESSAGES
 	cerr << "ERROR reading main header from socket" << endl;
 #endif
@@ -254,7 +259,7 @@ namespace DAL { // Namespace DAL -- begin
 
     if (read_bytes > 0) {
       if (!bigendian) { convertEndian(&first_block_header); }
-      if ((read_bytes = receiveBytes(reinterpret_cast<char *>(sample_data), dataBlockSize)) != -1) {
+      if ((read_bytes = receiveBytes(reinterpret_cast<char *>(sample_data), dataBlockSize)) > 0) {
 	return true;
       }
       else if (read_bytes == 0) {
@@ -293,7 +298,9 @@ namespace DAL { // Namespace DAL -- begin
     if (read_bytes > 0) { // throw away block header
       //	if (!bigendian) { convertEndian(&blockheader); }
       if ((read_bytes = receiveBytes(reinterpret_cast<char *>(sample_data), dataBlockSize)) > 0) {
+#ifdef DAL_DEBUGGING_MESSAGES
 	cout << "sampledata[0].xx=" << sample_data->xx << ", yy=" << sample_data->yy << endl;
+#endif
 	return true;
       }
       else if (read_bytes == 0) {
@@ -326,6 +333,23 @@ namespace DAL { // Namespace DAL -- begin
   {
     int64_t bytes_read  = 0;
     int8_t *bytepointer = reinterpret_cast<int8_t *>(storage);
+    struct timeval start;
+    struct timeval end;
+
+    gettimeofday (&start, NULL);
+
+    if (!socketmode) {
+      /* File mode: a short read means we hit the end of the file */
+      rawfile->read (reinterpret_cast<char *>(bytepointer), nrOfBytesToRead);
+      bytes_read = rawfile->gcount();
+      gettimeofday (&end, NULL);
+      itsReadTime  += (end.tv_sec-start.tv_sec) + 1e-6*(end.tv_usec-start.tv_usec);
+      itsBytesRead += bytes_read;
+      if (bytes_read < nrOfBytesToRead) {
+	return 0;
+      }
+      return bytes_read;
+    }
 
     while (true) {
       bytes_read = recvfrom(server_socket, bytepointer, nrOfBytesToRead, 0, (sockaddr *) &incoming_addr, &socklen);
@@ -338,8 +362,11 @@ namespace DAL { // Namespace DAL -- begin
 	return 0;
       }
       nrOfBytesToRead -= bytes_read;
-      bytepointer += bytes_read;
+      bytepointer     += bytes_read;
+      itsBytesRead    += bytes_read;
       if (nrOfBytesToRead == 0) { // did we read enough?
+	gettimeofday (&end, NULL);
+	itsReadTime += (end.tv_sec-start.tv_sec) + 1e-6*(end.tv_usec-start.tv_usec);
 	return bytes_read;
       }
     }
@@ -93,6 +93,16 @@ namespace DAL { // Namespace DAL -- begin
     
     //! Print debug info of the main header
     void printHeaderParameters(BFRawFormat::BFRaw_Header &header);
+
+    //! Get the time spent receiving data from file or socket, [s]
+    inline double readTime (void) const {
+      return itsReadTime;
+    };
+
+    //! Get the number of bytes received from file or socket
+    inline uint64_t bytesRead (void) const {
+      return itsBytesRead;
+    };
     
   private:
     
@@ -129,6 +139,10 @@ namespace DAL { // Namespace DAL -- begin
     std::string dec_str;
     size_t dataBlockSize; // the size of a data block (excluded its header)
     size_t blockHeaderSize;
+    //! Time spent in receiveBytes, [s]
+    double itsReadTime;
+    //! Number of bytes received
+    uint64_t itsBytesRead;
   };
   
 } // END : namespace DAL
@@ -50,8 +50,11 @@ BF2H5::BF2H5 (const std::string &outfile,
     itsReader(0),
     oneBlockdataSize(0),
     itsReadBuffer(0),
-    itsCurrentNrOfReadBuffers(INITIAL_NR_OF_READ_BUFFERS)
+    itsCurrentNrOfReadBuffers(INITIAL_NR_OF_READ_BUFFERS),
+    itsNrOfBlocks(0)
 {
+  pthread_mutex_init(&itsBufferTrackerMutex, NULL);
+
   itsParseFile        = parset_filename;
   itsDownsampleFactor = downsample_factor;
   itsDoIntensity      = do_intensity;
@@ -88,14 +91,40 @@ BF2H5::~BF2H5()
 #ifdef DAL_WITH_LOFAR
   delete itsParset;
 #endif
+
+  pthread_mutex_destroy(&itsBufferTrackerMutex);
 }
 
 // ==============================================================================
 //
-//  Destruction
+//  Methods
 //
 // ==============================================================================
 
+//_______________________________________________________________________________
+//                                                                       readTime
+
+double BF2H5::readTime (void) const
+{
+  return itsReader ? itsReader->readTime() : 0;
+}
+
+//_______________________________________________________________________________
+//                                                                calculationTime
+
+double BF2H5::calculationTime (void) const
+{
+  return itsCalculator ? itsCalculator->calculationTime() : 0;
+}
+
+//_______________________________________________________________________________
+//                                                                      writeTime
+
+double BF2H5::writeTime (void) const
+{
+  return itsWriter ? itsWriter->writeTime() : 0;
+}
+
 //_______________________________________________________________________________
 //                                                                  setSocketMode
 
@@ -167,12 +196,15 @@ bool BF2H5::allocateSampleBuffers(void)
 
 void BF2H5::blockComplete (long int blockNr)
 {
+  pthread_mutex_lock(&itsBufferTrackerMutex);
   for (bufferTracker::iterator it = itsBufferTracker.begin(); it != itsBufferTracker.end(); ++it) {
     if (it->second == blockNr) {
       it->second = -1;
+      pthread_mutex_unlock(&itsBufferTrackerMutex);
       return;
     }
   }
+  pthread_mutex_unlock(&itsBufferTrackerMutex);
   std::cerr << "[BF2H5::blockComplete] ERROR, trying to free a read buffer for block "
 	    << blockNr
 	    << " that doesn't have a read buffer!"
@@ -184,10 +216,12 @@ void BF2H5::blockComplete (long int blockNr)
 
 bool BF2H5::switchReadBuffer (long int block_nr)
 {
+  pthread_mutex_lock(&itsBufferTrackerMutex);
   for (bufferTracker::iterator it = itsBufferTracker.begin(); it != itsBufferTracker.end(); ++it) {
     if (it->second == -1) { // not in use
       it->second    = block_nr;
       itsReadBuffer = it->first;
+      pthread_mutex_unlock(&itsBufferTrackerMutex);
       return true;
     }
   }
@@ -202,10 +236,12 @@ bool BF2H5::switchReadBuffer (long int block_nr)
   }
   catch (bad_alloc) {
     cerr << "BF2H5::switchReadBuffer, ERROR cannot allocate memory for new input read buffer." << endl;
+    pthread_mutex_unlock(&itsBufferTrackerMutex);
     return false;
   }
   itsBufferTracker.insert(std::pair<uint8_t, long int>(itsCurrentNrOfReadBuffers, block_nr));
   itsReadBuffer = itsCurrentNrOfReadBuffers++; // switch to new buffer
+  pthread_mutex_unlock(&itsBufferTrackerMutex);
 //	itsCalculator->showStatus();
 //	itsWriter->showStatus();
   return true;
@@ -214,7 +250,12 @@ bool BF2H5::switchReadBuffer (long int block_nr)
 //_______________________________________________________________________________
 //                                                                          start
 
-void BF2H5::start (bool const &verbose)
+/*!
+  \param verbose -- Be verbose during processing?
+  \return status -- Status of the operation; returns \e false in case an error
+          was encountered.
+*/
+bool BF2H5::start (bool const &verbose)
 {
   bool result          = true;
   unsigned int blockNr = 0;
@@ -229,6 +270,7 @@ void BF2H5::start (bool const &verbose)
   }
 
   if (result) {
+    result = false;
     if (itsReader->readMainHeader(getMainHeaderForWrite())) {
       
       if (verbose) {
@@ -246,7 +288,7 @@ void BF2H5::start (bool const &verbose)
       }  // END : if (verbose)
       
       oneBlockdataSize = BFMainHeader.nrSamplesPerSubband * BFMainHeader.nrSubbands;
-      // size_t downSampledDataSize = BFMainHeader.nrSamplesPerSubband / itsDownsampleFactor;
+      size_t downSampledDataSize = BFMainHeader.nrSamplesPerSubband / itsDownsampleFactor;
 
       if (allocateSampleBuffers()) {
 
@@ -262,7 +304,10 @@ void BF2H5::start (bool const &verbose)
 				    downSampledDataSize,
 				    BFMainHeader.nrSubbands);
 #else
-	itsWriter = NULL;
+        itsWriter = new HDF5Writer (this,
+				    outputFile,
+				    downSampledDataSize,
+				    BFMainHeader.nrSubbands);
 #endif
 
         if (itsReader->readFirstDataBlock(firstBlockHeader, itsSampleBuffers[itsReadBuffer], oneBlockdataSize * sizeof(BFRawFormat::Sample))) {
@@ -274,25 +319,18 @@ void BF2H5::start (bool const &verbose)
             itsCalculator->calculateDataBlock(blockNr++, itsSampleBuffers[itsReadBuffer]); // calculator will call calculationFinished when done
             switchReadBuffer(blockNr);
             while (!(itsReader->finishedReading())) {
-              itsReader->readDataBlock(itsSampleBuffers[itsReadBuffer]); // blocking read
+              if (!itsReader->readDataBlock(itsSampleBuffers[itsReadBuffer])) { // blocking read
+		break;
+	      }
               itsCalculator->calculateDataBlock(blockNr++, itsSampleBuffers[itsReadBuffer]); // non-blocking calculator will call calculationFinished
               switchReadBuffer(blockNr);
             }
-            cout << "[BF2H5::start] Reader finished, connection closed" << endl;
-            while ((itsCalculator->stillProcessing()) || (itsWriter->dataLeft())) {
-              cout << "[BF2H5::start] Still processing last received data..." << endl;
-              /*
-		#ifdef DAL_DEBUGGING_MESSAGES
-		if (itsCalculator->stillProcessing()) {
-		cout << "calculator says it's still processing..." << endl;
-		cout << itsCalculator->whatAreYouDoing() << endl;
-		}
-		if (itsWriter->dataLeft()) {
-		cout << "writer says it has still data left to write..." << endl;
-            }
-#endif
-              */
-              sleep(1); // calculator or hdf5 writer still busy
+	    itsNrOfBlocks = blockNr;
+	    if (verbose) {
+	      cout << "[BF2H5::start] Reader finished, connection closed" << endl;
+	    }
+            while (itsCalculator->stillProcessing()) {
+              usleep(1000); // calculator still has blocks queued
             }
 
             if (!itsCalculator->stop()) {
@@ -300,12 +338,21 @@ void BF2H5::start (bool const &verbose)
 		   << endl;
             }
 
+	    /* The last subbands are handed to the writer while the calculator
+	       threads are being joined, so only now check on the writer. */
+            while (itsWriter->dataLeft()) {
+              usleep(1000); // hdf5 writer still busy
+            }
+
             if (!itsWriter->stop()) {
               cerr << "[BF2H5::start] Writer thread didn't stop correctly!" << endl;
             }
-	    
-            cout << "HDF5 file " << inputFile << " has been written." << endl
-		 << "all done!" << endl;
+
+	    if (verbose) {
+	      cout << "HDF5 file " << outputFile << " has been written." << endl
+		   << "all done!" << endl;
+	    }
+	    result = true;
           } // END : if (itsWriter->start())
           else {
             cerr << "[BF2H5::start] Could not start writer thread!" << endl;
@@ -318,4 +365,5 @@ void BF2H5::start (bool const &verbose)
     }
   }  // END : if (result)
 
+  return result;
 }
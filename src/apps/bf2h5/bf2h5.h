@@ -24,6 +24,7 @@
 // Standard header files
 #include <string>
 #include <map>
+#include <pthread.h>
 
 #include <dal_config.h>
 
@@ -38,8 +39,6 @@
 #include "StationBeamReader.h"
 #include <data_hl/BFRawFormat.h>
 
-#define DAL_DEBUGGING_MESSAGES
-
 #define INITIAL_NR_OF_READ_BUFFERS 2
 
 typedef std::vector<BFRawFormat::Sample *> sampleBuffers;
@@ -105,7 +104,7 @@ class BF2H5 {
   //! Set input mode to read from file
   void setFileMode(std::string &infile);
   //! Start the bf2h5 main process
-  void start (bool const &verbose=false);
+  bool start (bool const &verbose=false);
   //! Get sample data header
   inline const BFRawFormat::Sample &getSampleData (void) const {
     return *itsSampleBuffers[itsReadBuffer];
@@ -126,6 +125,19 @@ class BF2H5 {
   inline uint16_t getNrSubbands(void) const {
     return BFMainHeader.nrSubbands;
   }
+  //! Get the number of data blocks passed on to the calculator
+  inline unsigned int getNrBlocks (void) const {
+    return itsNrOfBlocks;
+  }
+
+  // === Stage timing ===========================================================
+
+  //! Get the time spent by the reader receiving data, [s]
+  double readTime (void) const;
+  //! Get the time spent by the calculator, summed over its threads, [s]
+  double calculationTime (void) const;
+  //! Get the time spent by the writer appending data to the output file, [s]
+  double writeTime (void) const;
   
   // === Signaling functions for threads ========================================
 
@@ -183,6 +195,8 @@ class BF2H5 {
   //sample buffers things
   uint8_t itsReadBuffer, itsCurrentNrOfReadBuffers; // the current read buffer
   bufferTracker itsBufferTracker; // keeps track of which buffer is used for which data block
+  pthread_mutex_t itsBufferTrackerMutex; // reader and calculator threads both modify itsBufferTracker
+  unsigned int itsNrOfBlocks;
   sampleBuffers itsSampleBuffers; // pointers to input data samplebuffers
   
   std::string EpochUTC;
@@ -0,0 +1,268 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+/*!
+  \file bf2h5bench.cpp
+
+  \ingroup DAL
+  \ingroup dal_apps
+
+  \brief End-to-end benchmark of the bf2h5 processing chain
+
+  \author agent
+
+  \date 2026/10/18
+
+  <h3>Synopsis</h3>
+
+  Feeds a synthetic stream of beam-formed raw data, created by
+  DAL::BFRawGenerator, through the complete processing chain of \e bf2h5:
+
+  \verbatim
+  StationBeamReader -> Bf2h5Calculator -> HDF5Writer
+  \endverbatim
+
+  In file mode the stream first is written to disk, such that the generator
+  is not part of the timed section; in socket mode the generator runs in a
+  separate thread, sending the stream across the loopback interface while
+  \e bf2h5 is receiving it. At the end the throughput (samples/s and MB/s)
+  of the complete chain is reported, together with the time spent within
+  each of the stages. Since the calculator runs several threads in parallel,
+  its time is summed over all threads.
+
+  <h3>Usage</h3>
+
+  \verbatim
+  bf2h5bench --subbands 62 --samples 16384 --blocks 50 --downsample 16
+  bf2h5bench --port 4346 --blocks 50
+  \endverbatim
+*/
+
+#include <cstdio>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <pthread.h>
+#include <sys/time.h>
+#include <boost/program_options.hpp>
+
+#include "bf2h5.h"
+#include "BFRawGenerator.h"
+
+namespace bpo = boost::program_options;
+
+using std::cerr;
+using std::cout;
+using std::endl;
+
+//! Parameters handed to the generator thread in socket mode
+struct GeneratorSetup {
+  DAL::BFRawGenerator *generator;
+  unsigned int port;
+  unsigned int nofBlocks;
+  bool status;
+};
+
+//_______________________________________________________________________________
+//                                                                 runGenerator
+
+/*!
+  \brief Thread function sending the generated stream to a local socket
+
+  \param setup -- Pointer to a GeneratorSetup object.
+*/
+void * runGenerator (void *setup)
+{
+  GeneratorSetup *param = reinterpret_cast<GeneratorSetup *>(setup);
+
+  param->status = false;
+
+  if (param->generator->setSocketMode (param->port)) {
+    param->status = param->generator->generate (param->nofBlocks);
+  }
+
+  return NULL;
+}
+
+//_______________________________________________________________________________
+//                                                                      seconds
+
+//! Get the time difference between two time stamps, [s]
+double seconds (struct timeval const &start,
+		struct timeval const &end)
+{
+  return (end.tv_sec-start.tv_sec) + 1e-6*(end.tv_usec-start.tv_usec);
+}
+
+//_______________________________________________________________________________
+//                                                                           main
+
+int main (int argc, char *argv[])
+{
+  std::string infile    = "bf2h5bench.dat";
+  std::string outfile   = "bf2h5bench.h5";
+  std::string signal    = "noise";
+  unsigned int port     = 0;
+  unsigned int subbands = BFRawFormat::maxNrSubbands;
+  unsigned int samples  = 16384;
+  unsigned int blocks   = 20;
+  unsigned int dsFactor = 16;
+  bool keepFiles        = false;
+  DAL::BFRawGenerator::SignalType signalType;
+
+  // Processing of command line options ____________________
+
+  bpo::options_description desc ("[bf2h5bench] Available command line options");
+
+  desc.add_options ()
+    ("help,H", "Show help messages")
+    ("port,P", bpo::value<unsigned int>(), "Stream through a loopback TCP socket on this port, instead of a file")
+    ("infile,I", bpo::value<std::string>(), "Name of the intermediate raw data file [bf2h5bench.dat]")
+    ("outfile,O", bpo::value<std::string>(), "Name of the output HDF5 file [bf2h5bench.h5]")
+    ("subbands,S", bpo::value<unsigned int>(), "Number of subbands [62]")
+    ("samples,N", bpo::value<unsigned int>(), "Number of samples per subband and block [16384]")
+    ("blocks,B", bpo::value<unsigned int>(), "Number of data blocks [20]")
+    ("downsample,D", bpo::value<unsigned int>(), "Downsampling factor [16]")
+    ("signal", bpo::value<std::string>(), "Signal content: zero, constant, ramp, noise, tone [noise]")
+    ("keep", "Keep the raw data and HDF5 files after the run")
+    ;
+
+  bpo::variables_map vm;
+  bpo::store (bpo::parse_command_line(argc,argv,desc), vm);
+
+  if (vm.count("help")) {
+    cout << "\n" << desc << endl;
+    return 0;
+  }
+
+  if (vm.count("port"))       { port      = vm["port"].as<unsigned int>();       }
+  if (vm.count("infile"))     { infile    = vm["infile"].as<std::string>();      }
+  if (vm.count("outfile"))    { outfile   = vm["outfile"].as<std::string>();     }
+  if (vm.count("subbands"))   { subbands  = vm["subbands"].as<unsigned int>();   }
+  if (vm.count("samples"))    { samples   = vm["samples"].as<unsigned int>();    }
+  if (vm.count("blocks"))     { blocks    = vm["blocks"].as<unsigned int>();     }
+  if (vm.count("downsample")) { dsFactor  = vm["downsample"].as<unsigned int>(); }
+  if (vm.count("signal"))     { signal    = vm["signal"].as<std::string>();      }
+  if (vm.count("keep"))       { keepFiles = true;                                }
+
+  if (dsFactor < 1) {
+    dsFactor = 1;
+  }
+
+  if (!DAL::BFRawGenerator::signalType (signalType, signal)) {
+    cerr << "[bf2h5bench] Unknown signal type " << signal << endl;
+    return 1;
+  }
+
+  DAL::BFRawGenerator gen (subbands, samples, signalType);
+  GeneratorSetup setup;
+  pthread_t generatorThread;
+  struct timeval start;
+  struct timeval end;
+  bool status = true;
+
+  cout << "[bf2h5bench] Summary of benchmark parameters." << endl;
+  cout << "-- Input mode ............. : " << (port ? "socket" : "file") << endl;
+  cout << "-- nof. subbands .......... : " << gen.nofSubbands()          << endl;
+  cout << "-- Samples per subband .... : " << gen.nofSamplesPerSubband() << endl;
+  cout << "-- nof. blocks ............ : " << blocks                     << endl;
+  cout << "-- Block size [Bytes] ..... : " << gen.blockSize()            << endl;
+  cout << "-- Signal ................. : " << signal                     << endl;
+  cout << "-- Downsampling factor .... : " << dsFactor                   << endl;
+
+  // Prepare the input _____________________________________
+
+  if (port == 0) {
+    if (!gen.setFileMode (infile) || !gen.generate (blocks)) {
+      cerr << "[bf2h5bench] Failed to generate input file " << infile << endl;
+      return 1;
+    }
+  }
+
+  remove (outfile.c_str());
+
+  // Run the processing chain ______________________________
+
+  BF2H5 bf2h5 (outfile, "", dsFactor, true);
+
+  if (port > 0) {
+    setup.generator = &gen;
+    setup.port      = port;
+    setup.nofBlocks = blocks;
+    setup.status    = false;
+    bf2h5.setSocketMode (port);
+  } else {
+    bf2h5.setFileMode (infile);
+  }
+
+  gettimeofday (&start, NULL);
+
+  if (port > 0) {
+    if (pthread_create (&generatorThread, NULL, runGenerator, (void *) &setup) != 0) {
+      cerr << "[bf2h5bench] Failed to start generator thread!" << endl;
+      return 1;
+    }
+  }
+
+  status = bf2h5.start ();
+
+  if (port > 0) {
+    pthread_join (generatorThread, NULL);
+    status = status && setup.status;
+  }
+
+  gettimeofday (&end, NULL);
+
+  /* Every generated block must have made it through the chain */
+  if (bf2h5.getNrBlocks() != blocks) {
+    cerr << "[bf2h5bench] Processed " << bf2h5.getNrBlocks() << " of "
+	 << blocks << " blocks!" << endl;
+    status = false;
+  }
+
+  // Report results ________________________________________
+
+  double elapsed     = seconds (start, end);
+  double nofSamples  = double(bf2h5.getNrBlocks())*gen.nofSamplesPerBlock();
+  double nofMegaByte = double(bf2h5.getNrBlocks())*gen.blockSize()/(1024.0*1024.0);
+
+  cout << "[bf2h5bench] Results." << endl;
+  cout << "-- Status ................. : " << (status ? "ok" : "FAILED") << endl;
+  cout << "-- Blocks processed ....... : " << bf2h5.getNrBlocks()         << endl;
+  cout << "-- Elapsed time [s] ....... : " << elapsed                     << endl;
+  if (elapsed > 0) {
+    cout << "-- Throughput [samples/s] . : " << nofSamples/elapsed  << endl;
+    cout << "-- Throughput [MB/s] ...... : " << nofMegaByte/elapsed << endl;
+  }
+  cout << "-- Stage times [s]" << endl;
+  cout << "   StationBeamReader ...... : " << bf2h5.readTime()        << endl;
+  cout << "   Bf2h5Calculator ........ : " << bf2h5.calculationTime() << "  (summed over "
+       << NUM_CALCULATION_THREADS << " threads)" << endl;
+  cout << "   HDF5Writer ............. : " << bf2h5.writeTime()       << endl;
+
+  if (!keepFiles) {
+    if (port == 0) {
+      remove (infile.c_str());
+    }
+    remove (outfile.c_str());
+  }
+
+  return (status ? 0 : 1);
+}
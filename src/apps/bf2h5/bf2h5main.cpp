@@ -239,7 +239,5 @@ int main (int argc, char *argv[])
     bf2h5.setFileMode(infile);
   }
   
-  bf2h5.start();	
-  
-  return 0;
+  return (bf2h5.start() ? 0 : 1);
 }
@@ -0,0 +1,151 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+/*!
+  \file bfrawgen.cpp
+
+  \ingroup DAL
+  \ingroup dal_apps
+
+  \brief Generate a synthetic stream of beam-formed raw data
+
+  \author agent
+
+  \date 2026/10/18
+
+  <h3>Usage</h3>
+
+  <ol>
+    <li>Write 20 blocks of noise for 8 subbands to a file:
+    \verbatim
+    bfrawgen --outfile bfraw.dat --subbands 8 --blocks 20
+    \endverbatim
+    <li>Send the stream to an instance of \e bf2h5 listening on port 4346:
+    \verbatim
+    bf2h5 --port 4346 --outfile bf.h5 &
+    bfrawgen --port 4346 --blocks 20 --signal tone
+    \endverbatim
+  </ol>
+*/
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <boost/program_options.hpp>
+
+#include "BFRawGenerator.h"
+
+namespace bpo = boost::program_options;
+
+using std::cerr;
+using std::cout;
+using std::endl;
+
+//_______________________________________________________________________________
+//                                                                           main
+
+int main (int argc, char *argv[])
+{
+  std::string outfile;
+  std::string host      = "127.0.0.1";
+  std::string signal    = "noise";
+  unsigned int port     = 0;
+  unsigned int subbands = BFRawFormat::maxNrSubbands;
+  unsigned int samples  = 155648;
+  unsigned int blocks   = 10;
+  int amplitude         = 100;
+  DAL::BFRawGenerator::SignalType signalType;
+
+  // Processing of command line options ____________________
+
+  bpo::options_description desc ("[bfrawgen] Available command line options");
+
+  desc.add_options ()
+    ("help,H", "Show help messages")
+    ("outfile,O", bpo::value<std::string>(), "Name of the output file")
+    ("port,P", bpo::value<unsigned int>(), "Port number to send the stream to")
+    ("host", bpo::value<std::string>(), "Address of the receiving host [127.0.0.1]")
+    ("subbands,S", bpo::value<unsigned int>(), "Number of subbands [62]")
+    ("samples,N", bpo::value<unsigned int>(), "Number of samples per subband and block [155648]")
+    ("blocks,B", bpo::value<unsigned int>(), "Number of data blocks [10]")
+    ("signal", bpo::value<std::string>(), "Signal content: zero, constant, ramp, noise, tone [noise]")
+    ("amplitude", bpo::value<int>(), "Amplitude of the signal, positive [100]")
+    ;
+
+  bpo::variables_map vm;
+  bpo::store (bpo::parse_command_line(argc,argv,desc), vm);
+
+  if (vm.count("help") || argc == 1) {
+    cout << "\n" << desc << endl;
+    return 0;
+  }
+
+  if (vm.count("outfile"))   { outfile   = vm["outfile"].as<std::string>();    }
+  if (vm.count("port"))      { port      = vm["port"].as<unsigned int>();      }
+  if (vm.count("host"))      { host      = vm["host"].as<std::string>();       }
+  if (vm.count("subbands"))  { subbands  = vm["subbands"].as<unsigned int>();  }
+  if (vm.count("samples"))   { samples   = vm["samples"].as<unsigned int>();   }
+  if (vm.count("blocks"))    { blocks    = vm["blocks"].as<unsigned int>();    }
+  if (vm.count("signal"))    { signal    = vm["signal"].as<std::string>();     }
+  if (vm.count("amplitude")) { amplitude = vm["amplitude"].as<int>();          }
+
+  if (outfile.empty() && port == 0) {
+    cerr << "[bfrawgen] Either an output file or a port number is required!" << endl;
+    cerr << desc << endl;
+    return 1;
+  }
+
+  if (!DAL::BFRawGenerator::signalType (signalType, signal)) {
+    cerr << "[bfrawgen] Unknown signal type " << signal << endl;
+    return 1;
+  }
+
+  // Generate the stream ___________________________________
+
+  if (amplitude > 32767) {
+    cerr << "[bfrawgen] Amplitude exceeds the range of the samples!" << endl;
+    return 1;
+  }
+
+  DAL::BFRawGenerator gen (subbands, samples, signalType);
+
+  if (!gen.setAmplitude (std::max (amplitude, 0))) {
+    return 1;
+  }
+
+  if (port > 0) {
+    if (!gen.setSocketMode (port, host)) {
+      return 1;
+    }
+  } else {
+    if (!gen.setFileMode (outfile)) {
+      return 1;
+    }
+  }
+
+  if (!gen.generate (blocks)) {
+    return 1;
+  }
+
+  cout << "[bfrawgen] Written " << gen.bytesWritten() << " bytes ("
+       << blocks << " blocks of " << gen.blockSize() << " bytes)" << endl;
+
+  return 0;
+}
@@ -0,0 +1,411 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+/*!
+  \file h5filterbench.cpp
+
+  \ingroup DAL
+  \ingroup dal_apps
+
+  \brief Benchmark of compression ratio versus throughput of HDF5 filter pipelines
+
+  \author agent
+
+  \date 2026/10/18
+
+  <h3>Synopsis</h3>
+
+  Writes and reads back synthetic data, representative of the two main LOFAR
+  data products, through a number of filter pipelines (see DAL::HDF5Filter):
+
+  <ul>
+    <li>\b TBB -- Time-series of 16 bit integers per dipole, as produced by
+    the Transient Buffer Boards; the signal is dominated by noise of a few
+    ADC counts. The dataset is of shape <tt>[dipoles,samples]</tt> and
+    chunked along the time axis.
+    <li>\b BF -- Beam-formed Stokes I data as 32 bit floating point numbers,
+    of shape <tt>[samples,channels]</tt> and chunked in spectral slices;
+    each channel carries a bandpass level with fluctuations around it.
+  </ul>
+
+  For every pipeline the compression ratio (size of the raw data divided by
+  the size of the stored data) is reported together with the throughput for
+  writing and reading the dataset, in MB/s of uncompressed data. Pipelines
+  using dynamically loaded filters (LZ4, Bitshuffle) are listed as \e n/a if
+  the filter cannot be found by the library (see \c HDF5_PLUGIN_PATH).
+
+  <h3>Usage</h3>
+
+  \verbatim
+  h5filterbench --samples 1048576 --dipoles 16 --channels 256
+  \endverbatim
+*/
+
+#include <cstdio>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <sys/time.h>
+#include <boost/program_options.hpp>
+
+#include <core/HDF5Dataset.h>
+#include <core/HDF5Filter.h>
+
+namespace bpo = boost::program_options;
+
+using std::cerr;
+using std::cout;
+using std::endl;
+using DAL::HDF5Dataset;
+using DAL::HDF5Filter;
+
+//_______________________________________________________________________________
+//                                                                      seconds
+
+//! Get the time difference between two time stamps, [s]
+double seconds (struct timeval const &start,
+		struct timeval const &end)
+{
+  return (end.tv_sec-start.tv_sec) + 1e-6*(end.tv_usec-start.tv_usec);
+}
+
+//_______________________________________________________________________________
+//                                                                      uniform
+
+//! Linear congruential generator, uniform numbers within [0,1)
+double uniform (unsigned int &state)
+{
+  state = 1664525u*state + 1013904223u;
+  return (state >> 8)/16777216.0;
+}
+
+//_______________________________________________________________________________
+//                                                                        gauss
+
+//! Approximately Gaussian distributed numbers, with zero mean and unit variance
+double gauss (unsigned int &state)
+{
+  double sum = 0;
+  for (int n=0; n<12; ++n) {
+    sum += uniform (state);
+  }
+  return sum-6.0;
+}
+
+//_______________________________________________________________________________
+//                                                                    pipelines
+
+/*!
+  \brief Set up the list of filter pipelines to be benchmarked
+  \retval names     -- Names of the pipelines.
+  \retval pipelines -- The filter pipelines.
+  \param isFloat    -- Pipelines for floating point data? If set, the
+         scale-offset filter retains 3 decimal digits (lossy).
+*/
+void pipelines (std::vector<std::string> &names,
+		std::vector<HDF5Filter> &pipelines,
+		bool const &isFloat)
+{
+  HDF5Filter filter;
+
+  names.clear();
+  pipelines.clear();
+
+  names.push_back ("none");
+  pipelines.push_back (filter);
+
+  filter.clear();
+  filter.addDeflate (1);
+  names.push_back ("deflate(1)");
+  pipelines.push_back (filter);
+
+  names.push_back ("shuffle+deflate(1)");
+  pipelines.push_back (HDF5Filter::shuffleDeflate (1));
+
+  names.push_back ("shuffle+deflate(4)");
+  pipelines.push_back (HDF5Filter::shuffleDeflate (4));
+
+  filter.clear();
+  if (isFloat) {
+    filter.addScaleOffset (H5Z_SO_FLOAT_DSCALE, 3);
+    names.push_back ("scaleoffset(3)+shuffle+deflate(1)");
+  } else {
+    filter.addScaleOffset (H5Z_SO_INT);
+    names.push_back ("scaleoffset+shuffle+deflate(1)");
+  }
+  filter.addShuffle ();
+  filter.addDeflate (1);
+  pipelines.push_back (filter);
+
+  filter = HDF5Filter::shuffleDeflate (1);
+  filter.addFletcher32 ();
+  names.push_back ("shuffle+deflate(1)+fletcher32");
+  pipelines.push_back (filter);
+
+  filter.clear();
+  filter.addLZ4 ();
+  names.push_back ("lz4");
+  pipelines.push_back (filter);
+
+  filter.clear();
+  filter.addBitshuffle (true);
+  names.push_back ("bitshuffle+lz4");
+  pipelines.push_back (filter);
+}
+
+//_______________________________________________________________________________
+//                                                                    benchmark
+
+/*!
+  \brief Write and read back a dataset for each of the filter pipelines
+
+  \param fileID   -- Identifier of the file to which the datasets are written.
+  \param label    -- Label of the data set, used as prefix for the names of
+         the datasets.
+  \param data     -- Array with the data.
+  \param shape    -- Shape of the dataset.
+  \param chunk    -- Shape of the chunks.
+  \param datatype -- HDF5 datatype of the data.
+  \param isFloat  -- Floating point data?
+  \return status  -- Returns \e false if the data read back did not match the
+          data written for one of the lossless pipelines.
+*/
+template <class T>
+bool benchmark (hid_t const &fileID,
+		std::string const &label,
+		T *data,
+		std::vector<hsize_t> const &shape,
+		std::vector<hsize_t> const &chunk,
+		hid_t const &datatype,
+		bool const &isFloat)
+{
+  bool status = true;
+  std::vector<std::string> names;
+  std::vector<HDF5Filter> filters;
+  std::vector<int> start (shape.size(),0);
+  std::vector<int> block (shape.begin(), shape.end());
+  unsigned int nofDatapoints = 1;
+  struct timeval t0;
+  struct timeval t1;
+
+  for (unsigned int n(0); n<shape.size(); ++n) {
+    nofDatapoints *= shape[n];
+  }
+
+  double megaBytes = nofDatapoints*sizeof(T)/(1024.0*1024.0);
+  T *buffer        = new T [nofDatapoints];
+
+  pipelines (names, filters, isFloat);
+
+  cout << "\n[h5filterbench] " << label << " data, shape " << shape
+       << ", chunk " << chunk << ", " << megaBytes << " MB" << endl;
+  cout << std::setw(36) << std::left << "-- Pipeline"
+       << std::setw(10) << std::right << "Ratio"
+       << std::setw(14) << "Write [MB/s]"
+       << std::setw(14) << "Read [MB/s]"
+       << endl;
+
+  for (unsigned int n(0); n<filters.size(); ++n) {
+
+    /* Skip pipelines with filters not available to the library */
+    std::vector<H5Z_filter_t> ids = filters[n].filters();
+    bool available = true;
+    for (unsigned int k(0); k<ids.size(); ++k) {
+      available = available && HDF5Filter::available (ids[k]);
+    }
+
+    cout << "   " << std::setw(33) << std::left << names[n] << std::right;
+
+    if (!available) {
+      cout << std::setw(10) << "n/a" << endl;
+      continue;
+    }
+
+    std::string name = label + "_" + names[n];
+    hsize_t storage  = 0;
+
+    /* Write the data */
+    gettimeofday (&t0, NULL);
+    {
+      HDF5Dataset dataset;
+      dataset.setFilter (filters[n]);
+      dataset.open (fileID, name, shape, chunk, datatype);
+      dataset.writeData (data, start, block);
+      H5Fflush (fileID, H5F_SCOPE_LOCAL);
+      storage = H5Dget_storage_size (dataset.objectID());
+    }
+    gettimeofday (&t1, NULL);
+    double writeTime = seconds (t0, t1);
+
+    /* Read the data back */
+    gettimeofday (&t0, NULL);
+    {
+      HDF5Dataset dataset (fileID, name);
+      dataset.readData (buffer, start, block);
+    }
+    gettimeofday (&t1, NULL);
+    double readTime = seconds (t0, t1);
+
+    /* Verify the lossless pipelines */
+    bool lossy = filters[n].hasFilter(H5Z_FILTER_SCALEOFFSET) && isFloat;
+    if (!lossy) {
+      for (unsigned int k(0); k<nofDatapoints; ++k) {
+	if (buffer[k] != data[k]) {
+	  cerr << "[h5filterbench] Mismatch at element " << k
+	       << " for pipeline " << names[n] << endl;
+	  status = false;
+	  break;
+	}
+      }
+    }
+
+    cout << std::setw(10) << std::fixed << std::setprecision(2)
+	 << (storage > 0 ? nofDatapoints*sizeof(T)/double(storage) : 0.0)
+	 << std::setw(14) << std::setprecision(1)
+	 << (writeTime > 0 ? megaBytes/writeTime : 0.0)
+	 << std::setw(14)
+	 << (readTime > 0 ? megaBytes/readTime : 0.0)
+	 << endl;
+    cout.unsetf (std::ios::fixed);
+  }
+
+  delete [] buffer;
+
+  return status;
+}
+
+//_______________________________________________________________________________
+//                                                                           main
+
+int main (int argc, char *argv[])
+{
+  std::string outfile   = "h5filterbench.h5";
+  unsigned int samples  = 1048576;
+  unsigned int dipoles  = 16;
+  unsigned int channels = 256;
+  double noise          = 8.0;
+  bool keepFile         = false;
+  bool status           = true;
+
+  // Processing of command line options ____________________
+
+  bpo::options_description desc ("[h5filterbench] Available command line options");
+
+  desc.add_options ()
+    ("help,H", "Show help messages")
+    ("outfile,O", bpo::value<std::string>(), "Name of the output HDF5 file [h5filterbench.h5]")
+    ("samples,N", bpo::value<unsigned int>(), "Number of TBB samples per dipole [1048576]")
+    ("dipoles,D", bpo::value<unsigned int>(), "Number of TBB dipoles [16]")
+    ("channels,C", bpo::value<unsigned int>(), "Number of BF channels [256]")
+    ("noise", bpo::value<double>(), "RMS of the TBB noise, [ADC counts] [8]")
+    ("keep", "Keep the HDF5 file after the run")
+    ;
+
+  bpo::variables_map vm;
+  bpo::store (bpo::parse_command_line(argc,argv,desc), vm);
+
+  if (vm.count("help")) {
+    cout << "\n" << desc << endl;
+    return 0;
+  }
+
+  if (vm.count("outfile"))  { outfile  = vm["outfile"].as<std::string>();   }
+  if (vm.count("samples"))  { samples  = vm["samples"].as<unsigned int>();  }
+  if (vm.count("dipoles"))  { dipoles  = vm["dipoles"].as<unsigned int>();  }
+  if (vm.count("channels")) { channels = vm["channels"].as<unsigned int>(); }
+  if (vm.count("noise"))    { noise    = vm["noise"].as<double>();          }
+  if (vm.count("keep"))     { keepFile = true;                              }
+
+  if (samples < channels) {
+    cerr << "[h5filterbench] Number of samples must exceed number of channels!" << endl;
+    return 1;
+  }
+
+  hid_t fileID = H5Fcreate (outfile.c_str(),
+			    H5F_ACC_TRUNC,
+			    H5P_DEFAULT,
+			    H5P_DEFAULT);
+
+  if (!H5Iis_valid(fileID)) {
+    cerr << "[h5filterbench] Failed to create file " << outfile << endl;
+    return 1;
+  }
+
+  unsigned int state = 42;
+
+  // TBB: int16 time-series per dipole _____________________
+
+  {
+    std::vector<hsize_t> shape (2);
+    shape[0] = dipoles;
+    shape[1] = samples;
+    /* Each dipole is stored as a separate time-series */
+    std::vector<hsize_t> chunk (2);
+    chunk[0] = 1;
+    chunk[1] = HDF5Dataset::chunkShape (std::vector<hsize_t>(1,samples),
+					sizeof(short))[0];
+
+    short *data = new short [dipoles*samples];
+    for (unsigned int n(0); n<dipoles*samples; ++n) {
+      data[n] = short (noise*gauss(state));
+    }
+
+    status = benchmark (fileID, "TBB", data, shape, chunk, H5T_NATIVE_SHORT, false)
+      && status;
+
+    delete [] data;
+  }
+
+  // BF: float Stokes I spectra ____________________________
+
+  {
+    unsigned int nofSpectra = samples/channels;
+    std::vector<hsize_t> shape (2);
+    shape[0] = nofSpectra;
+    shape[1] = channels;
+    std::vector<hsize_t> chunk = HDF5Dataset::chunkShape (shape,
+							  sizeof(float),
+							  HDF5Dataset::SpectralSlice);
+
+    float *data = new float [nofSpectra*channels];
+    for (unsigned int t(0); t<nofSpectra; ++t) {
+      for (unsigned int c(0); c<channels; ++c) {
+	/* Bandpass with roll-off towards the edges, radiometer noise on top */
+	double x        = (c+0.5)/channels - 0.5;
+	double bandpass = 1000.0*(1.0-2.0*x*x);
+	data[t*channels+c] = float (bandpass*(1.0+0.05*gauss(state)));
+      }
+    }
+
+    status = benchmark (fileID, "BF", data, shape, chunk, H5T_NATIVE_FLOAT, true)
+      && status;
+
+    delete [] data;
+  }
+
+  H5Fclose (fileID);
+
+  if (!keepFile) {
+    remove (outfile.c_str());
+  }
+
+  return (status ? 0 : 1);
+}
@@ -0,0 +1,197 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+/*!
+  \file tbbindex.cpp
+
+  \ingroup DAL
+  \ingroup dal_apps
+
+  \brief Build and query an index of the dipole datasets in an archive of TBB dumps
+
+  \author agent
+
+  \date 2026/10/18
+
+  <h3>Synopsis</h3>
+
+  Maintains a DAL::TBB_Index, stored in an HDF5 file, for an archive directory
+  of TBB dumps. With \e --update the index is brought up to date with the
+  contents of the directory: only files which are new or have changed since
+  the last run are scanned, using a number of worker processes. With \e --start
+  and \e --end the index is queried for the dipole datasets holding data within
+  the given window of time (in seconds since 1970), optionally restricted to a
+  number of stations; with \e --gaps the periods not covered by each of the
+  selected stations are listed instead.
+
+  <h3>Usage</h3>
+
+  \verbatim
+  tbbindex --index archive.idx --update /data/tbb --jobs 8
+  tbbindex --index archive.idx --start 1316000000 --end 1316000010 --station 2 --station 5
+  tbbindex --index archive.idx --start 1316000000 --end 1316003600 --station 2 --gaps
+  \endverbatim
+*/
+
+#include <cstdio>
+#include <iostream>
+#include <iomanip>
+#include <set>
+#include <string>
+#include <vector>
+#include <boost/program_options.hpp>
+
+#include <data_hl/TBB_DipoleDataset.h>
+#include <data_hl/TBB_Index.h>
+
+namespace bpo = boost::program_options;
+
+using std::cerr;
+using std::cout;
+using std::endl;
+using DAL::TBB_DipoleDataset;
+using DAL::TBB_Index;
+using DAL::TBB_IndexEntry;
+
+//_______________________________________________________________________________
+//                                                                           main
+
+int main (int argc, char *argv[])
+{
+  std::string indexfile = "tbbindex.h5";
+  std::string directory;
+  std::string suffix    = "_tbb.h5";
+  unsigned int jobs     = 0;
+  double start          = 0;
+  double end            = 0;
+  std::vector<unsigned int> stations;
+
+  // Processing of command line options ____________________
+
+  bpo::options_description desc ("[tbbindex] Available command line options");
+
+  desc.add_options ()
+    ("help,H", "Show help messages")
+    ("index,I", bpo::value<std::string>(), "Name of the index file [tbbindex.h5]")
+    ("update,U", bpo::value<std::string>(), "Update the index from the files in a directory")
+    ("suffix", bpo::value<std::string>(), "Suffix of the names of the files to index [_tbb.h5]")
+    ("jobs,j", bpo::value<unsigned int>(), "Number of worker processes scanning files [nof. processors]")
+    ("start,s", bpo::value<double>(), "Start of the window of time to query, [s]")
+    ("end,e", bpo::value<double>(), "End of the window of time to query, [s]")
+    ("station", bpo::value<std::vector<unsigned int> >(), "Station to query; may be given multiple times [all]")
+    ("gaps", "List the periods not covered by the stations instead of the datasets")
+    ("summary", "Show a summary of the index")
+    ;
+
+  bpo::variables_map vm;
+  bpo::store (bpo::parse_command_line(argc,argv,desc), vm);
+
+  if (vm.count("help") || argc < 2) {
+    cout << "\n" << desc << endl;
+    return 0;
+  }
+
+  if (vm.count("index"))   { indexfile = vm["index"].as<std::string>();               }
+  if (vm.count("update"))  { directory = vm["update"].as<std::string>();              }
+  if (vm.count("suffix"))  { suffix    = vm["suffix"].as<std::string>();              }
+  if (vm.count("jobs"))    { jobs      = vm["jobs"].as<unsigned int>();               }
+  if (vm.count("start"))   { start     = vm["start"].as<double>();                    }
+  if (vm.count("end"))     { end       = vm["end"].as<double>();                      }
+  if (vm.count("station")) { stations  = vm["station"].as<std::vector<unsigned int> >(); }
+
+  bool query = vm.count("start") || vm.count("end");
+
+  if (query && !(vm.count("start") && vm.count("end"))) {
+    cerr << "[tbbindex] Both start and end of the window of time are required!" << endl;
+    return 1;
+  }
+
+  if (vm.count("gaps") && stations.empty()) {
+    cerr << "[tbbindex] Listing gaps requires at least one station!" << endl;
+    return 1;
+  }
+
+  // Load and update the index _____________________________
+
+  TBB_Index index;
+
+  if (!directory.empty()) {
+    /* A missing index file simply means starting from scratch */
+    FILE *file = fopen (indexfile.c_str(), "r");
+    if (file) {
+      fclose (file);
+      if (!index.load (indexfile)) {
+	return 1;
+      }
+    }
+
+    if (!index.update (directory, jobs, suffix)) {
+      return 1;
+    }
+
+    cout << "[tbbindex] Scanned " << index.nofScanned() << " of "
+	 << index.nofFiles() << " files." << endl;
+
+    if (index.nofFailed() > 0) {
+      cerr << "[tbbindex] Failed to scan " << index.nofFailed()
+	   << " files; they are not indexed." << endl;
+    }
+
+    if (!index.save (indexfile)) {
+      return 1;
+    }
+  } else if (!index.load (indexfile)) {
+    return 1;
+  }
+
+  if (vm.count("summary")) {
+    index.summary();
+  }
+
+  // Query the index _______________________________________
+
+  if (query) {
+    std::set<unsigned int> selection (stations.begin(), stations.end());
+
+    cout << std::fixed << std::setprecision(9);
+
+    if (vm.count("gaps")) {
+      std::set<unsigned int>::iterator it;
+      for (it=selection.begin(); it!=selection.end(); ++it) {
+	std::vector<std::pair<double,double> > gaps = index.gaps (*it, start, end);
+	for (unsigned int n(0); n<gaps.size(); ++n) {
+	  cout << std::setw(3) << *it << "  "
+	       << gaps[n].first << "  " << gaps[n].second << endl;
+	}
+      }
+    } else {
+      std::vector<TBB_IndexEntry> result = index.query (start, end, selection);
+      for (unsigned int n(0); n<result.size(); ++n) {
+	cout << TBB_DipoleDataset::dipoleName (result[n].station,
+						result[n].rsp,
+						result[n].rcu) << "  "
+	     << result[n].start() << "  " << result[n].end() << "  "
+	     << index.files()[result[n].file].name << endl;
+      }
+    }
+  }
+
+  return 0;
+}
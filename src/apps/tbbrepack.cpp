@@ -0,0 +1,239 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+/*!
+  \file tbbrepack.cpp
+
+  \ingroup DAL
+  \ingroup dal_apps
+
+  \brief Repack a TBB dump into time-aligned 2-dimensional station matrices
+
+  \author agent
+
+  \date 2026/10/18
+
+  <h3>Synopsis</h3>
+
+  Reads the dipole datasets of a TBB time-series file and writes them into a
+  new file as DAL::TBB_StationMatrix datasets of shape <tt>[dipole,sample]</tt>,
+  in which the samples of all dipoles are aligned in time. By default one
+  matrix is written per station, named after the station group (e.g.
+  \e Station002); with \e --whole-file the dipoles of all stations are put into
+  a single matrix named \e Stations. Reading a window of time for all dipoles
+  of the repacked file then takes a single hyperslab read.
+
+  <h3>Usage</h3>
+
+  \verbatim
+  tbbrepack --infile dump_tbb.h5 --outfile dump_matrix.h5 --threads 8 --compression 4
+  tbbrepack --infile dump_tbb.h5 --outfile dump_matrix.h5 --station 2 --station 5
+  tbbrepack --infile dump_tbb.h5 --outfile dump_matrix.h5 --whole-file
+  \endverbatim
+*/
+
+#include <cstdio>
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+#include <boost/program_options.hpp>
+
+#include <core/dalCommon.h>
+#include <data_hl/TBB_StationMatrix.h>
+
+namespace bpo = boost::program_options;
+
+using std::cerr;
+using std::cout;
+using std::endl;
+using DAL::TBB_StationMatrix;
+
+//_______________________________________________________________________________
+//                                                                 open_dipoles
+
+/*!
+  \brief Open the dipole datasets of a station group
+
+  \retval datasets -- Identifiers of the dipole datasets, appended to the
+          vector; to be closed by the caller.
+  \retval names    -- Names of the dipole datasets, appended to the vector.
+  \param groupID   -- Identifier of the station group.
+*/
+void open_dipoles (std::vector<hid_t> &datasets,
+		   std::vector<std::string> &names,
+		   hid_t const &groupID)
+{
+  std::set<std::string> dipoles;
+  std::set<std::string>::iterator it;
+
+  DAL::h5get_names (dipoles, groupID, H5G_DATASET);
+
+  for (it=dipoles.begin(); it!=dipoles.end(); ++it) {
+    hid_t datasetID = H5Dopen (groupID, it->c_str(), H5P_DEFAULT);
+    if (datasetID > 0) {
+      datasets.push_back (datasetID);
+      names.push_back (*it);
+    }
+  }
+}
+
+//_______________________________________________________________________________
+//                                                                           main
+
+int main (int argc, char *argv[])
+{
+  std::string infile;
+  std::string outfile;
+  unsigned int threads     = 0;
+  unsigned int compression = 0;
+  hsize_t chunkLength      = 0;
+  bool wholeFile           = false;
+  std::vector<unsigned int> stations;
+
+  // Processing of command line options ____________________
+
+  bpo::options_description desc ("[tbbrepack] Available command line options");
+
+  desc.add_options ()
+    ("help,H", "Show help messages")
+    ("infile,I", bpo::value<std::string>(), "Name of the input TBB time-series file")
+    ("outfile,O", bpo::value<std::string>(), "Name of the output HDF5 file")
+    ("station", bpo::value<std::vector<unsigned int> >(), "Station to repack; may be given multiple times [all]")
+    ("whole-file", "Write the dipoles of all stations into a single matrix")
+    ("threads,T", bpo::value<unsigned int>(), "Number of threads assembling a matrix [nof. processors]")
+    ("chunk", bpo::value<hsize_t>(), "Number of samples per chunk [about 1 MB per chunk]")
+    ("compression,C", bpo::value<unsigned int>(), "Shuffle/deflate compression level, 0 for none [0]")
+    ;
+
+  bpo::variables_map vm;
+  bpo::store (bpo::parse_command_line(argc,argv,desc), vm);
+
+  if (vm.count("help") || argc < 2) {
+    cout << "\n" << desc << endl;
+    return 0;
+  }
+
+  if (vm.count("infile"))      { infile      = vm["infile"].as<std::string>();                 }
+  if (vm.count("outfile"))     { outfile     = vm["outfile"].as<std::string>();                }
+  if (vm.count("station"))     { stations    = vm["station"].as<std::vector<unsigned int> >(); }
+  if (vm.count("whole-file"))  { wholeFile   = true;                                           }
+  if (vm.count("threads"))     { threads     = vm["threads"].as<unsigned int>();               }
+  if (vm.count("chunk"))       { chunkLength = vm["chunk"].as<hsize_t>();                      }
+  if (vm.count("compression")) { compression = vm["compression"].as<unsigned int>();           }
+
+  if (infile.empty() || outfile.empty()) {
+    cerr << "[tbbrepack] Names of input and output file are required!" << endl;
+    return 1;
+  }
+
+  // Open input and output file ____________________________
+
+  hid_t inputID = H5Fopen (infile.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+
+  if (inputID < 0) {
+    cerr << "[tbbrepack] Failed to open file " << infile << endl;
+    return 1;
+  }
+
+  hid_t outputID = H5Fcreate (outfile.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+
+  if (outputID < 0) {
+    cerr << "[tbbrepack] Failed to create file " << outfile << endl;
+    H5Fclose (inputID);
+    return 1;
+  }
+
+  // Repack the station groups _____________________________
+
+  std::set<unsigned int> selection (stations.begin(), stations.end());
+  std::set<std::string> groups;
+  std::set<std::string>::iterator it;
+  std::vector<hid_t> datasets;
+  std::vector<std::string> names;
+  unsigned int nofMatrices (0);
+  bool status (true);
+
+  DAL::h5get_names (groups, inputID, H5G_GROUP);
+
+  for (it=groups.begin(); it!=groups.end(); ++it) {
+    unsigned int station;
+
+    if (sscanf (it->c_str(), "Station%u", &station) != 1
+	|| (!selection.empty() && !selection.count (station))) {
+      continue;
+    }
+
+    hid_t groupID = H5Gopen (inputID, it->c_str(), H5P_DEFAULT);
+
+    if (!wholeFile) {
+      datasets.clear();
+      names.clear();
+    }
+
+    open_dipoles (datasets, names, groupID);
+    H5Gclose (groupID);
+
+    if (!wholeFile && !datasets.empty()) {
+      cout << "[tbbrepack] " << *it << " : " << datasets.size() << " dipoles" << endl;
+      status = TBB_StationMatrix::create (outputID,
+					  *it,
+					  datasets,
+					  names,
+					  threads,
+					  chunkLength,
+					  compression) && status;
+      ++nofMatrices;
+      for (unsigned int n(0); n<datasets.size(); ++n) {
+	H5Dclose (datasets[n]);
+      }
+    }
+  }
+
+  if (wholeFile && !datasets.empty()) {
+    cout << "[tbbrepack] Stations : " << datasets.size() << " dipoles" << endl;
+    status = TBB_StationMatrix::create (outputID,
+					"Stations",
+					datasets,
+					names,
+					threads,
+					chunkLength,
+					compression);
+    ++nofMatrices;
+    for (unsigned int n(0); n<datasets.size(); ++n) {
+      H5Dclose (datasets[n]);
+    }
+  }
+
+  H5Fclose (outputID);
+  H5Fclose (inputID);
+
+  if (nofMatrices == 0) {
+    cerr << "[tbbrepack] No dipole datasets found in " << infile << endl;
+    return 1;
+  }
+
+  if (!status) {
+    cerr << "[tbbrepack] Failed to repack " << infile << endl;
+    return 1;
+  }
+
+  return 0;
+}
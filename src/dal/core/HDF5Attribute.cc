@@ -203,34 +203,26 @@ namespace DAL { // Namespace DAL -- begin
     
     if (H5Iis_valid(location)) {
 
-      herr_t status   = 0;
-      hid_t attribute = 0;
-      hid_t datatype  = 0;
       hsize_t nofAttr = nofAttributes (location);
       
       if (nofAttr>0) {
 
 	for (hsize_t n=0; n<nofAttr; ++n) {
-	  attribute = H5Aopen_by_idx (location,
-				      ".",
-				      H5_INDEX_CRT_ORDER,
-				      H5_ITER_INC,
-				      n,
-				      H5P_DEFAULT,
-				      H5P_DEFAULT);
-	  // Get the type of the attribute and its class
-	  datatype = H5Aget_type(attribute);
+	  HDF5Handle attribute (H5Aopen_by_idx (location,
+						".",
+						H5_INDEX_CRT_ORDER,
+						H5_ITER_INC,
+						n,
+						H5P_DEFAULT,
+						H5P_DEFAULT));
 	  /* Feedback */
 	  std::cout << "index=" << n 
- 		    << ", objectType=" << HDF5Object::objectType(attribute)
-		    << ", objectName=" << HDF5Object::objectName(attribute)
-		    << ", attribute="  << attribute
-		    << ", datatype="   << HDF5Datatype::datatypeName(attribute)
-		    << ", dataclass="  << HDF5Object::datatypeClass(attribute)
+ 		    << ", objectType=" << HDF5Object::objectType(attribute.id())
+		    << ", objectName=" << HDF5Object::objectName(attribute.id())
+		    << ", attribute="  << attribute.id()
+		    << ", datatype="   << HDF5Datatype::datatypeName(attribute.id())
+		    << ", dataclass="  << HDF5Object::datatypeClass(attribute.id())
 		    << std::endl;
-	  /* Release object handlers */
-	  status = H5Aclose(attribute);
-	  status = H5Tclose(datatype);
 	}
       }
     } else {
@@ -356,27 +348,26 @@ namespace DAL { // Namespace DAL -- begin
     */
     
     if (h5err>0) {
-      hid_t attribute = H5Aopen (location,
-				 name.c_str(),
-				 H5P_DEFAULT);
+      HDF5Handle attribute (H5Aopen (location,
+				     name.c_str(),
+				     H5P_DEFAULT));
       
-      if (H5Iis_valid(attribute)) {
+      if (attribute.isValid()) {
 	
 	std::vector<hsize_t> dims;
 	std::vector<hsize_t> dimsMax;
 	
-	h5err           = HDF5Dataspace::shape (attribute,dims,dimsMax);
-	hid_t datatype  = H5Aget_type (attribute);
-	hid_t dataspace = H5Aget_space(attribute);
+	h5err = HDF5Dataspace::shape (attribute.id(),dims,dimsMax);
+	HDF5Handle dataspace (H5Aget_space(attribute.id()));
 	
 	if (dims.size()>0) {
 	  
-	  hid_t memtype  = H5Tcopy (H5T_C_S1);
+	  HDF5Handle memtype (H5Tcopy (H5T_C_S1));
 	  /* Adjust the size of the buffer array */
 	  char **buffer = (char **) std::malloc (dims[0] * sizeof (char *));
-	  h5err = H5Tset_size (memtype, H5T_VARIABLE);
+	  h5err = H5Tset_size (memtype.id(), H5T_VARIABLE);
 	  /* Read the attribute into the buffer */
-	  h5err = H5Aread (attribute, memtype, buffer);
+	  h5err = H5Aread (attribute.id(), memtype.id(), buffer);
 	  
 	  /* Copy attribute data from buffer to returned array */
 	  data.resize(dims[0]);
@@ -386,17 +377,12 @@ namespace DAL { // Namespace DAL -- begin
 	  }
 	  
 	  /* Release allocated memory */
-	  h5err = H5Dvlen_reclaim (memtype, dataspace, H5P_DEFAULT, buffer);
+	  h5err = H5Dvlen_reclaim (memtype.id(), dataspace.id(), H5P_DEFAULT, buffer);
 	  std::free (buffer);
 	  
 	} else {
 	  return false;
 	}
-	
-	/* Release HDF5 object identifiers */
-	if (H5Iis_valid(datatype))  { H5Tclose (datatype);  };
-	if (H5Iis_valid(dataspace)) { H5Sclose (dataspace); };
-	if (H5Iis_valid(attribute)) { H5Aclose (attribute); };
       } else {
 	std::cerr << "[HDF5Attribute::read]"
 		  << " Failed to open attribute " << name << std::endl;
@@ -631,9 +617,9 @@ namespace DAL { // Namespace DAL -- begin
 			     unsigned int const &size)
   {
     bool status       = true;
-    hid_t   attribute = 0;
-    hid_t   dataspace = 0;
-    hid_t   datatype  = H5Tcopy (H5T_C_S1);
+    HDF5Handle attribute;
+    HDF5Handle dataspace;
+    HDF5Handle datatype (H5Tcopy (H5T_C_S1));
     hsize_t dims[1]   = { size };
     hsize_t *maxdims  = NULL;
     herr_t  h5err     = 0;
@@ -666,23 +652,23 @@ namespace DAL { // Namespace DAL -- begin
     */
     
     if (h5err>0) {
-      attribute = H5Aopen (location,
-			   name.c_str(),
-			   H5P_DEFAULT);
+      attribute.reset (H5Aopen (location,
+				name.c_str(),
+				H5P_DEFAULT));
     } else {
       /* Create dataspace for the attribute */
-      h5err     = H5Tset_size (datatype, H5T_VARIABLE);
-      dataspace = H5Screate_simple (1, dims, maxdims );
-      if (H5Iis_valid(dataspace)) {
+      h5err = H5Tset_size (datatype.id(), H5T_VARIABLE);
+      dataspace.reset (H5Screate_simple (1, dims, maxdims));
+      if (dataspace.isValid()) {
 	/* Create the attribute itself ... */
-	attribute = H5Acreate (location,
-			       name.c_str(),
-			       datatype,
-			       dataspace,
-			       H5P_DEFAULT,
-			       H5P_DEFAULT);
+	attribute.reset (H5Acreate (location,
+				    name.c_str(),
+				    datatype.id(),
+				    dataspace.id(),
+				    H5P_DEFAULT,
+				    H5P_DEFAULT));
 	/* ... and check if creation was successful */
-	if (H5Iis_valid(attribute)) {
+	if (attribute.isValid()) {
 	  status = true;
 	} else {
 	  std::cerr << "[HDF5Attribute::write]"
@@ -705,9 +691,14 @@ namespace DAL { // Namespace DAL -- begin
     */
     
     if (status) {
-      datatype = H5Aget_type(attribute);
+      /* Variable-length strings are passed to the library as array of char* */
+      std::vector<char const *> buffer (size);
+      for (unsigned int n(0); n<size; ++n) {
+	buffer[n] = data[n].c_str();
+      }
+      datatype.reset (H5Aget_type(attribute.id()));
       /* Write the data to the attribute ... */
-      h5err = H5Awrite (attribute, datatype, data);
+      h5err = H5Awrite (attribute.id(), datatype.id(), &buffer[0]);
       /* ... and check the return value of the operation */
       if (h5err<0) {
 	std::cerr << "[HDF5Attribute::write]"
@@ -717,13 +708,7 @@ namespace DAL { // Namespace DAL -- begin
       }
     }
     
-    /*____________________________________________________________
-      Release HDF5 object handles
-    */
-    HDF5Object::close (datatype);
-    HDF5Object::close (dataspace);
-    HDF5Object::close (attribute);
-    
+    /* The HDF5 object handles are released when going out of scope */
     return status;
   }
   
@@ -24,6 +24,7 @@
 #include <cstdlib>
 
 #include <core/HDF5Dataspace.h>
+#include <core/HDF5Handle.h>
 
 #ifdef DAL_WITH_CASA
 #include <casa/Arrays/Vector.h>
@@ -253,24 +254,23 @@ namespace DAL { // Namespace DAL -- begin
 	*/
 
 	if (h5err>0) {
-	  hid_t attribute = H5Aopen (location,
-				     name.c_str(),
-				     H5P_DEFAULT);
+	  HDF5Handle attribute (H5Aopen (location,
+					 name.c_str(),
+					 H5P_DEFAULT));
 	  
-	  if (H5Iis_valid(attribute)) {
+	  if (attribute.isValid()) {
 
 	    std::vector<hsize_t> dims;
 	    std::vector<hsize_t> dimsMax;
 	    
-	    h5err           = HDF5Dataspace::shape (attribute,dims,dimsMax);
-	    hid_t datatype  = H5Aget_type (attribute);
-	    hid_t dataspace = H5Aget_space(attribute);
+	    h5err = HDF5Dataspace::shape (attribute.id(),dims,dimsMax);
+	    HDF5Handle datatype (H5Aget_type (attribute.id()));
 
 	    if (dims.size()>0) {
 
-	      hid_t nativeDatatype      = H5Tget_native_type(datatype, H5T_DIR_ASCEND);
+	      HDF5Handle nativeDatatype (H5Tget_native_type(datatype.id(), H5T_DIR_ASCEND));
 	      /* hsize_t datatypeSize      = H5Tget_size (datatype); */
-	      H5T_class_t datatypeClass = H5Tget_class (datatype);
+	      H5T_class_t datatypeClass = H5Tget_class (datatype.id());
 	      int size                  = 1;
 
 	      for (size_t n=0; n<dims.size(); ++n) {
@@ -286,18 +286,13 @@ namespace DAL { // Namespace DAL -- begin
 			  << " Attribute of type string - not yet supported!"
 			  << std::endl;
 	      } else {
-		h5err = H5Aread (attribute,
-				 nativeDatatype,
+		h5err = H5Aread (attribute.id(),
+				 nativeDatatype.id(),
 				 &data[0]);
 	      }
 	    } else {
 	      return false;
 	    }
-	    
-	    /* Release HDF5 object identifiers */
-	    if (H5Iis_valid(datatype))  { H5Tclose (datatype);  };
-	    if (H5Iis_valid(dataspace)) { H5Sclose (dataspace); };
-	    if (H5Iis_valid(attribute)) { H5Aclose (attribute); };
 	  } else {
 	    std::cerr << "[HDF5Attribute::read]"
 		      << " Failed to open attribute " << name << std::endl;
@@ -357,8 +352,8 @@ namespace DAL { // Namespace DAL -- begin
 			 hid_t const &datatype)
       {
 	bool status       = true;
-	hid_t   attribute = 0;
-	hid_t   dataspace = 0;
+	HDF5Handle attribute;
+	HDF5Handle dataspace;
 	hsize_t dims[1]   = { size };
 	hsize_t *maxdims  = 0;
 	herr_t h5err      = 0;
@@ -384,22 +379,22 @@ namespace DAL { // Namespace DAL -- begin
 	*/
 	
 	if (h5err>0) {
-	  attribute = H5Aopen (location,
-			       name.c_str(),
-			       H5P_DEFAULT);
+	  attribute.reset (H5Aopen (location,
+				    name.c_str(),
+				    H5P_DEFAULT));
 	} else {
 	  /* Create dataspace for the attribute */
-	  dataspace = H5Screate_simple (1, dims, maxdims );
-	  if (H5Iis_valid(dataspace)) {
+	  dataspace.reset (H5Screate_simple (1, dims, maxdims));
+	  if (dataspace.isValid()) {
 	    /* Create the attribute itself ... */
-	    attribute = H5Acreate (location,
-				   name.c_str(),
-				   datatype,
-				   dataspace,
-				   0,
-				   0);
+	    attribute.reset (H5Acreate (location,
+					name.c_str(),
+					datatype,
+					dataspace.id(),
+					0,
+					0));
 	    /* ... and check if creation was successful */
-	    if (H5Iis_valid(attribute)) {
+	    if (attribute.isValid()) {
 	      status = true;
 	    } else {
 	      std::cerr << "[HDF5Attribute::write]"
@@ -428,7 +423,7 @@ namespace DAL { // Namespace DAL -- begin
 	
 	if (status) {
 	  /* Write the data to the attribute ... */
-	  h5err = H5Awrite (attribute, datatype, data);
+	  h5err = H5Awrite (attribute.id(), datatype, data);
 	  /* ... and check the return value of the operation */
 	  if (h5err<0) {
 	    std::cerr << "[HDF5Attribute::write]"
@@ -438,12 +433,7 @@ namespace DAL { // Namespace DAL -- begin
 	  }
 	}
 
-	/*____________________________________________________________
-	  Release HDF5 object handles
-	*/
-	HDF5Object::close (dataspace);
-	HDF5Object::close (attribute);
-	
+	/* The HDF5 object handles are released when going out of scope */
 	return status;
       }
     
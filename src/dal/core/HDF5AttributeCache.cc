@@ -0,0 +1,386 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "HDF5AttributeCache.h"
+
+namespace DAL { // Namespace DAL -- begin
+
+  // ============================================================================
+  //
+  //  Construction
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                           HDF5AttributeCache
+
+  HDF5AttributeCache::HDF5AttributeCache ()
+  {
+    itsLocation = 0;
+  }
+
+  //_____________________________________________________________________________
+  //                                                           HDF5AttributeCache
+
+  /*!
+    \param location -- Identifier of the object, the attributes of which are
+           loaded.
+  */
+  HDF5AttributeCache::HDF5AttributeCache (hid_t const &location)
+  {
+    itsLocation = 0;
+    load (location);
+  }
+
+  // ============================================================================
+  //
+  //  Parameters
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                        names
+
+  std::set<std::string> HDF5AttributeCache::names () const
+  {
+    std::set<std::string> result;
+    std::map<std::string,Entry>::const_iterator it;
+
+    for (it=itsEntries.begin(); it!=itsEntries.end(); ++it) {
+      result.insert (it->first);
+    }
+
+    return result;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                      summary
+
+  /*!
+    \param os -- Output stream to which the summary is written.
+  */
+  void HDF5AttributeCache::summary (std::ostream &os)
+  {
+    os << "[HDF5AttributeCache] Summary of internal parameters." << std::endl;
+    os << "-- Location ID          = " << itsLocation << std::endl;
+    os << "-- nof. attributes      = " << itsEntries.size() << std::endl;
+    os << "-- Attribute names      = [";
+
+    std::map<std::string,Entry>::const_iterator it;
+    for (it=itsEntries.begin(); it!=itsEntries.end(); ++it) {
+      os << " " << it->first;
+    }
+    os << " ]" << std::endl;
+  }
+
+  // ============================================================================
+  //
+  //  Methods
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                         load
+
+  /*!
+    \param location -- Identifier of the object, to which the attributes are
+           attached.
+    \return status  -- Status of the operation; returns \e false in case the
+            attributes could not be iterated over. Attributes which cannot be
+	    cached (see get()) are skipped without raising an error.
+  */
+  bool HDF5AttributeCache::load (hid_t const &location)
+  {
+    clear ();
+
+    if (!H5Iis_valid(location)) {
+      std::cerr << "[HDF5AttributeCache::load] Invalid object identifier!"
+		<< std::endl;
+      return false;
+    }
+
+    itsLocation = location;
+
+    hsize_t index (0);
+    herr_t h5error = H5Aiterate2 (location,
+				  H5_INDEX_NAME,
+				  H5_ITER_NATIVE,
+				  &index,
+				  HDF5AttributeCache::H5Aiterate_load,
+				  this);
+
+    if (h5error < 0) {
+      std::cerr << "[HDF5AttributeCache::load] Failed to iterate over attributes!"
+		<< std::endl;
+      return false;
+    }
+
+    return true;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                         load
+
+  /*!
+    \param location -- Identifier of the object, to which the attribute is
+           attached.
+    \param name     -- Name of the attribute.
+    \return status  -- Returns \e false if the attribute does not exist or
+            cannot be cached.
+  */
+  bool HDF5AttributeCache::load (hid_t const &location,
+				 std::string const &name)
+  {
+    if (location != itsLocation) {
+      clear ();
+      itsLocation = location;
+    } else {
+      itsEntries.erase (name);
+    }
+
+    if (!H5Iis_valid(location) || H5Aexists (location, name.c_str()) <= 0) {
+      return false;
+    }
+
+    hid_t attribute = H5Aopen (location, name.c_str(), H5P_DEFAULT);
+    bool status     = decode (attribute, name);
+
+    H5Aclose (attribute);
+
+    return status;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                        clear
+
+  void HDF5AttributeCache::clear ()
+  {
+    itsLocation = 0;
+    itsEntries.clear();
+  }
+
+  //_____________________________________________________________________________
+  //                                                                          get
+
+  /*!
+    \param name    -- Name of the attribute.
+    \retval data   -- Values of the attribute.
+    \return status -- Returns \e false if the attribute is not held in the cache
+            or is not of type string.
+  */
+  bool HDF5AttributeCache::get (std::string const &name,
+				std::vector<std::string> &data) const
+  {
+    std::map<std::string,Entry>::const_iterator it = itsEntries.find(name);
+
+    if (it == itsEntries.end() || it->second.typeClass != H5T_STRING) {
+      return false;
+    }
+
+    data = it->second.strings;
+
+    return true;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                       decode
+
+  /*!
+    \param attribute -- Identifier of the opened attribute.
+    \param name      -- Name of the attribute.
+    \return status   -- Returns \e false if the attribute is not of a class held
+            in the cache or could not be read.
+  */
+  bool HDF5AttributeCache::decode (hid_t const &attribute,
+				   std::string const &name)
+  {
+    bool status (true);
+    Entry entry;
+    hid_t datatype  = H5Aget_type (attribute);
+    hid_t dataspace = H5Aget_space (attribute);
+    hssize_t npoints = H5Sget_simple_extent_npoints (dataspace);
+
+    entry.typeClass   = H5Tget_class (datatype);
+    entry.typeSize    = 0;
+    entry.typeSign    = H5T_SGN_NONE;
+    entry.nofElements = npoints > 0 ? npoints : 0;
+
+    switch (entry.typeClass) {
+    case H5T_INTEGER:
+    case H5T_FLOAT:
+      {
+	hid_t nativeType = H5Tget_native_type (datatype, H5T_DIR_ASCEND);
+	entry.typeSize   = H5Tget_size (nativeType);
+	entry.typeSign   = H5Tget_sign (nativeType);
+	entry.values.resize (entry.nofElements*entry.typeSize);
+	if (entry.nofElements > 0) {
+	  status = H5Aread (attribute, nativeType, &entry.values[0]) >= 0;
+	}
+	H5Tclose (nativeType);
+      }
+      break;
+    case H5T_STRING:
+      if (entry.nofElements == 0) {
+	break;
+      } else if (H5Tis_variable_str (datatype) > 0) {
+	hid_t memtype  = H5Tcopy (H5T_C_S1);
+	char **buffer  = new char* [entry.nofElements];
+	H5Tset_size (memtype, H5T_VARIABLE);
+	if (H5Aread (attribute, memtype, buffer) >= 0) {
+	  for (hsize_t n=0; n<entry.nofElements; ++n) {
+	    entry.strings.push_back (buffer[n] == NULL ? "" : buffer[n]);
+	  }
+	  H5Dvlen_reclaim (memtype, dataspace, H5P_DEFAULT, buffer);
+	} else {
+	  status = false;
+	}
+	delete [] buffer;
+	H5Tclose (memtype);
+      } else {
+	size_t length = H5Tget_size (datatype);
+	std::vector<char> buffer (entry.nofElements*length);
+	if (H5Aread (attribute, datatype, &buffer[0]) >= 0) {
+	  for (hsize_t n=0; n<entry.nofElements; ++n) {
+	    char const *begin = &buffer[n*length];
+	    entry.strings.push_back (std::string (begin, strnlen (begin, length)));
+	  }
+	} else {
+	  status = false;
+	}
+      }
+      break;
+    default:
+      /* Attributes of other classes are not cached */
+      status = false;
+      break;
+    };
+
+    if (status) {
+      itsEntries[name] = entry;
+    }
+
+    H5Tclose (datatype);
+    H5Sclose (dataspace);
+
+    return status;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                      convert
+
+  /*!
+    \param name       -- Name of the attribute.
+    \param memoryType -- Datatype to which the values are converted.
+    \retval buffer    -- Converted values, <tt>nofElements*H5Tget_size(memoryType)</tt>
+            bytes.
+    \return status    -- Returns \e false if the attribute is not held in the
+            cache, is not numerical or the values cannot be converted.
+  */
+  bool HDF5AttributeCache::convert (std::string const &name,
+				    hid_t const &memoryType,
+				    std::vector<char> &buffer) const
+  {
+    std::map<std::string,Entry>::const_iterator it = itsEntries.find(name);
+
+    if (it == itsEntries.end()) {
+      return false;
+    }
+
+    Entry const &entry = it->second;
+    hid_t sourceType;
+
+    /* Native datatype matching the cached values */
+    if (entry.typeClass == H5T_INTEGER) {
+      bool isSigned = entry.typeSign != H5T_SGN_NONE;
+      switch (entry.typeSize) {
+      case 1:
+	sourceType = isSigned ? H5T_NATIVE_SCHAR : H5T_NATIVE_UCHAR;
+	break;
+      case 2:
+	sourceType = isSigned ? H5T_NATIVE_SHORT : H5T_NATIVE_USHORT;
+	break;
+      case 4:
+	sourceType = isSigned ? H5T_NATIVE_INT : H5T_NATIVE_UINT;
+	break;
+      default:
+	sourceType = isSigned ? H5T_NATIVE_LLONG : H5T_NATIVE_ULLONG;
+	break;
+      };
+    } else if (entry.typeClass == H5T_FLOAT) {
+      if (entry.typeSize == sizeof(float)) {
+	sourceType = H5T_NATIVE_FLOAT;
+      } else if (entry.typeSize == sizeof(double)) {
+	sourceType = H5T_NATIVE_DOUBLE;
+      } else {
+	sourceType = H5T_NATIVE_LDOUBLE;
+      }
+    } else {
+      return false;
+    }
+
+    /* Convert in place, in a buffer large enough for either type */
+    size_t memorySize = H5Tget_size (memoryType);
+    size_t nelem      = entry.nofElements;
+
+    buffer.resize (nelem*std::max(memorySize,entry.typeSize));
+
+    if (nelem == 0) {
+      return true;
+    }
+
+    std::memcpy (&buffer[0], &entry.values[0], entry.values.size());
+
+    if (H5Tconvert (sourceType, memoryType, nelem, &buffer[0], NULL, H5P_DEFAULT) < 0) {
+      buffer.clear();
+      return false;
+    }
+
+    buffer.resize (nelem*memorySize);
+
+    return true;
+  }
+
+  //_____________________________________________________________________________
+  //                                                              H5Aiterate_load
+
+  /*!
+    \param location -- Identifier of the object, to which the attribute is
+           attached.
+    \param name     -- Name of the attribute.
+    \param info     -- Attribute info (not used).
+    \param cache    -- Pointer to the HDF5AttributeCache object.
+    \return status  -- Always 0, i.e. continue the iteration.
+  */
+  herr_t HDF5AttributeCache::H5Aiterate_load (hid_t location,
+					      const char *name,
+					      const H5A_info_t * /* info */,
+					      void *cache)
+  {
+    hid_t attribute = H5Aopen (location, name, H5P_DEFAULT);
+
+    if (H5Iis_valid(attribute)) {
+      static_cast<HDF5AttributeCache *>(cache)->decode (attribute, name);
+      H5Aclose (attribute);
+    }
+
+    return 0;
+  }
+
+} // Namespace DAL -- end
@@ -0,0 +1,299 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#ifndef HDF5ATTRIBUTECACHE_H
+#define HDF5ATTRIBUTECACHE_H
+
+// Standard library header files
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <core/HDF5TypeTraits.h>
+
+namespace DAL { // Namespace DAL -- begin
+
+  /*!
+    \class HDF5AttributeCache
+
+    \ingroup DAL
+    \ingroup core
+
+    \brief In-memory copy of the attributes attached to an HDF5 object
+
+    \author agent
+
+    \date 2026/10/18
+
+    \test tHDF5AttributeCache.cc
+
+    <h3>Prerequisite</h3>
+
+    <ul type="square">
+      <li>DAL::HDF5Attribute
+      <li>DAL::HDF5TypeTraits
+    </ul>
+
+    <h3>Synopsis</h3>
+
+    Reading an attribute through HDF5Attribute::read involves checking for its
+    existence, opening it, querying datatype and dataspace, reading and closing
+    it again. When the same attributes are requested over and over -- e.g.
+    TIME, SAMPLE_NUMBER and DATA_LENGTH for each of the dipole datasets of a
+    TBB file -- these round trips dominate the time spent. An
+    HDF5AttributeCache iterates once over all attributes attached to an object
+    (using \c H5Aiterate), reads them and keeps their values in memory;
+    subsequent requests are served from memory, converting the values to the
+    requested type as needed.
+
+    Numerical attributes are kept in their native datatype and converted upon
+    request (e.g. an attribute of type \c int can be retrieved as \c double);
+    string attributes (fixed and variable length) are kept as
+    <tt>std::string</tt>. Attributes of other classes (e.g. compound types) are
+    not cached, and get() returns \e false for them, such that the caller can
+    fall back to HDF5Attribute::read.
+
+    The cache does not notice changes made to the file: after writing an
+    attribute call invalidate() -- HDF5GroupBase::setAttribute does this --
+    or clear() to drop all values.
+
+    <h3>Example(s)</h3>
+
+    <ol>
+      <li>Read a number of attributes attached to the root group of a file:
+      \code
+      DAL::HDF5AttributeCache attributes (fileID);
+      std::string telescope;
+      std::vector<std::string> stations;
+
+      attributes.get ("TELESCOPE", telescope);
+      attributes.get ("OBSERVATION_STATIONS_LIST", stations);
+      \endcode
+      <li>Lazily load attributes on first access, and keep the cache up to date
+      when writing:
+      \code
+      cache.read (location, "TIME", time);
+
+      HDF5Attribute::write (location, "TIME", newTime);
+      cache.invalidate ("TIME");
+      \endcode
+    </ol>
+  */
+  class HDF5AttributeCache {
+
+    //! Value of a single cached attribute
+    struct Entry {
+      //! Datatype class of the attribute
+      H5T_class_t typeClass;
+      //! Size of the native datatype, [Bytes]
+      size_t typeSize;
+      //! Sign of the native (integer) datatype
+      H5T_sign_t typeSign;
+      //! Number of elements
+      hsize_t nofElements;
+      //! Values of a numerical attribute, in the native datatype
+      std::vector<char> values;
+      //! Values of a string attribute
+      std::vector<std::string> strings;
+    };
+
+    //! Identifier of the object, from which the attributes have been loaded
+    hid_t itsLocation;
+    //! Cached attributes
+    std::map<std::string,Entry> itsEntries;
+
+  public:
+
+    // === Construction =========================================================
+
+    //! Default constructor
+    HDF5AttributeCache ();
+
+    //! Argumented constructor, loading the attributes attached to \c location
+    HDF5AttributeCache (hid_t const &location);
+
+    // === Parameter access =====================================================
+
+    //! Identifier of the object, from which the attributes have been loaded
+    inline hid_t location () const {
+      return itsLocation;
+    }
+
+    //! Number of cached attributes
+    inline unsigned int size () const {
+      return itsEntries.size();
+    }
+
+    //! Is the attribute \c name held in the cache?
+    inline bool contains (std::string const &name) const {
+      return itsEntries.find(name) != itsEntries.end();
+    }
+
+    //! Names of the cached attributes
+    std::set<std::string> names () const;
+
+    /*!
+      \brief Get the name of the class
+      \return className -- The name of the class, HDF5AttributeCache.
+    */
+    inline std::string className () const {
+      return "HDF5AttributeCache";
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    inline void summary () {
+      summary (std::cout);
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    void summary (std::ostream &os);
+
+    // === Methods ==============================================================
+
+    //! Load all attributes attached to \c location
+    bool load (hid_t const &location);
+
+    //! (Re-)load the single attribute \c name attached to \c location
+    bool load (hid_t const &location,
+	       std::string const &name);
+
+    //! Drop the cached value of attribute \c name
+    inline void invalidate (std::string const &name) {
+      itsEntries.erase (name);
+    }
+
+    //! Drop all cached values
+    void clear ();
+
+    //! Get the values of a string attribute
+    bool get (std::string const &name,
+	      std::vector<std::string> &data) const;
+
+    //! Get the values of a boolean attribute
+    inline bool get (std::string const &name,
+		     std::vector<bool> &data) const {
+      std::vector<int> buffer;
+      if (get (name, buffer)) {
+	data.assign (buffer.begin(), buffer.end());
+	return true;
+      } else {
+	return false;
+      }
+    }
+
+    /*!
+      \brief Get the values of a numerical attribute
+      \param name    -- Name of the attribute.
+      \retval data   -- Values of the attribute, converted to type \c T.
+      \return status -- Returns \e false if the attribute is not held in the
+              cache or cannot be converted to type \c T.
+    */
+    template <class T>
+      bool get (std::string const &name,
+		std::vector<T> &data) const
+      {
+	std::vector<char> buffer;
+
+	if (!convert (name, HDF5TypeTraits<T>::type(), buffer)) {
+	  return false;
+	}
+
+	data.resize (buffer.size()/sizeof(T));
+	if (!data.empty()) {
+	  std::memcpy (&data[0], &buffer[0], data.size()*sizeof(T));
+	}
+
+	return true;
+      }
+
+    /*!
+      \brief Get the value of a scalar attribute
+      \param name    -- Name of the attribute.
+      \retval data   -- Value of the attribute; for an array attribute its first
+              element.
+      \return status -- Returns \e false if the attribute is not held in the
+              cache, cannot be converted to type \c T or is not a scalar --
+	      same as HDF5Attribute::read.
+    */
+    template <class T>
+      bool get (std::string const &name,
+		T &data) const
+      {
+	std::vector<T> buffer;
+
+	if (!get (name, buffer) || buffer.empty()) {
+	  return false;
+	}
+
+	data = buffer[0];
+
+	return buffer.size() == 1;
+      }
+
+    /*!
+      \brief Get the value(s) of an attribute, loading the cache if required
+      \param location -- Identifier of the object, to which the attribute is
+             attached; if the cache holds the attributes of a different object,
+	     all attributes of \c location are loaded.
+      \param name     -- Name of the attribute; if it is not held in the cache
+             (e.g. after invalidate()), it is (re-)loaded.
+      \retval data    -- Value(s) of the attribute.
+      \return status  -- Status of the operation, see get().
+    */
+    template <class T>
+      bool read (hid_t const &location,
+		 std::string const &name,
+		 T &data)
+      {
+	if (location != itsLocation) {
+	  load (location);
+	} else if (!contains(name)) {
+	  load (location, name);
+	}
+
+	return get (name, data);
+      }
+
+  private:
+
+    //! Decode an open attribute and add it to the cache
+    bool decode (hid_t const &attribute,
+		 std::string const &name);
+
+    //! Convert the values of a numerical attribute to \c memoryType
+    bool convert (std::string const &name,
+		  hid_t const &memoryType,
+		  std::vector<char> &buffer) const;
+
+    //! Callback for H5Aiterate, decoding one attribute
+    static herr_t H5Aiterate_load (hid_t location,
+				   const char *name,
+				   const H5A_info_t *info,
+				   void *cache);
+
+  }; // Class HDF5AttributeCache -- end
+
+} // Namespace DAL -- end
+
+#endif /* HDF5ATTRIBUTECACHE_H */
@@ -0,0 +1,499 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "HDF5BlockIterator.h"
+
+namespace DAL { // Namespace DAL -- begin
+
+  // ============================================================================
+  //
+  //  Construction
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                            HDF5BlockIterator
+
+  /*!
+    The iterator is left without a ring of buffers; a derived class sets it up
+    through setupRing() and then calls start().
+  */
+  HDF5BlockIterator::HDF5BlockIterator ()
+  {
+    pthread_mutex_init (&itsMutex, NULL);
+    pthread_cond_init (&itsCondition, NULL);
+
+    init ();
+  }
+
+  //_____________________________________________________________________________
+  //                                                            HDF5BlockIterator
+
+  /*!
+    \param location   -- Identifier of the dataset.
+    \param block      -- Shape of the blocks; the number of elements must match
+           the rank of the dataset.
+    \param memoryType -- Datatype of the elements in memory.
+    \param axis       -- Axis along which to step through the dataset.
+    \param nofBuffers -- Number of buffers in the ring (at least 2), i.e. the
+           I/O thread reads up to <tt>nofBuffers-1</tt> blocks ahead.
+  */
+  HDF5BlockIterator::HDF5BlockIterator (hid_t const &location,
+					std::vector<hsize_t> const &block,
+					hid_t const &memoryType,
+					unsigned int const &axis,
+					unsigned int const &nofBuffers)
+  {
+    pthread_mutex_init (&itsMutex, NULL);
+    pthread_cond_init (&itsCondition, NULL);
+
+    init ();
+
+    if (setup (location, block, memoryType, axis, nofBuffers)) {
+      start ();
+    }
+  }
+
+  //_____________________________________________________________________________
+  //                                                            HDF5BlockIterator
+
+  /*!
+    \param dataset    -- Dataset object, over which to iterate.
+    \param block      -- Shape of the blocks; the number of elements must match
+           the rank of the dataset.
+    \param memoryType -- Datatype of the elements in memory.
+    \param axis       -- Axis along which to step through the dataset.
+    \param nofBuffers -- Number of buffers in the ring (at least 2), i.e. the
+           I/O thread reads up to <tt>nofBuffers-1</tt> blocks ahead.
+  */
+  HDF5BlockIterator::HDF5BlockIterator (HDF5Dataset const &dataset,
+					std::vector<hsize_t> const &block,
+					hid_t const &memoryType,
+					unsigned int const &axis,
+					unsigned int const &nofBuffers)
+  {
+    pthread_mutex_init (&itsMutex, NULL);
+    pthread_cond_init (&itsCondition, NULL);
+
+    init ();
+
+    if (setup (dataset.objectID(), block, memoryType, axis, nofBuffers)) {
+      start ();
+    }
+  }
+
+  // ============================================================================
+  //
+  //  Destruction
+  //
+  // ============================================================================
+
+  HDF5BlockIterator::~HDF5BlockIterator ()
+  {
+    stop ();
+
+    /* Releasing the identifiers of the plans involves HDF5 calls */
+    {
+      HDF5Lock lock;
+      itsPlan     = HDF5IOPlan();
+      itsTailPlan = HDF5IOPlan();
+    }
+
+    if (itsBuffers != NULL) {
+      delete [] itsBuffers;
+    }
+
+    pthread_cond_destroy (&itsCondition);
+    pthread_mutex_destroy (&itsMutex);
+  }
+
+  // ============================================================================
+  //
+  //  Parameters
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                   blockShape
+
+  std::vector<hsize_t> HDF5BlockIterator::blockShape () const
+  {
+    if (lastBlock() && itsTailPlan.isValid()) {
+      return itsTailPlan.block();
+    } else {
+      return itsPlan.block();
+    }
+  }
+
+  //_____________________________________________________________________________
+  //                                                                nofDatapoints
+
+  hsize_t HDF5BlockIterator::nofDatapoints () const
+  {
+    if (lastBlock() && itsTailPlan.isValid()) {
+      return itsTailPlan.nofDatapoints();
+    } else {
+      return itsPlan.nofDatapoints();
+    }
+  }
+
+  //_____________________________________________________________________________
+  //                                                                      summary
+
+  /*!
+    \param os -- Output stream to which the summary is written.
+  */
+  void HDF5BlockIterator::summary (std::ostream &os)
+  {
+    os << "[HDF5BlockIterator] Summary of internal parameters." << std::endl;
+    os << "-- Shape of dataset     = " << itsPlan.shape()  << std::endl;
+    os << "-- Shape of block       = " << itsPlan.block()  << std::endl;
+    os << "-- Axis of iteration    = " << itsAxis          << std::endl;
+    os << "-- nof. blocks          = " << itsNofBlocks     << std::endl;
+    os << "-- nof. buffers         = " << itsNofBuffers    << std::endl;
+    os << "-- Block size [Bytes]   = " << itsBlocksize     << std::endl;
+    os << "-- Blocks read          = " << itsNextRead      << std::endl;
+    os << "-- Blocks consumed      = " << itsNextConsume   << std::endl;
+    os << "-- I/O thread running   = " << itsRunning       << std::endl;
+    os << "-- Error encountered    = " << itsError         << std::endl;
+  }
+
+  // ============================================================================
+  //
+  //  Methods
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                         init
+
+  void HDF5BlockIterator::init ()
+  {
+    itsAxis        = 0;
+    itsBlockLength = 0;
+    itsNofBlocks   = 0;
+    itsBlocksize   = 0;
+    itsNofBuffers  = 0;
+    itsBuffers     = NULL;
+    itsNextRead    = 0;
+    itsNextConsume = 0;
+    itsFilled      = 0;
+    itsHolding     = false;
+    itsError       = false;
+    itsStop        = false;
+    itsRunning     = false;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                    setupRing
+
+  /*!
+    \param nofBlocks  -- Number of blocks of the iteration.
+    \param blocksize  -- Size of a (full) block, [Bytes].
+    \param nofBuffers -- Number of buffers in the ring (at least 2), i.e. the
+           I/O thread reads up to <tt>nofBuffers-1</tt> blocks ahead.
+    \return status    -- Status of the operation; returns \e false in case
+            there is nothing to iterate over.
+  */
+  bool HDF5BlockIterator::setupRing (hsize_t const &nofBlocks,
+				     size_t const &blocksize,
+				     unsigned int const &nofBuffers)
+  {
+    stop ();
+
+    if (itsBuffers != NULL) {
+      delete [] itsBuffers;
+      itsBuffers = NULL;
+    }
+
+    if (nofBlocks == 0 || blocksize == 0) {
+      return false;
+    }
+
+    itsNofBlocks  = nofBlocks;
+    itsBlocksize  = blocksize;
+    itsNofBuffers = nofBuffers < 2 ? 2 : nofBuffers;
+    itsBuffers    = new char [itsNofBuffers*itsBlocksize];
+
+    return true;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                        setup
+
+  /*!
+    \return status -- Status of the operation; returns \e false in case an error
+            was encountered.
+
+    The HDF5 calls made while setting up the read plans are done holding the
+    process-wide HDF5Lock.
+  */
+  bool HDF5BlockIterator::setup (hid_t const &location,
+				 std::vector<hsize_t> const &block,
+				 hid_t const &memoryType,
+				 unsigned int const &axis,
+				 unsigned int const &nofBuffers)
+  {
+    itsAxis = axis;
+
+    HDF5Lock lock;
+
+    if (axis >= block.size()) {
+      std::cerr << "[HDF5BlockIterator::setup] Invalid axis of iteration!"
+		<< std::endl;
+      return false;
+    }
+
+    if (!itsPlan.setup (location, block, memoryType)) {
+      std::cerr << "[HDF5BlockIterator::setup] Failed to set up read plan!"
+		<< std::endl;
+      return false;
+    }
+
+    /* The block must fit into the dataset along the remaining axes */
+
+    std::vector<hsize_t> shape = itsPlan.shape();
+
+    for (unsigned int n(0); n<shape.size(); ++n) {
+      if (n != axis && block[n] > shape[n]) {
+	std::cerr << "[HDF5BlockIterator::setup] Block exceeds shape of dataset"
+		  << " along axis " << n << "!" << std::endl;
+	itsPlan = HDF5IOPlan();
+	return false;
+      }
+    }
+
+    /* Number of blocks; set up a separate plan for a shorter last block */
+
+    hsize_t remainder = shape[axis]%block[axis];
+
+    hsize_t nofBlocks = shape[axis]/block[axis];
+
+    itsBlockLength = block[axis];
+
+    if (remainder > 0) {
+      std::vector<hsize_t> tail = block;
+      tail[axis] = remainder;
+      itsTailPlan.setup (location, tail, memoryType);
+      ++nofBlocks;
+    }
+
+    /* Allocate the ring of buffers */
+
+    return setupRing (nofBlocks,
+		      itsPlan.nofDatapoints()*H5Tget_size(memoryType),
+		      nofBuffers);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                       offset
+
+  /*!
+    \retval start -- Offset of the block within the dataset.
+    \param index  -- Number of the block along the direction of iteration.
+  */
+  void HDF5BlockIterator::offset (hsize_t *start,
+				  hsize_t const &index) const
+  {
+    for (unsigned int n(0); n<itsPlan.rank(); ++n) {
+      start[n] = 0;
+    }
+    start[itsAxis] = index*itsBlockLength;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                    readBlock
+
+  /*!
+    \retval buffer -- Buffer receiving the data of the block.
+    \param index   -- Number of the block along the direction of iteration.
+    \return status -- Status of the operation; returns \e false in case an
+            error was encountered while reading.
+  */
+  bool HDF5BlockIterator::readBlock (void *buffer,
+				     hsize_t const &index)
+  {
+    hsize_t start[H5S_MAX_RANK];
+
+    offset (start, index);
+
+    if (index+1 == itsNofBlocks && itsTailPlan.isValid()) {
+      return itsTailPlan.read (buffer, start);
+    } else {
+      return itsPlan.read (buffer, start);
+    }
+  }
+
+  //_____________________________________________________________________________
+  //                                                                        start
+
+  /*!
+    \return status -- Status of the operation; returns \e false in case the
+            iterator is not set up for a valid dataset or the I/O thread could
+	    not be started.
+  */
+  bool HDF5BlockIterator::start ()
+  {
+    if (!isValid()) {
+      return false;
+    }
+
+    stop ();
+
+    itsNextRead    = 0;
+    itsNextConsume = 0;
+    itsFilled      = 0;
+    itsHolding     = false;
+    itsError       = false;
+    itsStop        = false;
+
+    if (pthread_create (&itsThread, NULL, HDF5BlockIterator::run, this) != 0) {
+      std::cerr << "[HDF5BlockIterator::start] Failed to start I/O thread!"
+		<< std::endl;
+      return false;
+    }
+
+    itsRunning = true;
+
+    return true;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                         stop
+
+  void HDF5BlockIterator::stop ()
+  {
+    if (itsRunning) {
+      pthread_mutex_lock (&itsMutex);
+      itsStop = true;
+      pthread_cond_broadcast (&itsCondition);
+      pthread_mutex_unlock (&itsMutex);
+
+      pthread_join (itsThread, NULL);
+      itsRunning = false;
+    }
+  }
+
+  //_____________________________________________________________________________
+  //                                                                         next
+
+  /*!
+    Hands the buffer of the previous block back to the I/O thread and waits
+    until the next block has been read.
+
+    \return block -- Pointer to the data of the next block, which remains valid
+            until the following call to next(); \c NULL once the end of the
+	    dataset has been reached or if an error was encountered while
+	    reading.
+  */
+  void const * HDF5BlockIterator::next ()
+  {
+    void const *block = NULL;
+
+    pthread_mutex_lock (&itsMutex);
+
+    /* Hand the previous buffer back to the I/O thread */
+    if (itsHolding) {
+      --itsFilled;
+      itsHolding = false;
+      pthread_cond_broadcast (&itsCondition);
+    }
+
+    if (itsRunning && itsNextConsume < itsNofBlocks) {
+      /* Wait for the I/O thread to provide the next block */
+      while (itsNextRead <= itsNextConsume && !itsError) {
+	pthread_cond_wait (&itsCondition, &itsMutex);
+      }
+
+      if (itsNextRead > itsNextConsume) {
+	block = itsBuffers + (itsNextConsume%itsNofBuffers)*itsBlocksize;
+	itsHolding = true;
+	++itsNextConsume;
+      }
+    }
+
+    pthread_mutex_unlock (&itsMutex);
+
+    return block;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                     prefetch
+
+  void HDF5BlockIterator::prefetch ()
+  {
+    hsize_t index;
+    bool stopping;
+    bool status;
+
+    while (true) {
+
+      /* Wait for a free buffer */
+      pthread_mutex_lock (&itsMutex);
+      while (itsFilled == itsNofBuffers && !itsStop) {
+	pthread_cond_wait (&itsCondition, &itsMutex);
+      }
+      index    = itsNextRead;
+      stopping = itsStop;
+      pthread_mutex_unlock (&itsMutex);
+
+      if (stopping || index >= itsNofBlocks) {
+	break;
+      }
+
+      /* Read the block into its buffer, without holding the lock of the
+	 ring, but holding the process-wide lock on the HDF5 library */
+      HDF5Lock::lock ();
+      status = readBlock (itsBuffers + (index%itsNofBuffers)*itsBlocksize, index);
+      HDF5Lock::unlock ();
+
+      /* Publish the block to the consumer */
+      pthread_mutex_lock (&itsMutex);
+      if (status) {
+	++itsNextRead;
+	++itsFilled;
+      } else {
+	std::cerr << "[HDF5BlockIterator::prefetch] Failed to read block "
+		  << index << "!" << std::endl;
+	itsError = true;
+      }
+      pthread_cond_broadcast (&itsCondition);
+      pthread_mutex_unlock (&itsMutex);
+
+      if (!status) {
+	break;
+      }
+    }
+  }
+
+  //_____________________________________________________________________________
+  //                                                                          run
+
+  /*!
+    \param iterator -- Pointer to the HDF5BlockIterator object, for which the
+           I/O thread is run.
+  */
+  void * HDF5BlockIterator::run (void *iterator)
+  {
+    static_cast<HDF5BlockIterator *>(iterator)->prefetch ();
+    return NULL;
+  }
+
+} // Namespace DAL -- end
@@ -0,0 +1,306 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#ifndef HDF5BLOCKITERATOR_H
+#define HDF5BLOCKITERATOR_H
+
+// Standard library header files
+#include <iostream>
+#include <string>
+#include <vector>
+#include <pthread.h>
+
+#include <core/HDF5IOPlan.h>
+#include <core/HDF5Lock.h>
+
+namespace DAL { // Namespace DAL -- begin
+
+  /*!
+    \class HDF5BlockIterator
+
+    \ingroup DAL
+    \ingroup core
+
+    \brief Iterate over the blocks of a dataset, prefetching on a background thread
+
+    \author agent
+
+    \date 2026/10/18
+
+    \test tHDF5BlockIterator.cc
+
+    <h3>Prerequisite</h3>
+
+    <ul type="square">
+      <li>DAL::HDF5Dataset
+      <li>DAL::HDF5IOPlan
+      <li>DAL::HDF5Lock
+    </ul>
+
+    <h3>Synopsis</h3>
+
+    When scanning through a large dataset (e.g. the time-series of a TBB dipole
+    or a BF Stokes dataset), processing of a block of data and reading the next
+    one alternate, such that the disk is idle while the CPU is busy and vice
+    versa. An HDF5BlockIterator splits the dataset into consecutive blocks
+    along one axis (the \e direction of the iteration) and reads them on a
+    separate I/O thread into a ring of buffers, staying ahead of the consumer
+    by up to <tt>nofBuffers-1</tt> blocks. HDF5BlockIterator::next hands out a
+    pointer to the next block as soon as it has been read; no copy of the data
+    is made. The pointer remains valid until the following call to next(),
+    at which point the buffer is handed back to the I/O thread.
+
+    Along the direction of iteration the dataset is covered completely: if its
+    length is not a multiple of the block length, the last block is shorter
+    (see HDF5BlockIterator::blockShape). Along all other axes the block starts
+    at position 0.
+
+    <b>Note:</b> unless the HDF5 library has been built thread-safe, it must
+    not be called concurrently from multiple threads. The iterator makes all
+    of its HDF5 calls -- on the I/O thread as well as during construction and
+    destruction -- holding the process-wide DAL::HDF5Lock. While the iterator
+    is running (i.e. between start() and reaching the end of the dataset or
+    stop()), any other HDF5 call made by the consumer (or by any other thread
+    of the process) must therefore be made holding an HDF5Lock as well. The
+    lock must not be held while calling next(), as waiting for the I/O thread
+    to provide the next block would then never end.
+
+    Iterators assembling their blocks from more than a single dataset (e.g.
+    DAL::TBB_BlockIterator) derive from this class: they use the protected
+    constructor, set up the ring through setupRing(), override readBlock() --
+    which is called on the I/O thread, holding the HDF5Lock -- and start the
+    I/O thread once they have been set up completely. As the I/O thread calls
+    into the derived object, the destructor of a derived class has to stop()
+    the thread before releasing any of its members.
+
+    <h3>Example(s)</h3>
+
+    <ol>
+      <li>Process the time-series of a TBB dipole dataset in blocks of 65536
+      samples, using triple buffering:
+      \code
+      DAL::TBB_DipoleDataset dipole (stationGroupID, "001002003");
+      DAL::HDF5BlockIterator it (dipole.locationID(),
+                                 std::vector<hsize_t> (1, 65536),
+                                 H5T_NATIVE_SHORT);
+      short const *block;
+
+      while ((block = it.next<short>())) {
+        process (block, it.nofDatapoints());
+      }
+      \endcode
+      <li>Iterate over a BF Stokes dataset [time,frequency] in blocks of 256
+      spectra:
+      \code
+      std::vector<hsize_t> block (2);
+      block[0] = 256;
+      block[1] = stokes.shape()[1];
+
+      DAL::HDF5BlockIterator it (stokes, block, H5T_NATIVE_FLOAT, 0, 3);
+      \endcode
+    </ol>
+
+  */
+  class HDF5BlockIterator {
+
+    //! Plan for reading a full block
+    HDF5IOPlan itsPlan;
+    //! Plan for reading the last (shorter) block
+    HDF5IOPlan itsTailPlan;
+    //! Axis along which the iteration proceeds
+    unsigned int itsAxis;
+    //! Length of a (full) block along the direction of the iteration
+    hsize_t itsBlockLength;
+    //! Number of blocks
+    hsize_t itsNofBlocks;
+    //! Size of a (full) block, [Bytes]
+    size_t itsBlocksize;
+    //! Number of buffers in the ring
+    unsigned int itsNofBuffers;
+    //! Memory for the ring of buffers
+    char *itsBuffers;
+    //! Number of the next block to be read by the I/O thread
+    hsize_t itsNextRead;
+    //! Number of the block handed out last to the consumer, plus one
+    hsize_t itsNextConsume;
+    //! Number of buffers currently holding data (incl. the one handed out)
+    unsigned int itsFilled;
+    //! Is the consumer holding a buffer handed out by next()?
+    bool itsHolding;
+    //! Error status of the I/O thread
+    bool itsError;
+    //! Request the I/O thread to stop
+    bool itsStop;
+    //! Is the I/O thread running?
+    bool itsRunning;
+    //! The I/O thread
+    pthread_t itsThread;
+    //! Lock protecting the state of the ring
+    pthread_mutex_t itsMutex;
+    //! Signal a change of the state of the ring
+    pthread_cond_t itsCondition;
+
+  public:
+
+    // === Construction =========================================================
+
+    //! Argumented constructor, for an iterator on a dataset identifier
+    HDF5BlockIterator (hid_t const &location,
+		       std::vector<hsize_t> const &block,
+		       hid_t const &memoryType,
+		       unsigned int const &axis=0,
+		       unsigned int const &nofBuffers=3);
+
+    //! Argumented constructor, for an iterator on an open dataset
+    HDF5BlockIterator (HDF5Dataset const &dataset,
+		       std::vector<hsize_t> const &block,
+		       hid_t const &memoryType,
+		       unsigned int const &axis=0,
+		       unsigned int const &nofBuffers=3);
+
+    // === Destruction ==========================================================
+
+    //! Destructor
+    virtual ~HDF5BlockIterator ();
+
+    // === Parameter access =====================================================
+
+    //! Is the iterator set up for a valid dataset?
+    inline bool isValid () const {
+      return itsBuffers != NULL;
+    }
+
+    //! Get the axis along which the iteration proceeds
+    inline unsigned int axis () const {
+      return itsAxis;
+    }
+
+    //! Get the number of blocks along the direction of the iteration
+    inline hsize_t nofBlocks () const {
+      return itsNofBlocks;
+    }
+
+    //! Get the number of buffers in the ring
+    inline unsigned int nofBuffers () const {
+      return itsNofBuffers;
+    }
+
+    //! Get the number of the block handed out last by next()
+    inline hsize_t index () const {
+      return itsNextConsume-1;
+    }
+
+    //! Get the shape of the block handed out last by next()
+    virtual std::vector<hsize_t> blockShape () const;
+
+    //! Get the number of elements in the block handed out last by next()
+    virtual hsize_t nofDatapoints () const;
+
+    //! Has an error been encountered while reading?
+    inline bool error () const {
+      return itsError;
+    }
+
+    /*!
+      \brief Get the name of the class
+
+      \return className -- The name of the class, HDF5BlockIterator.
+    */
+    inline std::string className () const {
+      return "HDF5BlockIterator";
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    inline void summary () {
+      summary (std::cout);
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    virtual void summary (std::ostream &os);
+
+    // === Methods ==============================================================
+
+    //! Start (or restart) prefetching from the first block
+    bool start ();
+
+    //! Stop the I/O thread
+    void stop ();
+
+    //! Get the next block
+    void const * next ();
+
+    //! Get the next block, as array of elements of type \c T
+    template <class T>
+      inline T const * next () {
+      return static_cast<T const *> (next());
+    }
+
+  protected:
+
+    //! Default constructor, for derived classes setting up the ring themselves
+    HDF5BlockIterator ();
+
+    //! Set up the ring of buffers
+    bool setupRing (hsize_t const &nofBlocks,
+		    size_t const &blocksize,
+		    unsigned int const &nofBuffers);
+
+    //! Is the block handed out last by next() the last block of the iteration?
+    inline bool lastBlock () const {
+      return itsNextConsume == itsNofBlocks;
+    }
+
+    //! Read block \c index into \c buffer; called on the I/O thread
+    virtual bool readBlock (void *buffer,
+			    hsize_t const &index);
+
+  private:
+
+    //! Initialize the state of the ring and of the I/O thread
+    void init ();
+
+    //! Set up the iterator
+    bool setup (hid_t const &location,
+		std::vector<hsize_t> const &block,
+		hid_t const &memoryType,
+		unsigned int const &axis,
+		unsigned int const &nofBuffers);
+
+    //! Offset of block \c index within the dataset
+    void offset (hsize_t *start,
+		 hsize_t const &index) const;
+
+    //! Main loop of the I/O thread
+    void prefetch ();
+
+    //! Entry point for the I/O thread
+    static void * run (void *iterator);
+
+    //! Copying is not supported, as the object owns a thread
+    HDF5BlockIterator (HDF5BlockIterator const &other);
+
+    //! Copying is not supported, as the object owns a thread
+    HDF5BlockIterator& operator= (HDF5BlockIterator const &other);
+
+  }; // Class HDF5BlockIterator -- end
+
+} // Namespace DAL -- end
+
+#endif /* HDF5BLOCKITERATOR_H */
@@ -19,6 +19,20 @@
  ***************************************************************************/
 
 #include <core/HDF5Dataset.h>
+#include <algorithm>
+#include <cmath>
+
+/* Direct chunk I/O is part of the core library as of release 1.10.3; before
+   only writing is available, through the high-level library. */
+#ifdef H5_VERSION_GE
+#if H5_VERSION_GE(1,10,3)
+#define DAL_HDF5_DIRECT_CHUNK_IO
+#endif
+#endif
+
+#ifndef DAL_HDF5_DIRECT_CHUNK_IO
+#include <hdf5_hl.h>
+#endif
 
 namespace DAL {
 
@@ -140,6 +154,29 @@ namespace DAL {
     HDF5Object::close (itsDataspace);
   }
   
+  // ============================================================================
+  //
+  //  Operators
+  //
+  // ============================================================================
+  
+  //_____________________________________________________________________________
+  //                                                                    operator=
+  
+  /*!
+    \param other -- Another HDF5Dataset object from which to make a copy.
+  */
+  HDF5Dataset& HDF5Dataset::operator= (HDF5Dataset const &other)
+  {
+    if (this != &other) {
+      HDF5Object::operator= (other);
+      HDF5Object::close (itsDatatype);
+      HDF5Object::close (itsDataspace);
+      copy (other);
+    }
+    return *this;
+  }
+  
   // ============================================================================
   //
   //  Parameter access
@@ -216,6 +253,13 @@ namespace DAL {
     itsShape.clear();
     itsChunking.clear();
     itsHyperslab.clear();
+
+    itsChunkCacheBytes      = 0;
+    itsChunkCacheSlots      = 0;
+    itsChunkCachePreemption = 0.75;
+    itsFilter.clear();
+    itsConversionPolicy     = WarnConversion;
+    itsConversionReported   = false;
   }
 
   //_____________________________________________________________________________
@@ -275,6 +319,10 @@ namespace DAL {
 	readParameters ();
 	// Retrieve the size of chunks for the raw data
 	status = getChunksize ();
+	// Assign the chunk cache, if requested
+	if (itsChunkCacheBytes > 0) {
+	  status = applyChunkCache ();
+	}
       } else {
 	std::cerr << "[HDF5Dataset::open] Error opening dataset "
 		  << name << std::endl;
@@ -518,9 +566,24 @@ namespace DAL {
 	// Set up the dataspace
 	itsDataspace = H5Screate_simple (rank, dims, maxdims);
 	// Create the dataset creation property list
-	hid_t creationProperties = H5Pcreate (H5P_DATASET_CREATE);
+	HDF5Handle creationProperties (H5Pcreate (H5P_DATASET_CREATE));
 	// Set the chunk size
-	h5error = H5Pset_chunk (creationProperties, rank, chunkdims);
+	h5error = H5Pset_chunk (creationProperties.id(), rank, chunkdims);
+	// Attach the filter pipeline
+	if (!itsFilter.empty()) {
+	  itsFilter.setFilters (creationProperties.id());
+	}
+	// Create the dataset access property list
+	HDF5Handle accessProps;
+	if (itsChunkCacheBytes > 0) {
+	  size_t chunkBytes = H5Tget_size (itsDatatype);
+	  for (int n(0); n<rank; ++n) {
+	    chunkBytes *= chunkdims[n];
+	  }
+	  accessProps.reset (accessProperties (itsChunkCacheBytes,
+					       itsChunkCacheSlots ? itsChunkCacheSlots : chunkCacheSlots (itsChunkCacheBytes, chunkBytes),
+					       itsChunkCachePreemption));
+	}
 	// Create the Dataset ...
 	datasetCreate = true;
 	datasetID     = H5Dcreate (location,
@@ -528,10 +591,9 @@ namespace DAL {
 				   itsDatatype,
 				   itsDataspace,
 				   H5P_DEFAULT,
-				   creationProperties,
-				   H5P_DEFAULT);
-	/* Release no longer required IDs */
-	H5Pclose (creationProperties);
+				   creationProperties.id(),
+				   accessProps.isValid() ? accessProps.id() : H5P_DEFAULT);
+	itsLayout     = H5D_CHUNKED;
       }
     }
     else if ( flags.flags() & IO_Mode::Truncate ) {
@@ -603,6 +665,11 @@ namespace DAL {
 	}
       }
     }
+
+    /* Retrieve the filter pipeline applied to the raw data */
+    itsFilter = HDF5Filter (propertyID);
+
+    H5Pclose (propertyID);
     
     return status;
   }
@@ -639,6 +706,131 @@ namespace DAL {
     return status;
   }
   
+  //_____________________________________________________________________________
+  //                                                                setChunkCache
+
+  /*!
+    \param nbytes  -- Total size of the raw data chunk cache, [Bytes]. The cache
+           should at least be able to hold all the chunks touched by a single
+	   selection, e.g. a complete row of chunks when reading a column.
+    \param nslots  -- Number of slots in the hash table of the chunk cache; if
+           set to 0, the number is derived from \c nbytes and the size of a
+	   single chunk (see HDF5Dataset::chunkCacheSlots).
+    \param w0      -- Preemption policy, within the range [0,1]; chunks which
+           have been completely read or written are preempted first for
+	   <tt>w0=1</tt>.
+    \return status -- Status of the operation; returns \e false in case an
+            error was encountered while re-opening the dataset.
+  */
+  bool HDF5Dataset::setChunkCache (size_t const &nbytes,
+				   size_t const &nslots,
+				   double const &w0)
+  {
+    itsChunkCacheBytes      = nbytes;
+    itsChunkCacheSlots      = nslots;
+    itsChunkCachePreemption = w0;
+
+    if (itsChunkCachePreemption < 0) {
+      itsChunkCachePreemption = 0;
+    } else if (itsChunkCachePreemption > 1) {
+      itsChunkCachePreemption = 1;
+    }
+
+    /* If the dataset already is open, the new settings need to be applied */
+    if (H5Iis_valid(itsLocation)) {
+      return applyChunkCache ();
+    } else {
+      return true;
+    }
+  }
+
+  //_____________________________________________________________________________
+  //                                                                   chunkCache
+
+  /*!
+    \retval nbytes -- Total size of the raw data chunk cache, [Bytes].
+    \retval nslots -- Number of slots in the hash table of the chunk cache.
+    \retval w0     -- Preemption policy.
+    \return status -- Status of the operation; returns \e false in case the
+            parameters could not be retrieved from the dataset.
+  */
+  bool HDF5Dataset::chunkCache (size_t &nbytes,
+				size_t &nslots,
+				double &w0)
+  {
+    bool status = true;
+
+    if (H5Iis_valid(itsLocation)) {
+      HDF5Handle accessProps (H5Dget_access_plist (itsLocation));
+      if (H5Pget_chunk_cache (accessProps.id(), &nslots, &nbytes, &w0) < 0) {
+	status = false;
+      }
+    } else {
+      nbytes = itsChunkCacheBytes;
+      nslots = itsChunkCacheSlots;
+      w0     = itsChunkCachePreemption;
+    }
+
+    return status;
+  }
+
+  //_____________________________________________________________________________
+  //                                                              applyChunkCache
+
+  /*!
+    As the chunk cache is a property of the dataset access property list, the
+    dataset is re-opened with the new settings.
+
+    \return status -- Status of the operation; returns \e false in case an
+            error was encountered.
+  */
+  bool HDF5Dataset::applyChunkCache ()
+  {
+    size_t nslots  = itsChunkCacheSlots;
+    ssize_t length = H5Iget_name (itsLocation, NULL, 0);
+
+    if (length <= 0) {
+      std::cerr << "[HDF5Dataset::applyChunkCache]"
+		<< " Failed to retrieve path of the dataset!"
+		<< std::endl;
+      return false;
+    }
+
+    /* Number of slots, if not provided, derived from the size of a chunk */
+    if (nslots == 0) {
+      size_t chunkBytes = H5Tget_size (itsDatatype);
+      for (unsigned int n(0); n<itsChunking.size(); ++n) {
+	chunkBytes *= itsChunking[n];
+      }
+      nslots = chunkCacheSlots (itsChunkCacheBytes, chunkBytes);
+    }
+
+    char *path        = new char [length+1];
+    H5Iget_name (itsLocation, path, length+1);
+    hid_t fileID      = H5Iget_file_id (itsLocation);
+    hid_t accessProps = accessProperties (itsChunkCacheBytes,
+					  nslots,
+					  itsChunkCachePreemption);
+
+    /* The library keeps a single cache per open dataset, configured when the
+       dataset first is opened; hence the old identifier is released first. */
+    HDF5Object::close (itsLocation);
+    itsLocation = H5Dopen (fileID, path, accessProps);
+
+    H5Pclose (accessProps);
+    H5Fclose (fileID);
+    delete [] path;
+
+    if (H5Iis_valid(itsLocation)) {
+      return true;
+    } else {
+      std::cerr << "[HDF5Dataset::applyChunkCache]"
+		<< " Failed to re-open dataset " << itsName
+		<< std::endl;
+      return false;
+    }
+  }
+
   //_____________________________________________________________________________
   //                                                                nofDatapoints
   
@@ -684,7 +876,7 @@ namespace DAL {
 	
 	switch (slab.selection()) {
 	case H5S_SELECT_SET:
-	  itsHyperslab.empty();
+	  itsHyperslab.clear();
 	  itsHyperslab.push_back(slab);
 	  break;
 	default:
@@ -761,113 +953,255 @@ namespace DAL {
   }
 
   //_____________________________________________________________________________
-  //                                                                     readData
-  
-  /// @cond TEMPLATE_SPECIALIZATIONS
-  
-  //! Read data of type \c bool (H5T_NATIVE_HBOOL)
-  template <> bool HDF5Dataset::readData (bool data[],
-					  HDF5Hyperslab &slab)
-  {
-    return readData (data, slab, H5T_NATIVE_HBOOL);
-  }
-  
-  //! Read data of type \c int (H5T_NATIVE_INT)
-  template <> bool HDF5Dataset::readData (int data[],
-					  HDF5Hyperslab &slab)
-  {
-    return readData (data, slab, H5T_NATIVE_INT);
-  }
-  
-  //! Read data of type \c uint (H5T_NATIVE_UINT)
-  template <> bool HDF5Dataset::readData (uint data[],
-					  HDF5Hyperslab &slab)
-  {
-    return readData (data, slab, H5T_NATIVE_UINT);
-  }
-  
-  //! Read data of type \c short (H5T_NATIVE_SHORT)
-  template <> bool HDF5Dataset::readData (short data[],
-					  HDF5Hyperslab &slab)
-  {
-    return readData (data, slab, H5T_NATIVE_SHORT);
-  }
-  
-  template <> bool HDF5Dataset::readData (long data[],
-					  HDF5Hyperslab &slab)
-  {
-    return readData (data, slab, H5T_NATIVE_LONG);
-  }
-  
-  template <> bool HDF5Dataset::readData (long long data[],
-					  HDF5Hyperslab &slab)
-  {
-    return readData (data, slab, H5T_NATIVE_LLONG);
-  }
-  
-  template <> bool HDF5Dataset::readData (float data[],
-					  HDF5Hyperslab &slab)
-  {
-    return readData (data, slab, H5T_NATIVE_FLOAT);
-  }
-  
-  template <> bool HDF5Dataset::readData (double data[],
-					  HDF5Hyperslab &slab)
+  //                                                              checkConversion
+
+  /*!
+    \param memoryType -- Datatype of the elements in memory.
+
+    \return status -- Returns \e false if a transfer between the dataset and
+            memory requires a conversion of the datatype and the conversion
+	    policy is set to HDF5Dataset::RejectConversion.
+  */
+  bool HDF5Dataset::checkConversion (hid_t const &memoryType)
   {
-    return readData (data, slab, H5T_NATIVE_DOUBLE);
+    if (itsConversionPolicy == AllowConversion || !H5Iis_valid(itsDatatype)) {
+      return true;
+    }
+
+    if (!HDF5Datatype::requiresConversion (itsDatatype, memoryType)) {
+      return true;
+    }
+
+    if (itsConversionPolicy == RejectConversion) {
+      std::cerr << "[HDF5Dataset::checkConversion]"
+		<< " Access to dataset " << itsName << " requires conversion"
+		<< " of the datatype - rejected!"
+		<< std::endl;
+      return false;
+    }
+
+    if (!itsConversionReported) {
+      std::cerr << "[HDF5Dataset::checkConversion]"
+		<< " Access to dataset " << itsName << " requires conversion"
+		<< " from " << H5Tget_size(itsDatatype) << " to "
+		<< H5Tget_size(memoryType) << " byte elements."
+		<< std::endl;
+      itsConversionReported = true;
+    }
+
+    return true;
   }
-  
-  /// @endcond
-  
+
   //_____________________________________________________________________________
-  //                                                                    writeData
-  
-  /// @cond TEMPLATE_SPECIALIZATIONS
-  
-  template <> bool HDF5Dataset::writeData (int const data[],
-					  HDF5Hyperslab &slab)
-  {
-    return writeData (data, slab, H5T_NATIVE_INT);
-  }
-  
-  template <> bool HDF5Dataset::writeData (uint const data[],
-					   HDF5Hyperslab &slab)
-  {
-    return writeData (data, slab, H5T_NATIVE_UINT);
-  }
-  
-  template <> bool HDF5Dataset::writeData (short const data[],
-					  HDF5Hyperslab &slab)
-  {
-    return writeData (data, slab, H5T_NATIVE_SHORT);
-  }
-  
-  template <> bool HDF5Dataset::writeData (long const data[],
-					  HDF5Hyperslab &slab)
+  //                                                                isChunkOrigin
+
+  /*!
+    \param offset  -- Logical position within the dataset.
+
+    \return status -- Returns \e true if the dataset is chunked and \c offset
+            is the position of the first element of one of its chunks.
+  */
+  bool HDF5Dataset::isChunkOrigin (std::vector<hsize_t> const &offset)
   {
-    return writeData (data, slab, H5T_NATIVE_LONG);
+    if (itsLayout != H5D_CHUNKED || itsChunking.empty()) {
+      std::cerr << "[HDF5Dataset::isChunkOrigin]"
+		<< " Dataset " << itsName << " does not have chunked layout!"
+		<< std::endl;
+      return false;
+    }
+
+    if (offset.size() != itsChunking.size()) {
+      std::cerr << "[HDF5Dataset::isChunkOrigin]"
+		<< " Rank of offset does not match rank of dataset!"
+		<< std::endl;
+      return false;
+    }
+
+    for (unsigned int n(0); n<offset.size(); ++n) {
+      if (offset[n]%itsChunking[n] != 0) {
+	std::cerr << "[HDF5Dataset::isChunkOrigin]"
+		  << " Offset " << offset << " not aligned with chunk boundaries "
+		  << itsChunking << "!"
+		  << std::endl;
+	return false;
+      }
+    }
+
+    return true;
   }
-  
-  template <> bool HDF5Dataset::writeData (long long const data[],
-					  HDF5Hyperslab &slab)
+
+  //_____________________________________________________________________________
+  //                                                                   writeChunk
+
+  /*!
+    \param data       -- Raw bytes of the chunk, in the layout in which they are
+           stored in the file, i.e. already passed through the filters of the
+	   pipeline not masked by \c filterMask.
+    \param nbytes     -- Number of bytes in \c data.
+    \param offset     -- Logical position of the first element of the chunk;
+           must be aligned with the chunk boundaries. If the chunk starts beyond
+	   the current shape of the dataset, the dataset is extended by the
+	   chunk, as far as its maximum shape allows.
+    \param filterMask -- Mask of the stages of the filter pipeline which have
+           \e not been applied to the data; bit \e i refers to stage \e i.
+
+    \return status    -- Status of the operation; returns \e false in case an
+            error was encountered.
+  */
+  bool HDF5Dataset::writeChunk (void const *data,
+				size_t const &nbytes,
+				std::vector<hsize_t> const &offset,
+				uint32_t const &filterMask)
   {
-    return writeData (data, slab, H5T_NATIVE_LLONG);
+    if (!isChunkOrigin (offset)) {
+      return false;
+    }
+
+    /* Extend the dataset, if the chunk starts beyond its current shape; the
+       partial chunk at the edge of the dataset is written in place */
+
+    unsigned int rank = offset.size();
+    bool extend (false);
+    std::vector<hsize_t> shape (rank);
+    std::vector<hsize_t> maxdims (rank);
+
+    HDF5Object::close (itsDataspace);
+    itsDataspace = H5Dget_space (itsLocation);
+
+    if (H5Sget_simple_extent_dims (itsDataspace, &shape[0], &maxdims[0]) < 0) {
+      std::cerr << "[HDF5Dataset::writeChunk] Failed to get shape of dataset "
+		<< itsName << std::endl;
+      return false;
+    }
+    itsShape = shape;
+
+    for (unsigned int n(0); n<rank; ++n) {
+      if (offset[n] >= shape[n]) {
+	if (maxdims[n] != H5S_UNLIMITED && offset[n] >= maxdims[n]) {
+	  std::cerr << "[HDF5Dataset::writeChunk] Chunk at " << offset
+		    << " exceeds the maximum shape " << maxdims
+		    << " of dataset " << itsName << std::endl;
+	  return false;
+	}
+	shape[n] = offset[n]+itsChunking[n];
+	if (maxdims[n] != H5S_UNLIMITED) {
+	  shape[n] = std::min (shape[n], maxdims[n]);
+	}
+	extend   = true;
+      }
+    }
+
+    if (extend) {
+      if (H5Dset_extent (itsLocation, &shape[0]) < 0) {
+	std::cerr << "[HDF5Dataset::writeChunk] Failed to extend dataset "
+		  << itsName << " to shape " << shape << std::endl;
+	return false;
+      }
+      HDF5Object::close (itsDataspace);
+      itsDataspace = H5Dget_space (itsLocation);
+      itsShape     = shape;
+    }
+
+    /* Write the chunk */
+
+    herr_t h5error;
+
+#ifdef DAL_HDF5_DIRECT_CHUNK_IO
+    h5error = H5Dwrite_chunk (itsLocation,
+			      H5P_DEFAULT,
+			      filterMask,
+			      &offset[0],
+			      nbytes,
+			      data);
+#else
+    h5error = H5DOwrite_chunk (itsLocation,
+			       H5P_DEFAULT,
+			       filterMask,
+			       const_cast<hsize_t *>(&offset[0]),
+			       nbytes,
+			       data);
+#endif
+
+    if (h5error < 0) {
+      std::cerr << "[HDF5Dataset::writeChunk] Failed to write chunk at "
+		<< offset << std::endl;
+      return false;
+    }
+
+    return true;
   }
-  
-  template <> bool HDF5Dataset::writeData (float const data[],
-					  HDF5Hyperslab &slab)
+
+  //_____________________________________________________________________________
+  //                                                                    readChunk
+
+  /*!
+    \retval data       -- Raw bytes of the chunk, as stored in the file; must
+             provide space for (at least) chunkStorageSize(offset) bytes.
+    \param offset      -- Logical position of the first element of the chunk;
+            must be aligned with the chunk boundaries.
+    \retval filterMask -- Mask of the stages of the filter pipeline which have
+             \e not been applied to the data.
+
+    \return status     -- Status of the operation; returns \e false in case an
+             error was encountered, e.g. if the chunk has not been written yet.
+  */
+  bool HDF5Dataset::readChunk (void *data,
+			       std::vector<hsize_t> const &offset,
+			       uint32_t &filterMask)
   {
-    return writeData (data, slab, H5T_NATIVE_FLOAT);
+    if (!isChunkOrigin (offset)) {
+      return false;
+    }
+
+#ifdef DAL_HDF5_DIRECT_CHUNK_IO
+    if (H5Dread_chunk (itsLocation,
+		       H5P_DEFAULT,
+		       &offset[0],
+		       &filterMask,
+		       data) < 0) {
+      std::cerr << "[HDF5Dataset::readChunk] Failed to read chunk at "
+		<< offset << std::endl;
+      return false;
+    }
+    return true;
+#else
+    std::cerr << "[HDF5Dataset::readChunk]"
+	      << " Direct chunk read requires HDF5 1.10.3 or later!"
+	      << std::endl;
+    return false;
+#endif
   }
-  
-  template <> bool HDF5Dataset::writeData (double const data[],
-					  HDF5Hyperslab &slab)
+
+  //_____________________________________________________________________________
+  //                                                             chunkStorageSize
+
+  /*!
+    \param offset -- Logical position of the first element of the chunk; must
+           be aligned with the chunk boundaries.
+
+    \return nbytes -- Size of the chunk as stored in the file, i.e. after
+            passing through the filter pipeline; returns 0 if the chunk has not
+	    been written yet or in case of an error.
+  */
+  hsize_t HDF5Dataset::chunkStorageSize (std::vector<hsize_t> const &offset)
   {
-    return writeData (data, slab, H5T_NATIVE_DOUBLE);
+    hsize_t nbytes (0);
+
+    if (!isChunkOrigin (offset)) {
+      return nbytes;
+    }
+
+#ifdef DAL_HDF5_DIRECT_CHUNK_IO
+    H5E_BEGIN_TRY {
+      if (H5Dget_chunk_storage_size (itsLocation, &offset[0], &nbytes) < 0) {
+	nbytes = 0;
+      }
+    } H5E_END_TRY;
+#endif
+
+    return nbytes;
   }
-  
-  /// @endcond
-  
+
   //_____________________________________________________________________________
   //                                                                      summary
   
@@ -887,6 +1221,8 @@ namespace DAL {
     os << "-- Chunk size             = " << itsChunking         << std::endl;
     os << "-- nof. datapoints        = " << nofDatapoints()     << std::endl;
     os << "-- nof. active hyperslabs = " << itsHyperslab.size() << std::endl;
+    os << "-- Chunk cache [Bytes]    = " << itsChunkCacheBytes  << std::endl;
+    os << "-- Filter pipeline        = " << itsFilter.names()   << std::endl;
   }
   
   // ============================================================================
@@ -912,6 +1248,163 @@ namespace DAL {
     }
   }
 
+  //_____________________________________________________________________________
+  //                                                                   chunkShape
+
+  /*!
+    \param shape       -- Shape of the dataset; axes of length 0 (e.g. of a
+           dataset which is yet to be extended) are treated as unlimited.
+    \param elementSize -- Size of a single element of the dataset, [Bytes].
+    \param pattern     -- Expected pattern by which the data will be accessed:
+           <ul>
+             <li>\e TimeSeries -- the chunk first is extended along the first
+	     axis (time), only then along the following ones.
+	     <li>\e SpectralSlice -- the chunk first is extended along the last
+	     axis (frequency), working back towards the first one.
+	     <li>\e Tile -- the chunk gets approximately the same extent along
+	     all axes; axes shorter than that are covered completely.
+	   </ul>
+    \param targetBytes -- Size of a chunk to aim for, [Bytes].
+    \return chunk      -- Shape of the chunks; each element is within the
+            range <tt>[1,shape[n]]</tt>.
+  */
+  std::vector<hsize_t> HDF5Dataset::chunkShape (std::vector<hsize_t> const &shape,
+						size_t const &elementSize,
+						AccessPattern const &pattern,
+						size_t const &targetBytes)
+  {
+    unsigned int rank = shape.size();
+    std::vector<hsize_t> chunk (rank,1);
+    std::vector<hsize_t> extent (rank);
+    uint64_t budget = targetBytes/(elementSize>0 ? elementSize : 1);
+
+    if (rank == 0) {
+      return chunk;
+    }
+
+    /* Chunks cannot be larger than can be represented in 32-bits */
+    if (budget*elementSize > (uint64_t)H5S_CHUNKSIZE_MAX) {
+      budget = (uint64_t)H5S_CHUNKSIZE_MAX/(elementSize>0 ? elementSize : 1);
+    }
+    if (budget < 1) {
+      budget = 1;
+    }
+
+    for (unsigned int n(0); n<rank; ++n) {
+      extent[n] = shape[n]>0 ? shape[n] : (hsize_t)(-1);
+    }
+
+    switch (pattern) {
+    case TimeSeries:
+      for (unsigned int n(0); n<rank && budget>1; ++n) {
+	chunk[n] = extent[n]<budget ? extent[n] : budget;
+	budget  /= chunk[n];
+      }
+      break;
+    case SpectralSlice:
+      for (int n(rank-1); n>=0 && budget>1; --n) {
+	chunk[n] = extent[n]<budget ? extent[n] : budget;
+	budget  /= chunk[n];
+      }
+      break;
+    case Tile:
+      {
+	std::vector<bool> complete (rank,false);
+	unsigned int nofFree = rank;
+	bool changed         = true;
+	double side          = 1;
+	/* Axes shorter than the edge length of the tile are taken completely;
+	   the remaining budget is shared among the other axes. */
+	while (changed && nofFree>0) {
+	  changed = false;
+	  side    = pow (double(budget), 1.0/nofFree);
+	  for (unsigned int n(0); n<rank; ++n) {
+	    if (!complete[n] && double(extent[n]) <= side) {
+	      chunk[n]    = extent[n];
+	      complete[n] = true;
+	      budget     /= extent[n];
+	      --nofFree;
+	      changed     = true;
+	    }
+	  }
+	}
+	for (unsigned int n(0); n<rank; ++n) {
+	  if (!complete[n]) {
+	    chunk[n] = side>1 ? (hsize_t)(side) : 1;
+	  }
+	}
+      }
+      break;
+    };
+
+    return chunk;
+  }
+
+  //_____________________________________________________________________________
+  //                                                              chunkCacheSlots
+
+  /*!
+    Following the recommendations for the HDF5 library, the number of slots
+    should be a prime number, about 100 times the number of chunks fitting into
+    the cache, in order to minimize the number of hash collisions.
+
+    \param nbytes     -- Total size of the raw data chunk cache, [Bytes].
+    \param chunkBytes -- Size of a single chunk, [Bytes].
+    \return nslots    -- Number of slots in the hash table, at least 521 (the
+            default value of the HDF5 library).
+  */
+  size_t HDF5Dataset::chunkCacheSlots (size_t const &nbytes,
+				       size_t const &chunkBytes)
+  {
+    size_t nslots = 521;
+    size_t nchunks = chunkBytes>0 ? nbytes/chunkBytes : 0;
+
+    if (100*nchunks > nslots) {
+      nslots = 100*nchunks;
+    }
+
+    /* Move on to the next prime number */
+    while (true) {
+      bool isPrime = true;
+      for (size_t n=2; n*n<=nslots; ++n) {
+	if (nslots%n == 0) {
+	  isPrime = false;
+	  break;
+	}
+      }
+      if (isPrime) {
+	return nslots;
+      }
+      ++nslots;
+    }
+  }
+
+  //_____________________________________________________________________________
+  //                                                             accessProperties
+
+  /*!
+    \param nbytes -- Total size of the raw data chunk cache, [Bytes].
+    \param nslots -- Number of slots in the hash table of the chunk cache.
+    \param w0     -- Preemption policy.
+    \return plist -- Identifier of the dataset access property list, to be
+            used with \c H5Dopen or \c H5Dcreate; the identifier needs to be
+	    released with \c H5Pclose once no longer needed.
+  */
+  hid_t HDF5Dataset::accessProperties (size_t const &nbytes,
+				       size_t const &nslots,
+				       double const &w0)
+  {
+    hid_t plist = H5Pcreate (H5P_DATASET_ACCESS);
+
+    if (H5Pset_chunk_cache (plist, nslots, nbytes, w0) < 0) {
+      std::cerr << "[HDF5Dataset::accessProperties]"
+		<< " Failed to set chunk cache parameters!"
+		<< std::endl;
+    }
+
+    return plist;
+  }
+
   // ============================================================================
   //
   //  Private functions
@@ -937,6 +1430,21 @@ namespace DAL {
     itsShape       = other.itsShape;
     itsChunking    = other.itsChunking;
     itsHyperslab   = other.itsHyperslab;
+
+    itsChunkCacheBytes      = other.itsChunkCacheBytes;
+    itsChunkCacheSlots      = other.itsChunkCacheSlots;
+    itsChunkCachePreemption = other.itsChunkCachePreemption;
+    itsFilter               = other.itsFilter;
+    itsConversionPolicy     = other.itsConversionPolicy;
+    itsConversionReported   = other.itsConversionReported;
+
+    /* Both objects share the dataspace and datatype identifiers */
+    if (H5Iis_valid(itsDataspace)) {
+      H5Iinc_ref (itsDataspace);
+    }
+    if (H5Iis_valid(itsDatatype)) {
+      H5Iinc_ref (itsDatatype);
+    }
   }
 
   //_____________________________________________________________________________
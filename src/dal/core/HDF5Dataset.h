@@ -29,6 +29,9 @@
 #include <core/HDF5Attribute.h>
 #include <core/HDF5Object.h>
 #include <core/HDF5Hyperslab.h>
+#include <core/HDF5Filter.h>
+#include <core/HDF5Handle.h>
+#include <core/HDF5TypeTraits.h>
 
 #define H5S_CHUNKSIZE_MAX ((uint32_t)(-1))  /* (4GB - 1) */
 
@@ -56,6 +59,7 @@ namespace DAL {
     <h3>Prerequisite</h3>
 
     <ul type="square">
+      <li>DAL::HDF5Filter
       <li>DAL::HDF5Hyperslab
       <li>DAL::HDF5Object
     </ul>
@@ -168,7 +172,23 @@ namespace DAL {
       \code
       herr_t H5Pset_chunk_cache (hid_t dapl_id, size_t rdcc_nslots, size_t rdcc_nbytes, double rdcc_w0)
       \endcode
+      The chunk cache is a property of the dataset access property list, i.e.
+      it only can be assigned when opening the dataset; HDF5Dataset::setChunkCache
+      therefore re-opens the dataset, if it already is open. By default the
+      library reserves 1 MB per dataset, which will be insufficient as soon as
+      a selection is spread across multiple chunks (e.g. reading a column of
+      a 2-dimensional array chunked by rows).
     </ul>
+
+    <h3>Chunking</h3>
+
+    The shape of the chunks should be chosen according to the way the data
+    later on will be accessed: ideally a selection is covered by as few chunks
+    as possible, while a single chunk does not carry along a lot of data outside
+    the selection. HDF5Dataset::chunkShape derives the chunk dimensions from the
+    shape of the dataset, the size of a single element and the expected
+    HDF5Dataset::AccessPattern, aiming for chunks of a given size in bytes (by
+    default 1 MB); the first axis is taken to be the time axis.
       
     <table border=0>
       <tr align=center>
@@ -245,11 +265,69 @@ namespace DAL {
       \endcode
       For further background information on how to define hyperslabs to select
       regions within a dataset, consult the documentation for DAL::HDF5Hyperslab.
+
+      <li>Create a dataset for a dynamic spectrum, which later on will be read
+      channel by channel, and reserve 64 MB of chunk cache for it:
+      \code
+      std::vector<hsize_t> shape (2);
+      shape[0] = 100000;   // time
+      shape[1] = 4096;     // frequency
+
+      std::vector<hsize_t> chunk = DAL::HDF5Dataset::chunkShape (shape,
+                                                                 sizeof(float),
+								 DAL::HDF5Dataset::TimeSeries);
+
+      DAL::HDF5Dataset dataset;
+      dataset.setChunkCache (64*1024*1024);
+      dataset.open (fileID, "Spectrum", shape, chunk, H5T_NATIVE_FLOAT);
+      \endcode
+
+      <li>Create a dataset for TBB time-series data, compressed using the
+      shuffle and deflate filters:
+      \code
+      DAL::HDF5Dataset dataset;
+      dataset.setFilter (DAL::HDF5Filter::shuffleDeflate (4));
+      dataset.open (fileID, "Timeseries", shape, chunk, H5T_NATIVE_SHORT);
+      \endcode
+
+      <li>Write TBB frames, which already have been assembled into complete
+      chunks (and possibly compressed outside of the library), directly to
+      disk; the chunk is stored as-is, i.e. without any type conversion or
+      passing through the filter pipeline:
+      \code
+      std::vector<hsize_t> offset (1, n*chunk[0]);
+      dataset.writeChunk (buffer, nbytes, offset);
+      \endcode
+      A \e filterMask with bit \e i set marks stage \e i of the filter
+      pipeline as not applied to the chunk; when reading the chunk back via
+      HDF5Dataset::readChunk the raw bytes are returned along with the mask.
     </ol>
     
   */
   class HDF5Dataset : public HDF5Object {
 
+  public:
+
+    //! Expected pattern by which the data of the dataset will be accessed
+    enum AccessPattern {
+      //! Long stretches along the first (time) axis, e.g. a single dipole or channel
+      TimeSeries,
+      //! Complete extent of the trailing (frequency) axes for a short range in time
+      SpectralSlice,
+      //! Sub-arrays of comparable extent along all axes
+      Tile
+    };
+
+    //! Handling of reads/writes which require conversion of the datatype
+    enum ConversionPolicy {
+      //! Let the library convert the elements silently
+      AllowConversion,
+      //! Convert, but report once per dataset that a conversion takes place
+      WarnConversion,
+      //! Refuse reads/writes which would require a conversion
+      RejectConversion
+    };
+
   protected:
 
     //! Name of the dataset
@@ -266,6 +344,18 @@ namespace DAL {
     std::vector<hsize_t> itsChunking;
     //! Hyperslabs for the dataspace attached to the dataset
     std::vector<DAL::HDF5Hyperslab> itsHyperslab;
+    //! Size of the raw data chunk cache, [Bytes]; 0 to use the file's default
+    size_t itsChunkCacheBytes;
+    //! Number of slots in the hash table of the raw data chunk cache
+    size_t itsChunkCacheSlots;
+    //! Preemption policy of the raw data chunk cache
+    double itsChunkCachePreemption;
+    //! Filter pipeline applied to the raw data
+    HDF5Filter itsFilter;
+    //! Handling of reads/writes which require conversion of the datatype
+    ConversionPolicy itsConversionPolicy;
+    //! Has a conversion of the datatype been reported already?
+    bool itsConversionReported;
 
   public:
     
@@ -301,6 +391,11 @@ namespace DAL {
     
     // Destructor
     virtual ~HDF5Dataset ();
+
+    // === Operators ============================================================
+
+    //! Overloading of the copy operator
+    HDF5Dataset& operator= (HDF5Dataset const &other);
     
     // === Parameter access =====================================================
     
@@ -399,6 +494,54 @@ namespace DAL {
       return offset (itsLocation);
     }
 
+    // === Chunk cache ==========================================================
+
+    //! Set the parameters of the raw data chunk cache
+    bool setChunkCache (size_t const &nbytes,
+			size_t const &nslots=0,
+			double const &w0=0.75);
+
+    //! Get the parameters of the raw data chunk cache
+    bool chunkCache (size_t &nbytes,
+		     size_t &nslots,
+		     double &w0);
+
+    // === Filter pipeline ======================================================
+
+    /*!
+      \brief Set the filter pipeline applied when creating the dataset
+      \param filter -- Filter pipeline; only is taken into account when a new
+             dataset is created, since filters cannot be attached afterwards.
+    */
+    inline void setFilter (HDF5Filter const &filter) {
+      itsFilter = filter;
+    }
+
+    //! Get the filter pipeline applied to the raw data of the dataset
+    inline HDF5Filter filter () const {
+      return itsFilter;
+    }
+
+    // === Datatype conversion ==================================================
+
+    //! Set the handling of reads/writes which require conversion of the datatype
+    inline void setConversionPolicy (ConversionPolicy const &policy) {
+      itsConversionPolicy   = policy;
+      itsConversionReported = false;
+    }
+
+    //! Get the handling of reads/writes which require conversion of the datatype
+    inline ConversionPolicy conversionPolicy () const {
+      return itsConversionPolicy;
+    }
+
+    //! Does transfer of elements of type \c T require a conversion?
+    template <class T>
+      inline bool requiresConversion () const {
+      return HDF5Datatype::requiresConversion (itsDatatype,
+					       HDF5TypeTraits<T>::type());
+    }
+
     // === Create/set attributes ================================================
 
     //! Read value of attribute attached to dataset
@@ -441,10 +584,16 @@ namespace DAL {
       \param slab    -- Hyberslab defining a selection of the data.
       \return status -- Status of the operation; returns \e false in case an
               error was encountered.
+
+      The datatype of the elements in memory is derived from \c T by means of
+      HDF5TypeTraits.
     */
     template <class T>
-      bool readData (T data[],
-		     HDF5Hyperslab &slab);
+      inline bool readData (T data[],
+			    HDF5Hyperslab &slab)
+      {
+	return readData (data, slab, HDF5TypeTraits<T>::type());
+      }
 
     /*!
       \brief Read the data
@@ -513,10 +662,16 @@ namespace DAL {
       \param slab    -- Hyberslab defining a selection of the data.
       \return status -- Status of the operation; returns \e false in case an
               error was encountered.
+
+      The datatype of the elements in memory is derived from \c T by means of
+      HDF5TypeTraits.
     */
     template <class T>
-      bool writeData (T const data[],
-		      HDF5Hyperslab &slab);
+      inline bool writeData (T const data[],
+			     HDF5Hyperslab &slab)
+      {
+	return writeData (data, slab, HDF5TypeTraits<T>::type());
+      }
     
     /*!
       \brief Write the data
@@ -582,11 +737,58 @@ namespace DAL {
 			  block);
       }
 
+    // === Direct chunk I/O =====================================================
+
+    //! Write a chunk of raw data, bypassing selection, conversion and filters
+    bool writeChunk (void const *data,
+		     size_t const &nbytes,
+		     std::vector<hsize_t> const &offset,
+		     uint32_t const &filterMask=0);
+
+    //! Read a chunk of raw data, bypassing selection, conversion and filters
+    bool readChunk (void *data,
+		    std::vector<hsize_t> const &offset,
+		    uint32_t &filterMask);
+
+    /*!
+      \brief Read a chunk of raw data, bypassing selection, conversion and filters
+      \retval data       -- Raw bytes of the chunk, as stored in the file;
+              resized to the storage size of the chunk.
+      \param offset      -- Logical position of the first element of the chunk.
+      \retval filterMask -- Mask of the filters skipped when the chunk was written.
+      \return status     -- Status of the operation; returns \e false in case an
+              error was encountered.
+    */
+    inline bool readChunk (std::vector<char> &data,
+			   std::vector<hsize_t> const &offset,
+			   uint32_t &filterMask) {
+      data.resize (chunkStorageSize (offset));
+      return data.empty() ? false : readChunk (&data[0], offset, filterMask);
+    }
+
+    //! Get the size of a chunk as stored in the file, [Bytes]
+    hsize_t chunkStorageSize (std::vector<hsize_t> const &offset);
+
     // === Static methods =======================================================
     
     //! Returns the address in the file of the dataset \c location.
     static haddr_t offset (hid_t const &location);
 
+    //! Get the shape of the chunks, matching a given pattern of access
+    static std::vector<hsize_t> chunkShape (std::vector<hsize_t> const &shape,
+					    size_t const &elementSize,
+					    AccessPattern const &pattern=HDF5Dataset::Tile,
+					    size_t const &targetBytes=1048576);
+
+    //! Get the number of hash table slots for a raw data chunk cache
+    static size_t chunkCacheSlots (size_t const &nbytes,
+				   size_t const &chunkBytes);
+
+    //! Create dataset access property list with the chunk cache parameters
+    static hid_t accessProperties (size_t const &nbytes,
+				   size_t const &nslots,
+				   double const &w0=0.75);
+
   private:
     
     //! Initialize the internal parameters
@@ -602,6 +804,12 @@ namespace DAL {
     bool adjustChunksize ();
     //! Retrieve the size of chunks for the raw data of a chunked layout dataset. 
     bool getChunksize ();
+    //! Re-open the dataset to apply the chunk cache parameters
+    bool applyChunkCache ();
+    //! Check the memory datatype against the conversion policy
+    bool checkConversion (hid_t const &memoryType);
+    //! Check whether a position is the origin of a chunk of the dataset
+    bool isChunkOrigin (std::vector<hsize_t> const &offset);
     //! Select a hyperslab for the dataspace attached to the dataset
     bool setHyperslab (HDF5Hyperslab &slab,
 		       bool const &resizeDataset);
@@ -628,6 +836,11 @@ namespace DAL {
       {
 	bool status (true);
 	
+	/* Check whether the library would have to convert the data */
+	if (!checkConversion (datatype)) {
+	  return false;
+	}
+
 	/* Set the Hyperslab for the dataspace attached to a dataset */
 	status = setHyperslab (slab, false);
 	
@@ -635,27 +848,25 @@ namespace DAL {
 	  /* Local variables */
 	  herr_t h5error          = 0;
 	  unsigned int nelem      = rank();
-	  hsize_t * dimensions    = new hsize_t[nelem];
-	  std::vector<int> stride = slab.stride();
+	  hsize_t dimensions[H5S_MAX_RANK];
 	  std::vector<int> block  = slab.block();
 	  /* Setup the memory space */
 	  for (unsigned int n=0; n<nelem; ++n) {
 	    dimensions[n] = block[n];
 	  }
-	  hid_t memorySpace = H5Screate_simple (nelem,
-						dimensions,
-						NULL);
+	  HDF5Handle memorySpace (H5Screate_simple (nelem,
+						    dimensions,
+						    NULL));
 	  /* Read the data from the dataset */
 	  h5error = H5Dread (itsLocation,
 			     datatype,
-			     memorySpace,
+			     memorySpace.id(),
 			     itsDataspace,
 			     H5P_DEFAULT,
 			     data);
-	  /* Release allocated memory */
-	  delete [] dimensions;
-	  /* Release HDF5 object identifier */
-	  HDF5Object::close (memorySpace);
+	  if (h5error < 0) {
+	    status = false;
+	  }
 	} else {
 	  std::cerr << "[HDF5Dataset::readData] Failed to properly set up Hyperslab!"
 		    << std::endl;
@@ -680,6 +891,12 @@ namespace DAL {
       {
 	bool status = true;
 
+	// Check whether the library would have to convert the data
+
+	if (!checkConversion (datatype)) {
+	  return false;
+	}
+
 	// Set the Hyperslab selection _____________________
 
 	status = setHyperslab (slab, true);
@@ -728,23 +945,21 @@ namespace DAL {
 	    }
 	  }
 
-	  hid_t memspace = H5Screate_simple (nelem,
-					     dims,
-					     dims);
+	  HDF5Handle memspace (H5Screate_simple (nelem,
+						 dims,
+						 dims));
 	  
 	  // Write data to dataset _________________________
 	  
 	  h5error = H5Dwrite (itsLocation,
 			      datatype,
-			      memspace,
+			      memspace.id(),
 			      itsDataspace,
 			      H5P_DEFAULT,
 			      data);
-	  
-
-	  // Release memory space __________________________
-	  
-	  HDF5Object::close (H5Sclose (memspace));
+	  if (h5error < 0) {
+	    status = false;
+	  }
 	} else {
 	  std::cerr << "[HDF5Dataset::writeDate] Failed to properly set up Hyperslab!"
 		    << std::endl;
@@ -0,0 +1,491 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "HDF5DatasetMap.h"
+
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace DAL { // Namespace DAL -- begin
+
+  // ============================================================================
+  //
+  //  Construction
+  //
+  // ============================================================================
+
+  HDF5DatasetMap::HDF5DatasetMap ()
+  {
+    init ();
+  }
+
+  //_____________________________________________________________________________
+  //                                                               HDF5DatasetMap
+
+  /*!
+    \param location -- Identifier of the dataset.
+  */
+  HDF5DatasetMap::HDF5DatasetMap (hid_t const &location)
+  {
+    init ();
+    setup (location);
+  }
+
+  //_____________________________________________________________________________
+  //                                                               HDF5DatasetMap
+
+  /*!
+    \param dataset -- Dataset object, the raw data of which are to be mapped.
+  */
+  HDF5DatasetMap::HDF5DatasetMap (HDF5Dataset const &dataset)
+  {
+    init ();
+    setup (dataset.objectID());
+  }
+
+  //_____________________________________________________________________________
+  //                                                                         init
+
+  void HDF5DatasetMap::init ()
+  {
+    itsDataset.reset ();
+    itsFileType.reset ();
+    itsRank        = 0;
+    itsElementSize = 0;
+    itsFile        = -1;
+    itsMap         = NULL;
+    itsMapLength   = 0;
+    itsData        = NULL;
+
+    for (unsigned int n(0); n<H5S_MAX_RANK; ++n) {
+      itsShape[n] = 0;
+    }
+  }
+
+  // ============================================================================
+  //
+  //  Destruction
+  //
+  // ============================================================================
+
+  HDF5DatasetMap::~HDF5DatasetMap ()
+  {
+    destroy();
+  }
+
+  void HDF5DatasetMap::destroy ()
+  {
+    if (itsMap != NULL) munmap (itsMap, itsMapLength);
+    if (itsFile >= 0)   close (itsFile);
+
+    /* Releases the reference on the dataset held by this object */
+    init ();
+  }
+
+  // ============================================================================
+  //
+  //  Parameters
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                        shape
+
+  std::vector<hsize_t> HDF5DatasetMap::shape () const
+  {
+    return std::vector<hsize_t> (itsShape, itsShape+itsRank);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                nofDatapoints
+
+  hsize_t HDF5DatasetMap::nofDatapoints () const
+  {
+    hsize_t nelem (itsRank > 0 ? 1 : 0);
+
+    for (unsigned int n(0); n<itsRank; ++n) {
+      nelem *= itsShape[n];
+    }
+
+    return nelem;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                      summary
+
+  /*!
+    \param os -- Output stream to which the summary is written.
+  */
+  void HDF5DatasetMap::summary (std::ostream &os)
+  {
+    os << "[HDF5DatasetMap] Summary of internal parameters." << std::endl;
+    os << "-- Dataset ID        = " << itsDataset.id()     << std::endl;
+    os << "-- Rank              = " << itsRank             << std::endl;
+    os << "-- Shape of dataset  = " << shape()             << std::endl;
+    os << "-- nof. datapoints   = " << nofDatapoints()     << std::endl;
+    os << "-- Element size      = " << itsElementSize      << std::endl;
+    os << "-- Data mapped       = " << isMapped()          << std::endl;
+    os << "-- Mapped length     = " << itsMapLength        << std::endl;
+  }
+
+  // ============================================================================
+  //
+  //  Methods
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                        setup
+
+  /*!
+    \param location -- Identifier of the dataset.
+
+    \return status -- Status of the operation; returns \e false in case an error
+            was encountered, e.g. if \c location does not point to a dataset.
+            A dataset which cannot be mapped (see mappable()) is not an error;
+            in that case readData() falls back to \c H5Dread.
+  */
+  bool HDF5DatasetMap::setup (hid_t const &location)
+  {
+    if (H5Iget_type(location) != H5I_DATASET) {
+      std::cerr << "[HDF5DatasetMap::setup] Provided location is not a dataset!"
+		<< std::endl;
+      return false;
+    }
+
+    /* Take a reference on the dataset first, as it might be the one held by
+       this object already. */
+    H5Iinc_ref (location);
+    HDF5Handle dataset (location);
+
+    destroy ();
+
+    itsDataset = dataset;
+    itsFileType.reset (H5Dget_type (itsDataset.id()));
+
+    HDF5Handle dataspace (H5Dget_space (itsDataset.id()));
+    int rank = H5Sget_simple_extent_ndims (dataspace.id());
+
+    if (rank > 0) {
+      itsRank = rank;
+      H5Sget_simple_extent_dims (dataspace.id(), itsShape, NULL);
+    }
+
+    if (itsRank == 0 || !itsFileType.isValid()) {
+      std::cerr << "[HDF5DatasetMap::setup] Failed to retrieve shape and type!"
+		<< std::endl;
+      destroy ();
+      return false;
+    }
+
+    itsElementSize = H5Tget_size (itsFileType.id());
+
+    if (mappable (itsDataset.id())) {
+      map ();
+    }
+
+    return true;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                          map
+
+  /*!
+    \return status -- Status of the operation; returns \e false in case the
+            data could not be mapped.
+  */
+  bool HDF5DatasetMap::map ()
+  {
+    haddr_t offset = H5Dget_offset (itsDataset.id());
+    size_t nbytes  = nofDatapoints()*itsElementSize;
+
+    if (offset == HADDR_UNDEF || nbytes == 0) {
+      return false;
+    }
+
+    /* Make sure the data written so far actually are in the file */
+    unsigned int intent (0);
+    HDF5Handle file (H5Iget_file_id (itsDataset.id()));
+
+    H5Fget_intent (file.id(), &intent);
+    if (intent & H5F_ACC_RDWR) {
+      H5Fflush (file.id(), H5F_SCOPE_LOCAL);
+    }
+
+    /* Open the file underlying the dataset */
+    ssize_t length = H5Fget_name (itsDataset.id(), NULL, 0);
+
+    if (length <= 0) {
+      return false;
+    }
+
+    std::vector<char> filename (length+1);
+    H5Fget_name (itsDataset.id(), &filename[0], length+1);
+
+    itsFile = open (&filename[0], O_RDONLY);
+
+    if (itsFile < 0) {
+      std::cerr << "[HDF5DatasetMap::map] Failed to open file "
+		<< &filename[0] << std::endl;
+      return false;
+    }
+
+    struct stat status;
+
+    if (fstat (itsFile, &status) != 0 || haddr_t(status.st_size) < offset+nbytes) {
+      std::cerr << "[HDF5DatasetMap::map] Data exceed the size of the file!"
+		<< std::endl;
+      close (itsFile);
+      itsFile = -1;
+      return false;
+    }
+
+    /* The offset of the mapping must be a multiple of the page size */
+    long pagesize   = sysconf (_SC_PAGESIZE);
+    off_t pageStart = offset - offset%pagesize;
+
+    itsMapLength = nbytes + (offset-pageStart);
+    itsMap       = mmap (NULL,
+			 itsMapLength,
+			 PROT_READ,
+			 MAP_SHARED,
+			 itsFile,
+			 pageStart);
+
+    if (itsMap == MAP_FAILED) {
+      std::cerr << "[HDF5DatasetMap::map] Failed to map data into memory!"
+		<< std::endl;
+      itsMap       = NULL;
+      itsMapLength = 0;
+      close (itsFile);
+      itsFile = -1;
+      return false;
+    }
+
+    itsData = static_cast<char const *>(itsMap) + (offset-pageStart);
+
+    return true;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                         data
+
+  /*!
+    \param memoryType -- Datatype of the elements in memory.
+
+    \return data -- Pointer to the first element of the dataset, with the
+            elements stored in row-major order; returns \c NULL if the data are
+            not mapped or if the datatype in the file differs from
+            \c memoryType. The pointer remains valid as long as this object.
+  */
+  void const * HDF5DatasetMap::data (hid_t const &memoryType) const
+  {
+    if (itsData == NULL || H5Tequal (itsFileType.id(), memoryType) <= 0) {
+      return NULL;
+    } else {
+      return itsData;
+    }
+  }
+
+  //_____________________________________________________________________________
+  //                                                                     readData
+
+  /*!
+    \retval buffer    -- Array to which the data are written; it must provide
+            space for the number of elements selected by \c count.
+    \param start      -- Offset of the hyperslab within the dataset.
+    \param count      -- Shape of the hyperslab.
+    \param memoryType -- Datatype of the elements in memory.
+
+    \return status -- Status of the operation; returns \e false in case an error
+            was encountered.
+
+    If the data are mapped and the datatype in the file matches
+    \c memoryType, the hyperslab is copied from the mapping; otherwise it is
+    read using \c H5Dread.
+  */
+  bool HDF5DatasetMap::readData (void *buffer,
+				 std::vector<hsize_t> const &start,
+				 std::vector<hsize_t> const &count,
+				 hid_t const &memoryType)
+  {
+    if (itsRank == 0) {
+      std::cerr << "[HDF5DatasetMap::readData] Not set up for a dataset!"
+		<< std::endl;
+      return false;
+    }
+
+    if (start.size() != itsRank || count.size() != itsRank) {
+      std::cerr << "[HDF5DatasetMap::readData] Rank of hyperslab does not"
+		<< " match rank of dataset!" << std::endl;
+      return false;
+    }
+
+    for (unsigned int n(0); n<itsRank; ++n) {
+      if (count[n] == 0 || start[n]+count[n] > itsShape[n]) {
+	std::cerr << "[HDF5DatasetMap::readData] Hyperslab exceeds shape of"
+		  << " dataset along axis " << n << "!" << std::endl;
+	return false;
+      }
+    }
+
+    // Copy from the mapped data ___________________________
+
+    if (data (memoryType) != NULL) {
+      copy (static_cast<char *>(buffer), start, count);
+      return true;
+    }
+
+    // Fall back to reading through the HDF5 library _______
+
+    bool status (true);
+    HDF5Handle filespace (H5Dget_space (itsDataset.id()));
+    HDF5Handle memspace (H5Screate_simple (itsRank, &count[0], NULL));
+
+    if (H5Sselect_hyperslab (filespace.id(),
+			     H5S_SELECT_SET,
+			     &start[0],
+			     NULL,
+			     &count[0],
+			     NULL) < 0) {
+      std::cerr << "[HDF5DatasetMap::readData] Failed to select hyperslab!"
+		<< std::endl;
+      status = false;
+    } else if (H5Dread (itsDataset.id(),
+			memoryType,
+			memspace.id(),
+			filespace.id(),
+			H5P_DEFAULT,
+			buffer) < 0) {
+      std::cerr << "[HDF5DatasetMap::readData] Failed to read data!"
+		<< std::endl;
+      status = false;
+    }
+
+    return status;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                         copy
+
+  /*!
+    \retval buffer -- Array to which the data are written.
+    \param start   -- Offset of the hyperslab within the dataset.
+    \param count   -- Shape of the hyperslab.
+
+    The hyperslab is copied in runs along the last axis, the elements of which
+    are contiguous both in the file and in the buffer.
+  */
+  void HDF5DatasetMap::copy (char *buffer,
+			     std::vector<hsize_t> const &start,
+			     std::vector<hsize_t> const &count) const
+  {
+    unsigned int last = itsRank-1;
+    size_t runLength  = count[last]*itsElementSize;
+    hsize_t index[H5S_MAX_RANK];
+
+    for (unsigned int n(0); n<itsRank; ++n) {
+      index[n] = 0;
+    }
+
+    while (true) {
+      /* Offset of the start of the run within the dataset */
+      hsize_t offset (0);
+      for (unsigned int n(0); n<itsRank; ++n) {
+	offset = offset*itsShape[n] + start[n] + index[n];
+      }
+
+      memcpy (buffer, itsData + offset*itsElementSize, runLength);
+      buffer += runLength;
+
+      /* Advance to the next run, with the last-but-one axis varying fastest */
+      int axis = int(last)-1;
+      while (axis >= 0 && ++index[axis] == count[axis]) {
+	index[axis] = 0;
+	--axis;
+      }
+      if (axis < 0) {
+	break;
+      }
+    }
+  }
+
+  // ============================================================================
+  //
+  //  Static methods
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                     mappable
+
+  /*!
+    \param location -- Identifier of the dataset.
+
+    \return mappable -- Returns \e true if the raw data of the dataset are
+            stored as a single contiguous block within the file on disk.
+  */
+  bool HDF5DatasetMap::mappable (hid_t const &location)
+  {
+    if (H5Iget_type(location) != H5I_DATASET) {
+      return false;
+    }
+
+    /* Layout, filters and external storage */
+
+    HDF5Handle createPlist (H5Dget_create_plist (location));
+    H5D_layout_t layout = H5Pget_layout (createPlist.id());
+    int nofFilters      = H5Pget_nfilters (createPlist.id());
+    int nofExternal     = H5Pget_external_count (createPlist.id());
+
+    if (layout != H5D_CONTIGUOUS || nofFilters != 0 || nofExternal != 0) {
+      return false;
+    }
+
+    /* Allocation of the storage */
+
+    if (H5Dget_offset (location) == HADDR_UNDEF) {
+      return false;
+    }
+
+    /* File driver */
+
+    HDF5Handle file (H5Iget_file_id (location));
+    HDF5Handle accessPlist (H5Fget_access_plist (file.id()));
+    hid_t driver = H5Pget_driver (accessPlist.id());
+
+    if (driver != H5FD_SEC2 && driver != H5FD_STDIO) {
+      return false;
+    }
+
+    /* Datatype */
+
+    HDF5Handle datatype (H5Dget_type (location));
+
+    return H5Tdetect_class (datatype.id(), H5T_VLEN) == 0
+      && H5Tdetect_class (datatype.id(), H5T_REFERENCE) == 0
+      && !(H5Tget_class (datatype.id()) == H5T_STRING
+	   && H5Tis_variable_str (datatype.id()) > 0);
+  }
+
+} // Namespace DAL -- end
@@ -0,0 +1,258 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#ifndef HDF5DATASETMAP_H
+#define HDF5DATASETMAP_H
+
+// Standard library header files
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <core/dalCommon.h>
+#include <core/HDF5Dataset.h>
+#include <core/HDF5Handle.h>
+#include <core/HDF5TypeTraits.h>
+
+namespace DAL { // Namespace DAL -- begin
+
+  /*!
+    \class HDF5DatasetMap
+
+    \ingroup DAL
+    \ingroup core
+
+    \brief Zero-copy access to a dataset by mapping its raw data into memory
+
+    \author agent
+
+    \date 2026/10/18
+
+    \test tHDF5DatasetMap.cc
+
+    <h3>Prerequisite</h3>
+
+    <ul type="square">
+      <li>DAL::HDF5Dataset
+      <li>DAL::HDF5IOPlan
+    </ul>
+
+    <h3>Synopsis</h3>
+
+    The raw data of a dataset with contiguous layout, to which no filters are
+    applied, are stored as a single block of bytes within the file, starting
+    at the address returned by HDF5Dataset::offset(). This is the case e.g.
+    for LOPES event files imported into HDF5 and for converted TBB dumps.
+    An HDF5DatasetMap maps this block into memory using \c mmap, such that
+    the elements of the dataset can be accessed directly through a pointer,
+    bypassing \c H5Dread: only the pages actually touched are read from
+    disk, and pages already held by the page cache are accessed without
+    copying.
+
+    A pointer to the data is handed out by data() only if the datatype of
+    the elements in the file matches the requested memory datatype (e.g.
+    \c H5T_STD_I16LE in the file and \c short on a little-endian machine).
+    readData() copies a hyperslab into a buffer; it uses the mapping where
+    possible and otherwise falls back to \c H5Dread, such that it works for
+    any dataset, including chunked or filtered ones and datatypes requiring
+    conversion.
+
+    A dataset is mapped if all of the following conditions hold (see
+    mappable()):
+    <ul>
+      <li>the layout of the dataset is contiguous and no filters and no
+      external storage are used;
+      <li>the storage of the dataset has been allocated, i.e. its offset is
+      defined;
+      <li>the file has been opened with the default (\e sec2) or the \e stdio
+      file driver, i.e. the file on disk holds the data;
+      <li>the datatype does not contain variable-length data or references.
+    </ul>
+
+    <b>Note:</b> the mapping is read-only. If the file is open for writing,
+    it is flushed before being mapped; data written to the dataset through
+    the HDF5 library afterwards only become visible after the next flush of
+    the file. Since the mapping is independent of the HDF5 library, data()
+    and reading through the mapping may be used concurrently from multiple
+    threads.
+
+    <h3>Example(s)</h3>
+
+    <ol>
+      <li>Random access to the samples of a TBB dipole dataset:
+      \code
+      DAL::HDF5DatasetMap map (dipole.locationID());
+      short const *samples = map.data<short>();
+
+      if (samples) {
+        for (unsigned int n=0; n<nofEvents; ++n) {
+          process (samples + position[n], 1024);
+        }
+      }
+      \endcode
+      <li>Read a block of 1024 samples, whatever the layout of the dataset:
+      \code
+      std::vector<hsize_t> start (1, 4096);
+      std::vector<hsize_t> count (1, 1024);
+      std::vector<float> buffer (1024);
+
+      map.readData (&buffer[0], start, count);
+      \endcode
+    </ol>
+  */
+  class HDF5DatasetMap {
+
+    //! Reference to the dataset
+    HDF5Handle itsDataset;
+    //! Datatype of the elements in the file
+    HDF5Handle itsFileType;
+    //! Rank of the dataset
+    unsigned int itsRank;
+    //! Shape of the dataset
+    hsize_t itsShape[H5S_MAX_RANK];
+    //! Size of an element in the file, [Bytes]
+    size_t itsElementSize;
+    //! File descriptor of the mapped file
+    int itsFile;
+    //! Start of the mapped region, aligned to a page boundary
+    void *itsMap;
+    //! Length of the mapped region, [Bytes]
+    size_t itsMapLength;
+    //! Start of the raw data of the dataset within the mapped region
+    char const *itsData;
+
+  public:
+
+    // === Construction =========================================================
+
+    //! Default constructor
+    HDF5DatasetMap ();
+
+    //! Argumented constructor, for a dataset identifier
+    HDF5DatasetMap (hid_t const &location);
+
+    //! Argumented constructor, for an open dataset
+    HDF5DatasetMap (HDF5Dataset const &dataset);
+
+    // === Destruction ==========================================================
+
+    //! Destructor
+    ~HDF5DatasetMap ();
+
+    // === Parameter access =====================================================
+
+    //! Is the object set up for a valid dataset?
+    inline bool isValid () const {
+      return itsRank > 0;
+    }
+
+    //! Are the raw data of the dataset mapped into memory?
+    inline bool isMapped () const {
+      return itsData != NULL;
+    }
+
+    //! Get the rank of the dataset
+    inline unsigned int rank () const {
+      return itsRank;
+    }
+
+    //! Get the shape of the dataset
+    std::vector<hsize_t> shape () const;
+
+    //! Get the number of elements of the dataset
+    hsize_t nofDatapoints () const;
+
+    /*!
+      \brief Get the name of the class
+
+      \return className -- The name of the class, HDF5DatasetMap.
+    */
+    inline std::string className () const {
+      return "HDF5DatasetMap";
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    inline void summary () {
+      summary (std::cout);
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    void summary (std::ostream &os);
+
+    // === Methods ==============================================================
+
+    //! Set up the object for a dataset, mapping its raw data if possible
+    bool setup (hid_t const &location);
+
+    //! Get a pointer to the mapped data, if matching the memory datatype
+    void const * data (hid_t const &memoryType) const;
+
+    //! Get a pointer to the mapped data, as array of elements of type \c T
+    template <class T>
+      inline T const * data () const {
+      return static_cast<T const *> (data (HDF5TypeTraits<T>::type()));
+    }
+
+    //! Read a hyperslab of the dataset into a buffer
+    bool readData (void *buffer,
+		   std::vector<hsize_t> const &start,
+		   std::vector<hsize_t> const &count,
+		   hid_t const &memoryType);
+
+    //! Read a hyperslab of the dataset into an array of elements of type \c T
+    template <class T>
+      inline bool readData (T *buffer,
+			    std::vector<hsize_t> const &start,
+			    std::vector<hsize_t> const &count) {
+      return readData (buffer, start, count, HDF5TypeTraits<T>::type());
+    }
+
+    // === Static methods =======================================================
+
+    //! Can the raw data of a dataset be mapped into memory?
+    static bool mappable (hid_t const &location);
+
+  private:
+
+    //! Initialize the internal parameters
+    void init ();
+
+    //! Unmap the data and release the dataset
+    void destroy ();
+
+    //! Map the raw data of the dataset into memory
+    bool map ();
+
+    //! Copy a hyperslab from the mapped data into a buffer
+    void copy (char *buffer,
+	       std::vector<hsize_t> const &start,
+	       std::vector<hsize_t> const &count) const;
+
+    //! Copying is not supported, as the object owns a mapping
+    HDF5DatasetMap (HDF5DatasetMap const &other);
+
+    //! Copying is not supported, as the object owns a mapping
+    HDF5DatasetMap& operator= (HDF5DatasetMap const &other);
+
+  }; // Class HDF5DatasetMap -- end
+
+} // Namespace DAL -- end
+
+#endif /* HDF5DATASETMAP_H */
@@ -371,5 +371,56 @@ namespace DAL { // Namespace DAL -- begin
     
     return name;
   }
+
+  //_____________________________________________________________________________
+  //                                                                  complexType
+
+  /*!
+    \param componentType -- Datatype of the real and the imaginary part.
+    \param size          -- Size of the complex number, [Bytes], e.g.
+           <tt>sizeof(std::complex<float>)</tt>.
+
+    \return datatype -- Identifier of a compound datatype with members \e real
+            and \e imag, matching the memory layout of <tt>std::complex<T></tt>;
+	    returns a negative value in case an error was encountered.
+  */
+  hid_t HDF5Datatype::complexType (hid_t const &componentType,
+				   size_t const &size)
+  {
+    size_t componentSize = H5Tget_size (componentType);
+    hid_t datatype       = H5Tcreate (H5T_COMPOUND, size);
+
+    if (datatype < 0) {
+      std::cerr << "[HDF5Datatype::complexType] Failed to create datatype!"
+		<< std::endl;
+      return datatype;
+    }
+
+    if (H5Tinsert (datatype, "real", 0, componentType) < 0
+	|| H5Tinsert (datatype, "imag", componentSize, componentType) < 0) {
+      std::cerr << "[HDF5Datatype::complexType] Failed to insert members!"
+		<< std::endl;
+      H5Tclose (datatype);
+      return -1;
+    }
+
+    return datatype;
+  }
+
+  //_____________________________________________________________________________
+  //                                                           requiresConversion
+
+  /*!
+    \param fileType   -- Datatype of the elements as stored in the file.
+    \param memoryType -- Datatype of the elements in memory.
+
+    \return status -- Returns \e true if the two datatypes differ, such that the
+            library has to convert each element when transferring data.
+  */
+  bool HDF5Datatype::requiresConversion (hid_t const &fileType,
+					 hid_t const &memoryType)
+  {
+    return H5Tequal (fileType, memoryType) <= 0;
+  }
   
 } // Namespace DAL -- end
@@ -110,6 +110,14 @@ namespace DAL { // Namespace DAL -- begin
     
     //! Get name for the datatype
     static std::string datatypeName (hid_t const &id);
+
+    //! Create compound datatype for a complex number
+    static hid_t complexType (hid_t const &componentType,
+			      size_t const &size);
+
+    //! Does transfer between two datatypes require a conversion?
+    static bool requiresConversion (hid_t const &fileType,
+				    hid_t const &memoryType);
     
   private:
     
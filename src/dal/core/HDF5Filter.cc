@@ -0,0 +1,483 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "HDF5Filter.h"
+
+#include <sstream>
+
+namespace DAL { // Namespace DAL -- begin
+
+  // ============================================================================
+  //
+  //  Construction
+  //
+  // ============================================================================
+
+  HDF5Filter::HDF5Filter ()
+  {
+    init ();
+  }
+
+  //_____________________________________________________________________________
+  //                                                                   HDF5Filter
+
+  /*!
+    \param plist -- Identifier of a dataset creation property list, e.g. as
+           returned by \c H5Dget_create_plist, from which to retrieve the
+	   stages of the filter pipeline.
+  */
+  HDF5Filter::HDF5Filter (hid_t const &plist)
+  {
+    init ();
+
+    if (!H5Iis_valid(plist)) {
+      std::cerr << "[HDF5Filter::HDF5Filter] Invalid property list ID!"
+		<< std::endl;
+      return;
+    }
+
+    int nofFilters = H5Pget_nfilters (plist);
+
+    for (int n(0); n<nofFilters; ++n) {
+      unsigned int flags   = 0;
+      size_t nofParameters = 32;
+      unsigned int parameters[32];
+      unsigned int config  = 0;
+      H5Z_filter_t filter  = H5Pget_filter2 (plist,
+					     n,
+					     &flags,
+					     &nofParameters,
+					     parameters,
+					     0,
+					     NULL,
+					     &config);
+      if (filter < 0) {
+	std::cerr << "[HDF5Filter::HDF5Filter] Failed to retrieve filter "
+		  << n << " of the pipeline!" << std::endl;
+	continue;
+      }
+      if (nofParameters > 32) {
+	nofParameters = 32;
+      }
+      itsFilters.push_back (filter);
+      itsFlags.push_back (flags);
+      itsParameters.push_back (std::vector<unsigned int> (parameters,
+							  parameters+nofParameters));
+    }
+  }
+
+  //_____________________________________________________________________________
+  //                                                                   HDF5Filter
+
+  /*!
+    \param other -- Another HDF5Filter object from which to create this new
+           one.
+  */
+  HDF5Filter::HDF5Filter (HDF5Filter const &other)
+  {
+    copy (other);
+  }
+
+  // ============================================================================
+  //
+  //  Destruction
+  //
+  // ============================================================================
+
+  HDF5Filter::~HDF5Filter ()
+  {
+    destroy();
+  }
+
+  void HDF5Filter::destroy ()
+  {;}
+
+  // ============================================================================
+  //
+  //  Operators
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                    operator=
+
+  HDF5Filter& HDF5Filter::operator= (HDF5Filter const &other)
+  {
+    if (this != &other) {
+      destroy ();
+      copy (other);
+    }
+    return *this;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                         copy
+
+  void HDF5Filter::copy (HDF5Filter const &other)
+  {
+    itsFilters    = other.itsFilters;
+    itsFlags      = other.itsFlags;
+    itsParameters = other.itsParameters;
+  }
+
+  // ============================================================================
+  //
+  //  Parameters
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                        names
+
+  /*!
+    \return names -- Names of the filters, in the order in which they are
+            applied to the raw data.
+  */
+  std::vector<std::string> HDF5Filter::names () const
+  {
+    std::vector<std::string> result;
+
+    for (unsigned int n(0); n<itsFilters.size(); ++n) {
+      result.push_back (name(itsFilters[n]));
+    }
+
+    return result;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                    hasFilter
+
+  /*!
+    \param filter -- Identifier of the filter.
+    \return found  -- Returns \e true if the filter is part of the pipeline.
+  */
+  bool HDF5Filter::hasFilter (H5Z_filter_t const &filter) const
+  {
+    for (unsigned int n(0); n<itsFilters.size(); ++n) {
+      if (itsFilters[n] == filter) {
+	return true;
+      }
+    }
+    return false;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                      summary
+
+  /*!
+    \param os -- Output stream to which the summary is written.
+  */
+  void HDF5Filter::summary (std::ostream &os)
+  {
+    os << "[HDF5Filter] Summary of internal parameters." << std::endl;
+    os << "-- nof. filters           = " << itsFilters.size() << std::endl;
+
+    for (unsigned int n(0); n<itsFilters.size(); ++n) {
+      os << "-- Filter " << n << "                 = " << name(itsFilters[n])
+	 << "  (id=" << itsFilters[n]
+	 << ", optional=" << ((itsFlags[n] & H5Z_FLAG_OPTIONAL) ? "yes" : "no")
+	 << ", available=" << (available(itsFilters[n]) ? "yes" : "no")
+	 << ", parameters=" << itsParameters[n] << ")"
+	 << std::endl;
+    }
+  }
+
+  // ============================================================================
+  //
+  //  Methods
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                         init
+
+  void HDF5Filter::init ()
+  {
+    itsFilters.clear();
+    itsFlags.clear();
+    itsParameters.clear();
+  }
+
+  //_____________________________________________________________________________
+  //                                                                   addShuffle
+
+  /*!
+    The shuffle filter itself does not compress the data, but improves the
+    effect of a subsequent compression stage.
+  */
+  void HDF5Filter::addShuffle ()
+  {
+    addFilter (H5Z_FILTER_SHUFFLE,
+	       std::vector<unsigned int>(),
+	       true);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                   addDeflate
+
+  /*!
+    \param level   -- Compression level, within the range [0,9]; higher levels
+           result in somewhat better compression at considerably lower speed.
+    \return status -- Status of the operation; returns \e false in case the
+            compression level is out of range.
+  */
+  bool HDF5Filter::addDeflate (unsigned int const &level)
+  {
+    if (level > 9) {
+      std::cerr << "[HDF5Filter::addDeflate] Invalid compression level "
+		<< level << " - must be within [0,9]!" << std::endl;
+      return false;
+    }
+
+    addFilter (H5Z_FILTER_DEFLATE,
+	       std::vector<unsigned int> (1,level),
+	       true);
+
+    return true;
+  }
+
+  //_____________________________________________________________________________
+  //                                                               addScaleOffset
+
+  /*!
+    \param scaleType   -- Type of scaling: \c H5Z_SO_INT for integer data,
+           \c H5Z_SO_FLOAT_DSCALE for floating point data (lossy).
+    \param scaleFactor -- For integer data the minimum number of bits to use
+           (\c H5Z_SO_INT_MINBITS_DEFAULT to let the library determine it);
+	   for floating point data the number of decimal digits to retain.
+  */
+  void HDF5Filter::addScaleOffset (H5Z_SO_scale_type_t const &scaleType,
+				   int const &scaleFactor)
+  {
+    std::vector<unsigned int> parameters (2);
+
+    parameters[0] = scaleType;
+    parameters[1] = scaleFactor;
+
+    addFilter (H5Z_FILTER_SCALEOFFSET,
+	       parameters,
+	       false);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                addFletcher32
+
+  void HDF5Filter::addFletcher32 ()
+  {
+    addFilter (H5Z_FILTER_FLETCHER32,
+	       std::vector<unsigned int>(),
+	       false);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                       addLZ4
+
+  /*!
+    \param blockSize -- Size of the blocks, into which a chunk is split before
+           compression, [Bytes]; 0 to use the default of the filter (1 GB).
+  */
+  void HDF5Filter::addLZ4 (unsigned int const &blockSize)
+  {
+    addFilter (LZ4,
+	       std::vector<unsigned int> (1,blockSize),
+	       true);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                addBitshuffle
+
+  /*!
+    \param lz4 -- Compress the bit-shuffled data using LZ4?
+
+    The first three parameters (version of the filter and element size) are
+    filled in by the filter itself; the block size is left at 0, such that it
+    is chosen automatically.
+  */
+  void HDF5Filter::addBitshuffle (bool const &lz4)
+  {
+    std::vector<unsigned int> parameters (5,0);
+
+    parameters[4] = lz4 ? 2 : 0;
+
+    addFilter (Bitshuffle,
+	       parameters,
+	       true);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                    addFilter
+
+  /*!
+    \param filter     -- Identifier of the filter.
+    \param parameters -- Auxiliary parameters passed to the filter.
+    \param optional   -- Is the filter optional? Optional filters, which are not
+           available to the library, are skipped when attaching the pipeline to
+	   a property list; furthermore the library is allowed to store a chunk
+	   unfiltered, if the filter fails on it.
+  */
+  void HDF5Filter::addFilter (H5Z_filter_t const &filter,
+			      std::vector<unsigned int> const &parameters,
+			      bool const &optional)
+  {
+    itsFilters.push_back (filter);
+    itsFlags.push_back (optional ? H5Z_FLAG_OPTIONAL : H5Z_FLAG_MANDATORY);
+    itsParameters.push_back (parameters);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                        clear
+
+  void HDF5Filter::clear ()
+  {
+    init ();
+  }
+
+  //_____________________________________________________________________________
+  //                                                                   setFilters
+
+  /*!
+    \param plist   -- Identifier of the dataset creation property list, to which
+           the filter pipeline is attached; the property list also needs to
+	   define the chunking of the dataset.
+    \return status -- Status of the operation; returns \e false in case an
+            error was encountered, e.g. a mandatory filter is not available.
+  */
+  bool HDF5Filter::setFilters (hid_t const &plist) const
+  {
+    bool status = true;
+
+    if (!H5Iis_valid(plist)) {
+      std::cerr << "[HDF5Filter::setFilters] Invalid property list ID!"
+		<< std::endl;
+      return false;
+    }
+
+    for (unsigned int n(0); n<itsFilters.size(); ++n) {
+      /* Check if the filter is available to the library */
+      if (!available(itsFilters[n])) {
+	if (itsFlags[n] & H5Z_FLAG_OPTIONAL) {
+#ifdef DAL_DEBUGGING_MESSAGES
+	  std::cerr << "[HDF5Filter::setFilters] Skipping filter "
+		    << name(itsFilters[n]) << " - not available."
+		    << std::endl;
+#endif
+	  continue;
+	} else {
+	  std::cerr << "[HDF5Filter::setFilters] Filter "
+		    << name(itsFilters[n]) << " not available!"
+		    << std::endl;
+	  status = false;
+	  continue;
+	}
+      }
+      /* Attach the filter to the property list */
+      if (H5Pset_filter (plist,
+			 itsFilters[n],
+			 itsFlags[n],
+			 itsParameters[n].size(),
+			 itsParameters[n].empty() ? NULL : &itsParameters[n][0]) < 0) {
+	std::cerr << "[HDF5Filter::setFilters] Failed to set filter "
+		  << name(itsFilters[n]) << "!" << std::endl;
+	status = false;
+      }
+    }
+
+    return status;
+  }
+
+  // ============================================================================
+  //
+  //  Static methods
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                    available
+
+  /*!
+    \param filter  -- Identifier of the filter.
+    \return status -- Returns \e true in case the filter is available, either
+            being built into the library or loaded from a plugin.
+  */
+  bool HDF5Filter::available (H5Z_filter_t const &filter)
+  {
+    htri_t status = 0;
+
+    /* Probing for a plugin which is not installed leaves an error stack */
+    H5E_BEGIN_TRY {
+      status = H5Zfilter_avail (filter);
+    } H5E_END_TRY;
+
+    return (status > 0);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                         name
+
+  /*!
+    \param filter -- Identifier of the filter.
+    \return name  -- Name of the filter.
+  */
+  std::string HDF5Filter::name (H5Z_filter_t const &filter)
+  {
+    switch (filter) {
+    case H5Z_FILTER_DEFLATE:
+      return "deflate";
+    case H5Z_FILTER_SHUFFLE:
+      return "shuffle";
+    case H5Z_FILTER_FLETCHER32:
+      return "fletcher32";
+    case H5Z_FILTER_SZIP:
+      return "szip";
+    case H5Z_FILTER_NBIT:
+      return "nbit";
+    case H5Z_FILTER_SCALEOFFSET:
+      return "scaleoffset";
+    case LZ4:
+      return "lz4";
+    case Bitshuffle:
+      return "bitshuffle";
+    default:
+      {
+	std::ostringstream os;
+	os << "filter" << filter;
+	return os.str();
+      }
+    };
+  }
+
+  //_____________________________________________________________________________
+  //                                                               shuffleDeflate
+
+  /*!
+    \param level  -- Compression level for the deflate stage.
+    \return filter -- Filter pipeline consisting of shuffle and deflate.
+  */
+  HDF5Filter HDF5Filter::shuffleDeflate (unsigned int const &level)
+  {
+    HDF5Filter filter;
+
+    filter.addShuffle ();
+    filter.addDeflate (level);
+
+    return filter;
+  }
+
+} // Namespace DAL -- end
@@ -0,0 +1,270 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#ifndef HDF5FILTER_H
+#define HDF5FILTER_H
+
+// Standard library header files
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <core/dalCommon.h>
+
+namespace DAL { // Namespace DAL -- begin
+
+  /*!
+    \class HDF5Filter
+
+    \ingroup DAL
+    \ingroup core
+
+    \brief Pipeline of filters applied to the raw data of a chunked dataset
+
+    \author agent
+
+    \date 2026/10/18
+
+    \test tHDF5Filter.cc
+
+    <h3>Prerequisite</h3>
+
+    <ul type="square">
+      <li>HDF5 Data Filters and Filter Pipeline
+      <li>DAL::HDF5Dataset
+    </ul>
+
+    <h3>Synopsis</h3>
+
+    HDF5 passes every chunk of a dataset through a pipeline of filters before
+    it is written to disk (and through the reverse pipeline when reading it
+    back). The pipeline is a property of the dataset creation property list,
+    i.e. it has to be defined when the dataset is created and cannot be changed
+    afterwards; filters furthermore only can be applied to datasets with
+    chunked layout.
+
+    An HDF5Filter object collects the stages of the pipeline, in the order in
+    which they are to be applied, and attaches them to a creation property list
+    by means of HDF5Filter::setFilters. Supported are the filters built into the
+    library,
+    <ul>
+      <li>\b shuffle -- Reorders the bytes of the elements within a chunk, such
+      that the bytes of equal significance are stored next to each other;
+      greatly improves compression of slowly varying integer data.
+      <li>\b deflate -- GZIP compression, with a level in the range [0,9].
+      <li>\b scaleoffset -- Lossless (integer) or lossy (floating point, for a
+      given number of decimal digits) packing of the values into the minimum
+      number of bits.
+      <li>\b fletcher32 -- Checksum for error detection, to be the last stage
+      of the pipeline.
+    </ul>
+    as well as third-party filters, which are loaded dynamically by the library
+    (see \c HDF5_PLUGIN_PATH), such as \b LZ4 and \b Bitshuffle. Since those
+    might not be installed on every system, a stage is marked as optional: if
+    the filter is not available, the stage is skipped when the pipeline is
+    attached to a property list, such that the dataset still can be created
+    (though without that stage).
+
+    A typical pipeline for integer data (e.g. TBB time-series) consists of
+    shuffle followed by deflate at a low level; for floating point data the
+    combination of Bitshuffle and LZ4 is much faster at comparable ratio.
+
+    <h3>Example(s)</h3>
+
+    <ol>
+      <li>Create a dataset, which is compressed using shuffle and deflate:
+      \code
+      DAL::HDF5Filter filter;
+      filter.addShuffle ();
+      filter.addDeflate (4);
+
+      DAL::HDF5Dataset dataset;
+      dataset.setFilter (filter);
+      dataset.open (fileID, "Data", shape, chunk, H5T_NATIVE_SHORT);
+      \endcode
+      <li>Use Bitshuffle/LZ4 if the plugin is installed, otherwise fall back to
+      shuffle and deflate:
+      \code
+      DAL::HDF5Filter filter;
+
+      if (DAL::HDF5Filter::available (DAL::HDF5Filter::Bitshuffle)) {
+        filter.addBitshuffle (true);
+      } else {
+        filter = DAL::HDF5Filter::shuffleDeflate ();
+      }
+      \endcode
+      <li>Inspect the filter pipeline of an existing dataset:
+      \code
+      hid_t dcpl = H5Dget_create_plist (datasetID);
+      DAL::HDF5Filter filter (dcpl);
+      H5Pclose (dcpl);
+
+      filter.summary();
+      \endcode
+    </ol>
+
+  */
+  class HDF5Filter {
+
+  public:
+
+    //! Identifiers of registered third-party filters
+    enum Plugin {
+      //! LZ4 compression
+      LZ4 = 32004,
+      //! Bitshuffle, optionally combined with LZ4 compression
+      Bitshuffle = 32008
+    };
+
+  private:
+
+    //! Identifiers of the filters, in the order of application
+    std::vector<H5Z_filter_t> itsFilters;
+    //! Flags passed along with the filters
+    std::vector<unsigned int> itsFlags;
+    //! Auxiliary parameters for the filters
+    std::vector<std::vector<unsigned int> > itsParameters;
+
+  public:
+
+    // === Construction =========================================================
+
+    //! Default constructor
+    HDF5Filter ();
+
+    //! Argumented constructor, retrieving the pipeline of a creation property list
+    HDF5Filter (hid_t const &plist);
+
+    //! Copy constructor
+    HDF5Filter (HDF5Filter const &other);
+
+    // === Destruction ==========================================================
+
+    //! Destructor
+    ~HDF5Filter ();
+
+    // === Operators ============================================================
+
+    /*!
+      \brief Overloading of the copy operator
+
+      \param other -- Another HDF5Filter object from which to make a copy.
+    */
+    HDF5Filter& operator= (HDF5Filter const &other);
+
+    // === Parameter access =====================================================
+
+    //! Get the number of stages in the filter pipeline
+    inline unsigned int nofFilters () const {
+      return itsFilters.size();
+    }
+
+    //! Is the filter pipeline empty?
+    inline bool empty () const {
+      return itsFilters.empty();
+    }
+
+    //! Get the identifiers of the filters, in the order of application
+    inline std::vector<H5Z_filter_t> filters () const {
+      return itsFilters;
+    }
+
+    //! Get the names of the filters, in the order of application
+    std::vector<std::string> names () const;
+
+    //! Does the pipeline contain a given filter?
+    bool hasFilter (H5Z_filter_t const &filter) const;
+
+    /*!
+      \brief Get the name of the class
+
+      \return className -- The name of the class, HDF5Filter.
+    */
+    inline std::string className () const {
+      return "HDF5Filter";
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    inline void summary () {
+      summary (std::cout);
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    void summary (std::ostream &os);
+
+    // === Methods ==============================================================
+
+    //! Append the shuffle filter to the pipeline
+    void addShuffle ();
+
+    //! Append deflate (GZIP) compression to the pipeline
+    bool addDeflate (unsigned int const &level=6);
+
+    //! Append the scale-offset filter to the pipeline
+    void addScaleOffset (H5Z_SO_scale_type_t const &scaleType=H5Z_SO_INT,
+			 int const &scaleFactor=H5Z_SO_INT_MINBITS_DEFAULT);
+
+    //! Append the Fletcher32 checksum to the pipeline
+    void addFletcher32 ();
+
+    //! Append LZ4 compression (dynamically loaded filter) to the pipeline
+    void addLZ4 (unsigned int const &blockSize=0);
+
+    //! Append the Bitshuffle filter (dynamically loaded) to the pipeline
+    void addBitshuffle (bool const &lz4=true);
+
+    //! Append an arbitrary filter to the pipeline
+    void addFilter (H5Z_filter_t const &filter,
+		    std::vector<unsigned int> const &parameters=std::vector<unsigned int>(),
+		    bool const &optional=true);
+
+    //! Remove all stages from the pipeline
+    void clear ();
+
+    //! Attach the filter pipeline to a dataset creation property list
+    bool setFilters (hid_t const &plist) const;
+
+    // === Static methods =======================================================
+
+    //! Is a filter available to the library?
+    static bool available (H5Z_filter_t const &filter);
+
+    //! Get the name of a filter
+    static std::string name (H5Z_filter_t const &filter);
+
+    //! Get a pipeline consisting of shuffle followed by deflate
+    static HDF5Filter shuffleDeflate (unsigned int const &level=4);
+
+  private:
+
+    //! Initialize the object's internal parameters
+    void init ();
+
+    //! Unconditional copying
+    void copy (HDF5Filter const &other);
+
+    //! Unconditional deletion
+    void destroy(void);
+
+  }; // Class HDF5Filter -- end
+
+} // Namespace DAL -- end
+
+#endif /* HDF5FILTER_H */
@@ -0,0 +1,314 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "HDF5Handle.h"
+
+#include <pthread.h>
+
+namespace DAL { // Namespace DAL -- begin
+
+  /* Number of identifiers held by handles, per type of object; the mutex
+     guards the counters, as handles may be used from within the prefetching
+     thread of an HDF5BlockIterator. */
+  static std::map<H5I_type_t,unsigned int> liveHandles;
+  static pthread_mutex_t liveHandlesMutex = PTHREAD_MUTEX_INITIALIZER;
+
+  // ============================================================================
+  //
+  //  Construction
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                   HDF5Handle
+
+  /*!
+    \param id -- Object identifier, of which the handle takes ownership; pass
+           0 to create a handle not (yet) referring to any object.
+  */
+  HDF5Handle::HDF5Handle (hid_t const &id)
+  {
+    acquire (id);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                   HDF5Handle
+
+  /*!
+    \param other -- Another HDF5Handle object, the identifier of which is
+           shared by incrementing its reference count.
+  */
+  HDF5Handle::HDF5Handle (HDF5Handle const &other)
+  {
+    if (other.isValid()) {
+      H5Iinc_ref (other.itsID);
+      acquire (other.itsID);
+    } else {
+      acquire (0);
+    }
+  }
+
+  // ============================================================================
+  //
+  //  Destruction
+  //
+  // ============================================================================
+
+  HDF5Handle::~HDF5Handle ()
+  {
+    reset (0);
+  }
+
+  // ============================================================================
+  //
+  //  Operators
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                    operator=
+
+  /*!
+    \param other -- Another HDF5Handle object, the identifier of which is
+           shared by incrementing its reference count.
+  */
+  HDF5Handle& HDF5Handle::operator= (HDF5Handle const &other)
+  {
+    if (this != &other) {
+      if (other.isValid()) {
+	H5Iinc_ref (other.itsID);
+	reset (other.itsID);
+      } else {
+	reset (0);
+      }
+    }
+    return *this;
+  }
+
+  // ============================================================================
+  //
+  //  Parameters
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                      summary
+
+  /*!
+    \param os -- Output stream to which the summary is written.
+  */
+  void HDF5Handle::summary (std::ostream &os)
+  {
+    os << "[HDF5Handle] Summary of internal parameters." << std::endl;
+    os << "-- Object identifier  = " << itsID     << std::endl;
+    os << "-- Object type        = " << itsType   << std::endl;
+    os << "-- Valid identifier   = " << isValid() << std::endl;
+    if (isValid()) {
+      os << "-- Reference count    = " << H5Iget_ref(itsID) << std::endl;
+    }
+  }
+
+  // ============================================================================
+  //
+  //  Methods
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                        reset
+
+  /*!
+    \param id -- Object identifier, of which the handle takes ownership; the
+           identifier held so far is released.
+  */
+  void HDF5Handle::reset (hid_t const &id)
+  {
+    hid_t previous = release ();
+
+    if (H5Iis_valid(previous) > 0) {
+      HDF5Object::close (previous);
+    }
+
+    acquire (id);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                      release
+
+  /*!
+    \return id -- The identifier held by the handle; the caller becomes
+            responsible for closing it.
+  */
+  hid_t HDF5Handle::release ()
+  {
+    hid_t id = itsID;
+
+    if (itsType != H5I_BADID) {
+      pthread_mutex_lock (&liveHandlesMutex);
+      --liveHandles[itsType];
+      pthread_mutex_unlock (&liveHandlesMutex);
+    }
+
+    itsID   = 0;
+    itsType = H5I_BADID;
+
+    return id;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                      acquire
+
+  /*!
+    \param id -- Object identifier, of which the handle takes ownership.
+  */
+  void HDF5Handle::acquire (hid_t const &id)
+  {
+    itsID   = id;
+    itsType = H5I_BADID;
+
+    if (id > 0 && H5Iis_valid(id) > 0) {
+      itsType = H5Iget_type (id);
+      pthread_mutex_lock (&liveHandlesMutex);
+      ++liveHandles[itsType];
+      pthread_mutex_unlock (&liveHandlesMutex);
+    }
+  }
+
+  // ============================================================================
+  //
+  //  Static methods
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                               nofLiveHandles
+
+  /*!
+    \param type    -- Type of the objects, e.g. \c H5I_DATASPACE.
+    \return number -- Number of identifiers of the given type currently held by
+            HDF5Handle objects.
+  */
+  unsigned int HDF5Handle::nofLiveHandles (H5I_type_t const &type)
+  {
+    unsigned int number (0);
+    std::map<H5I_type_t,unsigned int>::const_iterator it;
+
+    pthread_mutex_lock (&liveHandlesMutex);
+    it = liveHandles.find (type);
+    if (it != liveHandles.end()) {
+      number = it->second;
+    }
+    pthread_mutex_unlock (&liveHandlesMutex);
+
+    return number;
+  }
+
+  //_____________________________________________________________________________
+  //                                                               nofLiveHandles
+
+  /*!
+    \return numbers -- Number of identifiers currently held by HDF5Handle
+            objects, per type of object; types without live handles are
+            omitted.
+  */
+  std::map<H5I_type_t,unsigned int> HDF5Handle::nofLiveHandles ()
+  {
+    std::map<H5I_type_t,unsigned int> numbers;
+    std::map<H5I_type_t,unsigned int>::const_iterator it;
+
+    pthread_mutex_lock (&liveHandlesMutex);
+    for (it=liveHandles.begin(); it!=liveHandles.end(); ++it) {
+      if (it->second > 0) {
+	numbers[it->first] = it->second;
+      }
+    }
+    pthread_mutex_unlock (&liveHandlesMutex);
+
+    return numbers;
+  }
+
+  //_____________________________________________________________________________
+  //                                                               nofIdentifiers
+
+  /*!
+    The library only provides the number of open identifiers for objects
+    associated with a file (\c H5Fget_obj_count), i.e. for files, groups,
+    datasets, named datatypes and attributes; for other types of objects (e.g.
+    dataspaces or property lists) use nofLiveHandles() instead.
+
+    \param type    -- Type of the objects, e.g. \c H5I_ATTR.
+    \return number -- Number of open identifiers of the given type within all
+            open files, including those not held by an HDF5Handle.
+  */
+  unsigned int HDF5Handle::nofIdentifiers (H5I_type_t const &type)
+  {
+    unsigned int types (0);
+
+    switch (type) {
+    case H5I_FILE:
+      types = H5F_OBJ_FILE;
+      break;
+    case H5I_GROUP:
+      types = H5F_OBJ_GROUP;
+      break;
+    case H5I_DATASET:
+      types = H5F_OBJ_DATASET;
+      break;
+    case H5I_DATATYPE:
+      types = H5F_OBJ_DATATYPE;
+      break;
+    case H5I_ATTR:
+      types = H5F_OBJ_ATTR;
+      break;
+    default:
+      std::cerr << "[HDF5Handle::nofIdentifiers] Unsupported type of object "
+		<< type << std::endl;
+      return 0;
+    }
+
+    ssize_t number = H5Fget_obj_count (H5F_OBJ_ALL, types);
+
+    if (number < 0) {
+      std::cerr << "[HDF5Handle::nofIdentifiers] Failed to get number of objects!"
+		<< std::endl;
+      return 0;
+    }
+
+    return number;
+  }
+
+  //_____________________________________________________________________________
+  //                                                           liveHandlesSummary
+
+  /*!
+    \param os -- Output stream to which the summary is written.
+  */
+  void HDF5Handle::liveHandlesSummary (std::ostream &os)
+  {
+    std::map<H5I_type_t,unsigned int> numbers = nofLiveHandles ();
+    std::map<H5I_type_t,unsigned int>::const_iterator it;
+
+    os << "[HDF5Handle] Number of live handles per type of object." << std::endl;
+    for (it=numbers.begin(); it!=numbers.end(); ++it) {
+      os << "-- Type " << it->first << " = " << it->second << std::endl;
+    }
+  }
+
+} // Namespace DAL -- end
@@ -0,0 +1,199 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#ifndef HDF5HANDLE_H
+#define HDF5HANDLE_H
+
+// Standard library header files
+#include <iostream>
+#include <map>
+
+#include <core/HDF5Object.h>
+
+namespace DAL { // Namespace DAL -- begin
+
+  /*!
+    \class HDF5Handle
+
+    \ingroup DAL
+    \ingroup core
+
+    \brief Owner of an HDF5 object identifier, closing it when going out of scope
+
+    \author agent
+
+    \date 2026/10/18
+
+    \test tHDF5Handle.cc
+
+    <h3>Prerequisite</h3>
+
+    <ul type="square">
+      <li>DAL::HDF5Object
+    </ul>
+
+    <h3>Synopsis</h3>
+
+    Most functions reading or writing data create a number of temporary
+    identifiers -- dataspaces, datatypes, property lists, attributes -- which
+    need to be released on every path out of the function. With a chain of
+    early returns in case of an error this is easily forgotten, and each
+    forgotten identifier keeps library resources (and, for objects within a
+    file, the file itself) alive. An HDF5Handle takes ownership of an
+    identifier and releases it through HDF5Object::close once it goes out of
+    scope, such that the cleanup no longer depends on the path taken.
+
+    Copying a handle does not duplicate the object, but increments the
+    reference count of the identifier (\c H5Iinc_ref); the identifier is
+    released once the last handle referring to it has been destroyed. Use
+    release() to hand over the identifier to code managing it by itself, and
+    reset() to take ownership of another one.
+
+    Identifiers of the predefined datatypes (e.g. \c H5T_NATIVE_INT) and the
+    default property list \c H5P_DEFAULT must not be passed to a handle, as
+    these cannot be closed.
+
+    For debugging purposes the class keeps track of the number of identifiers
+    currently held by handles, broken down by the type of the object (see
+    nofLiveHandles()); for the objects attached to a file, nofIdentifiers()
+    in addition reports the number of open identifiers of a given type,
+    whether held by a handle or not. Comparing these numbers before and after
+    a call is the simplest way to check that a function does not leak
+    identifiers.
+
+    <h3>Example(s)</h3>
+
+    <ol>
+      <li>Create a memory space, which is released on any path out of the
+      function:
+      \code
+      DAL::HDF5Handle memspace (H5Screate_simple (rank, dims, NULL));
+
+      if (!memspace.isValid()) {
+        return false;
+      }
+
+      h5error = H5Dread (datasetID,
+                         H5T_NATIVE_FLOAT,
+                         memspace.id(),
+                         filespace.id(),
+                         H5P_DEFAULT,
+                         data);
+      \endcode
+      <li>Check for leaked attribute identifiers:
+      \code
+      unsigned int before = DAL::HDF5Handle::nofIdentifiers (H5I_ATTR);
+      DAL::HDF5Attribute::read (location, "TIME", time);
+      unsigned int after  = DAL::HDF5Handle::nofIdentifiers (H5I_ATTR);
+      \endcode
+    </ol>
+  */
+  class HDF5Handle {
+
+    //! The object identifier owned by the handle
+    hid_t itsID;
+    //! Type of the object, under which the identifier has been accounted
+    H5I_type_t itsType;
+
+  public:
+
+    // === Construction =========================================================
+
+    //! Argumented constructor, taking ownership of the identifier \c id
+    HDF5Handle (hid_t const &id=0);
+
+    //! Copy constructor, sharing the identifier of \c other
+    HDF5Handle (HDF5Handle const &other);
+
+    // === Destruction ==========================================================
+
+    //! Destructor, releasing the identifier
+    ~HDF5Handle ();
+
+    // === Operators ============================================================
+
+    //! Overloading of the copy operator
+    HDF5Handle& operator= (HDF5Handle const &other);
+
+    // === Parameter access =====================================================
+
+    //! Get the object identifier owned by the handle
+    inline hid_t id () const {
+      return itsID;
+    }
+
+    //! Does the handle hold a valid object identifier?
+    inline bool isValid () const {
+      return H5Iis_valid(itsID) > 0;
+    }
+
+    //! Type of the object referred to by the handle
+    inline H5I_type_t type () const {
+      return itsType;
+    }
+
+    /*!
+      \brief Get the name of the class
+      \return className -- The name of the class, HDF5Handle.
+    */
+    inline std::string className () const {
+      return "HDF5Handle";
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    inline void summary () {
+      summary (std::cout);
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    void summary (std::ostream &os);
+
+    // === Methods ==============================================================
+
+    //! Release the current identifier and take ownership of \c id
+    void reset (hid_t const &id=0);
+
+    //! Give up ownership of the identifier, without closing it
+    hid_t release ();
+
+    // === Static methods =======================================================
+
+    //! Number of identifiers of the given type currently held by handles
+    static unsigned int nofLiveHandles (H5I_type_t const &type);
+
+    //! Number of identifiers held by handles, for all types of objects
+    static std::map<H5I_type_t,unsigned int> nofLiveHandles ();
+
+    //! Number of open identifiers of the given type within all open files
+    static unsigned int nofIdentifiers (H5I_type_t const &type);
+
+    //! Write the number of live handles per type of object to \c os
+    static void liveHandlesSummary (std::ostream &os=std::cout);
+
+  private:
+
+    //! Take ownership of \c id, accounting it under its type
+    void acquire (hid_t const &id);
+
+  }; // Class HDF5Handle -- end
+
+} // Namespace DAL -- end
+
+#endif /* HDF5HANDLE_H */
@@ -0,0 +1,496 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "HDF5IOPlan.h"
+
+#include <algorithm>
+
+namespace DAL { // Namespace DAL -- begin
+
+  // ============================================================================
+  //
+  //  Construction
+  //
+  // ============================================================================
+
+  HDF5IOPlan::HDF5IOPlan ()
+  {
+    init ();
+  }
+
+  //_____________________________________________________________________________
+  //                                                                   HDF5IOPlan
+
+  /*!
+    \param location   -- Identifier of the dataset.
+    \param block      -- Shape of the block transferred per read/write; the
+           number of elements must match the rank of the dataset.
+    \param memoryType -- Datatype of the elements in memory.
+  */
+  HDF5IOPlan::HDF5IOPlan (hid_t const &location,
+			  std::vector<hsize_t> const &block,
+			  hid_t const &memoryType)
+  {
+    init ();
+    setup (location, block, memoryType);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                   HDF5IOPlan
+
+  /*!
+    \param dataset    -- Dataset object, for which the plan is set up.
+    \param block      -- Shape of the block transferred per read/write; the
+           number of elements must match the rank of the dataset.
+    \param memoryType -- Datatype of the elements in memory.
+  */
+  HDF5IOPlan::HDF5IOPlan (HDF5Dataset const &dataset,
+			  std::vector<hsize_t> const &block,
+			  hid_t const &memoryType)
+  {
+    init ();
+    setup (dataset.objectID(), block, memoryType);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                   HDF5IOPlan
+
+  /*!
+    \param other -- Another HDF5IOPlan object from which to create this new
+           one.
+  */
+  HDF5IOPlan::HDF5IOPlan (HDF5IOPlan const &other)
+  {
+    init ();
+    copy (other);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                         init
+
+  void HDF5IOPlan::init ()
+  {
+    itsDataset     = 0;
+    itsFileSpace   = 0;
+    itsMemorySpace = 0;
+    itsMemoryType  = 0;
+    itsRank        = 0;
+
+    for (unsigned int n(0); n<H5S_MAX_RANK; ++n) {
+      itsShape[n] = itsBlock[n] = itsStart[n] = 0;
+    }
+  }
+
+  // ============================================================================
+  //
+  //  Destruction
+  //
+  // ============================================================================
+
+  HDF5IOPlan::~HDF5IOPlan ()
+  {
+    destroy();
+  }
+
+  void HDF5IOPlan::destroy ()
+  {
+    if (H5Iis_valid(itsMemoryType))  H5Tclose (itsMemoryType);
+    if (H5Iis_valid(itsMemorySpace)) H5Sclose (itsMemorySpace);
+    if (H5Iis_valid(itsFileSpace))   H5Sclose (itsFileSpace);
+    /* Release the reference on the dataset held by this plan */
+    if (H5Iis_valid(itsDataset))     H5Idec_ref (itsDataset);
+
+    init ();
+  }
+
+  // ============================================================================
+  //
+  //  Operators
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                    operator=
+
+  HDF5IOPlan& HDF5IOPlan::operator= (HDF5IOPlan const &other)
+  {
+    if (this != &other) {
+      destroy ();
+      copy (other);
+    }
+    return *this;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                         copy
+
+  /*!
+    As the plan holds HDF5 object identifiers, the copy is set up afresh from
+    the parameters of \c other, rather than sharing its identifiers.
+  */
+  void HDF5IOPlan::copy (HDF5IOPlan const &other)
+  {
+    if (other.isValid()) {
+      setup (other.itsDataset, other.block(), other.itsMemoryType);
+    }
+  }
+
+  // ============================================================================
+  //
+  //  Parameters
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                        block
+
+  std::vector<hsize_t> HDF5IOPlan::block () const
+  {
+    return std::vector<hsize_t> (itsBlock, itsBlock+itsRank);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                        shape
+
+  std::vector<hsize_t> HDF5IOPlan::shape () const
+  {
+    return std::vector<hsize_t> (itsShape, itsShape+itsRank);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                nofDatapoints
+
+  hsize_t HDF5IOPlan::nofDatapoints () const
+  {
+    hsize_t nelem = itsRank > 0 ? 1 : 0;
+
+    for (unsigned int n(0); n<itsRank; ++n) {
+      nelem *= itsBlock[n];
+    }
+
+    return nelem;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                      summary
+
+  /*!
+    \param os -- Output stream to which the summary is written.
+  */
+  void HDF5IOPlan::summary (std::ostream &os)
+  {
+    os << "[HDF5IOPlan] Summary of internal parameters." << std::endl;
+    os << "-- Dataset ID        = " << itsDataset          << std::endl;
+    os << "-- Rank              = " << itsRank             << std::endl;
+    os << "-- Shape of dataset  = " << shape()             << std::endl;
+    os << "-- Shape of block    = " << block()             << std::endl;
+    os << "-- Last block offset = "
+       << std::vector<hsize_t> (itsStart, itsStart+itsRank) << std::endl;
+    os << "-- nof. datapoints   = " << nofDatapoints()     << std::endl;
+  }
+
+  // ============================================================================
+  //
+  //  Methods
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                        setup
+
+  /*!
+    \param location   -- Identifier of the dataset.
+    \param block      -- Shape of the block transferred per read/write; the
+           number of elements must match the rank of the dataset.
+    \param memoryType -- Datatype of the elements in memory.
+
+    \return status -- Status of the operation; returns \e false in case an error
+            was encountered, e.g. if \c location does not point to a dataset.
+  */
+  bool HDF5IOPlan::setup (hid_t const &location,
+			  std::vector<hsize_t> const &block,
+			  hid_t const &memoryType)
+  {
+    /* Check the input parameters before releasing the current setup */
+
+    if (H5Iget_type(location) != H5I_DATASET) {
+      std::cerr << "[HDF5IOPlan::setup] Provided location is not a dataset!"
+		<< std::endl;
+      return false;
+    }
+
+    if (block.empty() || block.size() > H5S_MAX_RANK) {
+      std::cerr << "[HDF5IOPlan::setup] Invalid rank of the block!"
+		<< std::endl;
+      return false;
+    }
+
+    /* Take a reference on the dataset first, as it might be the one held by
+       this plan already. */
+    hid_t datasetID = location;
+    H5Iinc_ref (datasetID);
+
+    destroy ();
+
+    itsDataset   = datasetID;
+    itsFileSpace = H5Dget_space (itsDataset);
+
+    int rank = H5Sget_simple_extent_ndims (itsFileSpace);
+
+    if (rank != int(block.size())) {
+      std::cerr << "[HDF5IOPlan::setup] Rank of block (" << block.size()
+		<< ") does not match rank of dataset (" << rank << ")!"
+		<< std::endl;
+      destroy ();
+      return false;
+    }
+
+    itsRank = rank;
+    H5Sget_simple_extent_dims (itsFileSpace, itsShape, NULL);
+
+    for (unsigned int n(0); n<itsRank; ++n) {
+      if (block[n] == 0) {
+	std::cerr << "[HDF5IOPlan::setup] Empty block along axis " << n << "!"
+		  << std::endl;
+	destroy ();
+	return false;
+      }
+      itsBlock[n] = block[n];
+      itsStart[n] = 0;
+    }
+
+    itsMemorySpace = H5Screate_simple (itsRank, itsBlock, NULL);
+    itsMemoryType  = H5Tcopy (memoryType);
+
+    if (itsMemorySpace < 0 || itsMemoryType < 0) {
+      std::cerr << "[HDF5IOPlan::setup] Failed to set up memory space and type!"
+		<< std::endl;
+      destroy ();
+      return false;
+    }
+
+    return true;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                  updateShape
+
+  /*!
+    \return status -- Status of the operation; returns \e false in case the
+            dataspace of the dataset could not be retrieved.
+  */
+  bool HDF5IOPlan::updateShape ()
+  {
+    hid_t filespace = H5Dget_space (itsDataset);
+
+    if (filespace < 0) {
+      return false;
+    }
+
+    H5Sclose (itsFileSpace);
+    itsFileSpace = filespace;
+    H5Sget_simple_extent_dims (itsFileSpace, itsShape, NULL);
+
+    return true;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                       select
+
+  /*!
+    \param start   -- Offset of the block within the dataset.
+
+    \return status -- Status of the operation; returns \e false in case an error
+            was encountered.
+  */
+  bool HDF5IOPlan::select (hsize_t const *start)
+  {
+    for (unsigned int n(0); n<itsRank; ++n) {
+      itsStart[n] = start[n];
+    }
+
+    return H5Sselect_hyperslab (itsFileSpace,
+				H5S_SELECT_SET,
+				itsStart,
+				NULL,
+				itsBlock,
+				NULL) >= 0;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                         read
+
+  /*!
+    \retval data   -- Array of (at least) nofDatapoints() elements of the
+            memory datatype, into which the block is read.
+    \param start   -- Offset of the block within the dataset; array with rank()
+            elements.
+
+    \return status -- Status of the operation; returns \e false in case an error
+            was encountered, e.g. if the block exceeds the shape of the dataset.
+  */
+  bool HDF5IOPlan::read (void *data,
+			 hsize_t const *start)
+  {
+    if (!isValid()) {
+      std::cerr << "[HDF5IOPlan::read] Plan not set up for a dataset!"
+		<< std::endl;
+      return false;
+    }
+
+    /* The dataset may have been extended since the plan was set up */
+    if (!updateShape ()) {
+      std::cerr << "[HDF5IOPlan::read] Failed to retrieve shape of dataset!"
+		<< std::endl;
+      return false;
+    }
+
+    for (unsigned int n(0); n<itsRank; ++n) {
+      if (start[n]+itsBlock[n] > itsShape[n]) {
+	std::cerr << "[HDF5IOPlan::read] Block exceeds shape of dataset along axis "
+		  << n << "!" << std::endl;
+	return false;
+      }
+    }
+
+    if (!select (start)) {
+      std::cerr << "[HDF5IOPlan::read] Failed to select block!" << std::endl;
+      return false;
+    }
+
+    return H5Dread (itsDataset,
+		    itsMemoryType,
+		    itsMemorySpace,
+		    itsFileSpace,
+		    H5P_DEFAULT,
+		    data) >= 0;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                    readBlock
+
+  /*!
+    \retval data   -- Array of (at least) nofDatapoints() elements of the
+            memory datatype, into which the block is read.
+    \param index   -- Number of the block along the first axis, i.e. the block
+            starts at position <tt>index*block()[0]</tt>.
+
+    \return status -- Status of the operation; returns \e false in case an error
+            was encountered.
+  */
+  bool HDF5IOPlan::readBlock (void *data,
+			      hsize_t const &index)
+  {
+    hsize_t start[H5S_MAX_RANK] = { 0 };
+    start[0] = index*itsBlock[0];
+
+    return read (data, start);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                        write
+
+  /*!
+    \param data    -- Array of (at least) nofDatapoints() elements of the
+           memory datatype, which is written to the dataset.
+    \param start   -- Offset of the block within the dataset; array with rank()
+           elements.
+
+    \return status -- Status of the operation; returns \e false in case an error
+            was encountered. If the block exceeds the current shape of the
+	    dataset, the dataset is extended; this will fail for a dataset
+	    with contiguous layout or if the maximum shape is exceeded.
+  */
+  bool HDF5IOPlan::write (void const *data,
+			  hsize_t const *start)
+  {
+    if (!isValid()) {
+      std::cerr << "[HDF5IOPlan::write] Plan not set up for a dataset!"
+		<< std::endl;
+      return false;
+    }
+
+    /* Extend the dataset, if the block exceeds its current shape; the shape
+       is retrieved anew, as another writer may have extended the dataset, and
+       never is reduced. */
+
+    if (!updateShape ()) {
+      std::cerr << "[HDF5IOPlan::write] Failed to retrieve shape of dataset!"
+		<< std::endl;
+      return false;
+    }
+
+    bool extend (false);
+    hsize_t shape[H5S_MAX_RANK];
+
+    for (unsigned int n(0); n<itsRank; ++n) {
+      shape[n] = std::max (itsShape[n], start[n]+itsBlock[n]);
+      extend   = extend || shape[n] > itsShape[n];
+    }
+
+    if (extend) {
+      if (H5Dset_extent (itsDataset, shape) < 0) {
+	std::cerr << "[HDF5IOPlan::write] Failed to extend dataset!"
+		  << std::endl;
+	return false;
+      }
+      /* Re-create the file dataspace, such that it reflects the new shape */
+      if (!updateShape ()) {
+	std::cerr << "[HDF5IOPlan::write] Failed to retrieve shape of dataset!"
+		  << std::endl;
+	return false;
+      }
+    }
+
+    if (!select (start)) {
+      std::cerr << "[HDF5IOPlan::write] Failed to select block!" << std::endl;
+      return false;
+    }
+
+    return H5Dwrite (itsDataset,
+		     itsMemoryType,
+		     itsMemorySpace,
+		     itsFileSpace,
+		     H5P_DEFAULT,
+		     data) >= 0;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                   writeBlock
+
+  /*!
+    \param data    -- Array of (at least) nofDatapoints() elements of the
+           memory datatype, which is written to the dataset.
+    \param index   -- Number of the block along the first axis, i.e. the block
+           starts at position <tt>index*block()[0]</tt>.
+
+    \return status -- Status of the operation; returns \e false in case an error
+            was encountered.
+  */
+  bool HDF5IOPlan::writeBlock (void const *data,
+			       hsize_t const &index)
+  {
+    hsize_t start[H5S_MAX_RANK] = { 0 };
+    start[0] = index*itsBlock[0];
+
+    return write (data, start);
+  }
+
+} // Namespace DAL -- end
@@ -0,0 +1,256 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#ifndef HDF5IOPLAN_H
+#define HDF5IOPLAN_H
+
+// Standard library header files
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <core/dalCommon.h>
+#include <core/HDF5Dataset.h>
+
+namespace DAL { // Namespace DAL -- begin
+
+  /*!
+    \class HDF5IOPlan
+
+    \ingroup DAL
+    \ingroup core
+
+    \brief Prepared plan for repeated hyperslab I/O on a dataset
+
+    \author agent
+
+    \date 2026/10/18
+
+    \test tHDF5IOPlan.cc
+
+    <h3>Prerequisite</h3>
+
+    <ul type="square">
+      <li>DAL::HDF5Dataset
+      <li>DAL::HDF5Hyperslab
+    </ul>
+
+    <h3>Synopsis</h3>
+
+    Every call to HDF5Dataset::readData or HDF5Dataset::writeData sets up a new
+    HDF5Hyperslab, copies its parameters, allocates the arrays handed to the
+    HDF5 library and creates (and afterwards releases) a memory dataspace. When
+    streaming through a dataset in blocks of fixed shape all of this work is
+    the same for each block, except for the position of the block.
+
+    An HDF5IOPlan is set up once for a given block shape and memory datatype;
+    it keeps the memory dataspace, a private copy of the file dataspace and the
+    memory datatype, such that a read or write only needs to update the offset
+    of the selection within the file dataspace. All parameters are stored in
+    fixed-size arrays (up to \c H5S_MAX_RANK axes), hence no heap allocation
+    takes place in the steady state. The file dataspace is re-read from the
+    dataset before each read or write, such that blocks are checked against
+    the current shape of the dataset, even if it has been extended by another
+    writer since the plan was set up; a write only ever grows the dataset.
+
+    Since the plan keeps its own reference to the dataset, it remains valid
+    even if the HDF5Dataset object used to create it goes out of scope; note
+    however that the shape cached by HDF5Dataset is not updated if the plan
+    extends the dataset.
+
+    <h3>Example(s)</h3>
+
+    <ol>
+      <li>Stream through a time-series of 16 bit integers in blocks of 1024
+      samples:
+      \code
+      DAL::HDF5Dataset dataset (fileID, "Timeseries");
+      DAL::HDF5IOPlan plan (dataset,
+                            std::vector<hsize_t>(1,1024),
+			    H5T_NATIVE_SHORT);
+      short buffer[1024];
+
+      for (hsize_t n=0; n<dataset.shape()[0]/1024; ++n) {
+        plan.readBlock (buffer, n);
+      }
+      \endcode
+      <li>Append rows of 512 channels to a dynamic spectrum:
+      \code
+      std::vector<hsize_t> block (2);
+      block[0] = 1;
+      block[1] = 512;
+
+      DAL::HDF5IOPlan plan (dataset, block, H5T_NATIVE_FLOAT);
+
+      for (hsize_t row=0; row<nofRows; ++row) {
+        plan.writeBlock (spectrum, row);
+      }
+      \endcode
+    </ol>
+
+  */
+  class HDF5IOPlan {
+
+    //! Identifier of the dataset
+    hid_t itsDataset;
+    //! Private copy of the dataspace of the dataset
+    hid_t itsFileSpace;
+    //! Memory dataspace, matching the shape of the block
+    hid_t itsMemorySpace;
+    //! Datatype of the elements in memory
+    hid_t itsMemoryType;
+    //! Rank of the dataset
+    unsigned int itsRank;
+    //! Current shape of the dataset
+    hsize_t itsShape[H5S_MAX_RANK];
+    //! Shape of the block transferred per read/write
+    hsize_t itsBlock[H5S_MAX_RANK];
+    //! Offset of the block within the dataset
+    hsize_t itsStart[H5S_MAX_RANK];
+
+  public:
+
+    // === Construction =========================================================
+
+    //! Default constructor
+    HDF5IOPlan ();
+
+    //! Argumented constructor, for a plan on a dataset identifier
+    HDF5IOPlan (hid_t const &location,
+		std::vector<hsize_t> const &block,
+		hid_t const &memoryType);
+
+    //! Argumented constructor, for a plan on an open dataset
+    HDF5IOPlan (HDF5Dataset const &dataset,
+		std::vector<hsize_t> const &block,
+		hid_t const &memoryType);
+
+    //! Copy constructor
+    HDF5IOPlan (HDF5IOPlan const &other);
+
+    // === Destruction ==========================================================
+
+    //! Destructor
+    ~HDF5IOPlan ();
+
+    // === Operators ============================================================
+
+    /*!
+      \brief Overloading of the copy operator
+
+      \param other -- Another HDF5IOPlan object from which to make a copy.
+    */
+    HDF5IOPlan& operator= (HDF5IOPlan const &other);
+
+    // === Parameter access =====================================================
+
+    //! Is the plan set up for a valid dataset?
+    inline bool isValid () const {
+      return itsRank > 0;
+    }
+
+    //! Get the rank of the dataset
+    inline unsigned int rank () const {
+      return itsRank;
+    }
+
+    //! Get the shape of the block transferred per read/write
+    std::vector<hsize_t> block () const;
+
+    //! Get the current shape of the dataset
+    std::vector<hsize_t> shape () const;
+
+    //! Get the number of elements transferred per read/write
+    hsize_t nofDatapoints () const;
+
+    /*!
+      \brief Get the name of the class
+
+      \return className -- The name of the class, HDF5IOPlan.
+    */
+    inline std::string className () const {
+      return "HDF5IOPlan";
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    inline void summary () {
+      summary (std::cout);
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    void summary (std::ostream &os);
+
+    // === Methods ==============================================================
+
+    //! Set up the plan for a dataset, block shape and memory datatype
+    bool setup (hid_t const &location,
+		std::vector<hsize_t> const &block,
+		hid_t const &memoryType);
+
+    //! Read the block starting at the offset \c start
+    bool read (void *data,
+	       hsize_t const *start);
+
+    //! Read the block starting at the offset \c start
+    inline bool read (void *data,
+		      std::vector<hsize_t> const &start) {
+      return (start.size() == itsRank) ? read (data, &start[0]) : false;
+    }
+
+    //! Read the block number \c index along the first axis
+    bool readBlock (void *data,
+		    hsize_t const &index);
+
+    //! Write the block starting at the offset \c start
+    bool write (void const *data,
+		hsize_t const *start);
+
+    //! Write the block starting at the offset \c start
+    inline bool write (void const *data,
+		       std::vector<hsize_t> const &start) {
+      return (start.size() == itsRank) ? write (data, &start[0]) : false;
+    }
+
+    //! Write the block number \c index along the first axis
+    bool writeBlock (void const *data,
+		     hsize_t const &index);
+
+  private:
+
+    //! Initialize the object's internal parameters
+    void init ();
+
+    //! Unconditional copying
+    void copy (HDF5IOPlan const &other);
+
+    //! Unconditional deletion
+    void destroy(void);
+
+    //! Re-read the file dataspace and the current shape of the dataset
+    bool updateShape ();
+
+    //! Select the block at offset \c start within the file dataspace
+    bool select (hsize_t const *start);
+
+  }; // Class HDF5IOPlan -- end
+
+} // Namespace DAL -- end
+
+#endif /* HDF5IOPLAN_H */
@@ -0,0 +1,88 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "HDF5Lock.h"
+
+#include <pthread.h>
+
+namespace DAL { // Namespace DAL -- begin
+
+  /* The process-wide lock; being recursive it cannot be set up by a static
+     initializer, but is initialized upon first use. */
+  static pthread_mutex_t hdf5Mutex;
+  static pthread_once_t hdf5MutexOnce = PTHREAD_ONCE_INIT;
+
+  //! Initialize the process-wide lock as recursive mutex
+  static void initHDF5Mutex ()
+  {
+    pthread_mutexattr_t attr;
+
+    pthread_mutexattr_init (&attr);
+    pthread_mutexattr_settype (&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init (&hdf5Mutex, &attr);
+    pthread_mutexattr_destroy (&attr);
+  }
+
+  // ============================================================================
+  //
+  //  Construction
+  //
+  // ============================================================================
+
+  HDF5Lock::HDF5Lock ()
+  {
+    lock ();
+  }
+
+  // ============================================================================
+  //
+  //  Destruction
+  //
+  // ============================================================================
+
+  HDF5Lock::~HDF5Lock ()
+  {
+    unlock ();
+  }
+
+  // ============================================================================
+  //
+  //  Static methods
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                         lock
+
+  void HDF5Lock::lock ()
+  {
+    pthread_once (&hdf5MutexOnce, initHDF5Mutex);
+    pthread_mutex_lock (&hdf5Mutex);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                       unlock
+
+  void HDF5Lock::unlock ()
+  {
+    pthread_mutex_unlock (&hdf5Mutex);
+  }
+
+} // Namespace DAL -- end
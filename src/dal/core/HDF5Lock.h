@@ -0,0 +1,136 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#ifndef HDF5LOCK_H
+#define HDF5LOCK_H
+
+// Standard library header files
+#include <string>
+
+#include <hdf5.h>
+
+namespace DAL { // Namespace DAL -- begin
+
+  /*!
+    \class HDF5Lock
+
+    \ingroup DAL
+    \ingroup core
+
+    \brief Scoped lock serializing the calls into the HDF5 library
+
+    \author agent
+
+    \date 2026/10/18
+
+    \test tHDF5Lock.cc
+
+    <h3>Synopsis</h3>
+
+    Unless the HDF5 library has been built thread-safe (\c H5_HAVE_THREADSAFE),
+    it must not be entered by more than one thread at a time -- this includes
+    calls operating on unrelated files or objects, as the library keeps global
+    state (identifier tables, free lists, the error stack). All code issuing
+    HDF5 calls from more than one thread therefore has to agree on a single
+    lock; HDF5Lock provides that process-wide lock.
+
+    An HDF5Lock object acquires the lock upon construction and releases it once
+    it goes out of scope. The lock is recursive, i.e. a thread already holding
+    it may acquire it again (e.g. when a locked section calls a function of the
+    library taking the lock by itself). The lock is taken regardless of how the
+    HDF5 library has been built: a thread-safe build serializes the calls into
+    the core library only, whereas the high-level libraries used by the DAL
+    (e.g. \c H5TB for tables) keep state of their own and remain unsafe.
+
+    The classes of the library running HDF5 calls on threads of their own
+    (e.g. the I/O thread of an HDF5BlockIterator) take the lock for every call
+    they make. As long as such a thread may be active, any other thread
+    calling into the HDF5 library -- directly or through the classes of the
+    library -- has to hold the lock as well. Conversely, a thread must not
+    hold the lock while waiting for another thread, which needs it to make
+    progress (e.g. within HDF5BlockIterator::next); doing so results in a
+    deadlock.
+
+    <h3>Example(s)</h3>
+
+    <ol>
+      <li>Read an attribute while an HDF5BlockIterator is prefetching blocks
+      on its I/O thread:
+      \code
+      DAL::HDF5BlockIterator it (datasetID, block, H5T_NATIVE_SHORT);
+      double frequency;
+
+      {
+        DAL::HDF5Lock lock;
+        DAL::HDF5Attribute::read (datasetID, "SAMPLE_FREQUENCY_VALUE", frequency);
+      }
+
+      while ((data = it.next<short>())) {
+        process (data, it.nofDatapoints());
+      }
+      \endcode
+    </ol>
+  */
+  class HDF5Lock {
+
+  public:
+
+    // === Construction =========================================================
+
+    //! Default constructor, acquiring the lock
+    HDF5Lock ();
+
+    // === Destruction ==========================================================
+
+    //! Destructor, releasing the lock
+    ~HDF5Lock ();
+
+    // === Parameter access =====================================================
+
+    /*!
+      \brief Get the name of the class
+
+      \return className -- The name of the class, HDF5Lock.
+    */
+    inline std::string className () const {
+      return "HDF5Lock";
+    }
+
+    // === Static methods =======================================================
+
+    //! Acquire the lock; to be matched by a call to unlock()
+    static void lock ();
+
+    //! Release the lock acquired by lock()
+    static void unlock ();
+
+  private:
+
+    //! Copying is not supported, as the object holds the lock
+    HDF5Lock (HDF5Lock const &other);
+
+    //! Copying is not supported, as the object holds the lock
+    HDF5Lock& operator= (HDF5Lock const &other);
+
+  }; // Class HDF5Lock -- end
+
+} // Namespace DAL -- end
+
+#endif /* HDF5LOCK_H */
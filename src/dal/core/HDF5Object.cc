@@ -19,6 +19,7 @@
  ***************************************************************************/
 
 #include <core/HDF5Object.h>
+#include <core/HDF5Handle.h>
 
 namespace DAL { // Namespace DAL -- begin
   
@@ -127,10 +128,12 @@ namespace DAL { // Namespace DAL -- begin
     if (H5Iis_valid(itsLocation)) {
 
       /*______________________________________________________________
-	Returns a non-negative value if successful; otherwise returns
-	a negative value.
+	Both objects share the identifier, which therefore only is
+	released once the last of them has been destroyed. Returns the
+	new reference count if successful; otherwise returns a negative
+	value.
       */
-      herr_t status = H5Oincr_refcount(itsLocation);
+      int status = H5Iinc_ref(itsLocation);
 
       if (status<0) {
 	std::cerr << "[HDF5Object::copy] Error incrementing object reference counter!"
@@ -404,30 +407,27 @@ namespace DAL { // Namespace DAL -- begin
       
       if (isAttribute) {
 	/* Open attribute for verification */
-	hid_t id = H5Aopen (location, name.c_str(), H5P_DEFAULT);
-	if (H5Iis_valid(id)) {
+	HDF5Handle id (H5Aopen (location, name.c_str(), H5P_DEFAULT));
+	if (id.isValid()) {
 	  result = H5I_ATTR;
 	} else {
 	  result = H5I_BADID;
 	}
-	H5Aclose (id);
       } else {
 	if (isLink) {
 	  /* [1] Open object */
-	  hid_t id = H5Oopen (location,
-	  		      name.c_str(),
-	  		      H5P_DEFAULT);
-	  /* [2] Get object type */
-	  if (H5Iis_valid(id)) {
-	    result = H5Iget_type (id);
+	  HDF5Handle id (H5Oopen (location,
+				  name.c_str(),
+				  H5P_DEFAULT));
+	  /* [2] Get object type; the object is closed along with the handle */
+	  if (id.isValid()) {
+	    result = H5Iget_type (id.id());
 	  } else {
 	    std::cerr << "[HDF5Object::objectType] Failed to open object "
 	  	      << name
 	  	      << std::endl;
 	    result = H5I_BADID;
 	  }
-	  /* [3] Close object */
-	  HDF5Object::close (id);
 	}   //   END -- if (isLink>0)
 	else {
 	  std::cerr << "[HDF5Object::objectType] Failed to get object type!"
@@ -475,16 +475,14 @@ namespace DAL { // Namespace DAL -- begin
     switch (objectType (location)) {
     case H5I_ATTR:
       {
-	hid_t atype = H5Aget_type (location);
-	result      = H5Tget_class (atype);
-	H5Tclose (atype);
+	HDF5Handle atype (H5Aget_type (location));
+	result = H5Tget_class (atype.id());
       }
       break;
     case H5I_DATASET:
       {
-	hid_t atype = H5Dget_type (location);
-	result      = H5Tget_class (atype);
-	H5Tclose (atype);
+	HDF5Handle atype (H5Dget_type (location));
+	result = H5Tget_class (atype.id());
       }
       break;
     case H5I_DATATYPE:
@@ -684,18 +682,21 @@ namespace DAL { // Namespace DAL -- begin
   //                                                                         open
   
   /*!
-    \param filename -- Name of the file to be opened.
-    \param flags    -- I/O mode flags.
-    \return fileID  -- HDF5 object identifier for the opened file; returns \e 0 
-            in case the operation failed.
+    \param filename   -- Name of the file to be opened.
+    \param flags      -- I/O mode flags.
+    \param properties -- Settings for the file-creation and file-access
+           property lists.
+    \return fileID    -- HDF5 object identifier for the opened file; returns
+            \e 0 in case the operation failed.
    */
   hid_t HDF5Object::openFile (std::string const &filename,
-			  IO_Mode const &flags)
+			      IO_Mode const &flags,
+			      HDF5Property const &properties)
   {
     hid_t fileID = 0;
 
     /* Forward the function call */
-    open (fileID, filename, flags);
+    openFile (fileID, filename, flags, properties);
 
     return fileID;
   }
@@ -704,18 +705,28 @@ namespace DAL { // Namespace DAL -- begin
   //                                                                         open
 
   /*!
-    \retvalfileID    --
-    \param filename  -- 
-    \param flags     --
+    If the I/O mode \c flags contain IO_Mode::InMemory, the file is opened
+    through the core file driver, i.e. it is held in memory completely (see
+    IO_Mode::fileAccessList).
+
+    \retval fileID    -- Identifier for the opened file.
+    \param filename   -- Name of the file to be opened.
+    \param flags      -- I/O mode flags.
+    \param properties -- Settings for the file-creation and file-access
+           property lists; the file-creation settings only take effect if a
+	   new file is created.
     \return fileTruncated -- Was the file truncated? Returns \e true is this 
             was the case.
   */
   bool HDF5Object::openFile (hid_t &fileID,
 			     std::string const &filename,
-			     IO_Mode const &flags)
+			     IO_Mode const &flags,
+			     HDF5Property const &properties)
   {
     bool fileExists    = false;
     bool fileTruncated = false; 
+    hid_t fcpl         = properties.fileCreationList();
+    hid_t fapl         = properties.fileAccessList(flags);
     std::ifstream infile (filename.c_str(), std::ifstream::in);
     
     /*______________________________________________________
@@ -739,28 +750,28 @@ namespace DAL { // Namespace DAL -- begin
 	fileTruncated = true;
 	fileID        = H5Fcreate (filename.c_str(),
 				   H5F_ACC_TRUNC,
-				   H5P_DEFAULT,
-				   H5P_DEFAULT);
+				   fcpl,
+				   fapl);
       } else if ( flags.flags() & IO_Mode::Create ) {
 	/* Truncate existing file */
 	fileTruncated = true;
 	fileID        = H5Fcreate (filename.c_str(),
 				   H5F_ACC_TRUNC,
-				   H5P_DEFAULT,
-				   H5P_DEFAULT);
+				   fcpl,
+				   fapl);
       } else {
 	if ( flags.flags() & IO_Mode::ReadWrite ) {
 	  /* Open file as read/write */
 	  fileTruncated = false;
 	  fileID        = H5Fopen (filename.c_str(),
 				   H5F_ACC_RDWR,
-				   H5P_DEFAULT);
+				   fapl);
 	} else {
 	  /* Open file as read-only */
 	  fileTruncated = false;
 	  fileID        = H5Fopen (filename.c_str(),
 				   H5F_ACC_RDONLY,
-				   H5P_DEFAULT);
+				   fapl);
 	}
       }
     } else {
@@ -768,12 +779,112 @@ namespace DAL { // Namespace DAL -- begin
       fileTruncated = true;
       fileID        = H5Fcreate (filename.c_str(),
 				 H5F_ACC_TRUNC,
-				 H5P_DEFAULT,
-				 H5P_DEFAULT);
+				 fcpl,
+				 fapl);
     }
 
+    HDF5Property::close (fcpl);
+    HDF5Property::close (fapl);
+
     return fileTruncated;
   }
+
+  //_____________________________________________________________________________
+  //                                                                openFileImage
+
+  /*!
+    The file is opened through the core file driver without backing store,
+    i.e. changes to the file never go to disk; use fileImage() to retrieve
+    the modified contents.
+
+    \param buffer -- Buffer holding the image of an HDF5 file, e.g. as
+           retrieved through fileImage(); the buffer is copied, such that it
+	   can be released once the function returns.
+    \param size   -- Size of the image, [Bytes].
+    \param flags  -- I/O mode flags; IO_Mode::ReadWrite permits modification
+           of the (copied) image, IO_Mode::increment sets the step by which it
+	   grows.
+    \return fileID -- Identifier for the opened file; returns a negative value
+            in case the operation failed.
+  */
+  hid_t HDF5Object::openFileImage (void const *buffer,
+				   size_t const &size,
+				   IO_Mode const &flags)
+  {
+    static unsigned int nofImages (0);
+    hid_t fileID (-1);
+    hid_t fapl = H5Pcreate (H5P_FILE_ACCESS);
+    std::ostringstream name;
+
+    /* The core driver identifies files without backing store by their name */
+    name << "HDF5Object::openFileImage." << nofImages++;
+
+    if (H5Pset_fapl_core (fapl, flags.increment(), false) < 0
+	|| H5Pset_file_image (fapl, const_cast<void *>(buffer), size) < 0) {
+      std::cerr << "[HDF5Object::openFileImage] Failed to set up file image!"
+		<< std::endl;
+    } else if ( flags.flags() & IO_Mode::ReadWrite ) {
+      fileID = H5Fopen (name.str().c_str(), H5F_ACC_RDWR, fapl);
+    } else {
+      fileID = H5Fopen (name.str().c_str(), H5F_ACC_RDONLY, fapl);
+    }
+
+    H5Pclose (fapl);
+
+    return fileID;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                    fileImage
+
+  /*!
+    Flushes the file, to which \c location is attached, and copies its
+    contents into \c image; the result can be written to disk as-is, sent
+    over the network or re-opened through openFileImage(). This works for
+    files opened through any driver, though it is cheapest for files kept in
+    memory (IO_Mode::InMemory).
+
+    \retval image   -- Image of the file.
+    \param location -- Identifier of the file or of an object within it.
+    \return status  -- Status of the operation; returns \e false in case an
+            error was encountered.
+  */
+  bool HDF5Object::fileImage (std::vector<char> &image,
+			      hid_t const &location)
+  {
+    image.clear();
+
+    if (!H5Iis_valid(location)) {
+      std::cerr << "[HDF5Object::fileImage] Invalid object identifier!"
+		<< std::endl;
+      return false;
+    }
+
+    if (H5Fflush (location, H5F_SCOPE_GLOBAL) < 0) {
+      std::cerr << "[HDF5Object::fileImage] Failed to flush file!"
+		<< std::endl;
+      return false;
+    }
+
+    ssize_t size = H5Fget_file_image (location, NULL, 0);
+
+    if (size < 0) {
+      std::cerr << "[HDF5Object::fileImage] Failed to get size of file image!"
+		<< std::endl;
+      return false;
+    }
+
+    image.resize (size);
+
+    if (size > 0 && H5Fget_file_image (location, &image[0], size) != size) {
+      std::cerr << "[HDF5Object::fileImage] Failed to get file image!"
+		<< std::endl;
+      image.clear();
+      return false;
+    }
+
+    return true;
+  }
   
   //_____________________________________________________________________________
   //                                                                         open
@@ -26,10 +26,12 @@
 #include <fstream>
 #include <map>
 #include <set>
+#include <sstream>
 #include <string>
 #include <vector>
 
 #include <core/IO_Mode.h>
+#include <core/HDF5Property.h>
 
 namespace DAL { // Namespace DAL -- begin
   
@@ -301,11 +303,25 @@ namespace DAL { // Namespace DAL -- begin
     
     //! Open HDF5 file
     static hid_t openFile (std::string const &filename,
-			   IO_Mode const &flags=IO_Mode(IO_Mode::OpenOrCreate));
+			   IO_Mode const &flags=IO_Mode(IO_Mode::OpenOrCreate),
+			   HDF5Property const &properties=HDF5Property());
     //! Open HDF5 file
     static bool openFile (hid_t &fileID,
 			  std::string const &filename,
-			  IO_Mode const &flags=IO_Mode(IO_Mode::OpenOrCreate));
+			  IO_Mode const &flags=IO_Mode(IO_Mode::OpenOrCreate),
+			  HDF5Property const &properties=HDF5Property());
+    //! Open an HDF5 file from an image in memory
+    static hid_t openFileImage (void const *buffer,
+				size_t const &size,
+				IO_Mode const &flags=IO_Mode(IO_Mode::ReadOnly));
+    //! Open an HDF5 file from an image in memory
+    static inline hid_t openFileImage (std::vector<char> const &image,
+				       IO_Mode const &flags=IO_Mode(IO_Mode::ReadOnly)) {
+      return openFileImage (image.empty() ? NULL : &image[0], image.size(), flags);
+    }
+    //! Get the image of an HDF5 file
+    static bool fileImage (std::vector<char> &image,
+			   hid_t const &location);
     
     //! Open an object in an HDF5 file
     static hid_t open (hid_t const &location,
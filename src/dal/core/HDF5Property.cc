@@ -20,6 +20,14 @@
 
 #include "HDF5Property.h"
 
+/* File-space strategies and paged aggregation were introduced with
+   HDF5 1.10.1 */
+#ifdef H5_VERSION_GE
+#if H5_VERSION_GE(1,10,1)
+#define DAL_HDF5_FILE_SPACE_STRATEGY
+#endif
+#endif
+
 namespace DAL { // Namespace DAL -- begin
   
   // ============================================================================
@@ -29,7 +37,9 @@ namespace DAL { // Namespace DAL -- begin
   // ============================================================================
   
   HDF5Property::HDF5Property ()
-  {;}
+  {
+    init ();
+  }
   
   /*!
     \param other -- Another HDF5Property object from which to create this new
@@ -79,6 +89,15 @@ namespace DAL { // Namespace DAL -- begin
   {
     fileAccessFlag_p.clear();
     fileAccessFlag_p = other.fileAccessFlag_p;
+
+    itsFileSpaceStrategy  = other.itsFileSpaceStrategy;
+    itsPersistFreeSpace   = other.itsPersistFreeSpace;
+    itsPageSize           = other.itsPageSize;
+    itsPageBufferSize     = other.itsPageBufferSize;
+    itsAlignmentThreshold = other.itsAlignmentThreshold;
+    itsAlignment          = other.itsAlignment;
+    itsMetadataCacheSize  = other.itsMetadataCacheSize;
+    itsLatestFormat       = other.itsLatestFormat;
   }
 
   // ============================================================================
@@ -96,6 +115,14 @@ namespace DAL { // Namespace DAL -- begin
   void HDF5Property::summary (std::ostream &os)
   {
     os << "[HDF5Property] Summary of internal parameters." << std::endl;
+    os << "-- File-space strategy       = " << strategyName(itsFileSpaceStrategy) << std::endl;
+    os << "-- Persistent free space     = " << itsPersistFreeSpace   << std::endl;
+    os << "-- Page size        [Bytes]  = " << itsPageSize           << std::endl;
+    os << "-- Page buffer size [Bytes]  = " << itsPageBufferSize     << std::endl;
+    os << "-- Alignment        [Bytes]  = " << itsAlignment          << std::endl;
+    os << "-- Alignment threshold       = " << itsAlignmentThreshold << std::endl;
+    os << "-- Metadata cache   [Bytes]  = " << itsMetadataCacheSize  << std::endl;
+    os << "-- Latest file format        = " << itsLatestFormat       << std::endl;
   }
   
   // ============================================================================
@@ -103,7 +130,201 @@ namespace DAL { // Namespace DAL -- begin
   //  Methods
   //
   // ============================================================================
-  
-  
+
+  //_____________________________________________________________________________
+  //                                                                         init
+
+  void HDF5Property::init ()
+  {
+    fileAccessFlag_p.clear();
+
+    itsFileSpaceStrategy  = HDF5Property::DefaultStrategy;
+    itsPersistFreeSpace   = false;
+    itsPageSize           = 0;
+    itsPageBufferSize     = 0;
+    itsAlignmentThreshold = 1;
+    itsAlignment          = 1;
+    itsMetadataCacheSize  = 0;
+    itsLatestFormat       = false;
+  }
+
+  //_____________________________________________________________________________
+  //                                                             fileCreationList
+
+  /*!
+    \return fcpl -- File-creation property list for \c H5Fcreate; \c H5P_DEFAULT
+            if no file-space strategy or page size has been set, otherwise a
+	    new property list, which is to be released through close().
+  */
+  hid_t HDF5Property::fileCreationList () const
+  {
+    if (itsFileSpaceStrategy == HDF5Property::DefaultStrategy
+	&& itsPageSize == 0) {
+      return H5P_DEFAULT;
+    }
+
+#ifdef DAL_HDF5_FILE_SPACE_STRATEGY
+    hid_t fcpl = H5Pcreate (H5P_FILE_CREATE);
+    H5F_fspace_strategy_t strategy;
+
+    switch (itsFileSpaceStrategy) {
+    case HDF5Property::PagedAggregation:
+      strategy = H5F_FSPACE_STRATEGY_PAGE;
+      break;
+    case HDF5Property::Aggregation:
+      strategy = H5F_FSPACE_STRATEGY_AGGR;
+      break;
+    case HDF5Property::NoAggregation:
+      strategy = H5F_FSPACE_STRATEGY_NONE;
+      break;
+    default:
+      strategy = H5F_FSPACE_STRATEGY_FSM_AGGR;
+      break;
+    };
+
+    if (H5Pset_file_space_strategy (fcpl, strategy, itsPersistFreeSpace, 1) < 0) {
+      std::cerr << "[HDF5Property::fileCreationList]"
+		<< " Failed to set file-space strategy!" << std::endl;
+    }
+
+    if (itsPageSize > 0 && H5Pset_file_space_page_size (fcpl, itsPageSize) < 0) {
+      std::cerr << "[HDF5Property::fileCreationList]"
+		<< " Failed to set page size " << itsPageSize << "!" << std::endl;
+    }
+
+    return fcpl;
+#else
+    std::cerr << "[HDF5Property::fileCreationList]"
+	      << " File-space strategies require HDF5 1.10.1 or later!"
+	      << std::endl;
+    return H5P_DEFAULT;
+#endif
+  }
+
+  //_____________________________________________________________________________
+  //                                                               fileAccessList
+
+  /*!
+    \param flags -- I/O mode flags; for IO_Mode::InMemory the property list
+           selects the core file driver (see IO_Mode::fileAccessList).
+    \return fapl -- File-access property list for \c H5Fcreate and \c H5Fopen;
+            \c H5P_DEFAULT if neither the settings nor the I/O mode flags
+	    require a property list of their own, otherwise a new property list,
+	    which is to be released through close().
+  */
+  hid_t HDF5Property::fileAccessList (IO_Mode const &flags) const
+  {
+    hid_t fapl = flags.fileAccessList();
+
+    if (itsPageBufferSize == 0
+	&& itsAlignment <= 1
+	&& itsMetadataCacheSize == 0
+	&& !itsLatestFormat) {
+      return fapl;
+    }
+
+    if (fapl == H5P_DEFAULT) {
+      fapl = H5Pcreate (H5P_FILE_ACCESS);
+    }
+
+    /* Page buffer */
+    if (itsPageBufferSize > 0) {
+#ifdef DAL_HDF5_FILE_SPACE_STRATEGY
+      if (H5Pset_page_buffer_size (fapl, itsPageBufferSize, 0, 0) < 0) {
+	std::cerr << "[HDF5Property::fileAccessList]"
+		  << " Failed to set page buffer size!" << std::endl;
+      }
+#else
+      std::cerr << "[HDF5Property::fileAccessList]"
+		<< " Page buffering requires HDF5 1.10.1 or later!"
+		<< std::endl;
+#endif
+    }
+
+    /* Alignment of objects */
+    if (itsAlignment > 1) {
+      if (H5Pset_alignment (fapl, itsAlignmentThreshold, itsAlignment) < 0) {
+	std::cerr << "[HDF5Property::fileAccessList]"
+		  << " Failed to set alignment!" << std::endl;
+      }
+    }
+
+    /* Metadata cache */
+    if (itsMetadataCacheSize > 0) {
+      H5AC_cache_config_t config;
+      config.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+
+      if (H5Pget_mdc_config (fapl, &config) < 0) {
+	std::cerr << "[HDF5Property::fileAccessList]"
+		  << " Failed to get metadata cache configuration!" << std::endl;
+      } else {
+	config.set_initial_size = true;
+	config.initial_size     = itsMetadataCacheSize;
+	if (config.max_size < itsMetadataCacheSize) {
+	  config.max_size = itsMetadataCacheSize;
+	}
+	if (config.min_size > itsMetadataCacheSize) {
+	  config.min_size = itsMetadataCacheSize;
+	}
+	if (H5Pset_mdc_config (fapl, &config) < 0) {
+	  std::cerr << "[HDF5Property::fileAccessList]"
+		    << " Failed to set metadata cache size!" << std::endl;
+	}
+      }
+    }
+
+    /* Version bounds of the file format */
+    if (itsLatestFormat) {
+      if (H5Pset_libver_bounds (fapl, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) < 0) {
+	std::cerr << "[HDF5Property::fileAccessList]"
+		  << " Failed to set version bounds!" << std::endl;
+      }
+    }
+
+    return fapl;
+  }
+
+  // ============================================================================
+  //
+  //  Static methods
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                 strategyName
+
+  /*!
+    \param strategy -- File-space strategy.
+    \return name    -- Name of the file-space strategy.
+  */
+  std::string HDF5Property::strategyName (FileSpaceStrategy const &strategy)
+  {
+    switch (strategy) {
+    case HDF5Property::FreeSpaceManager:
+      return "FreeSpaceManager";
+    case HDF5Property::PagedAggregation:
+      return "PagedAggregation";
+    case HDF5Property::Aggregation:
+      return "Aggregation";
+    case HDF5Property::NoAggregation:
+      return "NoAggregation";
+    default:
+      return "DefaultStrategy";
+    };
+  }
+
+  //_____________________________________________________________________________
+  //                                                                        close
+
+  /*!
+    \param plist -- Property list as returned by fileCreationList() or
+           fileAccessList(); \c H5P_DEFAULT is skipped.
+  */
+  void HDF5Property::close (hid_t const &plist)
+  {
+    if (plist != H5P_DEFAULT && H5Iis_valid(plist)) {
+      H5Pclose (plist);
+    }
+  }
 
 } // Namespace DAL -- end
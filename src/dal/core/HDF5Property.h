@@ -26,7 +26,7 @@
 #include <map>
 #include <string>
 
-#include "dalCommon.h"
+#include <core/IO_Mode.h>
 
 namespace DAL { // Namespace DAL -- begin
   
@@ -36,7 +36,7 @@ namespace DAL { // Namespace DAL -- begin
     \ingroup DAL
     \ingroup core
     
-    \brief Brief description for class HDF5Property
+    \brief Settings for the file-creation and file-access property lists
     
     \author Lars B&auml;hren
 
@@ -47,18 +47,132 @@ namespace DAL { // Namespace DAL -- begin
     <h3>Prerequisite</h3>
     
     <ul type="square">
-      <li>[start filling in your text here]
+      <li>DAL::IO_Mode
+      <li>HDF5 property lists (\c H5Pcreate, \c H5Pset_*)
     </ul>
     
     <h3>Synopsis</h3>
+
+    By default files are created and opened with the default property lists
+    of the HDF5 library, such that small pieces of metadata end up scattered
+    in between the (large) blocks of data, at arbitrary offsets. On parallel
+    and RAID file systems (e.g. Lustre) these small, unaligned writes hurt
+    throughput considerably. An HDF5Property object collects the settings
+    addressing this, and turns them into the property lists passed to
+    \c H5Fcreate and \c H5Fopen:
+
+    <table border=0>
+      <tr>
+        <td class="indexkey">Setting</td>
+        <td class="indexkey">Property list</td>
+        <td class="indexkey">HDF5 function</td>
+      </tr>
+      <tr>
+        <td>File-space strategy / paged aggregation</td>
+        <td>creation</td>
+        <td>\c H5Pset_file_space_strategy, \c H5Pset_file_space_page_size</td>
+      </tr>
+      <tr>
+        <td>Page buffer</td>
+        <td>access</td>
+        <td>\c H5Pset_page_buffer_size</td>
+      </tr>
+      <tr>
+        <td>Data alignment</td>
+        <td>access</td>
+        <td>\c H5Pset_alignment</td>
+      </tr>
+      <tr>
+        <td>Metadata cache size</td>
+        <td>access</td>
+        <td>\c H5Pset_mdc_config</td>
+      </tr>
+      <tr>
+        <td>Latest file format</td>
+        <td>access</td>
+        <td>\c H5Pset_libver_bounds</td>
+      </tr>
+    </table>
+
+    With <i>paged aggregation</i> (HDF5Property::PagedAggregation) metadata
+    and raw data are allocated in separate pages of fixed size, such that
+    metadata is written in large, aligned pieces; the page buffer then caches
+    complete pages. The page buffer can only be used for files created with
+    paged aggregation and must be at least one page in size. File-space
+    strategies require HDF5 1.10.1 or later; with older versions of the library
+    the setting is ignored (with a warning).
+
+    Settings left at their defaults are not applied, i.e. for a default object
+    fileCreationList() and fileAccessList() return \c H5P_DEFAULT.
     
     <h3>Example(s)</h3>
+
+    <ol>
+      <li>Create a file with 4 MB pages, a page buffer of 64 MB and data blocks
+      of at least 1 MB aligned to 1 MB boundaries:
+      \code
+      DAL::HDF5Property properties;
+
+      properties.setFileSpaceStrategy (DAL::HDF5Property::PagedAggregation);
+      properties.setPageSize (4194304);
+      properties.setPageBufferSize (67108864);
+      properties.setAlignment (1048576, 1048576);
+
+      DAL::dalDataset dataset ("tbb.h5",
+                               "HDF5",
+                               DAL::IO_Mode(DAL::IO_Mode::Create),
+                               properties);
+      \endcode
+      <li>Create the property lists by hand:
+      \code
+      hid_t fcpl   = properties.fileCreationList();
+      hid_t fapl   = properties.fileAccessList();
+      hid_t fileID = H5Fcreate ("data.h5", H5F_ACC_TRUNC, fcpl, fapl);
+
+      HDF5Property::close (fcpl);
+      HDF5Property::close (fapl);
+      \endcode
+    </ol>
     
   */  
   class HDF5Property {
 
+  public:
+
+    //! Strategy for the management of file space
+    enum FileSpaceStrategy {
+      //! Library default (currently equivalent to FreeSpaceManager)
+      DefaultStrategy,
+      //! Free-space managers, aggregators and virtual file driver
+      FreeSpaceManager,
+      //! Free-space managers with paged aggregation
+      PagedAggregation,
+      //! Aggregators and virtual file driver, no free-space tracking
+      Aggregation,
+      //! Virtual file driver only
+      NoAggregation
+    };
+
+  private:
+
     //! Link traversal file access flag
     std::map<hid_t,std::string> fileAccessFlag_p;
+    //! File-space strategy
+    FileSpaceStrategy itsFileSpaceStrategy;
+    //! Keep track of free space across closing and re-opening the file?
+    bool itsPersistFreeSpace;
+    //! Page size for paged aggregation, [Bytes]; 0 for the library default
+    hsize_t itsPageSize;
+    //! Size of the page buffer, [Bytes]; 0 disables the page buffer
+    size_t itsPageBufferSize;
+    //! Objects at least this size are aligned, [Bytes]
+    hsize_t itsAlignmentThreshold;
+    //! Alignment of objects within the file, [Bytes]; 1 disables alignment
+    hsize_t itsAlignment;
+    //! Initial size of the metadata cache, [Bytes]; 0 for the library default
+    size_t itsMetadataCacheSize;
+    //! Use the latest version of the file format?
+    bool itsLatestFormat;
     
   public:
     
@@ -85,6 +199,91 @@ namespace DAL { // Namespace DAL -- begin
     HDF5Property& operator= (HDF5Property const &other); 
     
     // === Parameter access =====================================================
+
+    //! Get the file-space strategy
+    inline FileSpaceStrategy fileSpaceStrategy () const {
+      return itsFileSpaceStrategy;
+    }
+
+    /*!
+      \brief Set the file-space strategy
+      \param strategy -- Strategy for the management of file space.
+      \param persist  -- Keep track of free space across closing and
+             re-opening the file?
+    */
+    inline void setFileSpaceStrategy (FileSpaceStrategy const &strategy,
+				      bool const &persist=false) {
+      itsFileSpaceStrategy = strategy;
+      itsPersistFreeSpace  = persist;
+    }
+
+    //! Is free space tracked across closing and re-opening the file?
+    inline bool persistFreeSpace () const {
+      return itsPersistFreeSpace;
+    }
+
+    //! Get the page size for paged aggregation, [Bytes]
+    inline hsize_t pageSize () const {
+      return itsPageSize;
+    }
+
+    //! Set the page size for paged aggregation, [Bytes]
+    inline void setPageSize (hsize_t const &pageSize) {
+      itsPageSize = pageSize;
+    }
+
+    //! Get the size of the page buffer, [Bytes]
+    inline size_t pageBufferSize () const {
+      return itsPageBufferSize;
+    }
+
+    //! Set the size of the page buffer, [Bytes]; 0 disables the page buffer
+    inline void setPageBufferSize (size_t const &size) {
+      itsPageBufferSize = size;
+    }
+
+    //! Get the alignment of objects within the file, [Bytes]
+    inline hsize_t alignment () const {
+      return itsAlignment;
+    }
+
+    //! Get the size above which objects are aligned, [Bytes]
+    inline hsize_t alignmentThreshold () const {
+      return itsAlignmentThreshold;
+    }
+
+    /*!
+      \brief Set the alignment of objects within the file
+      \param alignment -- Alignment, [Bytes]; objects are placed at a multiple
+             of this value. 1 disables alignment.
+      \param threshold -- Only objects at least this size are aligned, [Bytes];
+             use e.g. the chunk size to align data, but not metadata.
+    */
+    inline void setAlignment (hsize_t const &alignment,
+			      hsize_t const &threshold=1) {
+      itsAlignment          = alignment;
+      itsAlignmentThreshold = threshold;
+    }
+
+    //! Get the initial size of the metadata cache, [Bytes]
+    inline size_t metadataCacheSize () const {
+      return itsMetadataCacheSize;
+    }
+
+    //! Set the initial size of the metadata cache, [Bytes]; 0 for the default
+    inline void setMetadataCacheSize (size_t const &size) {
+      itsMetadataCacheSize = size;
+    }
+
+    //! Use the latest version of the file format?
+    inline bool latestFormat () const {
+      return itsLatestFormat;
+    }
+
+    //! Enable/disable use of the latest version of the file format
+    inline void setLatestFormat (bool const &latestFormat) {
+      itsLatestFormat = latestFormat;
+    }
     
     /*!
       \brief Get the name of the class
@@ -104,8 +303,20 @@ namespace DAL { // Namespace DAL -- begin
     void summary (std::ostream &os);    
 
     // === Methods ==============================================================
-    
-    
+
+    //! Create the file-creation property list matching the settings
+    hid_t fileCreationList () const;
+
+    //! Create the file-access property list matching the settings
+    hid_t fileAccessList (IO_Mode const &flags=IO_Mode()) const;
+
+    // === Static methods =======================================================
+
+    //! Get the name of a file-space strategy
+    static std::string strategyName (FileSpaceStrategy const &strategy);
+
+    //! Release a property list created by fileCreationList/fileAccessList
+    static void close (hid_t const &plist);
     
   private:
 
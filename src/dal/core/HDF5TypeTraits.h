@@ -0,0 +1,169 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#ifndef HDF5TYPETRAITS_H
+#define HDF5TYPETRAITS_H
+
+// Standard library header files
+#include <complex>
+#include <string>
+
+#include <core/HDF5Datatype.h>
+
+namespace DAL { // Namespace DAL -- begin
+
+  /*!
+    \class HDF5TypeTraits
+
+    \ingroup DAL
+    \ingroup core
+
+    \brief Map a C++ type onto the matching native HDF5 datatype
+
+    \author agent
+
+    \date 2026/10/18
+
+    \test tHDF5Datatype.cc
+
+    <h3>Synopsis</h3>
+
+    Reading or writing typed data requires the identifier of the HDF5 datatype
+    describing the elements in memory. Rather than passing this identifier
+    along with each call (with the risk of a mismatch, which silently makes the
+    library convert each element), HDF5TypeTraits<T>::type() provides it for a
+    given type \c T. The mapping is resolved at compile time: there is no
+    definition of the primary template, such that using a type for which no
+    specialization exists results in a compilation error rather than in a
+    runtime conversion.
+
+    Specializations are provided for the native integer and floating point
+    types, \c bool and the complex types <tt>std::complex<T></tt> with
+    \c T = \c short (i.e. \c int16_t), \c int, \c float and \c double; the
+    latter are described by a compound datatype with members \e real and
+    \e imag (see HDF5Datatype::complexType). Further types (e.g.
+    DAL::BFRawFormat::Sample) are added by specializing the template next to
+    the definition of the type.
+
+    The native types are library constants which only become available once
+    the library has been initialized, hence type() is a function rather than a
+    constant; compound types are created once and then kept for the remainder
+    of the program.
+
+    <h3>Example(s)</h3>
+
+    <ol>
+      <li>Get the datatype for an array of complex numbers:
+      \code
+      hid_t datatype = DAL::HDF5TypeTraits<std::complex<float> >::type();
+      \endcode
+      <li>Add a mapping for a user-defined structure:
+      \code
+      namespace DAL {
+        template <> struct HDF5TypeTraits<MyStruct> {
+          static hid_t type () {
+            static hid_t id = -1;
+            if (!H5Iis_valid(id)) {
+              id = H5Tcreate (H5T_COMPOUND, sizeof(MyStruct));
+              H5Tinsert (id, "x", HOFFSET(MyStruct,x), H5T_NATIVE_INT);
+            }
+            return id;
+          }
+        };
+      }
+      \endcode
+    </ol>
+  */
+  template <class T> struct HDF5TypeTraits;
+
+  /// @cond TEMPLATE_SPECIALIZATIONS
+
+  template <> struct HDF5TypeTraits<bool> {
+    static hid_t type () { return H5T_NATIVE_HBOOL; }
+  };
+
+  template <> struct HDF5TypeTraits<char> {
+    static hid_t type () { return H5T_NATIVE_CHAR; }
+  };
+
+  template <> struct HDF5TypeTraits<signed char> {
+    static hid_t type () { return H5T_NATIVE_SCHAR; }
+  };
+
+  template <> struct HDF5TypeTraits<unsigned char> {
+    static hid_t type () { return H5T_NATIVE_UCHAR; }
+  };
+
+  template <> struct HDF5TypeTraits<short> {
+    static hid_t type () { return H5T_NATIVE_SHORT; }
+  };
+
+  template <> struct HDF5TypeTraits<unsigned short> {
+    static hid_t type () { return H5T_NATIVE_USHORT; }
+  };
+
+  template <> struct HDF5TypeTraits<int> {
+    static hid_t type () { return H5T_NATIVE_INT; }
+  };
+
+  template <> struct HDF5TypeTraits<unsigned int> {
+    static hid_t type () { return H5T_NATIVE_UINT; }
+  };
+
+  template <> struct HDF5TypeTraits<long> {
+    static hid_t type () { return H5T_NATIVE_LONG; }
+  };
+
+  template <> struct HDF5TypeTraits<unsigned long> {
+    static hid_t type () { return H5T_NATIVE_ULONG; }
+  };
+
+  template <> struct HDF5TypeTraits<long long> {
+    static hid_t type () { return H5T_NATIVE_LLONG; }
+  };
+
+  template <> struct HDF5TypeTraits<unsigned long long> {
+    static hid_t type () { return H5T_NATIVE_ULLONG; }
+  };
+
+  template <> struct HDF5TypeTraits<float> {
+    static hid_t type () { return H5T_NATIVE_FLOAT; }
+  };
+
+  template <> struct HDF5TypeTraits<double> {
+    static hid_t type () { return H5T_NATIVE_DOUBLE; }
+  };
+
+  template <class T> struct HDF5TypeTraits<std::complex<T> > {
+    static hid_t type () {
+      static hid_t id = -1;
+      if (!H5Iis_valid(id)) {
+	id = HDF5Datatype::complexType (HDF5TypeTraits<T>::type(),
+					sizeof(std::complex<T>));
+      }
+      return id;
+    }
+  };
+
+  /// @endcond
+
+} // Namespace DAL -- end
+
+#endif /* HDF5TYPETRAITS_H */
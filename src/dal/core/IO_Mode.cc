@@ -41,6 +41,7 @@ namespace DAL { // Namespace DAL -- begin
   
   IO_Mode::IO_Mode (IO_Mode::Flags const &flag)
   {
+    init();
     setFlag (flag);
   }
   
@@ -49,6 +50,7 @@ namespace DAL { // Namespace DAL -- begin
   
   IO_Mode::IO_Mode (int const &flags)
   {
+    init();
     setFlags (flags);
   }
 
@@ -101,7 +103,9 @@ namespace DAL { // Namespace DAL -- begin
   
   void IO_Mode::copy (IO_Mode const &other)
   {
-    itsFlags = other.itsFlags;
+    itsFlags        = other.itsFlags;
+    itsBackingStore = other.itsBackingStore;
+    itsIncrement    = other.itsIncrement;
   }
 
   // ============================================================================
@@ -129,6 +133,11 @@ namespace DAL { // Namespace DAL -- begin
       os << " " << flagNames[n];
     }
     os << " ]" << std::endl;
+
+    if (itsFlags & IO_Mode::InMemory) {
+      os << "-- Backing store     = " << itsBackingStore << std::endl;
+      os << "-- Increment [Bytes] = " << itsIncrement    << std::endl;
+    }
   }
   
   // ============================================================================
@@ -228,6 +237,8 @@ namespace DAL { // Namespace DAL -- begin
     flags[IO_Mode::WriteOnly]    = "WriteOnly";
     flags[IO_Mode::ReadWrite]    = "ReadWrite";
 
+    flags[IO_Mode::InMemory]     = "InMemory";
+
     return flags;
   }
 
@@ -366,6 +377,34 @@ namespace DAL { // Namespace DAL -- begin
     }
     
   }
+
+  //_____________________________________________________________________________
+  //                                                               fileAccessList
+
+  /*!
+    \return fapl -- File access property list for opening/creating a file with
+            the current settings; \c H5P_DEFAULT unless the IO_Mode::InMemory
+	    flag is set, in which case a new property list selecting the core
+	    file driver is returned, which must be released through
+	    \c H5Pclose by the caller.
+  */
+  hid_t IO_Mode::fileAccessList () const
+  {
+    if ( (itsFlags & IO_Mode::InMemory) == 0 ) {
+      return H5P_DEFAULT;
+    }
+
+    hid_t fapl = H5Pcreate (H5P_FILE_ACCESS);
+
+    if (H5Pset_fapl_core (fapl, itsIncrement, itsBackingStore) < 0) {
+      std::cerr << "[IO_Mode::fileAccessList] Failed to set core file driver!"
+		<< std::endl;
+      H5Pclose (fapl);
+      return H5P_DEFAULT;
+    }
+
+    return fapl;
+  }
 #endif
   
   //_____________________________________________________________________________
@@ -363,7 +363,32 @@ namespace DAL { // Namespace DAL -- begin
 
     \image html DAL_IO_Mode.png
 
+    For HDF5 files the IO_Mode::InMemory flag selects the \e core file driver:
+    the complete file is held in memory, which grows in steps of
+    IO_Mode::increment bytes. With the backing store enabled (see
+    IO_Mode::setBackingStore) the contents is written to the file on disk
+    once, when the file is closed; without it the disk is not touched at all
+    and the file can only be kept by exporting its image (see
+    HDF5Object::fileImage).
+
     <h3>Example(s)</h3>
+
+    <ol>
+      <li>Create a file which is kept in memory and written to disk only once,
+      when it is closed:
+      \code
+      DAL::IO_Mode flags (DAL::IO_Mode::Create | DAL::IO_Mode::InMemory);
+      flags.setBackingStore (true);
+      flags.setIncrement (64*1048576);
+
+      hid_t fileID = DAL::HDF5Object::openFile ("event.h5", flags);
+      \endcode
+      <li>Create a scratch file which never touches the disk:
+      \code
+      DAL::dalDataset dataset ("scratch.h5", "HDF5",
+                               DAL::IO_Mode(DAL::IO_Mode::Create|DAL::IO_Mode::InMemory));
+      \endcode
+    </ol>
     
   */  
   class IO_Mode {
@@ -431,6 +456,13 @@ namespace DAL { // Namespace DAL -- begin
 	  <td>ACC_RDWR</td>
 	  <td>ReadWrite</td>
 	</tr>
+        <tr>
+	  <td>DAL::IO::InMemory</td>
+	  <td>---</td>
+	  <td>---</td>
+	  <td>H5Pset_fapl_core</td>
+	  <td>---</td>
+	</tr>
       </table>
       </center>
     */
@@ -450,13 +482,19 @@ namespace DAL { // Namespace DAL -- begin
       //! Write access to the object.
       WriteOnly    = 64,
       //! Read and write access to the object.
-      ReadWrite    = 128
+      ReadWrite    = 128,
+      //! Keep the object in memory (HDF5 core file driver).
+      InMemory     = 256
     };
 
   private:
 
     //! Object I/O mode flags
     int itsFlags;
+    //! Write an in-memory file to disk when it is closed?
+    bool itsBackingStore;
+    //! Increment by which the memory of an in-memory file grows, [Bytes]
+    size_t itsIncrement;
 
   public:
     
@@ -524,6 +562,35 @@ namespace DAL { // Namespace DAL -- begin
     //! Reset the object I/O mode flags
     bool resetFlags ();
 
+    //! Is the contents of an in-memory file written to disk when closed?
+    inline bool backingStore () const {
+      return itsBackingStore;
+    }
+
+    /*!
+      \brief Enable/disable writing an in-memory file to disk when closed
+      \param backingStore -- Write the contents of the file to disk when it is
+             closed? If set to \e false, the file never touches the disk; this
+	     only takes effect together with the IO_Mode::InMemory flag.
+    */
+    inline void setBackingStore (bool const &backingStore) {
+      itsBackingStore = backingStore;
+    }
+
+    //! Get the increment by which the memory of an in-memory file grows
+    inline size_t increment () const {
+      return itsIncrement;
+    }
+
+    /*!
+      \brief Set the increment by which the memory of an in-memory file grows
+      \param increment -- Increment, [Bytes]; choose it of the order of the
+             expected size of the file to avoid repeated reallocation.
+    */
+    inline void setIncrement (size_t const &increment) {
+      itsIncrement = increment;
+    }
+
     // === Public methods =======================================================
 
     //! Get array containing the available flag names
@@ -536,6 +603,9 @@ namespace DAL { // Namespace DAL -- begin
     inline hid_t flagH5Fcreate () {
       return flagH5Fcreate (itsFlags);
     }
+
+    //! Create the file access property list matching the settings
+    hid_t fileAccessList () const;
 #endif
 
     //! Provide a summary of the object's internal parameters and status
@@ -584,7 +654,9 @@ namespace DAL { // Namespace DAL -- begin
 
     //! Initialize internal parameters
     inline void init () {
-      itsFlags = IO_Mode::Open | IO_Mode::ReadOnly;
+      itsFlags        = IO_Mode::Open | IO_Mode::ReadOnly;
+      itsBackingStore = false;
+      itsIncrement    = 1048576;
     }
     
     //! Unconditional copying
@@ -19,6 +19,7 @@
  ***************************************************************************/
 
 #include <core/dalArray.h>
+#include <core/HDF5Handle.h>
 
 namespace DAL {
 
@@ -118,50 +119,45 @@ namespace DAL {
     hsize_t      dims[1] = { arraysize };
     int32_t      itsRank  = 1;
     hsize_t      off[1]  = { offset };
-    hid_t filespace      = 0;
-    hid_t dataspace      = 0;
+    HDF5Handle filespace;
+    HDF5Handle dataspace;
     
     /* Select a hyperslab  */
-    if ( ( filespace = H5Dget_space( itsDatasetID ) ) < 0 )
+    filespace.reset (H5Dget_space (itsDatasetID));
+    if ( !filespace.isValid() )
       {
         std::cerr << "ERROR: Could not get filespace for array.\n";
         return DAL::FAIL;
       }
     
-    if ( H5Sselect_hyperslab( filespace, H5S_SELECT_SET, off, NULL,
+    if ( H5Sselect_hyperslab( filespace.id(), H5S_SELECT_SET, off, NULL,
                               dims, NULL) < 0 )
       {
         std::cerr << "ERROR: Could not select hyperslab for array.\n";
-        H5Sclose(filespace);
         return DAL::FAIL;
       }
     
     /* Define memory space */
-    if ( ( dataspace = H5Screate_simple (itsRank, dims, NULL) ) < 0 )
+    dataspace.reset (H5Screate_simple (itsRank, dims, NULL));
+    if ( !dataspace.isValid() )
       {
         std::cerr << "ERROR: Could not create dataspace for array.\n";
-        H5Sclose(filespace);
         return DAL::FAIL;
       }
 
     /* Write the data to the hyperslab  */
     if ( H5Dwrite( itsDatasetID,
 		   H5T_NATIVE_INT,
-		   dataspace,
-		   filespace,
+		   dataspace.id(),
+		   filespace.id(),
                    H5P_DEFAULT,
 		   data ) < 0 )
       {
         std::cerr << "ERROR: Could not write integer array.\n";
-        H5Sclose(dataspace);
-        H5Sclose(filespace);
         return DAL::FAIL;
       }
 
-    /* Close the memory- and data-space */
-    H5Sclose(dataspace);
-    H5Sclose(filespace);
-
+    /* The memory- and data-space are closed when going out of scope */
     return DAL::SUCCESS;
   }
   
@@ -183,46 +179,41 @@ namespace DAL {
     hsize_t      dims[1] = { arraysize };
     int32_t      itsRank  = 1;
     hsize_t      off[1]  = { offset };
-    hid_t filespace      = 0;
-    hid_t dataspace      = 0;
+    HDF5Handle filespace;
+    HDF5Handle dataspace;
     
     /* Select a hyperslab  */
-    if ( ( filespace = H5Dget_space( itsDatasetID ) ) < 0 )
+    filespace.reset (H5Dget_space (itsDatasetID));
+    if ( !filespace.isValid() )
       {
         std::cerr << "ERROR: Could not get filespace for array.\n";
         return DAL::FAIL;
       }
 
-    if ( H5Sselect_hyperslab( filespace, H5S_SELECT_SET, off, NULL,
+    if ( H5Sselect_hyperslab( filespace.id(), H5S_SELECT_SET, off, NULL,
                               dims, NULL ) < 0 )
       {
         std::cerr << "ERROR: Could not select hyperslab for array.\n";
-        H5Sclose(filespace);
         return DAL::FAIL;
       }
 
     /* Define memory space */
-    if ( ( dataspace = H5Screate_simple (itsRank, dims, NULL) ) < 0 )
+    dataspace.reset (H5Screate_simple (itsRank, dims, NULL));
+    if ( !dataspace.isValid() )
       {
         std::cerr << "ERROR: Could not create dataspace for array.\n";
-        H5Sclose(filespace);
         return DAL::FAIL;
       }
 
     /* Write the data to the hyperslab  */
-    if ( H5Dwrite (itsDatasetID, H5T_NATIVE_SHORT, dataspace, filespace,
+    if ( H5Dwrite (itsDatasetID, H5T_NATIVE_SHORT, dataspace.id(), filespace.id(),
                    H5P_DEFAULT, data ) < 0 )
       {
         std::cerr << "ERROR: Could not write short array.\n";
-        H5Sclose(dataspace);
-        H5Sclose(filespace);
         return DAL::FAIL;
       }
 
-    /* Close the memory- and data-space */
-    H5Sclose(dataspace);
-    H5Sclose(filespace);
-
+    /* The memory- and data-space are closed when going out of scope */
     return DAL::SUCCESS;
   }
 
@@ -243,21 +234,21 @@ namespace DAL {
   {
     hsize_t  dims[1] = { arraysize };
     hsize_t  off[1]  = { offset };
-    hid_t filespace  = 0;
-    hid_t complex_id = 0;
+    HDF5Handle filespace;
+    HDF5Handle complex_id;
 
     /* Select a hyperslab  */
-    if ( ( filespace = H5Dget_space( itsDatasetID ) ) < 0 )
+    filespace.reset (H5Dget_space (itsDatasetID));
+    if ( !filespace.isValid() )
       {
         std::cerr << "ERROR: Could not get filespace for array.\n";
         return DAL::FAIL;
       }
 
-    if ( H5Sselect_hyperslab( filespace, H5S_SELECT_SET, off, NULL,
+    if ( H5Sselect_hyperslab( filespace.id(), H5S_SELECT_SET, off, NULL,
                               dims, NULL) < 0 )
       {
         std::cerr << "ERROR: Could not select hyperslab for array.\n";
-        H5Sclose(filespace);
         return DAL::FAIL;
       }
 
@@ -268,39 +259,35 @@ namespace DAL {
         double im;   /*imaginary part*/
       } complex_t;
 
-    if ( ( complex_id = H5Tcreate (H5T_COMPOUND, sizeof(complex_t)) ) < 0 )
+    complex_id.reset (H5Tcreate (H5T_COMPOUND, sizeof(complex_t)));
+    if ( !complex_id.isValid() )
       {
         std::cerr << "ERROR: Could not create complex datatype.\n";
-        H5Sclose(filespace);
         return DAL::FAIL;
       }
 
-    if ( H5Tinsert( complex_id, "real", HOFFSET(complex_t,re),
+    if ( H5Tinsert( complex_id.id(), "real", HOFFSET(complex_t,re),
                     H5T_NATIVE_DOUBLE ) < 0 )
       {
         std::cerr << "ERROR: Could not insert element into compound datatype.\n";
-        H5Sclose(filespace);
         return DAL::FAIL;
       }
 
-    if ( H5Tinsert( complex_id, "imaginary", HOFFSET(complex_t,im),
+    if ( H5Tinsert( complex_id.id(), "imaginary", HOFFSET(complex_t,im),
                     H5T_NATIVE_DOUBLE ) < 0 )
       {
         std::cerr << "ERROR: Could not insert element into compound datatype.\n";
-        H5Sclose(filespace);
         return DAL::FAIL;
       }
 
     /* Write the data to the hyperslab  */
-    if ( H5Dwrite( itsDatasetID, complex_id, filespace, filespace,
+    if ( H5Dwrite( itsDatasetID, complex_id.id(), filespace.id(), filespace.id(),
                    H5P_DEFAULT, data ) < 0 )
       {
         std::cerr << "ERROR: Could not write complex<float> array.\n";
-        H5Sclose(filespace);
         return DAL::FAIL;
       }
 
-    H5Sclose(filespace);
     return DAL::SUCCESS;
   }
 
@@ -323,21 +310,21 @@ namespace DAL {
   {
     hsize_t      dims[1] = { arraysize };
     hsize_t      off[1]  = { offset };
-    hid_t filespace      = 0;
-    hid_t complex_id     = 0;
+    HDF5Handle filespace;
+    HDF5Handle complex_id;
 
-    if ( ( filespace = H5Dget_space( itsDatasetID ) ) < 0 )
+    filespace.reset (H5Dget_space (itsDatasetID));
+    if ( !filespace.isValid() )
       {
         std::cerr << "ERROR: Could not get filespace for array.\n";
         return DAL::FAIL;
       }
 
     /* Select a hyperslab  */
-    if ( H5Sselect_hyperslab( filespace, H5S_SELECT_SET, off, NULL,
+    if ( H5Sselect_hyperslab( filespace.id(), H5S_SELECT_SET, off, NULL,
                               dims, NULL ) < 0 )
       {
         std::cerr << "ERROR: Could not select hyperslab for array.\n";
-        H5Sclose(filespace);
         return DAL::FAIL;
       }
 
@@ -348,39 +335,35 @@ namespace DAL {
         Int16 im;   /*imaginary part*/
       } complex_t;
 
-    if ( ( complex_id = H5Tcreate (H5T_COMPOUND, sizeof(complex_t)) ) < 0 )
+    complex_id.reset (H5Tcreate (H5T_COMPOUND, sizeof(complex_t)));
+    if ( !complex_id.isValid() )
       {
         std::cerr << "ERROR: Could not create complex datatype.\n";
-        H5Sclose(filespace);
         return DAL::FAIL;
       }
 
-    if ( H5Tinsert ( complex_id, "real", HOFFSET(complex_t,re),
+    if ( H5Tinsert ( complex_id.id(), "real", HOFFSET(complex_t,re),
                      H5T_NATIVE_SHORT ) < 0 )
       {
         std::cerr << "ERROR: Could not insert element into compound datatype.\n";
-        H5Sclose(filespace);
         return DAL::FAIL;
       }
 
-    if ( H5Tinsert ( complex_id, "imaginary", HOFFSET(complex_t,im),
+    if ( H5Tinsert ( complex_id.id(), "imaginary", HOFFSET(complex_t,im),
                      H5T_NATIVE_SHORT ) < 0 )
       {
         std::cerr << "ERROR: Could not insert element into compound datatype.\n";
-        H5Sclose(filespace);
         return DAL::FAIL;
       }
 
     /* Write the data to the hyperslab  */
-    if ( H5Dwrite( itsDatasetID, complex_id, filespace, filespace,
+    if ( H5Dwrite( itsDatasetID, complex_id.id(), filespace.id(), filespace.id(),
                    H5P_DEFAULT, data ) < 0 )
       {
         std::cerr << "ERROR: Could not write complex<Int16> array.\n";
-        H5Sclose(filespace);
         return DAL::FAIL;
       }
 
-    H5Sclose(filespace);
 
     return DAL::SUCCESS;
   }
@@ -396,17 +379,15 @@ namespace DAL {
     std::vector<int> return_values;
     
     if (H5Iis_valid(itsDatasetID)) {
-      hid_t dataspace = H5Dget_space( itsDatasetID );    /* dataspace identifier */
-      int32_t rank        = H5Sget_simple_extent_ndims(dataspace);
+      HDF5Handle dataspace (H5Dget_space( itsDatasetID ));
+      int32_t rank        = H5Sget_simple_extent_ndims(dataspace.id());
       hsize_t  dims_out[rank];
       
-      if ( H5Sget_simple_extent_dims(dataspace, dims_out, NULL) < 0 )
+      if ( H5Sget_simple_extent_dims(dataspace.id(), dims_out, NULL) < 0 )
 	std::cerr << "ERROR: Could not get array dimensions.\n";
       
       for (int32_t ii=0; ii<rank; ii++)
 	return_values.push_back( dims_out[ii] );
-      
-      H5Sclose(dataspace);
     }
 
     return return_values;
@@ -488,12 +469,15 @@ namespace DAL {
                 array.  The size of the structure should match the dimensions
                 of the array.
     \param chnkdims Specifies the chunk size for extendible arrays.
+    \param filter Filter pipeline (e.g. compression) applied to the
+                data of an extendible array; ignored for fixed-size arrays.
    */
   dalFloatArray::dalFloatArray( hid_t obj_id,
 				std::string arrayname,
                                 std::vector<int> dims,
 				float data[],
-				std::vector<int> chnkdims )
+				std::vector<int> chnkdims,
+				HDF5Filter const &filter)
   {
     hid_t datatype  = 0;
     hid_t dataspace = 0;  // declare a few h5 variables
@@ -533,19 +517,24 @@ namespace DAL {
             std::cerr << "ERROR: Could not set array dataspace.\n";
           }
 
-        hid_t cparms = H5Pcreate( H5P_DATASET_CREATE );
-        if ( cparms < 0 )
+        HDF5Handle cparms (H5Pcreate( H5P_DATASET_CREATE ));
+        if ( !cparms.isValid() )
           {
             std::cerr << "ERROR: Could not set array propertylist.\n";
           }
 
-        if ( H5Pset_chunk( cparms, rank, chunk_dims ) < 0 )
+        if ( H5Pset_chunk( cparms.id(), rank, chunk_dims ) < 0 )
           {
             std::cerr << "ERROR: Could not set array chunk size.\n";
           }
 
+        if ( !filter.setFilters( cparms.id() ) )
+          {
+            std::cerr << "ERROR: Could not set array filters.\n";
+          }
+
         if ( ( itsDatasetID = H5Dcreate( obj_id, arrayname.c_str(), datatype,
-                                      dataspace, H5P_DEFAULT, cparms, H5P_DEFAULT ) ) < 0 )
+                                      dataspace, H5P_DEFAULT, cparms.id(), H5P_DEFAULT ) ) < 0 )
           {
             std::cerr << "ERROR: Could not create array.\n";
           }
@@ -616,12 +605,15 @@ namespace DAL {
                 array.  The size of the structure should match the dimensions
                 of the array.
     \param chnkdims Specifies the chunk size for extendible arrays.
+    \param filter Filter pipeline (e.g. compression) applied to the
+                data of an extendible array; ignored for fixed-size arrays.
   */
   dalComplexArray_float32::dalComplexArray_float32 (hid_t obj_id,
 						    std::string arrayname,
 						    std::vector<int> dims,
 						    std::complex<float> data[],
-						    std::vector<int> chnkdims )
+						    std::vector<int> chnkdims,
+						    HDF5Filter const &filter)
   {
     // declare a few h5 variables
     hid_t datatype   = 0;
@@ -680,26 +672,31 @@ namespace DAL {
                       << arrayname << "'.\n";
           }
 
-        hid_t cparms = H5Pcreate( H5P_DATASET_CREATE );
-        if ( cparms < 0 )
+        HDF5Handle cparms (H5Pcreate( H5P_DATASET_CREATE ));
+        if ( !cparms.isValid() )
           {
             std::cerr << "ERROR: Could not create property list for '"
                       << arrayname << "'.\n";
           }
 
-        if ( ( H5Pset_chunk( cparms, rank, chunk_dims ) ) < 0 )
+        if ( ( H5Pset_chunk( cparms.id(), rank, chunk_dims ) ) < 0 )
           {
             std::cerr << "ERROR: Could not set chunk size for '"
                       << arrayname << "'.\n";
           }
+
+        if ( !filter.setFilters( cparms.id() ) )
+          {
+            std::cerr << "ERROR: Could not set array filters.\n";
+          }
 	
 	/* create dataset */
 	itsDatasetID = H5Dcreate (obj_id,
 				  arrayname.c_str(),
 				  datatype,
 				  dataspace,
-				  cparms,
 				  H5P_DEFAULT,
+				  cparms.id(),
 				  H5P_DEFAULT);
         if (itsDatasetID< 0) {
 	  std::cerr << "ERROR: Could not create array '" << arrayname << "'.\n";
@@ -26,6 +26,7 @@
 #include <core/dalCommon.h>
 #include <core/dalObjectBase.h>
 #include <core/HDF5Attribute.h>
+#include <core/HDF5Filter.h>
 
 namespace DAL {
   
@@ -239,7 +240,8 @@ namespace DAL {
 		   std::string arrayname,
 		   std::vector<int> dims,
 		   float data[],
-		   std::vector<int>chnkdims);
+		   std::vector<int>chnkdims,
+		   HDF5Filter const &filter=HDF5Filter());
   };
   
   /*!
@@ -257,7 +259,8 @@ namespace DAL {
 			     std::string arrayname,
 			     std::vector<int> dims,
 			     std::complex<float> data[],
-			     std::vector<int>chnkdims);
+			     std::vector<int>chnkdims,
+			     HDF5Filter const &filter=HDF5Filter());
   };
   
 } // end namespace DAL
@@ -150,7 +150,13 @@ namespace DAL {
     std::vector<int> shape();
     //! Get the number of rows in the column.
     uint nofRows ();
-    //! Get the data object for the column.
+    /*!
+      \brief Get the data object for the column.
+
+      All requested cells are read in one go; for scanning large tables, or
+      for retrieving several columns in a single pass over the records, use
+      DAL::dalColumnReader instead.
+    */
     dalData * data (int &start,
 		    int &length)
     {
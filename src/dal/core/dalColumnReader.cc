@@ -0,0 +1,433 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "dalColumnReader.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace DAL { // Namespace DAL -- begin
+
+  // ============================================================================
+  //
+  //  Construction
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                              dalColumnReader
+
+  dalColumnReader::dalColumnReader ()
+  {
+    itsRowSize   = 0;
+    itsNofRows   = 0;
+    itsBatchSize = 0;
+    itsStart     = 0;
+    itsEnd       = 0;
+    itsPosition  = 0;
+  }
+
+  //_____________________________________________________________________________
+  //                                                              dalColumnReader
+
+  /*!
+    \param location  -- Identifier of the group to which the table is attached.
+    \param name      -- Name of the table.
+    \param columns   -- Names of the columns to read.
+    \param batchSize -- Number of rows read per batch.
+  */
+  dalColumnReader::dalColumnReader (hid_t const &location,
+				    std::string const &name,
+				    std::vector<std::string> const &columns,
+				    hsize_t const &batchSize)
+  {
+    open (location, name, columns, batchSize);
+  }
+
+  //_____________________________________________________________________________
+  //                                                              dalColumnReader
+
+  /*!
+    \param table     -- HDF5 table from which to read.
+    \param columns   -- Names of the columns to read.
+    \param batchSize -- Number of rows read per batch.
+  */
+  dalColumnReader::dalColumnReader (dalTable &table,
+				    std::vector<std::string> const &columns,
+				    hsize_t const &batchSize)
+  {
+    open (table.fileID(), table.name(), columns, batchSize);
+  }
+
+  // ============================================================================
+  //
+  //  Parameters
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                 setBatchSize
+
+  /*!
+    \param batchSize -- Number of rows read per batch; must be positive.
+    \return status   -- Returns \e false if the batch size is invalid.
+  */
+  bool dalColumnReader::setBatchSize (hsize_t const &batchSize)
+  {
+    if (batchSize == 0) {
+      std::cerr << "[dalColumnReader::setBatchSize] Batch size must be positive!"
+		<< std::endl;
+      return false;
+    }
+
+    itsBatchSize = batchSize;
+    itsBuffer.clear();
+
+    return true;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                     setRange
+
+  /*!
+    \param start   -- First row to read.
+    \param nofRows -- Number of rows to read; the range is clipped at the end
+           of the table.
+    \return status -- Returns \e false if \c start is beyond the end of the
+            table.
+  */
+  bool dalColumnReader::setRange (hsize_t const &start,
+				  hsize_t const &nofRows)
+  {
+    if (start > itsNofRows) {
+      std::cerr << "[dalColumnReader::setRange] Start row " << start
+		<< " beyond end of table (" << itsNofRows << " rows)!"
+		<< std::endl;
+      return false;
+    }
+
+    itsStart    = start;
+    itsEnd      = std::min (start+nofRows, itsNofRows);
+    itsPosition = itsStart;
+
+    return true;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                      summary
+
+  /*!
+    \param os -- Output stream to which the summary is written.
+  */
+  void dalColumnReader::summary (std::ostream &os)
+  {
+    os << "[dalColumnReader] Summary of internal parameters." << std::endl;
+    os << "-- Valid reader       = " << isValid()    << std::endl;
+    os << "-- Selected columns   = " << itsColumns   << std::endl;
+    os << "-- Column offsets     = " << itsOffsets   << std::endl;
+    os << "-- Column sizes       = " << itsSizes     << std::endl;
+    os << "-- Row size [Bytes]   = " << itsRowSize   << std::endl;
+    os << "-- nof. table rows    = " << itsNofRows   << std::endl;
+    os << "-- Batch size         = " << itsBatchSize << std::endl;
+    os << "-- Range of rows      = [" << itsStart << "," << itsEnd << ")" << std::endl;
+    os << "-- Position           = " << itsPosition  << std::endl;
+  }
+
+  // ============================================================================
+  //
+  //  Methods
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                         open
+
+  /*!
+    \param location  -- Identifier of the group to which the table is attached.
+    \param name      -- Name of the table.
+    \param columns   -- Names of the columns to read.
+    \param batchSize -- Number of rows read per batch.
+    \return status   -- Status of the operation; returns \e false in case an
+            error was encountered, e.g. if a column does not exist.
+  */
+  bool dalColumnReader::open (hid_t const &location,
+			      std::string const &name,
+			      std::vector<std::string> const &columns,
+			      hsize_t const &batchSize)
+  {
+    itsRowSize   = 0;
+    itsNofRows   = 0;
+    itsBatchSize = batchSize > 0 ? batchSize : 1;
+    itsStart     = 0;
+    itsEnd       = 0;
+    itsPosition  = 0;
+    itsColumns.clear();
+    itsOffsets.clear();
+    itsSizes.clear();
+    itsTypes.clear();
+    itsBuffer.clear();
+    itsMemoryType.reset ();
+
+    itsDataset.reset (H5Dopen (location, name.c_str(), H5P_DEFAULT));
+
+    if (!itsDataset.isValid()) {
+      std::cerr << "[dalColumnReader::open] Failed to open table "
+		<< name << std::endl;
+      return false;
+    }
+
+    /* Number of rows of the table */
+    HDF5Handle dataspace (H5Dget_space (itsDataset.id()));
+    hssize_t nofPoints = H5Sget_simple_extent_npoints (dataspace.id());
+
+    if (nofPoints < 0) {
+      std::cerr << "[dalColumnReader::open] Failed to get number of rows!"
+		<< std::endl;
+      return false;
+    }
+
+    itsNofRows = nofPoints;
+    itsEnd     = itsNofRows;
+
+    return setMemoryType (columns);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                setMemoryType
+
+  /*!
+    \param columns -- Names of the columns to read.
+    \return status -- Status of the operation; returns \e false in case an
+            error was encountered, e.g. if a column does not exist.
+  */
+  bool dalColumnReader::setMemoryType (std::vector<std::string> const &columns)
+  {
+    if (columns.empty()) {
+      std::cerr << "[dalColumnReader::setMemoryType] No columns selected!"
+		<< std::endl;
+      return false;
+    }
+
+    HDF5Handle fileType (H5Dget_type (itsDataset.id()));
+
+    if (H5Tget_class (fileType.id()) != H5T_COMPOUND) {
+      std::cerr << "[dalColumnReader::setMemoryType] Dataset is not a table!"
+		<< std::endl;
+      return false;
+    }
+
+    /* Native datatype and size of each of the selected columns */
+    for (unsigned int n(0); n<columns.size(); ++n) {
+      int index = H5Tget_member_index (fileType.id(), columns[n].c_str());
+      if (index < 0) {
+	std::cerr << "[dalColumnReader::setMemoryType] No column "
+		  << columns[n] << " in table!" << std::endl;
+	itsOffsets.clear();
+	itsSizes.clear();
+	itsTypes.clear();
+	return false;
+      }
+      HDF5Handle memberType (H5Tget_member_type (fileType.id(), index));
+      itsTypes.push_back (HDF5Handle (H5Tget_native_type (memberType.id(),
+							     H5T_DIR_ASCEND)));
+      itsOffsets.push_back (itsRowSize);
+      itsSizes.push_back (H5Tget_size (itsTypes.back().id()));
+      itsRowSize += itsSizes.back();
+    }
+
+    /* Compound type holding the selected columns, packed */
+    itsMemoryType.reset (H5Tcreate (H5T_COMPOUND, itsRowSize));
+
+    for (unsigned int n(0); n<columns.size(); ++n) {
+      if (H5Tinsert (itsMemoryType.id(),
+		     columns[n].c_str(),
+		     itsOffsets[n],
+		     itsTypes[n].id()) < 0) {
+	std::cerr << "[dalColumnReader::setMemoryType] Failed to insert column "
+		  << columns[n] << " into memory datatype!" << std::endl;
+	itsMemoryType.reset ();
+	return false;
+      }
+    }
+
+    itsColumns = columns;
+
+    return true;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                         next
+
+  /*!
+    \retval rows   -- Buffer for batchSize() packed rows of rowSize() Bytes.
+    \return nofRows -- Number of rows read; 0 once the end of the range has been
+            reached or in case of an error.
+  */
+  hsize_t dalColumnReader::next (void *rows)
+  {
+    if (itsPosition >= itsEnd) {
+      return 0;
+    }
+
+    hsize_t nofRows = std::min (itsBatchSize, itsEnd-itsPosition);
+
+    if (!read (rows, itsPosition, nofRows)) {
+      return 0;
+    }
+
+    itsPosition += nofRows;
+
+    return nofRows;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                         next
+
+  /*!
+    \retval columns -- One buffer per selected column, each with space for
+            batchSize() cells.
+    \return nofRows -- Number of rows read; 0 once the end of the range has been
+            reached or in case of an error.
+  */
+  hsize_t dalColumnReader::next (std::vector<void *> const &columns)
+  {
+    if (itsPosition >= itsEnd) {
+      return 0;
+    }
+
+    hsize_t nofRows = std::min (itsBatchSize, itsEnd-itsPosition);
+
+    if (!read (columns, itsPosition, nofRows)) {
+      return 0;
+    }
+
+    itsPosition += nofRows;
+
+    return nofRows;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                         read
+
+  /*!
+    \retval rows   -- Buffer for \c nofRows packed rows of rowSize() Bytes.
+    \param start   -- First row to read.
+    \param nofRows -- Number of rows to read.
+    \return status -- Status of the operation; returns \e false in case an
+            error was encountered.
+  */
+  bool dalColumnReader::read (void *rows,
+			      hsize_t const &start,
+			      hsize_t const &nofRows)
+  {
+    if (!isValid()) {
+      std::cerr << "[dalColumnReader::read] Reader not connected to a table!"
+		<< std::endl;
+      return false;
+    }
+
+    if (start+nofRows > itsNofRows) {
+      std::cerr << "[dalColumnReader::read] Rows [" << start << ","
+		<< start+nofRows << ") beyond end of table!" << std::endl;
+      return false;
+    }
+
+    if (nofRows == 0) {
+      return true;
+    }
+
+    HDF5Handle filespace (H5Dget_space (itsDataset.id()));
+    HDF5Handle memspace (H5Screate_simple (1, &nofRows, NULL));
+
+    if (H5Sselect_hyperslab (filespace.id(),
+			     H5S_SELECT_SET,
+			     &start,
+			     NULL,
+			     &nofRows,
+			     NULL) < 0) {
+      std::cerr << "[dalColumnReader::read] Failed to select rows!" << std::endl;
+      return false;
+    }
+
+    if (H5Dread (itsDataset.id(),
+		 itsMemoryType.id(),
+		 memspace.id(),
+		 filespace.id(),
+		 H5P_DEFAULT,
+		 rows) < 0) {
+      std::cerr << "[dalColumnReader::read] Failed to read rows!" << std::endl;
+      return false;
+    }
+
+    return true;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                         read
+
+  /*!
+    The rows are read in a single pass, in batches of at most batchSize() rows,
+    and then scattered into the buffers for the individual columns.
+
+    \retval columns -- One buffer per selected column, each with space for
+            \c nofRows cells.
+    \param start    -- First row to read.
+    \param nofRows  -- Number of rows to read.
+    \return status  -- Status of the operation; returns \e false in case an
+            error was encountered.
+  */
+  bool dalColumnReader::read (std::vector<void *> const &columns,
+			      hsize_t const &start,
+			      hsize_t const &nofRows)
+  {
+    if (columns.size() != itsColumns.size()) {
+      std::cerr << "[dalColumnReader::read] Expected " << itsColumns.size()
+		<< " buffers, got " << columns.size() << "!" << std::endl;
+      return false;
+    }
+
+    hsize_t batch = std::min (itsBatchSize, nofRows);
+
+    if (itsBuffer.size() < batch*itsRowSize) {
+      itsBuffer.resize (batch*itsRowSize);
+    }
+
+    for (hsize_t row(0); row<nofRows; row+=batch) {
+      hsize_t nofBatchRows = std::min (batch, nofRows-row);
+      if (!read (&itsBuffer[0], start+row, nofBatchRows)) {
+	return false;
+      }
+      /* Scatter the packed rows into the column buffers */
+      for (unsigned int col(0); col<columns.size(); ++col) {
+	char *dest       = static_cast<char *>(columns[col]) + row*itsSizes[col];
+	char const *src  = &itsBuffer[itsOffsets[col]];
+	size_t size      = itsSizes[col];
+	for (hsize_t n(0); n<nofBatchRows; ++n) {
+	  memcpy (dest, src, size);
+	  dest += size;
+	  src  += itsRowSize;
+	}
+      }
+    }
+
+    return true;
+  }
+
+} // Namespace DAL -- end
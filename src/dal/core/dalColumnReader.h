@@ -0,0 +1,276 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#ifndef DALCOLUMNREADER_H
+#define DALCOLUMNREADER_H
+
+// Standard library header files
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <core/HDF5Handle.h>
+#include <core/dalTable.h>
+
+namespace DAL { // Namespace DAL -- begin
+
+  /*!
+    \class dalColumnReader
+
+    \ingroup DAL
+    \ingroup core
+
+    \brief Read a selection of columns of an HDF5 table in batches of rows
+
+    \author agent
+
+    \date 2026/10/18
+
+    \test tdalColumnReader.cc
+
+    <h3>Prerequisite</h3>
+
+    <ul type="square">
+      <li>DAL::dalTable
+      <li>DAL::dalColumn
+      <li>DAL::HDF5Handle
+    </ul>
+
+    <h3>Synopsis</h3>
+
+    dalColumn::data() retrieves a column by reading all of its cells in one go
+    (\c H5TBread_fields_name), i.e. the memory required grows with the number
+    of rows of the table, and each further column requires another pass over
+    the table. A dalColumnReader instead reads a selection of columns (a
+    \e projection of the records) over a range of rows, in batches of a fixed
+    number of rows into buffers provided by the caller, such that tables of
+    arbitrary size can be scanned with bounded memory.
+
+    The selected columns are described by a compound memory datatype holding
+    only the corresponding members of the records, packed in the order of
+    selection; reading a batch is a single \c H5Dread with a hyperslab
+    selection of the rows, during which the library extracts the selected
+    members from the records -- all selected columns are fetched in one pass.
+    A batch either is returned as packed rows (see rowSize(), offset()), or is
+    scattered into one buffer per column.
+
+    <h3>Example(s)</h3>
+
+    <ol>
+      <li>Scan two columns of a table, 10000 rows at a time:
+      \code
+      std::vector<std::string> columns;
+      columns.push_back ("TIME");
+      columns.push_back ("FLUX");
+
+      DAL::dalColumnReader reader (fileID, "/Table", columns, 10000);
+      std::vector<double> time (reader.batchSize());
+      std::vector<float> flux (reader.batchSize());
+      std::vector<void *> buffers;
+      buffers.push_back (&time[0]);
+      buffers.push_back (&flux[0]);
+
+      hsize_t nofRows;
+      while ((nofRows = reader.next (buffers))) {
+        process (&time[0], &flux[0], nofRows);
+      }
+      \endcode
+      <li>Restrict the scan to the rows [1000,5000):
+      \code
+      reader.setRange (1000, 4000);
+      \endcode
+    </ol>
+  */
+  class dalColumnReader {
+
+    //! Identifier of the table dataset
+    HDF5Handle itsDataset;
+    //! Names of the selected columns
+    std::vector<std::string> itsColumns;
+    //! Memory datatype holding the selected columns
+    HDF5Handle itsMemoryType;
+    //! Size of a packed row of the selected columns, [Bytes]
+    size_t itsRowSize;
+    //! Offsets of the selected columns within a packed row, [Bytes]
+    std::vector<size_t> itsOffsets;
+    //! Sizes of the selected columns, [Bytes]
+    std::vector<size_t> itsSizes;
+    //! Native datatypes of the selected columns
+    std::vector<HDF5Handle> itsTypes;
+    //! Number of rows of the table
+    hsize_t itsNofRows;
+    //! Number of rows read per batch
+    hsize_t itsBatchSize;
+    //! First row of the range to read
+    hsize_t itsStart;
+    //! One past the last row of the range to read
+    hsize_t itsEnd;
+    //! Next row to read
+    hsize_t itsPosition;
+    //! Buffer for a batch of packed rows, when scattering into columns
+    std::vector<char> itsBuffer;
+
+  public:
+
+    // === Construction =========================================================
+
+    //! Default constructor
+    dalColumnReader ();
+
+    //! Argumented constructor, for a table attached to \c location
+    dalColumnReader (hid_t const &location,
+		     std::string const &name,
+		     std::vector<std::string> const &columns,
+		     hsize_t const &batchSize=4096);
+
+    //! Argumented constructor, for the HDF5 table represented by \c table
+    dalColumnReader (dalTable &table,
+		     std::vector<std::string> const &columns,
+		     hsize_t const &batchSize=4096);
+
+    // === Parameter access =====================================================
+
+    //! Is the reader set up to read from a table?
+    inline bool isValid () const {
+      return itsDataset.isValid() && itsMemoryType.isValid();
+    }
+
+    //! Names of the selected columns
+    inline std::vector<std::string> columns () const {
+      return itsColumns;
+    }
+
+    //! Number of selected columns
+    inline unsigned int nofColumns () const {
+      return itsColumns.size();
+    }
+
+    //! Size of a packed row of the selected columns, [Bytes]
+    inline size_t rowSize () const {
+      return itsRowSize;
+    }
+
+    //! Offset of the n-th selected column within a packed row, [Bytes]
+    inline size_t offset (unsigned int const &n) const {
+      return itsOffsets[n];
+    }
+
+    //! Size of a cell of the n-th selected column, [Bytes]
+    inline size_t size (unsigned int const &n) const {
+      return itsSizes[n];
+    }
+
+    //! Native datatype of the n-th selected column
+    inline hid_t type (unsigned int const &n) const {
+      return itsTypes[n].id();
+    }
+
+    //! Memory datatype describing a packed row of the selected columns
+    inline hid_t memoryType () const {
+      return itsMemoryType.id();
+    }
+
+    //! Number of rows of the table
+    inline hsize_t nofRows () const {
+      return itsNofRows;
+    }
+
+    //! Number of rows read per batch
+    inline hsize_t batchSize () const {
+      return itsBatchSize;
+    }
+
+    //! Set the number of rows read per batch
+    bool setBatchSize (hsize_t const &batchSize);
+
+    //! First row of the range to read
+    inline hsize_t start () const {
+      return itsStart;
+    }
+
+    //! One past the last row of the range to read
+    inline hsize_t end () const {
+      return itsEnd;
+    }
+
+    //! Restrict reading to \c nofRows rows, starting at row \c start
+    bool setRange (hsize_t const &start,
+		   hsize_t const &nofRows);
+
+    //! Next row to be read by next()
+    inline hsize_t position () const {
+      return itsPosition;
+    }
+
+    /*!
+      \brief Get the name of the class
+      \return className -- The name of the class, dalColumnReader.
+    */
+    inline std::string className () const {
+      return "dalColumnReader";
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    inline void summary () {
+      summary (std::cout);
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    void summary (std::ostream &os);
+
+    // === Methods ==============================================================
+
+    //! Open the table \c name attached to \c location, selecting \c columns
+    bool open (hid_t const &location,
+	       std::string const &name,
+	       std::vector<std::string> const &columns,
+	       hsize_t const &batchSize=4096);
+
+    //! Restart reading at the beginning of the range
+    inline void rewind () {
+      itsPosition = itsStart;
+    }
+
+    //! Read the next batch of rows as packed rows
+    hsize_t next (void *rows);
+
+    //! Read the next batch of rows, one buffer per selected column
+    hsize_t next (std::vector<void *> const &columns);
+
+    //! Read \c nofRows packed rows starting at row \c start
+    bool read (void *rows,
+	       hsize_t const &start,
+	       hsize_t const &nofRows);
+
+    //! Read \c nofRows rows starting at row \c start, one buffer per column
+    bool read (std::vector<void *> const &columns,
+	       hsize_t const &start,
+	       hsize_t const &nofRows);
+
+  private:
+
+    //! Set up the memory datatype for the selected columns
+    bool setMemoryType (std::vector<std::string> const &columns);
+
+  }; // Class dalColumnReader -- end
+
+} // Namespace DAL -- end
+
+#endif /* DALCOLUMNREADER_H */
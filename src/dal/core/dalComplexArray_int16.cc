@@ -32,12 +32,15 @@ namespace DAL {   // BEGIN -- namespace DAL
     \param data      -- complex<float> vector of data to write
     \param chnkdims  -- resizing (chunking) dimensions. Empty vector if the
            size of the array is fixed.
+    \param filter    -- Filter pipeline (e.g. compression) applied to the data
+           of an extendible array; ignored for fixed-size arrays.
   */
   dalComplexArray_int16::dalComplexArray_int16 (hid_t obj_id,
 						std::string arrayname,
 						std::vector<int> dims,
 						std::complex<Int16> data[],
-						std::vector<int> chnkdims)
+						std::vector<int> chnkdims,
+						HDF5Filter const &filter)
   {
     hid_t datatype    = 0;
     hid_t dataspace   = 0;
@@ -111,6 +114,11 @@ namespace DAL {   // BEGIN -- namespace DAL
                       << arrayname << "'.\n";
           }
 
+        if ( !filter.setFilters( cparms ) )
+          {
+            std::cerr << "ERROR: Could not set array filters.\n";
+          }
+
         if ( ( itsDatasetID = H5Dcreate( obj_id, arrayname.c_str(), datatype,
                                       dataspace, H5P_DEFAULT, cparms, H5P_DEFAULT ) ) < 0 )
           {
@@ -47,7 +47,8 @@ namespace DAL {
 			   std::string arrayname,
 			   std::vector<int> dims,
 			   std::complex<Int16> data[],
-			   std::vector<int>chnkdims);
+			   std::vector<int>chnkdims,
+			   HDF5Filter const &filter=HDF5Filter());
   };
 
 } //   END -- namespace DAL
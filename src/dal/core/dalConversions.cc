@@ -20,6 +20,10 @@
 
 #include <core/dalConversions.h>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 namespace DAL { // Namespace DAL -- begin
   
   // ============================================================================
@@ -82,4 +86,88 @@ namespace DAL { // Namespace DAL -- begin
     return ( mjd_time - (40587.0 * 86400.0) );
   }
   
+  // ============================================================================
+  //
+  //  Conversion of raw samples
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                               convertSamples
+
+  /*!
+    \retval out  -- [nelem] Array with the converted values,
+            <tt>out[n]=gain*in[n]</tt>.
+    \param in    -- [nelem] Array with the raw samples, e.g. as recorded by the
+           ADC of a TBB board.
+    \param nelem -- Number of samples to convert.
+    \param gain  -- Calibration gain, by which the samples are scaled.
+
+    If supported by the target, eight samples are converted at once using SSE2
+    instructions; the remaining samples are handled one by one. The arrays do
+    not need to be aligned.
+  */
+  void convertSamples (float *out,
+		       short const *in,
+		       size_t const &nelem,
+		       float const &gain)
+  {
+    size_t n (0);
+
+#ifdef __SSE2__
+    __m128 g = _mm_set1_ps (gain);
+
+    for (; n+8<=nelem; n+=8) {
+      __m128i samples = _mm_loadu_si128 ((__m128i const *)(in+n));
+      /* Sign-extend the 16-bit samples to 32-bit integers */
+      __m128i lo = _mm_srai_epi32 (_mm_unpacklo_epi16 (samples, samples), 16);
+      __m128i hi = _mm_srai_epi32 (_mm_unpackhi_epi16 (samples, samples), 16);
+      _mm_storeu_ps (out+n,   _mm_mul_ps (_mm_cvtepi32_ps (lo), g));
+      _mm_storeu_ps (out+n+4, _mm_mul_ps (_mm_cvtepi32_ps (hi), g));
+    }
+#endif
+
+    for (; n<nelem; ++n) {
+      out[n] = gain*in[n];
+    }
+  }
+
+  //_____________________________________________________________________________
+  //                                                               convertSamples
+
+  /*!
+    \retval out  -- [nelem] Array with the converted values,
+            <tt>out[n]=gain*in[n]</tt>.
+    \param in    -- [nelem] Array with the raw samples, e.g. as recorded by the
+           ADC of a TBB board.
+    \param nelem -- Number of samples to convert.
+    \param gain  -- Calibration gain, by which the samples are scaled.
+  */
+  void convertSamples (double *out,
+		       short const *in,
+		       size_t const &nelem,
+		       double const &gain)
+  {
+    size_t n (0);
+
+#ifdef __SSE2__
+    __m128d g = _mm_set1_pd (gain);
+
+    for (; n+8<=nelem; n+=8) {
+      __m128i samples = _mm_loadu_si128 ((__m128i const *)(in+n));
+      __m128i lo = _mm_srai_epi32 (_mm_unpacklo_epi16 (samples, samples), 16);
+      __m128i hi = _mm_srai_epi32 (_mm_unpackhi_epi16 (samples, samples), 16);
+      /* _mm_cvtepi32_pd converts the lower two integers of its argument */
+      _mm_storeu_pd (out+n,   _mm_mul_pd (_mm_cvtepi32_pd (lo), g));
+      _mm_storeu_pd (out+n+2, _mm_mul_pd (_mm_cvtepi32_pd (_mm_srli_si128 (lo, 8)), g));
+      _mm_storeu_pd (out+n+4, _mm_mul_pd (_mm_cvtepi32_pd (hi), g));
+      _mm_storeu_pd (out+n+6, _mm_mul_pd (_mm_cvtepi32_pd (_mm_srli_si128 (hi, 8)), g));
+    }
+#endif
+
+    for (; n<nelem; ++n) {
+      out[n] = gain*in[n];
+    }
+  }
+
 } // Namespace DAL -- end
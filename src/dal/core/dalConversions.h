@@ -55,6 +55,7 @@
     <li>Conversion of type T to string
     <li>Conversion between time formats
     <li>Conversion between different types of vectors
+    <li>Conversion of raw ADC samples to floating point values
   </ul>
   
   <h3>Example(s)</h3>
@@ -125,6 +126,40 @@ namespace DAL { // Namespace DAL -- begin
   boost::python::numeric::array mjd2unix_boost( boost::python::numeric::array mjd_time );
 #endif
   
+  // ============================================================================
+  //
+  //  Conversion of raw samples
+  //
+  // ============================================================================
+
+  //! Convert raw 16-bit samples to single precision values, applying a gain
+  void convertSamples (float *out,
+		       short const *in,
+		       size_t const &nelem,
+		       float const &gain=1.0f);
+
+  //! Convert raw 16-bit samples to double precision values, applying a gain
+  void convertSamples (double *out,
+		       short const *in,
+		       size_t const &nelem,
+		       double const &gain=1.0);
+
+  //! Convert blocks of raw 16-bit samples, applying a gain per block
+  template <class T>
+    void convertSamples (T *out,
+			 short const *in,
+			 size_t const &nofBlocks,
+			 size_t const &blocksize,
+			 std::vector<T> const &gains)
+    {
+      for (size_t n(0); n<nofBlocks; ++n) {
+	convertSamples (out+n*blocksize,
+			in+n*blocksize,
+			blocksize,
+			n<gains.size() ? gains[n] : T(1));
+      }
+    }
+
   // ============================================================================
   //
   //  Conversion between types of vectors
@@ -121,36 +121,26 @@ namespace DAL {
 					long idx2,
 					long idx3)
   {
-    std::vector<long> indices;
-    
-    if ( idx1>-1 )
-      indices.push_back( idx1 );
-    if ( idx2>-1 )
-      indices.push_back( idx2 );
-    if ( idx3>-1 )
-      indices.push_back( idx3 );
-    
-    if (indices.size() != (itsShape.size()) )
-      {
-        cerr << "ERROR: Number of indices do not match shape of column." << endl;
-        return(-1);
-      }
-    
+    long indices[3];
+    unsigned int nofIndices = collectIndices (idx1, idx2, idx3, indices);
+
+    if (nofIndices != itsShape.size()) {
+      cerr << "ERROR: Number of indices do not match shape of column." << endl;
+      return(-1);
+    }
+
+    /* The first index varies fastest */
     unsigned long index = 0;
     long bb = 1;
-    
-    itsShape.insert( itsShape.begin(), 1 );
-    for (unsigned int dim=0; dim<itsShape.size()-1; dim++) {
-      for (unsigned int ss=dim; ss>0; ss--)
-	bb *= itsShape[ ss ];
-      
+
+    for (unsigned int dim=0; dim<nofIndices; ++dim) {
       index += indices[dim]*bb;
-      bb=1;
+      bb    *= itsShape[dim];
     }
-    itsShape.erase( itsShape.begin() );
+
     return index;
   }
-  
+
   //_____________________________________________________________________________
   //                                                                      c_index
   
@@ -171,36 +161,23 @@ namespace DAL {
 				  long idx2,
 				  long idx3)
   {
-    std::vector<long> indices;
-
-    if ( idx1>-1 )
-      indices.push_back( idx1 );
-    if ( idx2>-1 )
-      indices.push_back( idx2 );
-    if ( idx3>-1 )
-      indices.push_back( idx3 );
+    long indices[3];
+    unsigned int nofIndices = collectIndices (idx1, idx2, idx3, indices);
 
-    if (indices.size() != (itsShape.size()) )
-      {
-        cerr << "ERROR: Number of indices do not match shape of column.\n";
-        return(-1);
-      }
+    if (nofIndices != itsShape.size()) {
+      cerr << "ERROR: Number of indices do not match shape of column.\n";
+      return(-1);
+    }
 
+    /* The last index varies fastest */
     unsigned long index = 0;
     long bb = 1;
 
-    //   std::cerr << "HDF5 HDF5 HDF5 HDF5 HDF5 HDF5" << endl;
-    // indx = xx*shape3[1]*shape3[2] + yy*shape3[2] + zz;
-    for (unsigned int dim = 0; dim < itsShape.size(); dim++)
-      {
-        for (unsigned int ss = itsShape.size()-1; ss > dim; ss--)
-          {
-            bb *= itsShape[ ss ];
-          }
-
-        index += indices[dim]*bb;
-        bb=1;
-      }
+    for (unsigned int dim=nofIndices; dim>0; --dim) {
+      index += indices[dim-1]*bb;
+      bb    *= itsShape[dim-1];
+    }
+
     return index;
   }
 
@@ -271,6 +248,30 @@ namespace DAL {
   //
   // ============================================================================
 
+  //_____________________________________________________________________________
+  //                                                               collectIndices
+
+  /*!
+    \param idx1     -- First index; ignored if negative.
+    \param idx2     -- Second index; ignored if negative.
+    \param idx3     -- Third index; ignored if negative.
+    \retval indices -- The non-negative indices, in the order given.
+    \return nofIndices -- The number of non-negative indices.
+  */
+  unsigned int dalData::collectIndices (long const &idx1,
+					long const &idx2,
+					long const &idx3,
+					long *indices)
+  {
+    unsigned int nofIndices (0);
+
+    if (idx1>-1) indices[nofIndices++] = idx1;
+    if (idx2>-1) indices[nofIndices++] = idx2;
+    if (idx3>-1) indices[nofIndices++] = idx3;
+
+    return nofIndices;
+  }
+
   //_____________________________________________________________________________
   //                                                                         init
   
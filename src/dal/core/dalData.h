@@ -50,6 +50,10 @@ namespace DAL {
     
     There will also be a way for the developer to get access to the c-array,
     exactly as it is stored.
+
+    For iterating over the elements, use a DAL::dalDataView: it provides
+    typed access with the index computation inlined, while get() computes
+    the position of the element from scratch for each call.
   */
   
   class dalData : public dalObjectBase {
@@ -144,6 +148,12 @@ namespace DAL {
     
     //! Initialize internal variables
     void init ();
+
+    //! Collect the non-negative indices, without allocating memory
+    static unsigned int collectIndices (long const &idx1,
+					long const &idx2,
+					long const &idx3,
+					long *indices);
     
   };
   
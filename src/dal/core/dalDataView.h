@@ -0,0 +1,454 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#ifndef DALDATAVIEW_H
+#define DALDATAVIEW_H
+
+// Standard library header files
+#include <complex>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <core/dalData.h>
+
+namespace DAL { // Namespace DAL -- begin
+
+  //_____________________________________________________________________________
+  //                                                                  dalDataType
+
+  /*!
+    \brief Name of the dalData datatype corresponding to the C++ type \c T
+
+    Used by dalDataView to check the type of the view against the type of the
+    data held by a dalData object; for types without a corresponding dalData
+    datatype the name is empty, and no check is performed.
+  */
+  template <class T> struct dalDataType {
+    static std::string name () { return std::string(); }
+  };
+  template <> struct dalDataType<char> {
+    static std::string name () { return dal_CHAR; }
+  };
+  template <> struct dalDataType<short> {
+    static std::string name () { return dal_SHORT; }
+  };
+  template <> struct dalDataType<int> {
+    static std::string name () { return dal_INT; }
+  };
+  template <> struct dalDataType<float> {
+    static std::string name () { return dal_FLOAT; }
+  };
+  template <> struct dalDataType<double> {
+    static std::string name () { return dal_DOUBLE; }
+  };
+  template <> struct dalDataType<std::complex<char> > {
+    static std::string name () { return dal_COMPLEX_CHAR; }
+  };
+  template <> struct dalDataType<std::complex<short> > {
+    static std::string name () { return dal_COMPLEX_SHORT; }
+  };
+  template <> struct dalDataType<Complex_Int16> {
+    static std::string name () { return dal_COMPLEX_SHORT; }
+  };
+  template <> struct dalDataType<std::complex<float> > {
+    static std::string name () { return dal_COMPLEX; }
+  };
+  template <> struct dalDataType<std::complex<double> > {
+    static std::string name () { return dal_DCOMPLEX; }
+  };
+  template <> struct dalDataType<std::string> {
+    static std::string name () { return dal_STRING; }
+  };
+
+  /*!
+    \class dalDataView
+
+    \ingroup DAL
+    \ingroup core
+
+    \brief Typed, non-owning view of an N-dimensional array
+
+    \author agent
+
+    \date 2026/10/18
+
+    \test tdalDataView.cc
+
+    <h3>Prerequisite</h3>
+
+    <ul type="square">
+      <li>DAL::dalData
+    </ul>
+
+    <h3>Synopsis</h3>
+
+    Accessing the elements of a dalData object through dalData::get requires
+    to compute the position of the element from its indices for every
+    access, and returns an untyped pointer. A dalDataView instead describes
+    the array by a typed pointer, its shape and the strides (in elements)
+    along each of the axes -- computed once, when constructing the view -- such
+    that accessing an element reduces to a few multiply-adds which the
+    compiler is able to inline. The view does not own the data, nor does it
+    allocate memory: shape and strides are kept in fixed-size arrays of
+    maxRank() elements, hence views are cheap to create and to copy.
+
+    The strides are derived from the order in which the elements are stored:
+    in C order (HDF5) the last index varies fastest, in Fortran order (CASA)
+    the first one. A view of a dalData object uses the order of the underlying
+    file type, i.e. the same indexing as dalData::get.
+
+    Elements along the axis varying fastest are contiguous in memory; such a
+    sequence is called a row, and can be traversed with plain pointers (see
+    rowBegin() and rowEnd()). slice() fixes the index along one of the axes,
+    returning a view of lower rank on the same data, which in general is
+    strided.
+
+    <h3>Example(s)</h3>
+
+    <ol>
+      <li>Sum up the data of a column:
+      \code
+      DAL::dalData *data = column.data();
+      DAL::dalDataView<float> view (*data);
+      float sum (0);
+
+      for (long row(0); row<view.nofRows(); ++row) {
+        for (float *it=view.rowBegin(row); it!=view.rowEnd(row); ++it) {
+          sum += *it;
+        }
+      }
+      \endcode
+      <li>View a plain array of 10 x 20 elements in C order, and select the
+      5-th column:
+      \code
+      std::vector<int> shape (2);
+      shape[0] = 10;
+      shape[1] = 20;
+      DAL::dalDataView<double> view (&buffer[0], shape);
+      DAL::dalDataView<double> column = view.slice (1, 5);
+
+      for (long n(0); n<column.shape(0); ++n) {
+        column(n) = 0;
+      }
+      \endcode
+    </ol>
+  */
+  template <class T>
+    class dalDataView {
+
+  public:
+
+    //! Order in which the elements of the array are stored
+    enum Order {
+      //! Last index varies fastest (HDF5)
+      C,
+      //! First index varies fastest (CASA)
+      Fortran
+    };
+
+    //! Maximum number of axes of a view
+    static int maxRank () {
+      return 8;
+    }
+
+  private:
+
+    //! Pointer to the first element
+    T *itsData;
+    //! Number of axes
+    int itsRank;
+    //! Number of elements along each of the axes
+    long itsShape[8];
+    //! Distance between consecutive elements along each of the axes
+    long itsStrides[8];
+    //! Order in which the elements are stored
+    Order itsOrder;
+
+  public:
+
+    // === Construction =========================================================
+
+    //! Default constructor, creating an empty view
+    dalDataView ()
+      : itsData (0),
+      itsRank (0),
+      itsOrder (C)
+      {
+      }
+
+    /*!
+      \brief Argumented constructor, for a contiguous array
+
+      \param data  -- Pointer to the first element of the array.
+      \param shape -- Number of elements along each of the axes.
+      \param order -- Order in which the elements are stored.
+    */
+    dalDataView (T *data,
+		 std::vector<int> const &shape,
+		 Order const &order=C)
+      {
+	init (data, shape, order);
+      }
+
+    /*!
+      \brief Argumented constructor, for the data held by a dalData object
+
+      The elements are ordered according to the file type of \c data, as for
+      dalData::get; a shape of <tt>[0]</tt> (as used for the columns of HDF5
+      tables) is replaced by the number of rows.
+
+      \param data -- Data object holding the array; must exist beyond the
+             lifetime of the view.
+    */
+    dalDataView (dalData &data)
+      {
+	std::vector<int> shape (data.itsShape);
+	std::string type = dalDataType<T>::name();
+
+	if (shape.size() == 1 && shape[0] <= 0) {
+	  shape[0] = data.itsNofRows;
+	}
+
+	if (!type.empty() && type != data.datatype()) {
+	  std::cerr << "[dalDataView] Type of view does not match datatype "
+		    << data.datatype() << std::endl;
+	  init (0, std::vector<int>(), C);
+	} else {
+	  init (static_cast<T *>(data.data),
+		shape,
+		data.arrayOrder() == "fortran" ? Fortran : C);
+	}
+      }
+
+    // === Parameter access =====================================================
+
+    //! Is the view attached to an array?
+    inline bool isValid () const {
+      return itsData != 0;
+    }
+
+    //! Pointer to the first element
+    inline T * data () const {
+      return itsData;
+    }
+
+    //! Number of axes
+    inline int rank () const {
+      return itsRank;
+    }
+
+    //! Number of elements along an axis
+    inline long shape (int const &axis) const {
+      return itsShape[axis];
+    }
+
+    //! Distance between consecutive elements along an axis, [elements]
+    inline long stride (int const &axis) const {
+      return itsStrides[axis];
+    }
+
+    //! Order in which the elements are stored
+    inline Order order () const {
+      return itsOrder;
+    }
+
+    //! Total number of elements
+    inline long size () const {
+      long n = itsRank > 0 ? 1 : 0;
+      for (int axis(0); axis<itsRank; ++axis) {
+	n *= itsShape[axis];
+      }
+      return n;
+    }
+
+    //! Axis along which the elements are contiguous
+    inline int rowAxis () const {
+      return itsOrder == C ? itsRank-1 : 0;
+    }
+
+    //! Is the view contiguous, i.e. not a strided selection of an array?
+    inline bool isContiguous () const {
+      long expected (1);
+      for (int n(0); n<itsRank; ++n) {
+	int axis = itsOrder == C ? itsRank-1-n : n;
+	if (itsShape[axis] > 1 && itsStrides[axis] != expected) {
+	  return false;
+	}
+	expected *= itsShape[axis];
+      }
+      return true;
+    }
+
+    /*!
+      \brief Get the name of the class
+      \return className -- The name of the class, dalDataView.
+    */
+    inline std::string className () const {
+      return "dalDataView";
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    inline void summary () {
+      summary (std::cout);
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    void summary (std::ostream &os)
+    {
+      os << "[dalDataView] Summary of internal parameters." << std::endl;
+      os << "-- Valid view         = " << isValid()      << std::endl;
+      os << "-- Array order        = " << (itsOrder == C ? "c" : "fortran") << std::endl;
+      os << "-- Rank               = " << itsRank        << std::endl;
+      os << "-- Shape              = [";
+      for (int n(0); n<itsRank; ++n) os << " " << itsShape[n];
+      os << " ]" << std::endl;
+      os << "-- Strides            = [";
+      for (int n(0); n<itsRank; ++n) os << " " << itsStrides[n];
+      os << " ]" << std::endl;
+      os << "-- Contiguous         = " << isContiguous() << std::endl;
+    }
+
+    // === Element access =======================================================
+
+    //! Element of a 1-dimensional view
+    inline T & operator() (long const &i) const {
+      return itsData[i*itsStrides[0]];
+    }
+
+    //! Element of a 2-dimensional view
+    inline T & operator() (long const &i,
+			   long const &j) const {
+      return itsData[i*itsStrides[0] + j*itsStrides[1]];
+    }
+
+    //! Element of a 3-dimensional view
+    inline T & operator() (long const &i,
+			   long const &j,
+			   long const &k) const {
+      return itsData[i*itsStrides[0] + j*itsStrides[1] + k*itsStrides[2]];
+    }
+
+    //! Element of a view of arbitrary rank, with \c rank() indices
+    inline T & operator() (long const *index) const {
+      long offset (0);
+      for (int axis(0); axis<itsRank; ++axis) {
+	offset += index[axis]*itsStrides[axis];
+      }
+      return itsData[offset];
+    }
+
+    // === Rows =================================================================
+
+    //! Number of elements per row
+    inline long rowLength () const {
+      return itsRank > 0 ? itsShape[rowAxis()] : 0;
+    }
+
+    //! Number of rows
+    inline long nofRows () const {
+      long length = rowLength();
+      return length > 0 ? size()/length : 0;
+    }
+
+    /*!
+      \brief Pointer to the first element of a row
+
+      Rows are numbered in storage order; the elements of a row are contiguous
+      if stride(rowAxis()) is 1, which holds for all views except slices along
+      the row axis.
+
+      \param row -- Number of the row.
+    */
+    inline T * rowBegin (long const &row) const {
+      long offset (0);
+      long rest (row);
+      for (int n(0); n<itsRank-1; ++n) {
+	/* Axes other than the row axis, fastest varying first */
+	int axis = itsOrder == C ? itsRank-2-n : n+1;
+	offset += (rest%itsShape[axis])*itsStrides[axis];
+	rest   /= itsShape[axis];
+      }
+      return itsData + offset;
+    }
+
+    //! Pointer past the last element of a contiguous row
+    inline T * rowEnd (long const &row) const {
+      return rowBegin(row) + rowLength();
+    }
+
+    // === Views ================================================================
+
+    /*!
+      \brief View of lower rank, with the index along \c axis fixed
+
+      \param axis  -- Axis along which the index is fixed.
+      \param index -- Index along \c axis.
+      \return view -- View of rank <tt>rank()-1</tt> on the same data.
+    */
+    dalDataView<T> slice (int const &axis,
+			  long const &index) const
+    {
+      dalDataView<T> view (*this);
+
+      view.itsData = itsData + index*itsStrides[axis];
+      view.itsRank = itsRank-1;
+
+      for (int n(axis); n<itsRank-1; ++n) {
+	view.itsShape[n]   = itsShape[n+1];
+	view.itsStrides[n] = itsStrides[n+1];
+      }
+
+      return view;
+    }
+
+  private:
+
+    //! Set up shape and strides for a contiguous array
+    void init (T *data,
+	       std::vector<int> const &shape,
+	       Order const &order)
+    {
+      itsData  = data;
+      itsOrder = order;
+      itsRank  = shape.size();
+
+      if (itsRank > maxRank()) {
+	std::cerr << "[dalDataView] Rank " << itsRank
+		  << " exceeds maximum rank of " << maxRank() << std::endl;
+	itsData = 0;
+	itsRank = 0;
+      }
+
+      long stride (1);
+
+      for (int n(0); n<itsRank; ++n) {
+	int axis           = order == C ? itsRank-1-n : n;
+	itsShape[axis]     = shape[axis];
+	itsStrides[axis]   = stride;
+	stride            *= shape[axis];
+      }
+    }
+
+  }; // Class dalDataView -- end
+
+} // Namespace DAL -- end
+
+#endif /* DALDATAVIEW_H */
@@ -109,6 +109,32 @@ namespace DAL {
 	  flags);
   }
   
+  //_____________________________________________________________________________
+  //                                                                   dalDataset
+  
+  /*!
+    \param filename   -- The name of the dataset/file to open.
+    \param filetype   -- Type of file to open ("HDF5", "CASA_MS", etc.).
+    \param flags      -- I/O mode flags.
+    \param properties -- Settings for the HDF5 file-creation and file-access
+           property lists, e.g. to enable paged aggregation and alignment.
+  */
+  dalDataset::dalDataset (std::string const &filename,
+                          std::string filetype,
+			  IO_Mode const &flags,
+			  HDF5Property const &properties)
+    : dalObjectBase()
+  {
+    init (filename,
+	  filetype,
+	  flags);
+
+    itsFileProperties = properties;
+
+    open (filename,
+	  flags);
+  }
+  
   // ============================================================================
   //
   //  Destruction
@@ -154,10 +180,11 @@ namespace DAL {
   
   void dalDataset::init()
   {
-    itsFilter      = dalFilter();
-    h5fh_p         = 0;
+    itsFilter         = dalFilter();
+    h5fh_p            = 0;
+    itsFileProperties = HDF5Property();
 #ifdef DAL_WITH_CASA
-    itsMS          = casa::MeasurementSet();
+    itsMS             = casa::MeasurementSet();
 #endif
   }
 
@@ -234,7 +261,8 @@ namespace DAL {
     
     fileTruncated = HDF5Object::openFile (h5fh_p,
 					  filename,
-					  flags);
+					  flags,
+					  itsFileProperties);
     
     /* Check the HDF5 objec identifier; if it is ok, do internal book-keeping */
     if (H5Iis_valid(h5fh_p)) {
@@ -249,6 +277,61 @@ namespace DAL {
     return fileIsOpen;
   }
 
+  //_____________________________________________________________________________
+  //                                                                    openImage
+
+  /*!
+    \param image       -- Image of an HDF5 file, e.g. as retrieved through
+           fileImage(); the image is copied, i.e. changes to the opened file do
+	   not affect \c image.
+    \param flags       -- I/O mode flags; use IO_Mode::ReadWrite to permit
+           modification of the file.
+    \return fileIsOpen -- Has the file been opened by reaching the end of this
+            function? Returns \e false in case an error was encountered trying
+	    to open the file.
+  */
+  bool dalDataset::openImage (std::vector<char> const &image,
+			      IO_Mode const &flags)
+  {
+    /* Release a previously opened file */
+    destroy ();
+
+    h5fh_p   = HDF5Object::openFileImage (image, flags);
+    itsFlags = flags;
+    itsFlags.addFlag (IO_Mode::InMemory);
+
+    if (H5Iis_valid(h5fh_p)) {
+      itsFiletype.setType (dalFileType::HDF5);
+      itsObjectHandler = &h5fh_p;
+      itsName          = HDF5Object::name (h5fh_p);
+      return true;
+    } else {
+      return false;
+    }
+  }
+
+  //_____________________________________________________________________________
+  //                                                                    fileImage
+
+  /*!
+    \retval image  -- Image of the HDF5 file, which can be written to disk
+           as-is or re-opened through openImage().
+    \return status -- Status of the operation; returns \e false in case the
+            object is not attached to an HDF5 file or the image could not be
+	    retrieved.
+  */
+  bool dalDataset::fileImage (std::vector<char> &image)
+  {
+    if (itsFiletype.type() != dalFileType::HDF5) {
+      std::cerr << "[dalDataset::fileImage] Not attached to an HDF5 file!"
+		<< std::endl;
+      image.clear();
+      return false;
+    }
+
+    return HDF5Object::fileImage (image, h5fh_p);
+  }
+
   //_____________________________________________________________________________
   //                                                                     openFITS
 
@@ -783,12 +866,15 @@ namespace DAL {
     \param data An array of integer values.
     \param cdims A vector a chunk dimensions (necessary for extending an
            hdf5 dataset).
+    \param filter Filter pipeline (e.g. compression) applied to an
+           extendible array.
     \return dalArray * pointer to an array object.
   */
   dalArray * dalDataset::createIntArray (std::string arrayname,
                                          std::vector<int> dims,
                                          int data[],
-                                         std::vector<int> cdims )
+                                         std::vector<int> cdims,
+                                         HDF5Filter const &filter)
   {
     switch (itsFiletype.type()) {
     case dalFileType::HDF5:
@@ -798,7 +884,8 @@ namespace DAL {
 					      arrayname,
 					      dims,
 					      data,
-					      cdims);
+					      cdims,
+					      filter);
 	  return la;
 	} else {
 	  std::cerr << "[dalDataset::createIntArray]"
@@ -831,13 +918,16 @@ namespace DAL {
     \param data An array of floating point values.
     \param cdims A vector a chunk dimensions (necessary for extending an
                  hdf5 dataset).
+    \param filter Filter pipeline (e.g. compression) applied to an
+           extendible array.
     \return dalArray * pointer to an array object.
      */
   dalArray *
   dalDataset::createFloatArray (std::string arrayname,
 				std::vector<int> dims,
                                 float data[],
-				std::vector<int> cdims)
+				std::vector<int> cdims,
+				HDF5Filter const &filter)
   {
     switch (itsFiletype.type()) {
     case dalFileType::HDF5:
@@ -847,7 +937,8 @@ namespace DAL {
 						  arrayname,
 						  dims,
 						  data,
-						  cdims);
+						  cdims,
+						  filter);
 	  return la;
 	} else {
 	  std::cerr << "[dalDataset::createFloatArray]"
@@ -882,13 +973,16 @@ namespace DAL {
     \param data An array of complex floating point values.
     \param cdims A vector a chunk dimensions (necessary for extending an
                  hdf5 dataset).
+    \param filter Filter pipeline (e.g. compression) applied to an
+           extendible array.
     \return dalArray * pointer to an array object.
      */
   dalArray *
   dalDataset::createComplexFloatArray( std::string arrayname,
                                        std::vector<int> dims,
                                        std::complex<float> data[],
-                                       std::vector<int> cdims )
+                                       std::vector<int> cdims,
+                                       HDF5Filter const &filter)
   {
     switch (itsFiletype.type()) {
     case dalFileType::HDF5:
@@ -898,7 +992,8 @@ namespace DAL {
 								      arrayname,
 								      dims,
 								      data,
-								      cdims);
+								      cdims,
+								      filter);
 	  return la;
 	} else {
 	  std::cerr << "[dalDataset::createComplexFloatArray]"
@@ -971,13 +1066,33 @@ namespace DAL {
   */
   dalTable * dalDataset::createTable( std::string tablename,
                                       std::string groupname )
+  {
+    return createTable (tablename, groupname, HDF5Filter());
+  }
+  
+  //_____________________________________________________________________________
+  //                                                                  createTable
+  
+  /*!
+    Creates a table in a group (mainly for hdf5), the rows of which are passed
+    through a filter pipeline (e.g. compression) before being written.
+
+    \param tablename -- Name of the table to be created
+    \param groupname -- Name of the group within which the table is to be
+           created.
+    \param filter    -- Filter pipeline applied to the rows of the table.
+    \return dalTable
+  */
+  dalTable * dalDataset::createTable( std::string tablename,
+                                      std::string groupname,
+				      HDF5Filter const &filter)
   {
     switch (itsFiletype.type()) {
     case dalFileType::HDF5:
       {
 	if (H5Iis_valid(h5fh_p)) {
 	  dalTable * lt = new dalTable( DAL::dalFileType::HDF5 );
-	  lt->createTable( itsObjectHandler, tablename, groupname );
+	  lt->createTable( itsObjectHandler, tablename, groupname, filter );
 	  return lt;
 	} else {
 	  std::cerr << "[dalDataset::createTable]"
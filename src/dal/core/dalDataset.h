@@ -108,6 +108,8 @@ namespace DAL {
     dalFilter itsFilter;
     //! HDF5 file handle
     hid_t h5fh_p;
+    //! Settings for the HDF5 file-creation and file-access property lists
+    HDF5Property itsFileProperties;
     
 #ifdef DAL_WITH_CASA
     casa::MeasurementSet itsMS;   // CASA measurement set
@@ -136,6 +138,12 @@ namespace DAL {
 		std::string filetype,
 		IO_Mode const &flags=IO_Mode(IO_Mode::Open));
     
+    //! Argumented constructor, with settings for the HDF5 property lists
+    dalDataset (std::string const &filename,
+		std::string filetype,
+		IO_Mode const &flags,
+		HDF5Property const &properties);
+    
     // === Destruction ==========================================================
     
     //! Default destructor
@@ -148,11 +156,30 @@ namespace DAL {
       return h5fh_p;
     }
 
+    //! Get the settings for the HDF5 file-creation and file-access property lists
+    inline HDF5Property fileProperties () const {
+      return itsFileProperties;
+    }
+
+    /*!
+      \brief Set the settings for the HDF5 file-creation and file-access property lists
+      \param properties -- Settings taking effect the next time an HDF5 file is
+             opened or created through open().
+    */
+    inline void setFileProperties (HDF5Property const &properties) {
+      itsFileProperties = properties;
+    }
+
     // === Public methods =======================================================
     
     //! Open the dataset
     bool open (std::string const &filename,
 	       IO_Mode const &flags=IO_Mode(IO_Mode::Open));
+    //! Open an HDF5 file from an image in memory
+    bool openImage (std::vector<char> const &image,
+		    IO_Mode const &flags=IO_Mode(IO_Mode::ReadOnly));
+    //! Get the image of the HDF5 file
+    bool fileImage (std::vector<char> &image);
     //! Close the dataset
     bool close();
     //! Get the attributes of the dataset
@@ -247,20 +274,27 @@ namespace DAL {
     dalArray * createIntArray (std::string arrayname,
 			       std::vector<int> dims,
 			       int data[],
-			       std::vector<int>cdims );
+			       std::vector<int> cdims,
+			       HDF5Filter const &filter=HDF5Filter());
     //! Create a new extendible floating point array in the root group.
     dalArray * createFloatArray (std::string arrayname,
 				 std::vector<int> dims,
 				 float data[],
-				 std::vector<int>cdims);
+				 std::vector<int> cdims,
+				 HDF5Filter const &filter=HDF5Filter());
     dalArray * createComplexFloatArray (std::string arrayname,
 					std::vector<int> dims,
 					std::complex<float> data[],
-					std::vector<int>cdims );
+					std::vector<int> cdims,
+					HDF5Filter const &filter=HDF5Filter());
     //! Create a new table in the root group
     dalTable * createTable (std::string tablename );
     //! Create a new table in a specified group
     dalTable * createTable (std::string tablename, std::string groupname );
+    //! Create a new table in a specified group, applying a filter pipeline
+    dalTable * createTable (std::string tablename,
+			    std::string groupname,
+			    HDF5Filter const &filter);
     dalGroup * createGroup (const char * groupname );
     //! Set table filter.
     void setFilter (std::string const &columns);
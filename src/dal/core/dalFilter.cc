@@ -19,9 +19,81 @@
  ***************************************************************************/
 
 #include <core/dalFilter.h>
+#include <core/dalColumnReader.h>
+#include <core/dalTableZoneMap.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
 
 namespace DAL {
 
+  //_____________________________________________________________________________
+  //                                                                         trim
+
+  //! Remove leading and trailing whitespace from \c str
+  static std::string trim (std::string const &str)
+  {
+    std::string::size_type first = str.find_first_not_of (" \t\n");
+    std::string::size_type last  = str.find_last_not_of (" \t\n");
+
+    if (first == std::string::npos) {
+      return "";
+    } else {
+      return str.substr (first, last-first+1);
+    }
+  }
+
+  //_____________________________________________________________________________
+  //                                                                evaluateCells
+
+  /*!
+    \brief Evaluate a condition for the cells of a column of type \c T
+
+    \param buffer  -- Packed rows, of which the cells of the column start at
+           the first position.
+    \param rowSize -- Size of a packed row, [Bytes].
+    \param nofRows -- Number of rows.
+    \param op      -- Comparison operator.
+    \param value   -- Value against which the cells are compared.
+    \retval mask   -- Cleared for the rows not fulfilling the condition.
+  */
+  template <class T>
+  static void evaluateCells (char const *buffer,
+			     size_t const &rowSize,
+			     hsize_t const &nofRows,
+			     dalFilter::Operator const &op,
+			     double const &value,
+			     std::vector<char> &mask)
+  {
+    T cell;
+
+    for (hsize_t n(0); n<nofRows; ++n, buffer+=rowSize) {
+      memcpy (&cell, buffer, sizeof(T));
+      switch (op) {
+      case dalFilter::Equal:
+	mask[n] &= (cell == value);
+	break;
+      case dalFilter::NotEqual:
+	mask[n] &= (cell != value);
+	break;
+      case dalFilter::Less:
+	mask[n] &= (cell < value);
+	break;
+      case dalFilter::LessEqual:
+	mask[n] &= (cell <= value);
+	break;
+      case dalFilter::Greater:
+	mask[n] &= (cell > value);
+	break;
+      case dalFilter::GreaterEqual:
+	mask[n] &= (cell >= value);
+	break;
+      }
+    }
+  }
+
   // ============================================================================
   //
   //  Construction
@@ -82,6 +154,9 @@ namespace DAL {
     itsFilterString = "";
     itsFiletype     = type;
     itsFilterIsSet  = false;
+    itsColumns.clear();
+    itsConditions.clear();
+    itsNofScannedRows = 0;
   }
 
   //_____________________________________________________________________________
@@ -103,6 +178,32 @@ namespace DAL {
       itsFilterString = "Select " + columns + " from $1";
       itsFilterIsSet   = true;
       break;
+    case dalFileType::HDF5:
+      {
+	std::string::size_type pos (0);
+	std::string::size_type comma (0);
+	itsColumns.clear();
+	itsConditions.clear();
+	/* Split the comma-separated list of column names */
+	while (comma != std::string::npos) {
+	  comma = columns.find (',', pos);
+	  std::string name = trim (columns.substr (pos, comma-pos));
+	  if (!name.empty()) {
+	    itsColumns.push_back (name);
+	  }
+	  pos = comma+1;
+	}
+	if (itsColumns.empty()) {
+	  std::cerr << "[dalFilter::setFilter] Empty list of column names!"
+		    << std::endl;
+	  itsFilterIsSet = false;
+	  status         = false;
+	} else {
+	  itsFilterString = "Select " + columns + " from $1";
+	  itsFilterIsSet  = true;
+	}
+      }
+      break;
     default:
       {
 	std::cerr << "[dalFilter::setFilter] Operation not yet supoorted for type "
@@ -160,6 +261,18 @@ namespace DAL {
         itsFilterIsSet  = true;
       }
       break;
+    case dalFileType::HDF5:
+      {
+	status = setFilter (cols) && parseConditions (conditions);
+	if (status) {
+	  itsFilterString = "Select " + cols + " from $1 where " + conditions;
+	} else {
+	  itsColumns.clear();
+	  itsConditions.clear();
+	  itsFilterIsSet = false;
+	}
+      }
+      break;
     default:
       {
 	std::cerr << "[dalFilter::setFilter] Operation not yet supoorted for type "
@@ -182,6 +295,375 @@ namespace DAL {
     os << "-- Filter string = " << itsFilterString         << std::endl;
     os << "-- File type     = " << itsFiletype.name()      << std::endl;
     os << "-- Filter is set = " << itsFilterIsSet          << std::endl;
+    os << "-- Columns       = " << itsColumns              << std::endl;
+    os << "-- Conditions    = " << itsConditions.size()   << std::endl;
+  }
+
+  //_____________________________________________________________________________
+  //                                                              parseConditions
+
+  /*!
+    \param conditions -- Conditions on the rows, e.g.
+           <tt>"TIME > 4.5e9 AND ANTENNA1 = 3"</tt>; each condition compares a
+           column against a numerical constant, conditions are combined by
+           \c AND.
+    \return status -- Returns \e false if the conditions could not be parsed.
+  */
+  bool dalFilter::parseConditions (std::string const &conditions)
+  {
+    std::vector<std::string> clauses;
+    std::string upper (conditions);
+    std::string::size_type pos (0);
+    std::string::size_type next (0);
+
+    itsConditions.clear();
+
+    if (trim (conditions).empty()) {
+      return true;
+    }
+
+    for (unsigned int n(0); n<upper.size(); ++n) {
+      upper[n] = toupper (upper[n]);
+    }
+
+    /* Split into clauses at the (whitespace-delimited) AND keywords */
+    while (pos <= conditions.size()) {
+      next = pos;
+      while ((next = upper.find ("AND", next)) != std::string::npos) {
+	if (next > 0 && isspace (upper[next-1])
+	    && next+3 < upper.size() && isspace (upper[next+3])) {
+	  break;
+	}
+	next += 3;
+      }
+      clauses.push_back (trim (conditions.substr (pos, next-pos)));
+      if (next == std::string::npos) {
+	break;
+      }
+      pos = next+3;
+    }
+
+    /* Parse the individual clauses */
+    for (unsigned int n(0); n<clauses.size(); ++n) {
+      Condition condition;
+      std::string const &clause = clauses[n];
+      std::string::size_type opStart = clause.find_first_of ("<>=!");
+      std::string::size_type opEnd   = clause.find_first_not_of ("<>=!", opStart);
+      if (opStart == std::string::npos || opEnd == std::string::npos) {
+	std::cerr << "[dalFilter::parseConditions] Missing operator in condition '"
+		  << clause << "'" << std::endl;
+	itsConditions.clear();
+	return false;
+      }
+      condition.column  = trim (clause.substr (0, opStart));
+      std::string op    = clause.substr (opStart, opEnd-opStart);
+      std::string value = trim (clause.substr (opEnd));
+      char *end (0);
+
+      if (op == "=" || op == "==") {
+	condition.op = Equal;
+      } else if (op == "!=" || op == "<>") {
+	condition.op = NotEqual;
+      } else if (op == "<") {
+	condition.op = Less;
+      } else if (op == "<=") {
+	condition.op = LessEqual;
+      } else if (op == ">") {
+	condition.op = Greater;
+      } else if (op == ">=") {
+	condition.op = GreaterEqual;
+      } else {
+	std::cerr << "[dalFilter::parseConditions] Unsupported operator '"
+		  << op << "'" << std::endl;
+	itsConditions.clear();
+	return false;
+      }
+
+      condition.value = strtod (value.c_str(), &end);
+
+      if (condition.column.empty() || value.empty() || *end != '\0') {
+	std::cerr << "[dalFilter::parseConditions] Condition '" << clause
+		  << "' is not a comparison of a column against a number!"
+		  << std::endl;
+	itsConditions.clear();
+	return false;
+      }
+
+      itsConditions.push_back (condition);
+    }
+
+    return true;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                   selectRows
+
+  /*!
+    \param location  -- Identifier of the group to which the table is attached.
+    \param table     -- Name of the table.
+    \retval rows     -- Indices of the rows matching the conditions, in
+           ascending order.
+    \param batchSize -- Number of rows read and evaluated at once.
+    \return status   -- Status of the operation; returns \e false in case an
+            error was encountered, e.g. a condition referring to a missing or
+            non-numerical column.
+  */
+  bool dalFilter::selectRows (hid_t const &location,
+			      std::string const &table,
+			      std::vector<hsize_t> &rows,
+			      hsize_t const &batchSize)
+  {
+    return scan (location, table, rows, NULL, batchSize);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                     readRows
+
+  /*!
+    \param location  -- Identifier of the group to which the table is attached.
+    \param table     -- Name of the table.
+    \retval data     -- The selected columns of the rows matching the
+           conditions, as packed rows: the cells of the columns follow each other
+           in the order of selection, in their native datatypes and without
+           padding (i.e. with the layout of a DAL::dalColumnReader for the
+           selected columns).
+    \retval rows     -- Indices of the rows matching the conditions, in
+           ascending order.
+    \param batchSize -- Number of rows read and evaluated at once.
+    \return status   -- Status of the operation; returns \e false in case an
+            error was encountered.
+  */
+  bool dalFilter::readRows (hid_t const &location,
+			    std::string const &table,
+			    std::vector<char> &data,
+			    std::vector<hsize_t> &rows,
+			    hsize_t const &batchSize)
+  {
+    return scan (location, table, rows, &data, batchSize);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                         scan
+
+  /*!
+    The table is read in batches by a dalColumnReader selecting the columns
+    to be returned, followed by the remaining columns referred to by the
+    conditions; as the selected columns come first, the selected part of a
+    matching row is a prefix of the packed row.
+
+    \param location  -- Identifier of the group to which the table is attached.
+    \param table     -- Name of the table.
+    \retval rows     -- Indices of the rows matching the conditions.
+    \retval data     -- Selected columns of the matching rows; \c NULL if only
+           the indices are requested.
+    \param batchSize -- Number of rows read and evaluated at once.
+    \return status   -- Status of the operation.
+  */
+  bool dalFilter::scan (hid_t const &location,
+			std::string const &table,
+			std::vector<hsize_t> &rows,
+			std::vector<char> *data,
+			hsize_t const &batchSize)
+  {
+    rows.clear();
+    if (data) {
+      data->clear();
+    }
+    itsNofScannedRows = 0;
+
+    if (itsFiletype.type() != dalFileType::HDF5) {
+      std::cerr << "[dalFilter::scan] Operation not supported for type "
+		<< itsFiletype.name() << std::endl;
+      return false;
+    }
+
+    /* Columns to be read */
+    std::vector<std::string> columns;
+    std::vector<unsigned int> index (itsConditions.size());
+
+    if (data) {
+      if (itsColumns.size() == 1 && itsColumns[0] == "*") {
+	HDF5Handle dataset (H5Dopen (location, table.c_str(), H5P_DEFAULT));
+	HDF5Handle type (H5Dget_type (dataset.id()));
+	int nofMembers = H5Tget_nmembers (type.id());
+	for (int n(0); n<nofMembers; ++n) {
+	  char *name = H5Tget_member_name (type.id(), n);
+	  columns.push_back (name);
+	  H5free_memory (name);
+	}
+      } else {
+	columns = itsColumns;
+      }
+    }
+
+    unsigned int nofSelected = columns.size();
+
+    for (unsigned int n(0); n<itsConditions.size(); ++n) {
+      index[n] = std::find (columns.begin(),
+			    columns.end(),
+			    itsConditions[n].column) - columns.begin();
+      if (index[n] == columns.size()) {
+	columns.push_back (itsConditions[n].column);
+      }
+    }
+
+    if (columns.empty()) {
+      /* Neither data nor conditions: all rows match */
+      HDF5Handle dataset (H5Dopen (location, table.c_str(), H5P_DEFAULT));
+      HDF5Handle dataspace (H5Dget_space (dataset.id()));
+      hssize_t nofRows = H5Sget_simple_extent_npoints (dataspace.id());
+      if (nofRows < 0) {
+	std::cerr << "[dalFilter::scan] Failed to open table " << table
+		  << std::endl;
+	return false;
+      }
+      for (hssize_t n(0); n<nofRows; ++n) {
+	rows.push_back (n);
+      }
+      return true;
+    }
+
+    dalColumnReader reader (location, table, columns, batchSize);
+
+    if (!reader.isValid()) {
+      return false;
+    }
+
+    size_t selectedSize = nofSelected ? reader.offset (nofSelected-1)
+      + reader.size (nofSelected-1) : 0;
+    std::vector<char> buffer (reader.batchSize()*reader.rowSize());
+    std::vector<char> mask (reader.batchSize());
+    std::vector<std::pair<hsize_t,hsize_t> > ranges;
+    dalTableZoneMap zoneMap;
+    hsize_t start (0);
+    hsize_t nofRows (0);
+
+    /* Restrict the scan to the candidate zones, if there is a zone map */
+    if (itsConditions.empty()
+	|| !dalTableZoneMap::exists (location, table)
+	|| !zoneMap.open (location, table)
+	|| !zoneMap.candidates (itsConditions, reader.nofRows(), ranges)) {
+      ranges.assign (1, std::make_pair (hsize_t(0), reader.nofRows()));
+    }
+
+    for (unsigned int range(0); range<ranges.size(); ++range) {
+      start = ranges[range].first;
+      reader.setRange (start, ranges[range].second-start);
+
+      while ((nofRows = reader.next (&buffer[0]))) {
+	std::fill (mask.begin(), mask.begin()+nofRows, 1);
+	/* Evaluate the conditions for all rows of the batch */
+	for (unsigned int n(0); n<itsConditions.size(); ++n) {
+	  if (!evaluate (itsConditions[n],
+			 reader,
+			 index[n],
+			 &buffer[0],
+			 nofRows,
+			 mask)) {
+	    rows.clear();
+	    if (data) {
+	      data->clear();
+	    }
+	    return false;
+	  }
+	}
+	/* Collect the matching rows */
+	for (hsize_t n(0); n<nofRows; ++n) {
+	  if (mask[n]) {
+	    rows.push_back (start+n);
+	    if (data) {
+	      char const *row = &buffer[n*reader.rowSize()];
+	      data->insert (data->end(), row, row+selectedSize);
+	    }
+	  }
+	}
+	start             += nofRows;
+	itsNofScannedRows += nofRows;
+      }
+    }
+
+    return true;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                     evaluate
+
+  /*!
+    \param condition -- Condition to evaluate.
+    \param reader    -- Reader by which the rows have been read.
+    \param column    -- Index of the column within the reader.
+    \param buffer    -- Packed rows as returned by the reader.
+    \param nofRows   -- Number of rows in the buffer.
+    \retval mask     -- Cleared for the rows not fulfilling the condition.
+    \return status   -- Returns \e false if the column is not numerical.
+  */
+  bool dalFilter::evaluate (Condition const &condition,
+			    dalColumnReader const &reader,
+			    unsigned int const &column,
+			    char const *buffer,
+			    hsize_t const &nofRows,
+			    std::vector<char> &mask)
+  {
+    hid_t type         = reader.type (column);
+    size_t size        = reader.size (column);
+    size_t rowSize     = reader.rowSize ();
+    char const *cells  = buffer + reader.offset (column);
+    Operator op        = condition.op;
+    double value       = condition.value;
+
+    switch (H5Tget_class (type)) {
+    case H5T_INTEGER:
+      {
+	bool isSigned = H5Tget_sign (type) == H5T_SGN_2;
+	switch (size) {
+	case 1:
+	  if (isSigned) {
+	    evaluateCells<signed char> (cells, rowSize, nofRows, op, value, mask);
+	  } else {
+	    evaluateCells<unsigned char> (cells, rowSize, nofRows, op, value, mask);
+	  }
+	  return true;
+	case 2:
+	  if (isSigned) {
+	    evaluateCells<short> (cells, rowSize, nofRows, op, value, mask);
+	  } else {
+	    evaluateCells<unsigned short> (cells, rowSize, nofRows, op, value, mask);
+	  }
+	  return true;
+	case 4:
+	  if (isSigned) {
+	    evaluateCells<int> (cells, rowSize, nofRows, op, value, mask);
+	  } else {
+	    evaluateCells<unsigned int> (cells, rowSize, nofRows, op, value, mask);
+	  }
+	  return true;
+	case 8:
+	  if (isSigned) {
+	    evaluateCells<long long> (cells, rowSize, nofRows, op, value, mask);
+	  } else {
+	    evaluateCells<unsigned long long> (cells, rowSize, nofRows, op, value, mask);
+	  }
+	  return true;
+	}
+      }
+      break;
+    case H5T_FLOAT:
+      if (size == sizeof(float)) {
+	evaluateCells<float> (cells, rowSize, nofRows, op, value, mask);
+	return true;
+      } else if (size == sizeof(double)) {
+	evaluateCells<double> (cells, rowSize, nofRows, op, value, mask);
+	return true;
+      }
+      break;
+    default:
+      break;
+    }
+
+    std::cerr << "[dalFilter::evaluate] Column " << condition.column
+	      << " is not of a supported numerical type!" << std::endl;
+
+    return false;
   }
   
 } // DAL namespace
@@ -25,6 +25,8 @@
 #include <core/dalObjectBase.h>
 
 namespace DAL {
+
+  class dalColumnReader;
   
   /*!
     \class dalFilter
@@ -36,14 +38,75 @@ namespace DAL {
 
     \author Joseph Masters
     \author Lars B&auml;hren
+
+    \test tdalFilter.cc
+
+    <h3>Synopsis</h3>
+
+    A filter consists of a selection of columns and, optionally, a set of
+    conditions the rows have to fulfill, e.g.
+    \code
+    DAL::dalFilter filter (DAL::dalFileType::HDF5,
+                           "TIME,DATA",
+                           "TIME > 4.5e9 AND ANTENNA1 = 3");
+    \endcode
+
+    For a CASA measurement set the filter is turned into a TaQL command, which
+    is evaluated by the table system when opening the table. For an HDF5 table
+    the conditions are parsed into a list of comparisons between a numerical
+    column and a constant, combined by \c AND; the operators <tt>=, ==, !=, <>,
+    <, <=, >, >=</tt> are supported. The conditions then are evaluated by
+    selectRows() and readRows(), which scan the table in batches of rows (see
+    DAL::dalColumnReader), reading only the columns the conditions refer to
+    (plus, for readRows(), the selected columns); each condition is evaluated
+    over all rows of a batch at once. Thereby the memory required is bounded
+    by the batch size, independent of the size of the table. If the table has
+    a zone map (see DAL::dalTableZoneMap), only the zones of rows which
+    possibly fulfill the conditions are read.
   */
   
   class dalFilter : public dalObjectBase {
 
+  public:
+
+    //! Comparison operators supported in the conditions on an HDF5 table
+    enum Operator {
+      //! Equal to
+      Equal,
+      //! Not equal to
+      NotEqual,
+      //! Less than
+      Less,
+      //! Less than or equal to
+      LessEqual,
+      //! Greater than
+      Greater,
+      //! Greater than or equal to
+      GreaterEqual
+    };
+
+    //! Condition on a single column of an HDF5 table
+    struct Condition {
+      //! Name of the column
+      std::string column;
+      //! Comparison operator
+      Operator op;
+      //! Value against which the cells of the column are compared
+      double value;
+    };
+
+  private:
+
     //! Table filter std::string
     std::string itsFilterString;
     //! Book-keeping whether a filter is set or not.
     bool itsFilterIsSet;
+    //! Selected columns; "*" selects all columns
+    std::vector<std::string> itsColumns;
+    //! Conditions on the rows, combined by AND
+    std::vector<Condition> itsConditions;
+    //! Number of rows read by the last scan of a table
+    hsize_t itsNofScannedRows;
     
   public:
 
@@ -87,6 +150,39 @@ namespace DAL {
       return itsFilterString;
     }
 
+    //! Get the selected columns
+    inline std::vector<std::string> columns () const {
+      return itsColumns;
+    }
+
+    //! Get the conditions on the rows
+    inline std::vector<Condition> conditions () const {
+      return itsConditions;
+    }
+
+    //! Get the number of conditions on the rows
+    inline unsigned int nofConditions () const {
+      return itsConditions.size();
+    }
+
+    //! Get the number of rows read by the last call to selectRows or readRows
+    inline hsize_t nofScannedRows () const {
+      return itsNofScannedRows;
+    }
+
+    //! Get the indices of the rows of an HDF5 table matching the conditions
+    bool selectRows (hid_t const &location,
+		     std::string const &table,
+		     std::vector<hsize_t> &rows,
+		     hsize_t const &batchSize=4096);
+
+    //! Read the selected columns of the rows matching the conditions
+    bool readRows (hid_t const &location,
+		   std::string const &table,
+		   std::vector<char> &data,
+		   std::vector<hsize_t> &rows,
+		   hsize_t const &batchSize=4096);
+
     //! Provide a summary of the internal status
     inline void summary () {
       summary (std::cout);
@@ -98,6 +194,24 @@ namespace DAL {
 
     //! Initialize internal parameters
     void init (dalFileType const &type=dalFileType());
+
+    //! Parse the conditions on the rows of an HDF5 table
+    bool parseConditions (std::string const &conditions);
+
+    //! Scan an HDF5 table for the rows matching the conditions
+    bool scan (hid_t const &location,
+	       std::string const &table,
+	       std::vector<hsize_t> &rows,
+	       std::vector<char> *data,
+	       hsize_t const &batchSize);
+
+    //! Evaluate a condition for a batch of rows
+    static bool evaluate (Condition const &condition,
+			  dalColumnReader const &reader,
+			  unsigned int const &column,
+			  char const *buffer,
+			  hsize_t const &nofRows,
+			  std::vector<char> &mask);
     
   };
   
@@ -277,6 +277,7 @@ namespace DAL {
     \param data A structure containing the data to be written.  The size
                 of the data must match the provided dimensions.
     \param cdims The chunk dimensions for an extendible array.
+    \param filter Filter pipeline applied to an extendible array.
 
     \return dalArray * A pointer to an array object.
   */
@@ -284,10 +285,11 @@ namespace DAL {
   dalGroup::createShortArray( std::string arrayname,
                               std::vector<int> dims,
                               short data[],
-                              std::vector<int> cdims )
+                              std::vector<int> cdims,
+                              HDF5Filter const &filter)
   {
     dalShortArray * la;
-    la = new dalShortArray( itsGroupID, arrayname, dims, data, cdims );
+    la = new dalShortArray( itsGroupID, arrayname, dims, data, cdims, filter );
     return la;
   }
 
@@ -305,6 +307,7 @@ namespace DAL {
     \param data A structure containing the data to be written.  The size
                 of the data must match the provided dimensions.
     \param cdims The chunk dimensions for an extendible array.
+    \param filter Filter pipeline applied to an extendible array.
 
     \return dalArray * A pointer to an array object.
   */
@@ -312,10 +315,11 @@ namespace DAL {
   dalGroup::createIntArray( std::string arrayname,
                             std::vector<int> dims,
                             int data[],
-                            std::vector<int> cdims )
+                            std::vector<int> cdims,
+                            HDF5Filter const &filter)
   {
     dalIntArray * la;
-    la = new dalIntArray( itsGroupID, arrayname, dims, data, cdims );
+    la = new dalIntArray( itsGroupID, arrayname, dims, data, cdims, filter );
     return la;
   }
 
@@ -333,6 +337,7 @@ namespace DAL {
     \param data A structure containing the data to be written.  The size
                 of the data must match the provided dimensions.
     \param cdims The chunk dimensions for an extendible array.
+    \param filter Filter pipeline applied to an extendible array.
 
     \return dalArray * A pointer to an array object.
   */
@@ -340,10 +345,11 @@ namespace DAL {
   dalGroup::createFloatArray( std::string arrayname,
                               std::vector<int> dims,
                               float data[],
-                              std::vector<int> cdims )
+                              std::vector<int> cdims,
+                              HDF5Filter const &filter)
   {
     dalFloatArray * la;
-    la = new dalFloatArray( itsGroupID, arrayname, dims, data, cdims );
+    la = new dalFloatArray( itsGroupID, arrayname, dims, data, cdims, filter );
     return la;
   }
 
@@ -362,6 +368,7 @@ namespace DAL {
     \param data A structure containing the data to be written.  The size
                 of the data must match the provided dimensions.
     \param cdims The chunk dimensions for an extendible array.
+    \param filter Filter pipeline applied to an extendible array.
 
     \return dalArray * A pointer to an array object.
   */
@@ -369,10 +376,11 @@ namespace DAL {
   dalGroup::createComplexFloatArray( std::string arrayname,
                                      std::vector<int> dims,
                                      std::complex<float> data[],
-                                     std::vector<int> cdims )
+                                     std::vector<int> cdims,
+                                     HDF5Filter const &filter)
   {
     dalComplexArray_float32 * la;
-    la = new dalComplexArray_float32( itsGroupID, arrayname, dims, data, cdims );
+    la = new dalComplexArray_float32( itsGroupID, arrayname, dims, data, cdims, filter );
     return la;
   }
 
@@ -391,6 +399,7 @@ namespace DAL {
     \param data A structure containing the data to be written.  The size
                 of the data must match the provided dimensions.
     \param cdims The chunk dimensions for an extendible array.
+    \param filter Filter pipeline applied to an extendible array.
 
     \return dalArray * A pointer to an array object.
   */
@@ -398,10 +407,11 @@ namespace DAL {
   dalGroup::createComplexShortArray( std::string arrayname,
                                      std::vector<int> dims,
                                      std::complex<Int16> data[],
-                                     std::vector<int> cdims )
+                                     std::vector<int> cdims,
+                                     HDF5Filter const &filter)
   {
     dalComplexArray_int16 * la;
-    la = new dalComplexArray_int16( itsGroupID, arrayname, dims, data, cdims );
+    la = new dalComplexArray_int16( itsGroupID, arrayname, dims, data, cdims, filter );
     return la;
   }
 
@@ -97,27 +97,32 @@ namespace DAL {
     dalArray * createShortArray(        std::string arrayname,
 					std::vector<int> dims,
 					short data[],
-					std::vector<int>cdims);
+					std::vector<int> cdims,
+					HDF5Filter const &filter=HDF5Filter());
     //! Create an array of ints within the group.
     dalArray * createIntArray(          std::string arrayname,
 					std::vector<int> dims,
 					int data[],
-					std::vector<int>cdims);
+					std::vector<int> cdims,
+					HDF5Filter const &filter=HDF5Filter());
     //! Create an array of floats within the group.
     dalArray * createFloatArray(        std::string arrayname,
 					std::vector<int> dims,
 					float data[],
-					std::vector<int>cdims);
+					std::vector<int> cdims,
+					HDF5Filter const &filter=HDF5Filter());
     
     dalArray * createComplexFloatArray( std::string arrayname,
 					std::vector<int> dims,
 					std::complex<float> data[],
-					std::vector<int>cdims );
+					std::vector<int> cdims,
+					HDF5Filter const &filter=HDF5Filter());
     
     dalArray * createComplexShortArray( std::string arrayname,
 					std::vector<int> dims,
 					std::complex<Int16> data[],
-					std::vector<int>cdims );
+					std::vector<int> cdims,
+					HDF5Filter const &filter=HDF5Filter());
     //! Retrief the array or table member names from the group.
     std::vector<std::string> getMemberNames();
     
@@ -40,7 +40,8 @@ namespace DAL {
 		 std::string arrayname,
 		 std::vector<int> dims,
 		 int data[],
-		 std::vector<int>chnkdims );
+		 std::vector<int>chnkdims,
+		 HDF5Filter const &filter=HDF5Filter());
     //! Read array data from object \e obj_id
     int * readIntArray (hid_t obj_id,
 			std::string arrayname);
@@ -39,12 +39,15 @@ namespace DAL {
                 array.  The size of the structure should match the dimensions
                 of the array.
     \param chnkdims Specifies the chunk size for extendible arrays.
+    \param filter Filter pipeline (e.g. compression) applied to the
+                data of an extendible array; ignored for fixed-size arrays.
    */
   dalShortArray::dalShortArray( hid_t obj_id,
 				std::string arrayname,
                                 std::vector<int> dims,
 				short data[],
-                                std::vector<int> chnkdims )
+                                std::vector<int> chnkdims,
+                                HDF5Filter const &filter)
   {
     hid_t datatype  = 0;
     hid_t dataspace = 0;  // declare a few h5 variables
@@ -92,6 +95,11 @@ namespace DAL {
 	  std::cerr << "ERROR: Could not set array chunk size.\n";
 	}
       
+      if ( !filter.setFilters( cparms ) )
+	{
+	  std::cerr << "ERROR: Could not set array filters.\n";
+	}
+      
       if ( ( itsDatasetID = H5Dcreate (obj_id, arrayname.c_str(), datatype,
 				       dataspace, H5P_DEFAULT, cparms, H5P_DEFAULT) ) < 0 )
 	{
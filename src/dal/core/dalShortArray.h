@@ -44,7 +44,8 @@ namespace DAL {
 		   std::string arrayname,
 		   std::vector<int> dims,
 		   short data[],
-		   std::vector<int>chnkdims);
+		   std::vector<int>chnkdims,
+		   HDF5Filter const &filter=HDF5Filter());
 
     //! Read data  from the array
     short * readShortArray (hid_t obj_id,
@@ -19,6 +19,8 @@
  ***************************************************************************/
 
 #include <core/dalTable.h>
+#include <core/HDF5Handle.h>
+#include <core/dalTableZoneMap.h>
 
 namespace DAL {
   
@@ -99,6 +101,7 @@ namespace DAL {
     status         = 0;
     itsFirstRecord = true;
     itsFilter      = dalFilter();
+    itsRecordSize  = 0;
 
     columns.clear();
     
@@ -383,6 +386,36 @@ namespace DAL {
     itsFilter.setFiletype(itsFiletype);
     itsFilter.setFilter(columns,conditions);
   }
+
+  //_____________________________________________________________________________
+  //                                                                   selectRows
+
+  /*!
+    \retval rows   -- Indices of the rows fulfilling the conditions of the
+           filter, see dalFilter::selectRows.
+    \return status -- Status of the operation; returns \e false in case an
+            error was encountered.
+  */
+  bool dalTable::selectRows (std::vector<hsize_t> &rows)
+  {
+    return itsFilter.selectRows (fileID(), itsName, rows);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                     readRows
+
+  /*!
+    \retval data   -- Selected columns of the rows fulfilling the conditions of
+           the filter, as packed rows, see dalFilter::readRows.
+    \retval rows   -- Indices of the rows fulfilling the conditions.
+    \return status -- Status of the operation; returns \e false in case an
+            error was encountered.
+  */
+  bool dalTable::readRows (std::vector<char> &data,
+			   std::vector<hsize_t> &rows)
+  {
+    return itsFilter.readRows (fileID(), itsName, data, rows);
+  }
   
   //_____________________________________________________________________________
   //                                                                getColumnData
@@ -756,6 +789,7 @@ namespace DAL {
       hid_t * lclfile = (hid_t*)voidfile; // H5File object
       file = lclfile;
       itsFileID = *lclfile;  // get the file handle
+      itsRecordSize = 0;
       
       itsTableID = H5Dopen ( itsFileID, itsName.c_str(), H5P_DEFAULT );
     }
@@ -827,11 +861,16 @@ namespace DAL {
     \param tablename The name of the table you want to create.
     \param groupname The name of the group you where you want to create
            the table.
+    \param filter Filter pipeline (e.g. compression) applied to the rows of
+           the table; see dalTable::h5applyPipeline.
   */
   void dalTable::createTable (void * voidfile,
                               std::string const &tablename,
-                              std::string groupname )
+                              std::string groupname,
+			      HDF5Filter const &filter)
   {
+    itsRecordSize = 0;
+
     if (itsFiletype.type()==dalFileType::HDF5)
       {
         // It is necessary to have at least one column for table creation
@@ -881,6 +920,9 @@ namespace DAL {
 				 data);
         delete [] fill;
         fill = NULL;
+        // attach the filter pipeline
+        itsPipeline = filter;
+        h5applyPipeline ();
         itsTableID = H5Dopen ( itsFileID, tablename.c_str(), H5P_DEFAULT );
       }
     else
@@ -1015,10 +1057,123 @@ namespace DAL {
 
     delete [] data;
     data = NULL;
+    /* The layout of the records has changed */
+    itsRecordSize = 0;
 
     if ( removedummy ) {
       removeColumn("000dummy000");
     }
+
+    // H5TBinsert_field re-creates the table without the filter pipeline
+    h5applyPipeline ();
+  }
+
+  //_____________________________________________________________________________
+  //                                                              h5applyPipeline
+
+  /*!
+    The table interface of the HDF5 library only supports deflate compression;
+    furthermore inserting or deleting a field re-creates the table dataset
+    without any filters. Therefore the table dataset is re-created here with
+    the filter pipeline assigned in dalTable::createTable, copying the records
+    and the attributes describing the table. Nothing is done if no pipeline is
+    assigned or the table dataset already has filters attached.
+
+    \return status -- Status of the operation; returns \e false in case an
+            error was encountered.
+  */
+  bool dalTable::h5applyPipeline ()
+  {
+    bool status = true;
+
+    if (itsPipeline.empty()) {
+      return true;
+    }
+
+    HDF5Handle dataset (H5Dopen (itsFileID, itsName.c_str(), H5P_DEFAULT));
+
+    if (!dataset.isValid()) {
+      std::cerr << "[dalTable::h5applyPipeline] Failed to open table "
+		<< itsName << std::endl;
+      return false;
+    }
+
+    HDF5Handle plist (H5Dget_create_plist (dataset.id()));
+
+    /* Check if the filter pipeline already is in place */
+    if (!HDF5Filter(plist.id()).empty()) {
+      return true;
+    }
+
+    HDF5Handle datatype (H5Dget_type (dataset.id()));
+    HDF5Handle dataspace (H5Dget_space (dataset.id()));
+    hssize_t nofRecords   = H5Sget_simple_extent_npoints (dataspace.id());
+    size_t recordSize     = H5Tget_size (datatype.id());
+    std::vector<char> buffer (nofRecords*recordSize+1);
+    hsize_t chunk         = CHUNK_SIZE;
+    HDF5Handle filterPlist (H5Pcreate (H5P_DATASET_CREATE));
+    std::string tmpName   = itsName + "_filtered";
+
+    /* Copy the records into a dataset with the filter pipeline attached */
+    if (H5Pget_layout (plist.id()) == H5D_CHUNKED) {
+      H5Pget_chunk (plist.id(), 1, &chunk);
+    }
+    H5Pset_chunk (filterPlist.id(), 1, &chunk);
+    itsPipeline.setFilters (filterPlist.id());
+
+    HDF5Handle filtered (H5Dcreate (itsFileID,
+				    tmpName.c_str(),
+				    datatype.id(),
+				    dataspace.id(),
+				    H5P_DEFAULT,
+				    filterPlist.id(),
+				    H5P_DEFAULT));
+    bool filteredCreated = filtered.isValid();
+
+    if (!filteredCreated) {
+      std::cerr << "[dalTable::h5applyPipeline] Failed to create filtered table "
+		<< tmpName << std::endl;
+      status = false;
+    } else {
+      if (H5Dread (dataset.id(), datatype.id(), H5S_ALL, H5S_ALL, H5P_DEFAULT, &buffer[0]) < 0
+	  || H5Dwrite (filtered.id(), datatype.id(), H5S_ALL, H5S_ALL, H5P_DEFAULT, &buffer[0]) < 0) {
+	std::cerr << "[dalTable::h5applyPipeline] Failed to copy table records!"
+		  << std::endl;
+	status = false;
+      }
+      /* Copy the attributes describing the table */
+      H5O_info_t info;
+      H5Oget_info (dataset.id(), &info);
+      for (hsize_t n(0); n<info.num_attrs; ++n) {
+	HDF5Handle attribute (H5Aopen_by_idx (dataset.id(), ".", H5_INDEX_NAME, H5_ITER_INC,
+					      n, H5P_DEFAULT, H5P_DEFAULT));
+	ssize_t length = H5Aget_name (attribute.id(), 0, NULL);
+	std::vector<char> name (length+1);
+	HDF5Handle attrType (H5Aget_type (attribute.id()));
+	HDF5Handle attrSpace (H5Aget_space (attribute.id()));
+	std::vector<char> value (H5Aget_storage_size(attribute.id())+1);
+	H5Aget_name (attribute.id(), length+1, &name[0]);
+	H5Aread (attribute.id(), attrType.id(), &value[0]);
+	HDF5Handle copy (H5Acreate (filtered.id(), &name[0], attrType.id(), attrSpace.id(),
+				    H5P_DEFAULT, H5P_DEFAULT));
+	H5Awrite (copy.id(), attrType.id(), &value[0]);
+      }
+    }
+
+    /* Release the identifiers before the original table is replaced */
+    filtered.reset ();
+    dataset.reset ();
+
+    /* Replace the original table by the filtered one */
+    if (status) {
+      H5Ldelete (itsFileID, itsName.c_str(), H5P_DEFAULT);
+      H5Lmove (itsFileID, tmpName.c_str(), itsFileID, itsName.c_str(),
+	       H5P_DEFAULT, H5P_DEFAULT);
+    } else if (filteredCreated) {
+      H5Ldelete (itsFileID, tmpName.c_str(), H5P_DEFAULT);
+    }
+
+    return status;
   }
 
   //_____________________________________________________________________________
@@ -1182,7 +1337,7 @@ namespace DAL {
           }
 
         // create a compound type that can hold each field
-        hid_t fieldtype = H5Tcreate( H5T_COMPOUND, sz );
+        HDF5Handle fieldtype (H5Tcreate( H5T_COMPOUND, sz ));
 
         size_t offset = 0;
         for ( unsigned int ii=0; ii<foo.size(); ii++)
@@ -1195,32 +1350,32 @@ namespace DAL {
 
             if ( dal_CHAR == foo[ii].getType() )
               {
-                H5Tinsert( fieldtype, foo[ii].name().c_str(), offset,
+                H5Tinsert( fieldtype.id(), foo[ii].name().c_str(), offset,
                            H5T_NATIVE_CHAR);
               }
             else if ( dal_SHORT == foo[ii].getType() )
               {
-                H5Tinsert( fieldtype, foo[ii].name().c_str(), offset,
+                H5Tinsert( fieldtype.id(), foo[ii].name().c_str(), offset,
                            H5T_NATIVE_SHORT);
               }
             else if ( dal_INT == foo[ii].getType() )
               {
-                H5Tinsert( fieldtype, foo[ii].name().c_str(), offset,
+                H5Tinsert( fieldtype.id(), foo[ii].name().c_str(), offset,
                            H5T_NATIVE_INT);
               }
             else if ( dal_FLOAT == foo[ii].getType() ) {
-	      H5Tinsert( fieldtype, foo[ii].name().c_str(), offset,
+	      H5Tinsert( fieldtype.id(), foo[ii].name().c_str(), offset,
 			 H5T_NATIVE_FLOAT);
 	    }
             else if ( dal_DOUBLE == foo[ii].getType() ) {
-	      H5Tinsert( fieldtype, foo[ii].name().c_str(), offset,
+	      H5Tinsert( fieldtype.id(), foo[ii].name().c_str(), offset,
 			 H5T_NATIVE_DOUBLE);
 	    }
           }
 	
 	// ----------   end complex column-specific code. -------------
 
-        h5addColumn_insert( subfields, compname, fieldtype, removedummy );
+        h5addColumn_insert( subfields, compname, fieldtype.id(), removedummy );
 
         return;
 
@@ -1251,6 +1406,8 @@ namespace DAL {
   */
   void dalTable::removeColumn (const std::string &colname)
   {
+    itsRecordSize = 0;
+
     if (itsFiletype.type()==dalFileType::HDF5)
       {
         status = H5TBget_table_info (itsFileID,
@@ -1286,6 +1443,7 @@ namespace DAL {
 	    
 	    status = H5TBdelete_field( itsFileID, itsName.c_str(),
 				       itsFieldNames[ii]);
+	    h5applyPipeline ();
 	    
 	    status = H5TBget_table_info (itsFileID,
 					 itsName.c_str(),
@@ -1323,6 +1481,10 @@ namespace DAL {
     to write.
     \param index The position of the column you want to write to.
     \param rownum The row position where you want to start writing data.
+    \param nrecs The number of rows to write.
+
+    If the table has a zone map (see dalTableZoneMap), the zones containing the
+    overwritten rows are rescanned.
   */
   void dalTable::writeDataByColNum (void * data,
 				    int index,
@@ -1361,6 +1523,15 @@ namespace DAL {
                                         index_num, start, numrecords, *col_size,
                                         col_offset, col_size, data);
 
+        /* Rows overwritten in place invalidate the zones containing them */
+        if (status >= 0 && dalTableZoneMap::exists (itsFileID, itsName)) {
+          dalTableZoneMap zoneMap (itsFileID, itsName);
+          if (!zoneMap.refresh (start, numrecords)) {
+            std::cerr << "[dalTable::writeDataByColNum] Failed to update zone map!"
+                      << std::endl;
+          }
+        }
+
         delete [] field_sizes;
         field_sizes = NULL;
         delete [] field_offsets;
@@ -1375,6 +1546,70 @@ namespace DAL {
     }
   }
   
+  //_____________________________________________________________________________
+  //                                                                   recordSize
+
+  /*!
+    \return size -- The size of a single record (row) of the table, [Bytes];
+            returns 0 if the layout of the records could not be retrieved.
+  */
+  size_t dalTable::recordSize ()
+  {
+    if (h5getFieldLayout()) {
+      return itsRecordSize;
+    } else {
+      return 0;
+    }
+  }
+
+  //_____________________________________________________________________________
+  //                                                             h5getFieldLayout
+
+  /*!
+    Sizes and offsets of the fields are retrieved once and then kept until the
+    layout of the table changes (i.e. a column is added or removed), such that
+    appending rows does not require any further metadata lookups.
+
+    \return status -- Status of the operation; returns \e false in case an
+            error was encountered.
+  */
+  bool dalTable::h5getFieldLayout ()
+  {
+    if (itsRecordSize > 0) {
+      return true;
+    }
+
+    if (itsFiletype.type()!=dalFileType::HDF5) {
+      std::cerr << "[dalTable::h5getFieldLayout] Operation not supported for type "
+		<< itsFiletype.name() << std::endl;
+      return false;
+    }
+
+    if (H5TBget_table_info (itsFileID, itsName.c_str(), &nfields, &nofRecords_p) < 0
+	|| nfields == 0) {
+      std::cerr << "[dalTable::h5getFieldLayout] Failed to get info on table "
+		<< itsName << std::endl;
+      return false;
+    }
+
+    itsFieldSizes.resize (nfields);
+    itsFieldOffsets.resize (nfields);
+
+    if (H5TBget_field_info (itsFileID,
+			    itsName.c_str(),
+			    NULL,
+			    &itsFieldSizes[0],
+			    &itsFieldOffsets[0],
+			    &itsRecordSize) < 0) {
+      std::cerr << "[dalTable::h5getFieldLayout] Failed to get field info of table "
+		<< itsName << std::endl;
+      itsRecordSize = 0;
+      return false;
+    }
+
+    return true;
+  }
+
   //_____________________________________________________________________________
   //                                                                    appendRow
   
@@ -1386,50 +1621,12 @@ namespace DAL {
   \param data The data you want to write at the end of the table.  The
   		  structure of the data parameter should match that of the
   		  table itself.
+    \return status -- Status of the operation; returns \e false in case an
+            error was encountered.
   */
-  void dalTable::appendRow( void * data )
+  bool dalTable::appendRow( void * data )
   {
-    if (itsFiletype.type()==dalFileType::HDF5)
-      {
-        hsize_t recs2write     = 1; // number of records to append
-        size_t * field_sizes   = NULL;
-        size_t * field_offsets = NULL;
-        size_t * size_out      = NULL;
-
-        // retrieve the input fields needed for the append_records call
-        H5TBget_table_info ( itsFileID, itsName.c_str(), &nfields, &nofRecords_p );
-
-        field_sizes = (size_t*)malloc( nfields * sizeof(size_t) );
-        field_offsets = (size_t*)malloc( nfields * sizeof(size_t) );
-        size_out = (size_t*)malloc( sizeof(size_t) );
-
-        status = H5TBget_field_info( itsFileID, itsName.c_str(), NULL, field_sizes,
-                                     field_offsets, size_out );
-
-        if ( itsFirstRecord )
-          {
-            hsize_t start = 0;
-            hsize_t numrows = 1;
-            status = H5TBwrite_records( itsFileID, itsName.c_str(), start,
-                                        numrows, *size_out, field_offsets, field_sizes,
-                                        data);
-            itsFirstRecord = false;
-          }
-        else
-          {
-            status = H5TBappend_records ( itsFileID, itsName.c_str(), recs2write,
-                                          *size_out, field_offsets,
-                                          field_sizes, data );
-          }
-        free( field_sizes );
-        free( field_offsets );
-        free( size_out );
-      }
-    else
-      {
-        std::cerr << "Operation not yet supported for type " << itsFiletype.name()
-		  << ".  Sorry.\n";
-      }
+    return appendRows (data, 1);
   }
 
   //_____________________________________________________________________________
@@ -1438,61 +1635,69 @@ namespace DAL {
   /*!
     \brief Append multiple rows.
 
-    Append multiple rows to the end of the table.
+    Append multiple rows to the end of the table. The layout of the records is
+    retrieved only once (see h5getFieldLayout), such that appending rows in a
+    loop does not involve repeated metadata lookups; still, appending larger
+    blocks of rows at once -- e.g. using a dalTableAppender -- is considerably
+    faster than appending them one by one.
 
     \param data The data you want to write at the end of the table.  The
                 structure of the data parameter should match that of the
                 table itself.
     \param row_count The number of rows you wish to append.
+    \return status -- Status of the operation; returns \e false in case an
+            error was encountered.
   */
-  void dalTable::appendRows (void * data,
+  bool dalTable::appendRows (void * data,
 			     long row_count)
   {
-    if (itsFiletype.type()==dalFileType::HDF5)
-      {
-        size_t * field_sizes = NULL;
-        size_t * field_offsets = NULL;
-        size_t * size_out = NULL;
-
-        // retrieve the input fields needed for the append_records call
-        H5TBget_table_info( itsFileID, itsName.c_str(), &nfields, &nofRecords_p );
+    if (itsFiletype.type()!=dalFileType::HDF5) {
+      std::cerr << "Operation not yet supported for type " << itsFiletype.name()
+		<< ".  Sorry.\n";
+      return false;
+    }
 
-        field_sizes  = (size_t *)malloc((size_t)nfields * sizeof(size_t));
-        field_offsets = (size_t *)malloc((size_t)nfields * sizeof(size_t));
-        size_out = (size_t*)malloc( sizeof(size_t) );
+    if (row_count < 1) {
+      return true;
+    }
 
-        status = H5TBget_field_info( itsFileID, itsName.c_str(), NULL, field_sizes,
-                                     field_offsets, size_out );
+    if (!h5getFieldLayout()) {
+      return false;
+    }
 
-        if ( itsFirstRecord )
-          {
-            hsize_t start = 0;
-            if (row_count>1)
-              {
-                status = H5TBappend_records ( itsFileID, itsName.c_str(),
-                                              (hsize_t)row_count-1, *size_out,
-                                              field_offsets, field_sizes, data);
-              }
-            status = H5TBwrite_records( itsFileID, itsName.c_str(), start,
-                                        (hsize_t)row_count, *size_out,
-                                        field_offsets, field_sizes, data );
-            itsFirstRecord = false;
-          }
-        else
-          {
-            status = H5TBappend_records ( itsFileID, itsName.c_str(),
-                                          (hsize_t)row_count, *size_out,
-                                          field_offsets, field_sizes, data);
-          }
-        free( field_sizes );
-        free( field_offsets );
-        free( size_out );
+    if ( itsFirstRecord )
+      {
+	/* The table is created with a single (dummy) record, which is
+	   overwritten by the first row */
+	hsize_t start = 0;
+	status = 0;
+	if (row_count>1)
+	  {
+	    status = H5TBappend_records ( itsFileID, itsName.c_str(),
+					  (hsize_t)row_count-1, itsRecordSize,
+					  &itsFieldOffsets[0], &itsFieldSizes[0], data);
+	  }
+	if (status >= 0) {
+	  status = H5TBwrite_records( itsFileID, itsName.c_str(), start,
+				      (hsize_t)row_count, itsRecordSize,
+				      &itsFieldOffsets[0], &itsFieldSizes[0], data );
+	}
+	if (status >= 0) {
+	  nofRecords_p   = row_count;
+	  itsFirstRecord = false;
+	}
       }
     else
       {
-        std::cerr << "Operation not yet supported for type " << itsFiletype.name()
-		  << ".  Sorry.\n";
+	status = H5TBappend_records ( itsFileID, itsName.c_str(),
+				      (hsize_t)row_count, itsRecordSize,
+				      &itsFieldOffsets[0], &itsFieldSizes[0], data);
+	if (status >= 0) {
+	  nofRecords_p += row_count;
+	}
       }
+
+    return status >= 0;
   }
 
   //_____________________________________________________________________________
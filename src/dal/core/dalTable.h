@@ -24,6 +24,7 @@
 #include <iomanip>
 
 #include <core/HDF5Attribute.h>
+#include <core/HDF5Filter.h>
 #include <core/dalFilter.h>
 #include <core/dalColumn.h>
 
@@ -68,8 +69,16 @@ namespace DAL {
     herr_t status;
     //! Table access filter
     dalFilter itsFilter;
+    //! Filter pipeline (e.g. compression) applied to the rows of the table
+    HDF5Filter itsPipeline;
     //! HDF5 list of columns
     char **itsFieldNames;
+    //! Size of a single record, [Bytes]; 0 if the field layout is not known
+    size_t itsRecordSize;
+    //! Sizes of the fields within a record, [Bytes]
+    std::vector<size_t> itsFieldSizes;
+    //! Offsets of the fields within a record, [Bytes]
+    std::vector<size_t> itsFieldOffsets;
 
     //! Access first record?
     bool itsFirstRecord;
@@ -121,6 +130,8 @@ namespace DAL {
     inline unsigned int nofColumns () const {
       return columns.size();
     }
+    //! Get the size of a single record (row) of the table, [Bytes]
+    size_t recordSize ();
 
     // === Public methods =======================================================
 
@@ -168,7 +179,8 @@ namespace DAL {
     //! Create a new table
     void createTable (void * voidfile,
 		      std::string const &tablename,
-		      std::string groupname);
+		      std::string groupname,
+		      HDF5Filter const &filter=HDF5Filter());
     //! Get a column object
     dalColumn * getColumn_complexInt16 (std::string colname);
     //! Get a column object
@@ -197,10 +209,15 @@ namespace DAL {
     //! Set filter to select \e columns with additional \e conditions applied.
     void setFilter (std::string const &columns,
 		    std::string const &conditions);
+    //! Get the indices of the rows passing the filter (HDF5 tables only)
+    bool selectRows (std::vector<hsize_t> &rows);
+    //! Read the selected columns of the rows passing the filter (HDF5 tables only)
+    bool readRows (std::vector<char> &data,
+		   std::vector<hsize_t> &rows);
     //! Append row of data to the table.
-    void appendRow (void * data );
+    bool appendRow (void * data );
     //! Append rows of data to the table.
-    void appendRows (void * data, long number_of_rows );
+    bool appendRows (void * data, long number_of_rows );
     //! List the column of the table
     std::vector<std::string> listColumns();
     //! Read rows from the table
@@ -311,6 +328,10 @@ namespace DAL {
 			   std::string const & colname,
 			   hid_t const & field_type,
 			   bool const & removedummy );
+  //! Re-create the HDF5 table with the filter pipeline attached
+  bool h5applyPipeline ();
+  //! Retrieve the layout of the fields within a record, unless known already
+  bool h5getFieldLayout ();
 
   };
   
@@ -0,0 +1,370 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "dalTableAppender.h"
+#include "HDF5Lock.h"
+
+#include <algorithm>
+#include <cstring>
+#include <sys/time.h>
+
+namespace DAL { // Namespace DAL -- begin
+
+  // ============================================================================
+  //
+  //  Construction
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                             dalTableAppender
+
+  /*!
+    \param table         -- Table to which the rows are appended; the table must
+           exist beyond the lifetime of the appender.
+    \param capacity      -- Number of rows the buffer can hold.
+    \param flushInterval -- Maximum time between writes of the buffer, [s]; 0
+           to write the buffer only once it is full.
+  */
+  dalTableAppender::dalTableAppender (dalTable &table,
+				      hsize_t const &capacity,
+				      double const &flushInterval)
+  {
+    itsTable         = &table;
+    itsRecordSize    = table.recordSize();
+    itsCapacity      = capacity > 0 ? capacity : 1;
+    itsFlushInterval = flushInterval;
+    itsNofBuffered   = 0;
+    itsNofWritten    = 0;
+    itsNofWrites     = 0;
+    itsLastWrite     = now();
+
+    if (itsRecordSize > 0) {
+      itsBuffer.resize (itsCapacity*itsRecordSize);
+    } else {
+      std::cerr << "[dalTableAppender] Failed to retrieve the record size of the table!"
+		<< std::endl;
+    }
+
+    pthread_mutex_init (&itsMutex, NULL);
+  }
+
+  // ============================================================================
+  //
+  //  Destruction
+  //
+  // ============================================================================
+
+  dalTableAppender::~dalTableAppender ()
+  {
+    flush ();
+    pthread_mutex_destroy (&itsMutex);
+  }
+
+  // ============================================================================
+  //
+  //  Parameters
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                  nofBuffered
+
+  hsize_t dalTableAppender::nofBuffered ()
+  {
+    pthread_mutex_lock (&itsMutex);
+    hsize_t number = itsNofBuffered;
+    pthread_mutex_unlock (&itsMutex);
+
+    return number;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                   nofWritten
+
+  hsize_t dalTableAppender::nofWritten ()
+  {
+    pthread_mutex_lock (&itsMutex);
+    hsize_t number = itsNofWritten;
+    pthread_mutex_unlock (&itsMutex);
+
+    return number;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                    nofWrites
+
+  unsigned int dalTableAppender::nofWrites ()
+  {
+    pthread_mutex_lock (&itsMutex);
+    unsigned int number = itsNofWrites;
+    pthread_mutex_unlock (&itsMutex);
+
+    return number;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                      summary
+
+  /*!
+    \param os -- Output stream to which the summary is written.
+  */
+  void dalTableAppender::summary (std::ostream &os)
+  {
+    os << "[dalTableAppender] Summary of internal parameters." << std::endl;
+    os << "-- Record size [Bytes]  = " << itsRecordSize    << std::endl;
+    os << "-- Buffer capacity      = " << itsCapacity      << std::endl;
+    os << "-- Flush interval [s]   = " << itsFlushInterval << std::endl;
+    os << "-- nof. buffered rows   = " << nofBuffered()    << std::endl;
+    os << "-- nof. written rows    = " << nofWritten()     << std::endl;
+    os << "-- nof. writes          = " << nofWrites()      << std::endl;
+  }
+
+  // ============================================================================
+  //
+  //  Methods
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                       append
+
+  /*!
+    \param row     -- Data of the row, with the layout of the records of the
+           table.
+    \return status -- Status of the operation; returns \e false in case an
+            error was encountered while writing to the table.
+  */
+  bool dalTableAppender::append (void const *row)
+  {
+    return append (row, 1);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                       append
+
+  /*!
+    \param rows    -- Data of the rows, with the layout of the records of the
+           table.
+    \param nofRows -- Number of rows.
+    \return status -- Status of the operation; returns \e false in case an
+            error was encountered while writing to the table.
+  */
+  bool dalTableAppender::append (void const *rows,
+				 hsize_t const &nofRows)
+  {
+    if (itsRecordSize == 0) {
+      return false;
+    }
+
+    bool status       = true;
+    char const *data  = static_cast<char const *>(rows);
+    hsize_t remaining = nofRows;
+
+    /* Rows fitting into the buffer are copied without taking the HDF5 lock */
+    pthread_mutex_lock (&itsMutex);
+
+    if (itsNofBuffered+nofRows < itsCapacity
+	&& !(itsFlushInterval > 0 && now()-itsLastWrite >= itsFlushInterval)) {
+      memcpy (&itsBuffer[itsNofBuffered*itsRecordSize],
+	      data,
+	      nofRows*itsRecordSize);
+      itsNofBuffered += nofRows;
+      pthread_mutex_unlock (&itsMutex);
+      return true;
+    }
+
+    pthread_mutex_unlock (&itsMutex);
+
+    /* Writing to the table; the HDF5 lock is always taken before the mutex */
+    HDF5Lock lock;
+    pthread_mutex_lock (&itsMutex);
+
+    while (status && remaining > 0) {
+      if (itsNofBuffered == 0 && remaining >= itsCapacity) {
+	/* Blocks at least the size of the buffer are written directly */
+	status     = write (data, remaining);
+	remaining  = 0;
+      } else {
+	hsize_t n = std::min (remaining, itsCapacity-itsNofBuffered);
+	memcpy (&itsBuffer[itsNofBuffered*itsRecordSize],
+		data,
+		n*itsRecordSize);
+	itsNofBuffered += n;
+	data           += n*itsRecordSize;
+	remaining      -= n;
+	if (itsNofBuffered == itsCapacity) {
+	  status = writeBuffer ();
+	}
+      }
+    }
+
+    /* Write the buffer if it has been held for too long */
+    if (status
+	&& itsFlushInterval > 0
+	&& itsNofBuffered > 0
+	&& now()-itsLastWrite >= itsFlushInterval) {
+      status = writeBuffer ();
+    }
+
+    pthread_mutex_unlock (&itsMutex);
+
+    return status;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                        flush
+
+  /*!
+    \return status -- Status of the operation; returns \e false in case an
+            error was encountered while writing to the table.
+  */
+  bool dalTableAppender::flush ()
+  {
+    HDF5Lock lock;
+    pthread_mutex_lock (&itsMutex);
+    bool status = writeBuffer ();
+    pthread_mutex_unlock (&itsMutex);
+
+    return status;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                enableZoneMap
+
+  /*!
+    If the table has no zone map yet, it is created from the rows already
+    present in the table.
+
+    \param zoneSize -- Number of rows per zone; ignored if the table already
+           has a zone map.
+    \return status  -- Status of the operation; returns \e false in case an
+            error was encountered.
+  */
+  bool dalTableAppender::enableZoneMap (hsize_t const &zoneSize)
+  {
+    HDF5Lock lock;
+    pthread_mutex_lock (&itsMutex);
+
+    bool status = writeBuffer ()
+      && itsZoneMap.open (itsTable->fileID(), itsTable->name(), zoneSize);
+
+    if (status && itsZoneMap.nofRows() < itsTable->nofRecords()) {
+      status = itsZoneMap.build ();
+    }
+
+    if (!status) {
+      std::cerr << "[dalTableAppender::enableZoneMap] Failed to set up zone map!"
+		<< std::endl;
+      itsZoneMap = dalTableZoneMap();
+    }
+
+    pthread_mutex_unlock (&itsMutex);
+
+    return status;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                        write
+
+  /*!
+    Requires the caller to hold both the process-wide HDF5Lock and the mutex
+    of the appender.
+
+    \param rows    -- Data of the rows.
+    \param nofRows -- Number of rows.
+    \return status -- Status of the operation; returns \e false in case an
+            error was encountered while writing to the table. A failure to
+            update the zone map is reported, but does not affect the status,
+            as the rows have been written nevertheless.
+  */
+  bool dalTableAppender::write (void const *rows,
+				hsize_t const &nofRows)
+  {
+    if (nofRows == 0) {
+      return true;
+    }
+
+    bool status = itsTable->appendRows (const_cast<void *>(rows), nofRows);
+
+    if (status) {
+      itsNofWritten += nofRows;
+      ++itsNofWrites;
+      if (itsZoneMap.isValid()) {
+	hsize_t start = itsTable->nofRecords()-nofRows;
+	bool zoneStatus (true);
+	if (start > itsZoneMap.nofRows()) {
+	  /* Rows appended to the table outside of the appender are read back */
+	  zoneStatus = itsZoneMap.refresh (itsZoneMap.nofRows(),
+					   itsTable->nofRecords()-itsZoneMap.nofRows());
+	} else {
+	  zoneStatus = itsZoneMap.update (rows, start, nofRows);
+	}
+	/* The rows are in the table; rows not covered remain candidates */
+	if (!zoneStatus) {
+	  std::cerr << "[dalTableAppender::write] Failed to update zone map!"
+		    << std::endl;
+	}
+      }
+    } else {
+      std::cerr << "[dalTableAppender::write] Failed to append "
+		<< nofRows << " rows to the table!" << std::endl;
+    }
+
+    itsLastWrite = now();
+
+    return status;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                  writeBuffer
+
+  /*!
+    Requires the caller to hold both the process-wide HDF5Lock and the mutex
+    of the appender.
+
+    \return status -- Status of the operation; returns \e false in case an
+            error was encountered while writing to the table. In that case the
+            rows are dropped from the buffer nevertheless, such that a failing
+            table does not block the producers.
+  */
+  bool dalTableAppender::writeBuffer ()
+  {
+    if (itsNofBuffered == 0) {
+      return true;
+    }
+
+    bool status = write (&itsBuffer[0], itsNofBuffered);
+    itsNofBuffered = 0;
+
+    return status;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                          now
+
+  double dalTableAppender::now ()
+  {
+    struct timeval tv;
+    gettimeofday (&tv, NULL);
+    return tv.tv_sec + 1e-6*tv.tv_usec;
+  }
+
+} // Namespace DAL -- end
@@ -0,0 +1,240 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#ifndef DALTABLEAPPENDER_H
+#define DALTABLEAPPENDER_H
+
+// Standard library header files
+#include <iostream>
+#include <string>
+#include <vector>
+#include <pthread.h>
+
+#include <core/dalTable.h>
+#include <core/dalTableZoneMap.h>
+
+namespace DAL { // Namespace DAL -- begin
+
+  /*!
+    \class dalTableAppender
+
+    \ingroup DAL
+    \ingroup core
+
+    \brief Buffered appending of rows to a table
+
+    \author agent
+
+    \date 2026/10/18
+
+    \test tdalTableAppender.cc
+
+    <h3>Prerequisite</h3>
+
+    <ul type="square">
+      <li>DAL::dalTable
+    </ul>
+
+    <h3>Synopsis</h3>
+
+    Each call to dalTable::appendRow results in a separate call to
+    \c H5TBappend_records, i.e. in extending the dataset and writing a single
+    record -- building up a table with a large number of rows this way is
+    dominated by the per-call overhead of the library. A dalTableAppender
+    instead collects the rows in a contiguous buffer (holding capacity() rows)
+    and writes them to the table in a single call once the buffer is full;
+    optionally the buffer also is written after flushInterval() seconds have
+    passed since the last write, such that slowly filling tables (e.g. logs)
+    are kept up to date in the file. Blocks of rows larger than the buffer are
+    written directly, without being copied.
+
+    The rows passed to append() must have the layout of the records of the
+    table (see dalTable::recordSize); the layout is retrieved once, when
+    constructing the appender, hence no columns must be added or removed while
+    the appender is in use. Rows still held in the buffer are written by
+    flush(), which is called by the destructor as well.
+
+    Multiple threads may append to the same appender concurrently: access to
+    the buffer is serialized by a mutex of the appender. Writing to the table
+    (and to its zone map) additionally takes the process-wide DAL::HDF5Lock,
+    such that the appender can be used alongside the other classes calling
+    into the HDF5 library from threads of their own; the HDF5 lock always is
+    acquired before the mutex. Rows which merely are copied into the buffer
+    do not require the HDF5 lock. The order of rows appended by different
+    threads is the order in which they acquire the mutex; rows passed within
+    a single call to append() are kept together.
+
+    With enableZoneMap() the appender also keeps the zone map of the table
+    (see DAL::dalTableZoneMap) up to date, by including each block of rows
+    written to the table; rows appended to the table by other means are read
+    back from the table upon the next write.
+
+    <h3>Example(s)</h3>
+
+    <ol>
+      <li>Append a large number of rows to a table:
+      \code
+      struct Row {
+        int time;
+        float value;
+      };
+
+      DAL::dalTableAppender appender (table, 8192);
+      Row row;
+
+      for (int n(0); n<nofRows; ++n) {
+        row.time  = n;
+        row.value = 0.5*n;
+        appender.append (&row);
+      }
+
+      appender.flush();
+      \endcode
+      <li>Keep a slowly growing table up to date, writing the buffered rows at
+      least every 5 seconds:
+      \code
+      DAL::dalTableAppender appender (table, 1024, 5.0);
+      \endcode
+    </ol>
+  */
+  class dalTableAppender {
+
+    //! Table to which the rows are appended
+    dalTable *itsTable;
+    //! Size of a single row, [Bytes]
+    size_t itsRecordSize;
+    //! Number of rows the buffer can hold
+    hsize_t itsCapacity;
+    //! Maximum time between writes of the buffer, [s]; 0 to write on size only
+    double itsFlushInterval;
+    //! Buffer collecting the rows before writing them to the table
+    std::vector<char> itsBuffer;
+    //! Number of rows currently held in the buffer
+    hsize_t itsNofBuffered;
+    //! Number of rows written to the table
+    hsize_t itsNofWritten;
+    //! Number of writes to the table
+    unsigned int itsNofWrites;
+    //! Time of the last write to the table, [s]
+    double itsLastWrite;
+    //! Serializes access to the buffer; taken after the HDF5Lock when writing
+    pthread_mutex_t itsMutex;
+    //! Zone map of the table, updated with the rows written
+    dalTableZoneMap itsZoneMap;
+
+  public:
+
+    // === Construction =========================================================
+
+    //! Argumented constructor
+    dalTableAppender (dalTable &table,
+		      hsize_t const &capacity=4096,
+		      double const &flushInterval=0);
+
+    // === Destruction ==========================================================
+
+    //! Destructor, writing the rows still held in the buffer
+    ~dalTableAppender ();
+
+    // === Parameter access =====================================================
+
+    //! Size of a single row, [Bytes]; 0 if the table is not usable
+    inline size_t recordSize () const {
+      return itsRecordSize;
+    }
+
+    //! Number of rows the buffer can hold
+    inline hsize_t capacity () const {
+      return itsCapacity;
+    }
+
+    //! Maximum time between writes of the buffer, [s]
+    inline double flushInterval () const {
+      return itsFlushInterval;
+    }
+
+    //! Number of rows currently held in the buffer
+    hsize_t nofBuffered ();
+
+    //! Number of rows written to the table
+    hsize_t nofWritten ();
+
+    //! Number of writes to the table
+    unsigned int nofWrites ();
+
+    /*!
+      \brief Get the name of the class
+      \return className -- The name of the class, dalTableAppender.
+    */
+    inline std::string className () const {
+      return "dalTableAppender";
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    inline void summary () {
+      summary (std::cout);
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    void summary (std::ostream &os);
+
+    // === Methods ==============================================================
+
+    //! Append a single row
+    bool append (void const *row);
+
+    //! Append a block of rows
+    bool append (void const *rows,
+		 hsize_t const &nofRows);
+
+    //! Write the rows held in the buffer to the table
+    bool flush ();
+
+    //! Keep the zone map of the table up to date with the rows written
+    bool enableZoneMap (hsize_t const &zoneSize=4096);
+
+    //! Is the zone map of the table kept up to date?
+    inline bool hasZoneMap () const {
+      return itsZoneMap.isValid();
+    }
+
+  private:
+
+    //! Write \c nofRows rows to the table; the mutex must be held
+    bool write (void const *rows,
+		hsize_t const &nofRows);
+
+    //! Write the buffer to the table; the mutex must be held
+    bool writeBuffer ();
+
+    //! Get the current wall-clock time, [s]
+    static double now ();
+
+    //! Unimplemented, as the buffer is bound to a single table
+    dalTableAppender (dalTableAppender const &other);
+
+    //! Unimplemented, as the buffer is bound to a single table
+    dalTableAppender& operator= (dalTableAppender const &other);
+
+  }; // Class dalTableAppender -- end
+
+} // Namespace DAL -- end
+
+#endif /* DALTABLEAPPENDER_H */
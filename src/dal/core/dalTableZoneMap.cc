@@ -0,0 +1,650 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "dalTableZoneMap.h"
+#include <core/HDF5Attribute.h>
+#include <core/dalColumnReader.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace DAL { // Namespace DAL -- begin
+
+  //_____________________________________________________________________________
+  //                                                                  rangeOfCells
+
+  /*!
+    \brief Extend the range [min,max] by the cells of a column of type \c T
+
+    \param cells   -- Pointer to the cell of the first row.
+    \param rowSize -- Distance between the cells of consecutive rows, [Bytes].
+    \param nofRows -- Number of rows.
+    \retval min    -- Minimum of the cells.
+    \retval max    -- Maximum of the cells; a NaN extends the range to
+           [-inf,+inf].
+  */
+  template <class T>
+  static void rangeOfCells (char const *cells,
+			    size_t const &rowSize,
+			    hsize_t const &nofRows,
+			    double &min,
+			    double &max)
+  {
+    T cell;
+    double value;
+
+    for (hsize_t n(0); n<nofRows; ++n, cells+=rowSize) {
+      memcpy (&cell, cells, sizeof(T));
+      value = cell;
+      if (value != value) {
+	min = -HUGE_VAL;
+	max = HUGE_VAL;
+      } else {
+	if (value < min) min = value;
+	if (value > max) max = value;
+      }
+    }
+  }
+
+  //_____________________________________________________________________________
+  //                                                                   rangeOfType
+
+  //! Extend the range [min,max] by the cells of a column of type \c type
+  static void rangeOfType (hid_t const &type,
+			   char const *cells,
+			   size_t const &rowSize,
+			   hsize_t const &nofRows,
+			   double &min,
+			   double &max)
+  {
+    size_t size = H5Tget_size (type);
+
+    if (H5Tget_class (type) == H5T_FLOAT) {
+      if (size == sizeof(float)) {
+	rangeOfCells<float> (cells, rowSize, nofRows, min, max);
+      } else {
+	rangeOfCells<double> (cells, rowSize, nofRows, min, max);
+      }
+    } else if (H5Tget_sign (type) == H5T_SGN_2) {
+      switch (size) {
+      case 1:
+	rangeOfCells<signed char> (cells, rowSize, nofRows, min, max);
+	break;
+      case 2:
+	rangeOfCells<short> (cells, rowSize, nofRows, min, max);
+	break;
+      case 4:
+	rangeOfCells<int> (cells, rowSize, nofRows, min, max);
+	break;
+      default:
+	rangeOfCells<long long> (cells, rowSize, nofRows, min, max);
+	break;
+      }
+    } else {
+      switch (size) {
+      case 1:
+	rangeOfCells<unsigned char> (cells, rowSize, nofRows, min, max);
+	break;
+      case 2:
+	rangeOfCells<unsigned short> (cells, rowSize, nofRows, min, max);
+	break;
+      case 4:
+	rangeOfCells<unsigned int> (cells, rowSize, nofRows, min, max);
+	break;
+      default:
+	rangeOfCells<unsigned long long> (cells, rowSize, nofRows, min, max);
+	break;
+      }
+    }
+  }
+
+  // ============================================================================
+  //
+  //  Construction
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                              dalTableZoneMap
+
+  dalTableZoneMap::dalTableZoneMap ()
+  {
+    itsLocation   = 0;
+    itsZoneSize   = 0;
+    itsRecordSize = 0;
+    itsNofRows    = 0;
+  }
+
+  //_____________________________________________________________________________
+  //                                                              dalTableZoneMap
+
+  /*!
+    \param location -- Identifier of the group to which the table is attached.
+    \param table    -- Name of the table.
+    \param zoneSize -- Number of rows per zone; ignored if the table already
+           has a zone map.
+  */
+  dalTableZoneMap::dalTableZoneMap (hid_t const &location,
+				    std::string const &table,
+				    hsize_t const &zoneSize)
+  {
+    open (location, table, zoneSize);
+  }
+
+  // ============================================================================
+  //
+  //  Parameters
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                       exists
+
+  /*!
+    \param location -- Identifier of the group to which the table is attached.
+    \param table    -- Name of the table.
+    \return exists  -- \e true if the side dataset holding the zone map exists.
+  */
+  bool dalTableZoneMap::exists (hid_t const &location,
+				std::string const &table)
+  {
+    return H5Lexists (location, name(table).c_str(), H5P_DEFAULT) > 0;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                      summary
+
+  /*!
+    \param os -- Output stream to which the summary is written.
+  */
+  void dalTableZoneMap::summary (std::ostream &os)
+  {
+    os << "[dalTableZoneMap] Summary of internal parameters." << std::endl;
+    os << "-- Table              = " << itsTable    << std::endl;
+    os << "-- Zone map dataset   = " << name()      << std::endl;
+    os << "-- Columns            = " << itsColumns  << std::endl;
+    os << "-- Zone size          = " << itsZoneSize << std::endl;
+    os << "-- nof. zones         = " << (isValid() ? nofZones() : 0) << std::endl;
+    os << "-- nof. rows covered  = " << itsNofRows  << std::endl;
+  }
+
+  // ============================================================================
+  //
+  //  Methods
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                         open
+
+  /*!
+    \param location -- Identifier of the group to which the table is attached.
+    \param table    -- Name of the table.
+    \param zoneSize -- Number of rows per zone; ignored if the table already
+           has a zone map.
+    \return status  -- Status of the operation; returns \e false in case an
+            error was encountered.
+  */
+  bool dalTableZoneMap::open (hid_t const &location,
+			      std::string const &table,
+			      hsize_t const &zoneSize)
+  {
+    itsLocation   = location;
+    itsTable      = table;
+    itsZoneSize   = zoneSize > 0 ? zoneSize : 1;
+    itsRecordSize = 0;
+    itsNofRows    = 0;
+    itsColumns.clear();
+    itsOffsets.clear();
+    itsTypes.clear();
+    itsZones.clear();
+
+    /* Numerical columns of the table */
+    HDF5Handle dataset (H5Dopen (location, table.c_str(), H5P_DEFAULT));
+    if (!dataset.isValid()) {
+      std::cerr << "[dalTableZoneMap::open] Failed to open table "
+		<< table << std::endl;
+      return false;
+    }
+
+    /* Records are passed in the native (aligned) layout, as by dalTable */
+    HDF5Handle fileType (H5Dget_type (dataset.id()));
+    HDF5Handle nativeType (H5Tget_native_type (fileType.id(), H5T_DIR_ASCEND));
+    int nofMembers = H5Tget_nmembers (nativeType.id());
+
+    for (int n(0); n<nofMembers; ++n) {
+      H5T_class_t memberClass = H5Tget_member_class (nativeType.id(), n);
+      if (memberClass == H5T_INTEGER || memberClass == H5T_FLOAT) {
+	char *memberName = H5Tget_member_name (nativeType.id(), n);
+	itsColumns.push_back (memberName);
+	itsOffsets.push_back (H5Tget_member_offset (nativeType.id(), n));
+	itsTypes.push_back (HDF5Handle (H5Tget_member_type (nativeType.id(), n)));
+	H5free_memory (memberName);
+      }
+    }
+
+    itsRecordSize = H5Tget_size (nativeType.id());
+
+    /* Read the zone map, if the table has one */
+    if (exists (location, table)) {
+      HDF5Handle zoneMap (H5Dopen (location, name().c_str(), H5P_DEFAULT));
+      HDF5Handle dataspace (H5Dget_space (zoneMap.id()));
+      std::vector<std::string> columns;
+      hsize_t dims[2] = { 0, 0 };
+
+      HDF5Attribute::read (zoneMap.id(), "COLUMNS", columns);
+      HDF5Attribute::read (zoneMap.id(), "ZONE_SIZE", itsZoneSize);
+      H5Sget_simple_extent_dims (dataspace.id(), dims, NULL);
+
+      if (columns != itsColumns || dims[1] != width() || itsZoneSize == 0) {
+	std::cerr << "[dalTableZoneMap::open] Zone map does not match table "
+		  << table << "!" << std::endl;
+	itsRecordSize = 0;
+	return false;
+      }
+
+      itsZones.resize (dims[0]*dims[1]);
+      if (dims[0] > 0
+	  && H5Dread (zoneMap.id(),
+		      H5T_NATIVE_DOUBLE,
+		      H5S_ALL,
+		      H5S_ALL,
+		      H5P_DEFAULT,
+		      &itsZones[0]) < 0) {
+	std::cerr << "[dalTableZoneMap::open] Failed to read zone map!"
+		  << std::endl;
+	itsRecordSize = 0;
+	return false;
+      }
+
+      for (hsize_t zone(0); zone<nofZones(); ++zone) {
+	itsNofRows += nofRows (zone);
+      }
+    }
+
+    return true;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                        build
+
+  /*!
+    \param batchSize -- Number of rows read at once.
+    \return status   -- Status of the operation; returns \e false in case an
+            error was encountered.
+  */
+  bool dalTableZoneMap::build (hsize_t const &batchSize)
+  {
+    if (!isValid()) {
+      return false;
+    }
+
+    itsNofRows = 0;
+    itsZones.clear();
+
+    return scan (0, std::numeric_limits<hsize_t>::max(), batchSize)
+      && write (0);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                      refresh
+
+  /*!
+    The zones containing the rows are reset and filled again from the current
+    contents of the table, such that values overwritten in place no longer
+    widen the ranges of the zones. Rows between the end of the zone map and
+    \c start are included as well, keeping the zone map contiguous.
+
+    \param start     -- Index of the first of the rows within the table.
+    \param nofRows   -- Number of rows.
+    \param batchSize -- Number of rows read at once.
+    \return status   -- Status of the operation; returns \e false in case an
+            error was encountered.
+  */
+  bool dalTableZoneMap::refresh (hsize_t const &start,
+				 hsize_t const &nofRows,
+				 hsize_t const &batchSize)
+  {
+    if (!isValid()) {
+      return false;
+    }
+
+    if (nofRows == 0 || itsColumns.empty()) {
+      return true;
+    }
+
+    hsize_t firstZone = std::min (start, itsNofRows)/itsZoneSize;
+    hsize_t lastZone  = (start+nofRows-1)/itsZoneSize;
+    unsigned int w    = width();
+
+    for (hsize_t zone(firstZone); zone<=lastZone && zone<nofZones(); ++zone) {
+      itsZones[zone*w] = 0;
+      for (unsigned int n(0); n<itsColumns.size(); ++n) {
+	itsZones[zone*w+1+2*n] = DBL_MAX;
+	itsZones[zone*w+2+2*n] = -DBL_MAX;
+      }
+    }
+
+    return scan (firstZone*itsZoneSize, (lastZone+1)*itsZoneSize, batchSize)
+      && write (firstZone);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                       update
+
+  /*!
+    \param rows    -- Data of the rows, with the layout of the records of the
+           table.
+    \param start   -- Index of the first of the rows within the table; must not
+           be beyond the rows already described by the zone map.
+    \param nofRows -- Number of rows.
+    \return status -- Status of the operation; returns \e false in case an
+            error was encountered.
+  */
+  bool dalTableZoneMap::update (void const *rows,
+				hsize_t const &start,
+				hsize_t const &nofRows)
+  {
+    if (!isValid()) {
+      return false;
+    }
+
+    if (start > itsNofRows) {
+      std::cerr << "[dalTableZoneMap::update] Rows starting at " << start
+		<< " do not follow the " << itsNofRows
+		<< " rows described by the zone map!" << std::endl;
+      return false;
+    }
+
+    if (nofRows == 0) {
+      return true;
+    }
+
+    accumulate (static_cast<char const *>(rows),
+		itsRecordSize,
+		itsOffsets,
+		start,
+		nofRows);
+
+    return write (start/itsZoneSize);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                   candidates
+
+  /*!
+    \param conditions   -- Conditions on the rows, combined by AND.
+    \param nofTableRows -- Number of rows of the table.
+    \retval ranges      -- Ranges [first,last) of rows possibly fulfilling the
+            conditions; adjacent zones are merged into a single range.
+    \return status      -- Returns \e false if the zone map is not valid.
+  */
+  bool dalTableZoneMap::candidates (std::vector<dalFilter::Condition> const &conditions,
+				    hsize_t const &nofTableRows,
+				    std::vector<std::pair<hsize_t,hsize_t> > &ranges) const
+  {
+    ranges.clear();
+
+    if (!isValid()) {
+      return false;
+    }
+
+    /* Index of the columns referred to by the conditions */
+    std::vector<int> index (conditions.size(), -1);
+
+    for (unsigned int n(0); n<conditions.size(); ++n) {
+      std::vector<std::string>::const_iterator it = std::find (itsColumns.begin(),
+							       itsColumns.end(),
+							       conditions[n].column);
+      if (it != itsColumns.end()) {
+	index[n] = it - itsColumns.begin();
+      }
+    }
+
+    for (hsize_t zone(0); zone<nofZones(); ++zone) {
+      hsize_t first = zone*itsZoneSize;
+      hsize_t last  = std::min (first+nofRows(zone), nofTableRows);
+      bool match    = first < last;
+
+      for (unsigned int n(0); match && n<conditions.size(); ++n) {
+	if (index[n] < 0) {
+	  continue;
+	}
+	double lo    = min (zone, index[n]);
+	double hi    = max (zone, index[n]);
+	double value = conditions[n].value;
+	switch (conditions[n].op) {
+	case dalFilter::Equal:
+	  match = lo <= value && value <= hi;
+	  break;
+	case dalFilter::NotEqual:
+	  match = !(lo == value && hi == value);
+	  break;
+	case dalFilter::Less:
+	  match = lo < value;
+	  break;
+	case dalFilter::LessEqual:
+	  match = lo <= value;
+	  break;
+	case dalFilter::Greater:
+	  match = hi > value;
+	  break;
+	case dalFilter::GreaterEqual:
+	  match = hi >= value;
+	  break;
+	}
+      }
+
+      if (match) {
+	if (!ranges.empty() && ranges.back().second == first) {
+	  ranges.back().second = last;
+	} else {
+	  ranges.push_back (std::make_pair (first, last));
+	}
+      }
+    }
+
+    /* Rows not described by the zone map always are candidates */
+    if (itsNofRows < nofTableRows) {
+      if (!ranges.empty() && ranges.back().second == itsNofRows) {
+	ranges.back().second = nofTableRows;
+      } else {
+	ranges.push_back (std::make_pair (itsNofRows, nofTableRows));
+      }
+    }
+
+    return true;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                         scan
+
+  /*!
+    \param start     -- Index of the first row to read.
+    \param end       -- One past the last row to read; clipped at the end of
+           the table.
+    \param batchSize -- Number of rows read at once.
+    \return status   -- Status of the operation; returns \e false in case an
+            error was encountered.
+  */
+  bool dalTableZoneMap::scan (hsize_t const &start,
+			      hsize_t const &end,
+			      hsize_t const &batchSize)
+  {
+    if (itsColumns.empty()) {
+      return true;
+    }
+
+    dalColumnReader reader (itsLocation, itsTable, itsColumns, batchSize);
+    if (!reader.isValid()) {
+      return false;
+    }
+
+    hsize_t last = std::min (end, reader.nofRows());
+    if (start >= last) {
+      return true;
+    }
+    reader.setRange (start, last-start);
+
+    std::vector<char> buffer (reader.batchSize()*reader.rowSize());
+    std::vector<size_t> offsets (itsColumns.size());
+    hsize_t row (start);
+    hsize_t nofRows (0);
+
+    for (unsigned int n(0); n<offsets.size(); ++n) {
+      offsets[n] = reader.offset(n);
+    }
+
+    while ((nofRows = reader.next (&buffer[0]))) {
+      accumulate (&buffer[0], reader.rowSize(), offsets, row, nofRows);
+      row += nofRows;
+    }
+
+    return true;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                   accumulate
+
+  /*!
+    \param rows    -- Data of the rows.
+    \param rowSize -- Size of a row, [Bytes].
+    \param offsets -- Offsets of the numerical columns within a row, [Bytes].
+    \param start   -- Index of the first of the rows within the table.
+    \param nofRows -- Number of rows.
+  */
+  void dalTableZoneMap::accumulate (char const *rows,
+				    size_t const &rowSize,
+				    std::vector<size_t> const &offsets,
+				    hsize_t const &start,
+				    hsize_t const &nofRows)
+  {
+    hsize_t end       = start+nofRows;
+    hsize_t lastZone  = (end-1)/itsZoneSize;
+    unsigned int w    = width();
+
+    /* Add the zones not yet present */
+    while (nofZones() <= lastZone) {
+      itsZones.push_back (0);
+      for (unsigned int n(0); n<itsColumns.size(); ++n) {
+	itsZones.push_back (DBL_MAX);
+	itsZones.push_back (-DBL_MAX);
+      }
+    }
+
+    if (end > itsNofRows) {
+      itsNofRows = end;
+    }
+
+    /* Process the rows zone by zone */
+    for (hsize_t row(start); row<end; ) {
+      hsize_t zone    = row/itsZoneSize;
+      hsize_t zoneEnd = std::min ((zone+1)*itsZoneSize, end);
+      double *values  = &itsZones[zone*w];
+      char const *first = rows + (row-start)*rowSize;
+
+      for (unsigned int n(0); n<itsColumns.size(); ++n) {
+	rangeOfType (itsTypes[n].id(),
+		     first+offsets[n],
+		     rowSize,
+		     zoneEnd-row,
+		     values[1+2*n],
+		     values[2+2*n]);
+      }
+
+      /* Rows written again are not counted twice */
+      values[0] = std::min (itsNofRows, (zone+1)*itsZoneSize) - zone*itsZoneSize;
+      row       = zoneEnd;
+    }
+  }
+
+  //_____________________________________________________________________________
+  //                                                                        write
+
+  /*!
+    \param firstZone -- First of the zones to be written; the zones before are
+           unchanged.
+    \return status   -- Status of the operation; returns \e false in case an
+            error was encountered.
+  */
+  bool dalTableZoneMap::write (hsize_t const &firstZone)
+  {
+    hsize_t dims[2]  = { nofZones(), width() };
+    HDF5Handle dataset;
+
+    if (exists (itsLocation, itsTable)) {
+      dataset.reset (H5Dopen (itsLocation, name().c_str(), H5P_DEFAULT));
+      if (H5Dset_extent (dataset.id(), dims) < 0) {
+	std::cerr << "[dalTableZoneMap::write] Failed to extend zone map!"
+		  << std::endl;
+	return false;
+      }
+    } else {
+      hsize_t maxdims[2] = { H5S_UNLIMITED, width() };
+      hsize_t chunk[2]   = { 64, width() };
+      HDF5Handle dataspace (H5Screate_simple (2, dims, maxdims));
+      HDF5Handle plist (H5Pcreate (H5P_DATASET_CREATE));
+      H5Pset_chunk (plist.id(), 2, chunk);
+      dataset.reset (H5Dcreate (itsLocation,
+				name().c_str(),
+				H5T_NATIVE_DOUBLE,
+				dataspace.id(),
+				H5P_DEFAULT,
+				plist.id(),
+				H5P_DEFAULT));
+      if (!dataset.isValid()) {
+	std::cerr << "[dalTableZoneMap::write] Failed to create zone map "
+		  << name() << std::endl;
+	return false;
+      }
+      HDF5Attribute::write (dataset.id(), "COLUMNS", itsColumns);
+      HDF5Attribute::write (dataset.id(), "ZONE_SIZE", itsZoneSize);
+    }
+
+    if (firstZone >= nofZones()) {
+      return true;
+    }
+
+    /* Write the modified zones */
+    hsize_t start[2] = { firstZone, 0 };
+    hsize_t count[2] = { nofZones()-firstZone, width() };
+    HDF5Handle filespace (H5Dget_space (dataset.id()));
+    HDF5Handle memspace (H5Screate_simple (2, count, NULL));
+
+    H5Sselect_hyperslab (filespace.id(), H5S_SELECT_SET, start, NULL, count, NULL);
+
+    if (H5Dwrite (dataset.id(),
+		  H5T_NATIVE_DOUBLE,
+		  memspace.id(),
+		  filespace.id(),
+		  H5P_DEFAULT,
+		  &itsZones[firstZone*width()]) < 0) {
+      std::cerr << "[dalTableZoneMap::write] Failed to write zone map!"
+		<< std::endl;
+      return false;
+    }
+
+    return true;
+  }
+
+} // Namespace DAL -- end
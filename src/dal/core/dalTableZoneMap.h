@@ -0,0 +1,263 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#ifndef DALTABLEZONEMAP_H
+#define DALTABLEZONEMAP_H
+
+// Standard library header files
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <core/HDF5Handle.h>
+#include <core/dalFilter.h>
+
+namespace DAL { // Namespace DAL -- begin
+
+  /*!
+    \class dalTableZoneMap
+
+    \ingroup DAL
+    \ingroup core
+
+    \brief Per-zone minimum and maximum of the numerical columns of a table
+
+    \author agent
+
+    \date 2026/10/18
+
+    \test tdalTableZoneMap.cc
+
+    <h3>Prerequisite</h3>
+
+    <ul type="square">
+      <li>DAL::dalTable
+      <li>DAL::dalFilter
+      <li>DAL::dalTableAppender
+    </ul>
+
+    <h3>Synopsis</h3>
+
+    Selecting rows by a condition on e.g. the time column requires reading
+    every record of the table, even if only a few minutes out of an
+    observation of many hours are requested. A zone map divides the rows of a
+    table into zones of zoneSize() consecutive rows and keeps, for each zone,
+    the number of rows and the minimum and maximum value of every numerical
+    (integer or floating point) column. A zone whose range of values cannot
+    fulfill the conditions of a filter does not need to be read at all (see
+    candidates()); dalFilter::selectRows and dalFilter::readRows make use of
+    the zone map of a table automatically, if one exists.
+
+    The zone map is stored as a side dataset next to the table, named after
+    the table with the suffix <tt>_ZONEMAP</tt>: a 2-dimensional dataset of
+    type \c double with one row per zone, holding the number of rows of the
+    zone, followed by minimum and maximum of each of the columns (in the order
+    listed by the attribute \c COLUMNS); the attribute \c ZONE_SIZE holds the
+    number of rows per zone.
+
+    The zone map describes the leading nofRows() rows of the table; rows
+    beyond those always are considered candidates, such that rows appended to
+    the table without updating the zone map never are skipped by mistake.
+    A dalTableAppender keeps the zone map up to date incrementally, see
+    dalTableAppender::enableZoneMap; for an existing table the zone map is
+    created by build(). Rows overwritten in place (e.g. by
+    dalTable::writeDataByColNum) are accounted for by refresh(), which
+    rescans the zones containing them.
+
+    Values are compared as \c double -- the same conversion is applied when
+    evaluating the conditions of a dalFilter, hence no matching rows are lost
+    through rounding of 64-bit integers. A zone containing a NaN is never
+    skipped.
+
+    <h3>Example(s)</h3>
+
+    <ol>
+      <li>Create the zone map for an existing table:
+      \code
+      DAL::dalTableZoneMap zoneMap (fileID, "/Table", 8192);
+      zoneMap.build ();
+      \endcode
+      <li>Keep the zone map up to date while appending rows:
+      \code
+      DAL::dalTableAppender appender (table);
+      appender.enableZoneMap (8192);
+      \endcode
+    </ol>
+  */
+  class dalTableZoneMap {
+
+    //! Identifier of the group to which the table is attached
+    hid_t itsLocation;
+    //! Name of the table
+    std::string itsTable;
+    //! Number of rows per zone
+    hsize_t itsZoneSize;
+    //! Names of the numerical columns
+    std::vector<std::string> itsColumns;
+    //! Offsets of the numerical columns within a native record, [Bytes]
+    std::vector<size_t> itsOffsets;
+    //! Native datatypes of the numerical columns
+    std::vector<HDF5Handle> itsTypes;
+    //! Size of a native record of the table, [Bytes]
+    size_t itsRecordSize;
+    //! Number of leading rows of the table described by the zone map
+    hsize_t itsNofRows;
+    //! Number of rows, minimum and maximum per column, for each of the zones
+    std::vector<double> itsZones;
+
+  public:
+
+    // === Construction =========================================================
+
+    //! Default constructor
+    dalTableZoneMap ();
+
+    //! Argumented constructor
+    dalTableZoneMap (hid_t const &location,
+		     std::string const &table,
+		     hsize_t const &zoneSize=4096);
+
+    // === Parameter access =====================================================
+
+    //! Is the zone map attached to a table?
+    inline bool isValid () const {
+      return itsRecordSize > 0;
+    }
+
+    //! Name of the side dataset holding the zone map
+    inline std::string name () const {
+      return name (itsTable);
+    }
+
+    //! Name of the side dataset holding the zone map of \c table
+    static std::string name (std::string const &table) {
+      return table + "_ZONEMAP";
+    }
+
+    //! Does the table have a zone map?
+    static bool exists (hid_t const &location,
+			std::string const &table);
+
+    //! Number of rows per zone
+    inline hsize_t zoneSize () const {
+      return itsZoneSize;
+    }
+
+    //! Names of the numerical columns
+    inline std::vector<std::string> columns () const {
+      return itsColumns;
+    }
+
+    //! Number of leading rows of the table described by the zone map
+    inline hsize_t nofRows () const {
+      return itsNofRows;
+    }
+
+    //! Number of zones
+    inline hsize_t nofZones () const {
+      return itsZones.size()/width();
+    }
+
+    //! Number of rows in a zone
+    inline hsize_t nofRows (hsize_t const &zone) const {
+      return hsize_t (itsZones[zone*width()]);
+    }
+
+    //! Minimum of a column within a zone
+    inline double min (hsize_t const &zone,
+		       unsigned int const &column) const {
+      return itsZones[zone*width()+1+2*column];
+    }
+
+    //! Maximum of a column within a zone
+    inline double max (hsize_t const &zone,
+		       unsigned int const &column) const {
+      return itsZones[zone*width()+2+2*column];
+    }
+
+    /*!
+      \brief Get the name of the class
+      \return className -- The name of the class, dalTableZoneMap.
+    */
+    inline std::string className () const {
+      return "dalTableZoneMap";
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    inline void summary () {
+      summary (std::cout);
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    void summary (std::ostream &os);
+
+    // === Methods ==============================================================
+
+    //! Attach to the table \c table, reading its zone map if it exists
+    bool open (hid_t const &location,
+	       std::string const &table,
+	       hsize_t const &zoneSize=4096);
+
+    //! Create the zone map by scanning all rows of the table
+    bool build (hsize_t const &batchSize=4096);
+
+    //! Rescan the zones containing the given rows from the table
+    bool refresh (hsize_t const &start,
+		  hsize_t const &nofRows,
+		  hsize_t const &batchSize=4096);
+
+    //! Include rows, with the layout of the records of the table
+    bool update (void const *rows,
+		 hsize_t const &start,
+		 hsize_t const &nofRows);
+
+    //! Get the ranges of rows possibly fulfilling the conditions
+    bool candidates (std::vector<dalFilter::Condition> const &conditions,
+		     hsize_t const &nofTableRows,
+		     std::vector<std::pair<hsize_t,hsize_t> > &ranges) const;
+
+  private:
+
+    //! Number of values stored per zone
+    inline unsigned int width () const {
+      return 1+2*itsColumns.size();
+    }
+
+    //! Read the rows [start,end) from the table and include them
+    bool scan (hsize_t const &start,
+	       hsize_t const &end,
+	       hsize_t const &batchSize);
+
+    //! Include rows with the given offsets of the columns
+    void accumulate (char const *rows,
+		     size_t const &rowSize,
+		     std::vector<size_t> const &offsets,
+		     hsize_t const &start,
+		     hsize_t const &nofRows);
+
+    //! Write the zones starting with \c firstZone to the side dataset
+    bool write (hsize_t const &firstZone);
+
+  }; // Class dalTableZoneMap -- end
+
+} // Namespace DAL -- end
+
+#endif /* DALTABLEZONEMAP_H */
@@ -0,0 +1,284 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include <core/HDF5Attribute.h>
+#include <core/HDF5AttributeCache.h>
+
+#include <sys/time.h>
+
+// Namespace usage
+using std::cerr;
+using std::cout;
+using std::endl;
+using DAL::HDF5Attribute;
+using DAL::HDF5AttributeCache;
+
+/*!
+  \file tHDF5AttributeCache.cc
+
+  \ingroup DAL
+  \ingroup core
+
+  \brief A collection of test routines for the DAL::HDF5AttributeCache class
+
+  \author agent
+
+  \date 2026/10/18
+*/
+
+//_______________________________________________________________________________
+//                                                                       seconds
+
+//! Get the current wall-clock time in seconds
+double seconds ()
+{
+  struct timeval tv;
+  gettimeofday (&tv, NULL);
+  return tv.tv_sec + 1e-6*tv.tv_usec;
+}
+
+//_______________________________________________________________________________
+//                                                                      test_get
+
+/*!
+  \brief Test retrieval of attribute values from the cache
+
+  \param fileID          -- Identifier of the file, to whose root group the
+         attributes are attached.
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_get (hid_t const &fileID)
+{
+  cout << "\n[tHDF5AttributeCache::test_get]\n" << endl;
+
+  int nofFailedTests (0);
+
+  cout << "[1] Testing default constructor ..." << endl;
+  try {
+    HDF5AttributeCache cache;
+    //
+    cache.summary();
+    if (cache.size() != 0) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing HDF5AttributeCache(hid_t) ..." << endl;
+  try {
+    HDF5AttributeCache cache (fileID);
+    //
+    cache.summary();
+    if (cache.size() != 6)             ++nofFailedTests;
+    if (!cache.contains("TELESCOPE"))  ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Testing retrieval of scalar attributes ..." << endl;
+  try {
+    HDF5AttributeCache cache (fileID);
+    int nofStations (0);
+    double frequency (0);
+    double nofStationsDouble (0);
+    std::string telescope;
+    bool flag (false);
+    //
+    if (!cache.get ("NOF_STATIONS", nofStations))     ++nofFailedTests;
+    if (!cache.get ("FREQUENCY", frequency))          ++nofFailedTests;
+    if (!cache.get ("TELESCOPE", telescope))          ++nofFailedTests;
+    if (!cache.get ("FLAG", flag))                    ++nofFailedTests;
+    /* Conversion int -> double */
+    if (!cache.get ("NOF_STATIONS", nofStationsDouble)) ++nofFailedTests;
+
+    cout << "-- NOF_STATIONS = " << nofStations << endl;
+    cout << "-- FREQUENCY    = " << frequency   << endl;
+    cout << "-- TELESCOPE    = " << telescope   << endl;
+    cout << "-- FLAG         = " << flag        << endl;
+
+    if (nofStations != 36)          ++nofFailedTests;
+    if (frequency != 200e6)         ++nofFailedTests;
+    if (telescope != "LOFAR")       ++nofFailedTests;
+    if (!flag)                      ++nofFailedTests;
+    if (nofStationsDouble != 36.0)  ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[4] Testing retrieval of array attributes ..." << endl;
+  try {
+    HDF5AttributeCache cache (fileID);
+    std::vector<std::string> stations;
+    std::vector<float> weights;
+    int weight (0);
+    //
+    if (!cache.get ("STATIONS_LIST", stations))  ++nofFailedTests;
+    if (!cache.get ("WEIGHTS", weights))         ++nofFailedTests;
+    /* An array cannot be retrieved as scalar */
+    if (cache.get ("WEIGHTS", weight))           ++nofFailedTests;
+
+    if (stations.size() != 3 || stations[2] != "RS106") ++nofFailedTests;
+    if (weights.size() != 4 || weights[3] != 0.75)      ++nofFailedTests;
+    /* Missing attribute */
+    if (cache.get ("MISSING", weight))           ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                     test_read
+
+/*!
+  \brief Test lazy loading and invalidation of the cache
+
+  \param fileID          -- Identifier of the file, to whose root group the
+         attributes are attached.
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_read (hid_t const &fileID)
+{
+  cout << "\n[tHDF5AttributeCache::test_read]\n" << endl;
+
+  int nofFailedTests (0);
+
+  cout << "[1] Testing read() with lazy loading ..." << endl;
+  try {
+    HDF5AttributeCache cache;
+    int nofStations (0);
+    //
+    if (!cache.read (fileID, "NOF_STATIONS", nofStations)) ++nofFailedTests;
+    if (cache.location() != fileID)  ++nofFailedTests;
+    if (cache.size() != 6)           ++nofFailedTests;
+    if (nofStations != 36)           ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing invalidate() after writing an attribute ..." << endl;
+  try {
+    HDF5AttributeCache cache (fileID);
+    int nofStations (0);
+    //
+    HDF5Attribute::write (fileID, "NOF_STATIONS", int(40));
+    /* The cache still holds the previous value ... */
+    cache.get ("NOF_STATIONS", nofStations);
+    if (nofStations != 36) ++nofFailedTests;
+    /* ... until the attribute is invalidated */
+    cache.invalidate ("NOF_STATIONS");
+    if (cache.contains ("NOF_STATIONS")) ++nofFailedTests;
+    cache.read (fileID, "NOF_STATIONS", nofStations);
+    if (nofStations != 40) ++nofFailedTests;
+    /* Restore the original value */
+    HDF5Attribute::write (fileID, "NOF_STATIONS", int(36));
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Comparing timing against HDF5Attribute::read ..." << endl;
+  try {
+    unsigned int nofPasses (1000);
+    int nofStations (0);
+    double frequency (0);
+    std::string telescope;
+    double t0, t1, t2;
+
+    t0 = seconds();
+    for (unsigned int n(0); n<nofPasses; ++n) {
+      HDF5Attribute::read (fileID, "NOF_STATIONS", nofStations);
+      HDF5Attribute::read (fileID, "FREQUENCY", frequency);
+      HDF5Attribute::read (fileID, "TELESCOPE", telescope);
+    }
+    t1 = seconds();
+    HDF5AttributeCache cache;
+    for (unsigned int n(0); n<nofPasses; ++n) {
+      cache.read (fileID, "NOF_STATIONS", nofStations);
+      cache.read (fileID, "FREQUENCY", frequency);
+      cache.read (fileID, "TELESCOPE", telescope);
+    }
+    t2 = seconds();
+
+    cout << "-- nof. reads                 = " << 3*nofPasses << endl;
+    cout << "-- HDF5Attribute::read [s]     = " << t1-t0 << endl;
+    cout << "-- HDF5AttributeCache::read [s] = " << t2-t1 << endl;
+
+    if (nofStations != 36 || telescope != "LOFAR") ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                           main
+
+int main ()
+{
+  int nofFailedTests (0);
+  std::string filename ("tHDF5AttributeCache.h5");
+
+  hid_t fileID = H5Fcreate (filename.c_str(),
+			    H5F_ACC_TRUNC,
+			    H5P_DEFAULT,
+			    H5P_DEFAULT);
+
+  if (H5Iis_valid(fileID)) {
+    /* Attach the attributes used in the tests */
+    std::vector<std::string> stations (3);
+    std::vector<float> weights (4);
+
+    stations[0] = "CS001";
+    stations[1] = "CS002";
+    stations[2] = "RS106";
+    for (unsigned int n(0); n<weights.size(); ++n) {
+      weights[n] = 0.25*n;
+    }
+
+    HDF5Attribute::write (fileID, "TELESCOPE",     std::string("LOFAR"));
+    HDF5Attribute::write (fileID, "NOF_STATIONS",  int(36));
+    HDF5Attribute::write (fileID, "FREQUENCY",     double(200e6));
+    HDF5Attribute::write (fileID, "FLAG",          true);
+    HDF5Attribute::write (fileID, "STATIONS_LIST", stations);
+    HDF5Attribute::write (fileID, "WEIGHTS",       weights);
+
+    // Test retrieval of attribute values
+    nofFailedTests += test_get (fileID);
+    // Test lazy loading and invalidation
+    nofFailedTests += test_read (fileID);
+  } else {
+    cerr << "-- ERROR: Failed to create file " << filename << endl;
+    return -1;
+  }
+
+  H5Fclose (fileID);
+
+  return nofFailedTests;
+}
@@ -0,0 +1,346 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include <core/HDF5BlockIterator.h>
+
+#include <cmath>
+#include <sys/time.h>
+
+// Namespace usage
+using std::cerr;
+using std::cout;
+using std::endl;
+using DAL::HDF5BlockIterator;
+using DAL::HDF5Dataset;
+using DAL::HDF5IOPlan;
+using DAL::HDF5Lock;
+
+/*!
+  \file tHDF5BlockIterator.cc
+
+  \ingroup DAL
+  \ingroup core
+
+  \brief A collection of test routines for the DAL::HDF5BlockIterator class
+
+  \author agent
+
+  \date 2026/10/18
+*/
+
+//! Number of rows of the test dataset
+const hsize_t nofRows    = 1000;
+//! Number of columns of the test dataset
+const hsize_t nofColumns = 64;
+
+//_______________________________________________________________________________
+//                                                                       seconds
+
+//! Get the current wall-clock time in seconds
+double seconds ()
+{
+  struct timeval tv;
+  gettimeofday (&tv, NULL);
+  return tv.tv_sec + 1e-6*tv.tv_usec;
+}
+
+//_______________________________________________________________________________
+//                                                                        compute
+
+//! Simulate processing of a block of data
+double compute (float const *data,
+		hsize_t const &nelem,
+		unsigned int const &nofPasses)
+{
+  double sum (0);
+
+  for (unsigned int pass(0); pass<nofPasses; ++pass) {
+    for (hsize_t n(0); n<nelem; ++n) {
+      sum += std::sqrt (std::fabs (data[n]) + pass);
+    }
+  }
+
+  return sum;
+}
+
+//_______________________________________________________________________________
+//                                                               test_iteration
+
+/*!
+  \brief Test iteration over the blocks of a dataset
+
+  \param fileID          -- Identifier of the file, to which the dataset is
+         attached.
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_iteration (hid_t const &fileID)
+{
+  cout << "\n[tHDF5BlockIterator::test_iteration]\n" << endl;
+
+  int nofFailedTests (0);
+  std::vector<hsize_t> block (2);
+
+  cout << "[1] Testing iteration along the first axis ..." << endl;
+  try {
+    HDF5Dataset dataset (fileID, "Data");
+
+    block[0] = 128;
+    block[1] = nofColumns;
+
+    HDF5BlockIterator it (dataset, block, H5T_NATIVE_FLOAT);
+    float const *data;
+    hsize_t nofBlocks (0);
+    hsize_t row (0);
+
+    it.summary();
+
+    while ((data = it.next<float>())) {
+      std::vector<hsize_t> shape = it.blockShape();
+      for (hsize_t n(0); n<shape[0]*shape[1]; ++n) {
+	if (data[n] != float(row*nofColumns+n)) {
+	  ++nofFailedTests;
+	  break;
+	}
+      }
+      row += shape[0];
+      ++nofBlocks;
+    }
+
+    cout << "-- nof. blocks = " << nofBlocks << endl;
+    cout << "-- nof. rows   = " << row << endl;
+    if (nofBlocks != 8)   ++nofFailedTests;
+    if (row != nofRows)   ++nofFailedTests;
+    if (it.error())       ++nofFailedTests;
+    /* Iteration stays at the end of the dataset */
+    if (it.next() != NULL) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing iteration along the second axis, double buffering ..." << endl;
+  try {
+    HDF5Dataset dataset (fileID, "Data");
+
+    block[0] = nofRows;
+    block[1] = 10;
+
+    HDF5BlockIterator it (dataset, block, H5T_NATIVE_FLOAT, 1, 2);
+    float const *data;
+    hsize_t column (0);
+
+    while ((data = it.next<float>())) {
+      std::vector<hsize_t> shape = it.blockShape();
+      /* Check the last row of the block */
+      for (hsize_t n(0); n<shape[1]; ++n) {
+	if (data[(shape[0]-1)*shape[1]+n] != float((nofRows-1)*nofColumns+column+n)) {
+	  ++nofFailedTests;
+	  break;
+	}
+      }
+      column += shape[1];
+    }
+
+    if (it.nofBlocks() != 7)   ++nofFailedTests;
+    if (column != nofColumns)  ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Testing restart and early termination ..." << endl;
+  try {
+    HDF5Dataset dataset (fileID, "Data");
+
+    block[0] = 10;
+    block[1] = nofColumns;
+
+    HDF5BlockIterator it (dataset, block, H5T_NATIVE_FLOAT);
+    float const *data = it.next<float>();
+
+    if (data == NULL || data[0] != 0) ++nofFailedTests;
+    it.next();
+    it.next();
+    if (it.index() != 2) ++nofFailedTests;
+
+    /* Restart from the beginning */
+    it.start();
+    data = it.next<float>();
+    if (data == NULL || it.index() != 0) ++nofFailedTests;
+    /* Leave the remaining blocks unread; the destructor stops the thread */
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[4] Testing rejection of invalid parameters ..." << endl;
+  try {
+    HDF5Dataset dataset (fileID, "Data");
+
+    block[0] = 10;
+    block[1] = nofColumns+1;
+
+    HDF5BlockIterator it (dataset, block, H5T_NATIVE_FLOAT);
+
+    if (it.isValid())       ++nofFailedTests;
+    if (it.next() != NULL)  ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[5] Testing HDF5 calls of the consumer holding HDF5Lock ..." << endl;
+  try {
+    HDF5Dataset dataset (fileID, "Data");
+
+    block[0] = 50;
+    block[1] = nofColumns;
+
+    HDF5BlockIterator it (dataset, block, H5T_NATIVE_FLOAT);
+    float const *data;
+    float first;
+    hsize_t row (0);
+    hsize_t start[2];
+    std::vector<hsize_t> element (2, 1);
+
+    /* Read the first element of each block through a plan of our own, while
+       the I/O thread is prefetching the following blocks */
+    while ((data = it.next<float>())) {
+      HDF5Lock lock;
+      HDF5IOPlan plan (dataset, element, H5T_NATIVE_FLOAT);
+      start[0] = row;
+      start[1] = 0;
+      if (!plan.read (&first, start) || first != data[0]) {
+	++nofFailedTests;
+	break;
+      }
+      row += it.blockShape()[0];
+    }
+
+    if (row != nofRows)  ++nofFailedTests;
+    if (it.error())      ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                 test_overlap
+
+/*!
+  \brief Compare sequential read+compute against prefetching
+
+  \param fileID          -- Identifier of the file, to which the dataset is
+         attached.
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_overlap (hid_t const &fileID)
+{
+  cout << "\n[tHDF5BlockIterator::test_overlap]\n" << endl;
+
+  int nofFailedTests (0);
+  unsigned int nofPasses (20);
+  std::vector<hsize_t> block (2);
+  double t0, t1, t2;
+  double sumSequential (0);
+  double sumPrefetch (0);
+
+  block[0] = 100;
+  block[1] = nofColumns;
+
+  try {
+    HDF5Dataset dataset (fileID, "Data");
+    HDF5IOPlan plan (dataset, block, H5T_NATIVE_FLOAT);
+    float *buffer = new float [plan.nofDatapoints()];
+
+    t0 = seconds();
+    for (hsize_t n(0); n<nofRows/block[0]; ++n) {
+      plan.readBlock (buffer, n);
+      sumSequential += compute (buffer, plan.nofDatapoints(), nofPasses);
+    }
+    t1 = seconds();
+
+    HDF5BlockIterator it (dataset, block, H5T_NATIVE_FLOAT);
+    float const *data;
+    while ((data = it.next<float>())) {
+      sumPrefetch += compute (data, it.nofDatapoints(), nofPasses);
+    }
+    t2 = seconds();
+
+    cout << "-- Sequential read+compute [s] = " << t1-t0 << endl;
+    cout << "-- Prefetching iterator    [s] = " << t2-t1 << endl;
+
+    if (sumSequential != sumPrefetch) ++nofFailedTests;
+
+    delete [] buffer;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                           main
+
+int main ()
+{
+  int nofFailedTests (0);
+  std::string filename ("tHDF5BlockIterator.h5");
+
+  hid_t fileID = H5Fcreate (filename.c_str(),
+			    H5F_ACC_TRUNC,
+			    H5P_DEFAULT,
+			    H5P_DEFAULT);
+
+  if (H5Iis_valid(fileID)) {
+    /* Create the dataset used in the tests */
+    std::vector<hsize_t> shape (2);
+    shape[0] = nofRows;
+    shape[1] = nofColumns;
+
+    std::vector<float> data (nofRows*nofColumns);
+    for (hsize_t n(0); n<data.size(); ++n) {
+      data[n] = n;
+    }
+
+    HDF5Dataset dataset (fileID, "Data", shape, H5T_NATIVE_FLOAT);
+    HDF5IOPlan plan (dataset, shape, H5T_NATIVE_FLOAT);
+    plan.writeBlock (&data[0], 0);
+
+    // Test iteration over the blocks of a dataset
+    nofFailedTests += test_iteration (fileID);
+    // Compare sequential read+compute against prefetching
+    nofFailedTests += test_overlap (fileID);
+  } else {
+    cerr << "-- ERROR: Failed to create file " << filename << endl;
+    return -1;
+  }
+
+  H5Fclose (fileID);
+
+  return nofFailedTests;
+}
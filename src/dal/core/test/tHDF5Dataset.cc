@@ -31,8 +31,11 @@
   \date 2009/12/03
 */
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <string>
+#include <zlib.h>
 
 #include <core/dalCommon.h>
 #include <core/HDF5Attribute.h>
@@ -482,6 +485,294 @@ int test_array1d (hid_t const &fileID)
   return nofFailedTests;
 }
 
+//_______________________________________________________________________________
+//                                                                  test_chunking
+
+/*!
+  \brief Test selection of chunk shape and configuration of the chunk cache
+
+  \param fileID          -- HDF5 object identifier for the file, to which the 
+         dataset are attached.
+  \return nofFailedTests -- The number of failed tests encountered within this
+          functions.
+*/
+int test_chunking (hid_t const &fileID)
+{
+  cout << "\n[tHDF5Datatset::test_chunking]\n" << endl;
+
+  int nofFailedTests = 0;
+  std::vector<hsize_t> shape (2);
+  std::vector<hsize_t> chunk;
+
+  shape[0] = 100000;
+  shape[1] = 512;
+
+  cout << "[1] Testing chunkShape(shape,elementSize,pattern) ..." << endl;
+  try {
+    /* Time-series: first axis gets filled first */
+    chunk = HDF5Dataset::chunkShape (shape, sizeof(float), HDF5Dataset::TimeSeries);
+    cout << "-- TimeSeries    : " << chunk << endl;
+    if (chunk[0] != 262144/2 && chunk[0] != shape[0]) ++nofFailedTests;
+    if (chunk[0]*chunk[1]*sizeof(float) > 1048576) ++nofFailedTests;
+    /* Spectral slice: complete second axis */
+    chunk = HDF5Dataset::chunkShape (shape, sizeof(float), HDF5Dataset::SpectralSlice);
+    cout << "-- SpectralSlice : " << chunk << endl;
+    if (chunk[1] != shape[1] || chunk[0] != 512) ++nofFailedTests;
+    /* Tile: comparable extent along both axes */
+    chunk = HDF5Dataset::chunkShape (shape, sizeof(float), HDF5Dataset::Tile);
+    cout << "-- Tile          : " << chunk << endl;
+    if (chunk[0] != 512 || chunk[1] != 512) ++nofFailedTests;
+    /* Short axis is covered completely */
+    shape[1] = 8;
+    chunk = HDF5Dataset::chunkShape (shape, sizeof(float), HDF5Dataset::Tile);
+    cout << "-- Tile (short)  : " << chunk << endl;
+    if (chunk[1] != 8 || chunk[0] != 32768) ++nofFailedTests;
+  } catch (std::string message) {
+    std::cerr << message << endl;
+    ++nofFailedTests;
+  }
+
+  cout << "[2] Testing chunkCacheSlots(nbytes,chunkBytes) ..." << endl;
+  try {
+    size_t nslots = HDF5Dataset::chunkCacheSlots (1048576, 1048576);
+    cout << "-- 1 MB / 1 MB   : " << nslots << endl;
+    if (nslots != 521) ++nofFailedTests;
+    nslots = HDF5Dataset::chunkCacheSlots (64*1048576, 1048576);
+    cout << "-- 64 MB / 1 MB  : " << nslots << endl;
+    if (nslots != 6421) ++nofFailedTests;
+  } catch (std::string message) {
+    std::cerr << message << endl;
+    ++nofFailedTests;
+  }
+
+  cout << "[3] Testing setChunkCache() before creating dataset ..." << endl;
+  try {
+    size_t nbytes = 0;
+    size_t nslots = 0;
+    double w0     = 0;
+
+    shape[1] = 512;
+    chunk    = HDF5Dataset::chunkShape (shape, sizeof(double), HDF5Dataset::TimeSeries);
+
+    DAL::HDF5Dataset dataset;
+    dataset.setChunkCache (16*1048576, 0, 1.0);
+    dataset.open (fileID, "ChunkCache", shape, chunk);
+    dataset.chunkCache (nbytes, nslots, w0);
+
+    cout << "-- Chunking      : " << dataset.chunking() << endl;
+    cout << "-- Chunk cache   : " << nbytes << " / " << nslots << " / " << w0 << endl;
+
+    if (nbytes != 16*1048576 || w0 != 1.0) ++nofFailedTests;
+    if (dataset.chunking() != chunk) ++nofFailedTests;
+  } catch (std::string message) {
+    std::cerr << message << endl;
+    ++nofFailedTests;
+  }
+
+  cout << "[4] Testing setChunkCache() on open dataset ..." << endl;
+  try {
+    size_t nbytes = 0;
+    size_t nslots = 0;
+    double w0     = 0;
+
+    DAL::HDF5Dataset dataset (fileID, "ChunkCache");
+    dataset.setChunkCache (4*1048576, 1009);
+    dataset.chunkCache (nbytes, nslots, w0);
+
+    cout << "-- Chunk cache   : " << nbytes << " / " << nslots << " / " << w0 << endl;
+
+    if (nbytes != 4*1048576 || nslots != 1009) ++nofFailedTests;
+    if (dataset.shape() != shape) ++nofFailedTests;
+  } catch (std::string message) {
+    std::cerr << message << endl;
+    ++nofFailedTests;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                              test_directChunk
+
+/*!
+  \brief Test direct read/write of chunks of raw data
+
+  \param fileID          -- HDF5 object identifier for the file, to which the 
+         dataset are attached.
+  \return nofFailedTests -- The number of failed tests encountered within this
+          functions.
+*/
+int test_directChunk (hid_t const &fileID)
+{
+  cout << "\n[tHDF5Datatset::test_directChunk]\n" << endl;
+
+  int nofFailedTests = 0;
+  unsigned int nofChunks (4);
+  std::vector<hsize_t> shape (1,1024);
+  std::vector<hsize_t> chunk (1,1024);
+  std::vector<hsize_t> offset (1,0);
+  std::vector<short> data (nofChunks*chunk[0]);
+  std::vector<short> buffer (nofChunks*chunk[0]);
+  uint32_t filterMask;
+
+  for (unsigned int n(0); n<data.size(); ++n) {
+    data[n] = short(n%1000);
+  }
+
+  cout << "[1] Testing writeChunk() extending the dataset ..." << endl;
+  try {
+    HDF5Dataset dataset (fileID, "DirectChunk", shape, chunk, H5T_NATIVE_SHORT);
+
+    for (unsigned int n(0); n<nofChunks; ++n) {
+      offset[0] = n*chunk[0];
+      if (!dataset.writeChunk (&data[offset[0]],
+			       chunk[0]*sizeof(short),
+			       offset)) {
+	++nofFailedTests;
+      }
+    }
+
+    cout << "-- Shape after writing chunks = " << dataset.shape() << endl;
+    if (dataset.shape()[0] != nofChunks*chunk[0]) ++nofFailedTests;
+
+    /* Data are accessible through the regular interface */
+    std::vector<int> start (1,0);
+    std::vector<int> block (1,nofChunks*chunk[0]);
+    dataset.readData (&buffer[0], start, block);
+    if (buffer != data) ++nofFailedTests;
+  } catch (std::string message) {
+    std::cerr << message << endl;
+    ++nofFailedTests;
+  }
+
+  cout << "[2] Testing readChunk() ..." << endl;
+  try {
+    HDF5Dataset dataset (fileID, "DirectChunk");
+    std::vector<char> raw;
+
+    offset[0] = 2*chunk[0];
+    cout << "-- Chunk storage size = " << dataset.chunkStorageSize (offset) << endl;
+
+    if (dataset.readChunk (raw, offset, filterMask)) {
+      if (raw.size() != chunk[0]*sizeof(short)) ++nofFailedTests;
+      if (filterMask != 0)                      ++nofFailedTests;
+      if (std::memcmp (&raw[0], &data[offset[0]], raw.size()) != 0) {
+	++nofFailedTests;
+      }
+    } else {
+      ++nofFailedTests;
+    }
+
+    /* Offsets not aligned with the chunk boundaries are rejected */
+    offset[0] = 100;
+    if (dataset.readChunk (raw, offset, filterMask)) ++nofFailedTests;
+  } catch (std::string message) {
+    std::cerr << message << endl;
+    ++nofFailedTests;
+  }
+
+  cout << "[3] Testing writeChunk() with chunk compressed outside HDF5 ..." << endl;
+  try {
+    DAL::HDF5Filter filter;
+    filter.addDeflate (4);
+
+    HDF5Dataset dataset;
+    dataset.setFilter (filter);
+    dataset.open (fileID, "DirectChunkDeflate", shape, chunk, H5T_NATIVE_SHORT);
+
+    /* Compress the chunk the way the deflate filter would */
+    uLongf nbytes = compressBound (chunk[0]*sizeof(short));
+    std::vector<Bytef> compressed (nbytes);
+    compress2 (&compressed[0],
+	       &nbytes,
+	       reinterpret_cast<Bytef const *>(&data[0]),
+	       chunk[0]*sizeof(short),
+	       4);
+
+    offset[0] = 0;
+    if (!dataset.writeChunk (&compressed[0], nbytes, offset)) ++nofFailedTests;
+
+    cout << "-- Raw chunk [Bytes]    = " << chunk[0]*sizeof(short) << endl;
+    cout << "-- Stored chunk [Bytes] = " << dataset.chunkStorageSize (offset) << endl;
+    if (dataset.chunkStorageSize (offset) != nbytes) ++nofFailedTests;
+
+    /* Reading through the pipeline decompresses the chunk */
+    std::vector<int> start (1,0);
+    std::vector<int> block (1,chunk[0]);
+    buffer.assign (buffer.size(), 0);
+    dataset.readData (&buffer[0], start, block);
+    if (!std::equal (data.begin(), data.begin()+chunk[0], buffer.begin())) {
+      ++nofFailedTests;
+    }
+  } catch (std::string message) {
+    std::cerr << message << endl;
+    ++nofFailedTests;
+  }
+
+  cout << "[4] Testing writeChunk() with partial chunk at the edge ..." << endl;
+  try {
+    std::vector<hsize_t> edgeShape (1,1000);
+    std::vector<hsize_t> edgeChunk (1,300);
+    std::vector<int> start (1,0);
+    std::vector<int> block (1,edgeShape[0]);
+
+    /* Rewriting the edge chunk keeps the shape; a chunk beyond it extends */
+    HDF5Dataset dataset (fileID, "DirectChunkEdge", edgeShape, edgeChunk, H5T_NATIVE_SHORT);
+
+    for (offset[0]=0; offset[0]<edgeShape[0]; offset[0]+=edgeChunk[0]) {
+      if (!dataset.writeChunk (&data[offset[0]],
+			       edgeChunk[0]*sizeof(short),
+			       offset)) {
+	++nofFailedTests;
+      }
+    }
+
+    cout << "-- Shape after writing chunks = " << dataset.shape() << endl;
+    if (dataset.shape() != edgeShape) ++nofFailedTests;
+
+    buffer.assign (buffer.size(), 0);
+    dataset.readData (&buffer[0], start, block);
+    if (!std::equal (data.begin(), data.begin()+edgeShape[0], buffer.begin())) {
+      ++nofFailedTests;
+    }
+
+    offset[0] = 4*edgeChunk[0];
+    if (!dataset.writeChunk (&data[0], edgeChunk[0]*sizeof(short), offset)) {
+      ++nofFailedTests;
+    }
+    cout << "-- Shape after appending chunk = " << dataset.shape() << endl;
+    if (dataset.shape()[0] != 5*edgeChunk[0]) ++nofFailedTests;
+
+    /* A dataset with fixed maximum shape only takes chunks inside of it */
+    hid_t space = H5Screate_simple (1, &edgeShape[0], &edgeShape[0]);
+    hid_t plist = H5Pcreate (H5P_DATASET_CREATE);
+    H5Pset_chunk (plist, 1, &edgeChunk[0]);
+    hid_t datasetID = H5Dcreate (fileID, "DirectChunkFixed", H5T_NATIVE_SHORT,
+				 space, H5P_DEFAULT, plist, H5P_DEFAULT);
+    H5Dclose (datasetID);
+    H5Pclose (plist);
+    H5Sclose (space);
+
+    HDF5Dataset fixed (fileID, "DirectChunkFixed");
+
+    offset[0] = 3*edgeChunk[0];
+    if (!fixed.writeChunk (&data[offset[0]], edgeChunk[0]*sizeof(short), offset)) {
+      ++nofFailedTests;
+    }
+    if (fixed.shape() != edgeShape) ++nofFailedTests;
+
+    offset[0] = 4*edgeChunk[0];
+    if (fixed.writeChunk (&data[0], edgeChunk[0]*sizeof(short), offset)) {
+      ++nofFailedTests;
+    }
+  } catch (std::string message) {
+    std::cerr << message << endl;
+    ++nofFailedTests;
+  }
+
+  return nofFailedTests;
+}
+
 //_______________________________________________________________________________
 //                                                                   test_array2d
 
@@ -1041,6 +1332,10 @@ int main (int argc,
       nofFailedTests += test_array1d (fileID);
       // Test access R/W access to 2-dim data arrays
       nofFailedTests += test_array2d (fileID);
+      // Test chunk shape selection and chunk cache
+      nofFailedTests += test_chunking (fileID);
+      // Test direct read/write of chunks
+      nofFailedTests += test_directChunk (fileID);
       // // Test the effect of the various Hyperslab parameters
       // nofFailedTests += test_hyperslab (fileID);
       // // Test expansion of extendable datasets
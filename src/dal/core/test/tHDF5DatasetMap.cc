@@ -0,0 +1,324 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include <core/HDF5DatasetMap.h>
+#include <core/HDF5IOPlan.h>
+
+// Namespace usage
+using std::cerr;
+using std::cout;
+using std::endl;
+using DAL::HDF5Dataset;
+using DAL::HDF5DatasetMap;
+using DAL::HDF5IOPlan;
+
+/*!
+  \file tHDF5DatasetMap.cc
+
+  \ingroup DAL
+  \ingroup core
+
+  \brief A collection of test routines for the DAL::HDF5DatasetMap class
+
+  \author agent
+
+  \date 2026/10/18
+*/
+
+//! Number of rows of the test datasets
+const hsize_t nofRows    = 20;
+//! Number of columns of the test datasets
+const hsize_t nofColumns = 30;
+
+//_______________________________________________________________________________
+//                                                                 create_dataset
+
+/*!
+  \brief Create a [nofRows,nofColumns] dataset of 16 bit integers
+
+  \param fileID  -- Identifier of the file, to which the dataset is attached.
+  \param name    -- Name of the dataset.
+  \param chunked -- Create the dataset with chunked layout and a deflate filter?
+*/
+void create_dataset (hid_t const &fileID,
+		     std::string const &name,
+		     bool const &chunked)
+{
+  hsize_t shape[2] = {nofRows, nofColumns};
+  hsize_t chunk[2] = {5, 10};
+  std::vector<short> data (nofRows*nofColumns);
+
+  for (size_t n(0); n<data.size(); ++n) {
+    data[n] = short(n) - 300;
+  }
+
+  hid_t dataspace = H5Screate_simple (2, shape, NULL);
+  hid_t plist     = H5Pcreate (H5P_DATASET_CREATE);
+
+  if (chunked) {
+    H5Pset_chunk (plist, 2, chunk);
+    H5Pset_deflate (plist, 6);
+  }
+
+  hid_t dataset = H5Dcreate (fileID,
+			     name.c_str(),
+			     H5T_STD_I16LE,
+			     dataspace,
+			     H5P_DEFAULT,
+			     plist,
+			     H5P_DEFAULT);
+
+  H5Dwrite (dataset,
+	    H5T_NATIVE_SHORT,
+	    H5S_ALL,
+	    H5S_ALL,
+	    H5P_DEFAULT,
+	    &data[0]);
+
+  H5Dclose (dataset);
+  H5Pclose (plist);
+  H5Sclose (dataspace);
+}
+
+//_______________________________________________________________________________
+//                                                              test_constructors
+
+/*!
+  \brief Test constructors for a new HDF5DatasetMap object
+
+  \param fileID          -- Identifier of the file, to which the datasets are
+         attached.
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_constructors (hid_t const &fileID)
+{
+  cout << "\n[tHDF5DatasetMap::test_constructors]\n" << endl;
+
+  int nofFailedTests (0);
+
+  cout << "[1] Testing HDF5DatasetMap() ..." << endl;
+  try {
+    HDF5DatasetMap map;
+    map.summary();
+
+    if (map.isValid())  ++nofFailedTests;
+    if (map.isMapped()) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing HDF5DatasetMap(hid_t) on contiguous dataset ..." << endl;
+  try {
+    hid_t datasetID = H5Dopen (fileID, "Contiguous", H5P_DEFAULT);
+    HDF5DatasetMap map (datasetID);
+    /* The map keeps its own reference on the dataset */
+    H5Dclose (datasetID);
+    map.summary();
+
+    if (!map.isMapped())                           ++nofFailedTests;
+    if (map.nofDatapoints() != nofRows*nofColumns) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Testing HDF5DatasetMap(HDF5Dataset) on chunked dataset ..." << endl;
+  try {
+    HDF5Dataset dataset (fileID, "Chunked");
+    HDF5DatasetMap map (dataset);
+    map.summary();
+
+    if (!map.isValid())                                ++nofFailedTests;
+    if (map.isMapped())                                ++nofFailedTests;
+    if (HDF5DatasetMap::mappable (dataset.objectID())) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[4] Testing rejection of invalid location ..." << endl;
+  try {
+    HDF5DatasetMap map (fileID);
+
+    if (map.isValid())                     ++nofFailedTests;
+    if (HDF5DatasetMap::mappable (fileID)) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                      test_data
+
+/*!
+  \brief Test access to the data of the datasets
+
+  \param fileID          -- Identifier of the file, to which the datasets are
+         attached.
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_data (hid_t const &fileID)
+{
+  cout << "\n[tHDF5DatasetMap::test_data]\n" << endl;
+
+  int nofFailedTests (0);
+  std::vector<hsize_t> start (2);
+  std::vector<hsize_t> count (2);
+
+  start[0] = 3;
+  start[1] = 7;
+  count[0] = 4;
+  count[1] = 11;
+
+  cout << "[1] Testing direct access through data<T>() ..." << endl;
+  try {
+    HDF5Dataset dataset (fileID, "Contiguous");
+    HDF5DatasetMap map (dataset);
+    short const *data = map.data<short>();
+
+    if (data == NULL) {
+      ++nofFailedTests;
+    } else {
+      for (hsize_t n(0); n<nofRows*nofColumns; ++n) {
+	if (data[n] != short(n)-300) {
+	  ++nofFailedTests;
+	  break;
+	}
+      }
+    }
+
+    /* No pointer is handed out if conversion would be required */
+    if (map.data<float>() != NULL) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing readData() through the mapping ..." << endl;
+  try {
+    HDF5Dataset dataset (fileID, "Contiguous");
+    HDF5DatasetMap map (dataset);
+    std::vector<short> buffer (count[0]*count[1]);
+    std::vector<short> reference (count[0]*count[1]);
+
+    if (!map.readData (&buffer[0], start, count)) ++nofFailedTests;
+
+    HDF5IOPlan plan (dataset, count, H5T_NATIVE_SHORT);
+    plan.read (&reference[0], &start[0]);
+
+    if (buffer != reference) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Testing readData() with conversion to float ..." << endl;
+  try {
+    HDF5Dataset dataset (fileID, "Contiguous");
+    HDF5DatasetMap map (dataset);
+    std::vector<float> buffer (count[0]*count[1]);
+
+    if (!map.readData (&buffer[0], start, count)) ++nofFailedTests;
+
+    for (hsize_t row(0); row<count[0]; ++row) {
+      for (hsize_t col(0); col<count[1]; ++col) {
+	hsize_t n = (start[0]+row)*nofColumns + start[1]+col;
+	if (buffer[row*count[1]+col] != float(short(n)-300)) ++nofFailedTests;
+      }
+    }
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[4] Testing readData() on chunked dataset ..." << endl;
+  try {
+    HDF5Dataset dataset (fileID, "Chunked");
+    HDF5Dataset datasetContiguous (fileID, "Contiguous");
+    HDF5DatasetMap map (dataset);
+    HDF5DatasetMap contiguous (datasetContiguous);
+    std::vector<short> buffer (count[0]*count[1]);
+    std::vector<short> reference (count[0]*count[1]);
+
+    if (map.data<short>() != NULL)                          ++nofFailedTests;
+    if (!map.readData (&buffer[0], start, count))           ++nofFailedTests;
+    if (!contiguous.readData (&reference[0], start, count)) ++nofFailedTests;
+    if (buffer != reference)                                ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[5] Testing rejection of invalid hyperslab ..." << endl;
+  try {
+    HDF5Dataset dataset (fileID, "Contiguous");
+    HDF5DatasetMap map (dataset);
+    std::vector<short> buffer (nofRows*nofColumns);
+    std::vector<hsize_t> origin (2, 0);
+    std::vector<hsize_t> shape = map.shape();
+
+    shape[1] += 1;
+    if (map.readData (&buffer[0], origin, shape))                    ++nofFailedTests;
+    if (map.readData (&buffer[0], std::vector<hsize_t>(1,0), count)) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                           main
+
+int main ()
+{
+  int nofFailedTests (0);
+  std::string filename ("tHDF5DatasetMap.h5");
+
+  hid_t fileID = H5Fcreate (filename.c_str(),
+			    H5F_ACC_TRUNC,
+			    H5P_DEFAULT,
+			    H5P_DEFAULT);
+
+  if (H5Iis_valid(fileID)) {
+    /* Create the datasets used in the tests */
+    create_dataset (fileID, "Contiguous", false);
+    create_dataset (fileID, "Chunked",    true);
+
+    // Test for the constructor(s)
+    nofFailedTests += test_constructors (fileID);
+    // Test access to the data of the datasets
+    nofFailedTests += test_data (fileID);
+  } else {
+    cerr << "-- ERROR: Failed to create file " << filename << endl;
+    return -1;
+  }
+
+  H5Fclose (fileID);
+
+  return nofFailedTests;
+}
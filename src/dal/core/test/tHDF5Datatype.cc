@@ -19,11 +19,15 @@
  ***************************************************************************/
 
 #include <core/HDF5Datatype.h>
+#include <core/HDF5Dataset.h>
+#include <core/HDF5TypeTraits.h>
+#include <data_hl/BFRawFormat.h>
 
 // Namespace usage
 using std::cout;
 using std::endl;
 using DAL::HDF5Datatype;
+using DAL::HDF5TypeTraits;
 
 /*!
   \file tHDF5Datatype.cc
@@ -130,6 +134,154 @@ int test_static_functions ()
   return nofFailedTests;
 }
 
+//_______________________________________________________________________________
+//                                                                    test_traits
+
+/*!
+  \brief Test mapping of C++ types onto native HDF5 datatypes
+
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_traits ()
+{
+  cout << "\n[tHDF5Datatype::test_traits]\n" << endl;
+
+  int nofFailedTests (0);
+
+  cout << "[1] Testing native datatypes ..." << endl;
+  try {
+    if (HDF5TypeTraits<short>::type()  != H5T_NATIVE_SHORT)  ++nofFailedTests;
+    if (HDF5TypeTraits<int>::type()    != H5T_NATIVE_INT)    ++nofFailedTests;
+    if (HDF5TypeTraits<float>::type()  != H5T_NATIVE_FLOAT)  ++nofFailedTests;
+    if (HDF5TypeTraits<double>::type() != H5T_NATIVE_DOUBLE) ++nofFailedTests;
+    if (HDF5TypeTraits<int16_t>::type() != H5T_NATIVE_SHORT) ++nofFailedTests;
+  } catch (std::string message) {
+    std::cerr << message << endl;
+    ++nofFailedTests;
+  }
+
+  cout << "[2] Testing complex datatypes ..." << endl;
+  try {
+    hid_t cfloat = HDF5TypeTraits<std::complex<float> >::type();
+    hid_t cshort = HDF5TypeTraits<std::complex<int16_t> >::type();
+
+    cout << "-- complex<float>   : " << H5Tget_size(cfloat) << " bytes, "
+	 << H5Tget_nmembers(cfloat) << " members" << endl;
+    cout << "-- complex<int16_t> : " << H5Tget_size(cshort) << " bytes, "
+	 << H5Tget_nmembers(cshort) << " members" << endl;
+
+    if (H5Tget_size(cfloat) != sizeof(std::complex<float>))   ++nofFailedTests;
+    if (H5Tget_size(cshort) != sizeof(std::complex<int16_t>)) ++nofFailedTests;
+    if (H5Tget_member_offset(cfloat,1) != sizeof(float))      ++nofFailedTests;
+    /* The datatype is created only once */
+    if (HDF5TypeTraits<std::complex<float> >::type() != cfloat) ++nofFailedTests;
+  } catch (std::string message) {
+    std::cerr << message << endl;
+    ++nofFailedTests;
+  }
+
+  cout << "[3] Testing BFRawFormat::Sample ..." << endl;
+  try {
+    hid_t sample = HDF5TypeTraits<BFRawFormat::Sample>::type();
+
+    cout << "-- Sample : " << H5Tget_size(sample) << " bytes" << endl;
+    if (H5Tget_size(sample) != sizeof(BFRawFormat::Sample)) ++nofFailedTests;
+    if (H5Tget_nmembers(sample) != 2)                       ++nofFailedTests;
+  } catch (std::string message) {
+    std::cerr << message << endl;
+    ++nofFailedTests;
+  }
+
+  cout << "[4] Testing requiresConversion() ..." << endl;
+  try {
+    if (HDF5Datatype::requiresConversion (H5T_NATIVE_SHORT, H5T_NATIVE_SHORT)) {
+      ++nofFailedTests;
+    }
+    if (!HDF5Datatype::requiresConversion (H5T_NATIVE_SHORT, H5T_NATIVE_FLOAT)) {
+      ++nofFailedTests;
+    }
+  } catch (std::string message) {
+    std::cerr << message << endl;
+    ++nofFailedTests;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                  test_dataset
+
+/*!
+  \brief Test typed access to a dataset, with conversion policies
+
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_dataset ()
+{
+  cout << "\n[tHDF5Datatype::test_dataset]\n" << endl;
+
+  int nofFailedTests (0);
+  hid_t fileID = H5Fcreate ("tHDF5Datatype.h5",
+			    H5F_ACC_TRUNC,
+			    H5P_DEFAULT,
+			    H5P_DEFAULT);
+  std::vector<hsize_t> shape (1,16);
+  std::vector<int> start (1,0);
+  std::vector<int> block (1,16);
+
+  cout << "[1] Testing complex<float> data ..." << endl;
+  try {
+    std::complex<float> data[16];
+    std::complex<float> buffer[16];
+    for (unsigned int n(0); n<16; ++n) {
+      data[n] = std::complex<float> (n, -float(n));
+    }
+
+    DAL::HDF5Dataset dataset (fileID,
+			      "ComplexFloat",
+			      shape,
+			      HDF5TypeTraits<std::complex<float> >::type());
+    dataset.setConversionPolicy (DAL::HDF5Dataset::RejectConversion);
+
+    if (dataset.requiresConversion<std::complex<float> >()) ++nofFailedTests;
+    if (!dataset.writeData (data, start, block)) ++nofFailedTests;
+    if (!dataset.readData (buffer, start, block)) ++nofFailedTests;
+    if (buffer[15] != data[15]) ++nofFailedTests;
+  } catch (std::string message) {
+    std::cerr << message << endl;
+    ++nofFailedTests;
+  }
+
+  cout << "[2] Testing conversion policies ..." << endl;
+  try {
+    short data[16];
+    double buffer[16];
+    for (unsigned int n(0); n<16; ++n) {
+      data[n] = n;
+    }
+
+    DAL::HDF5Dataset dataset (fileID, "Short", shape, H5T_NATIVE_SHORT);
+    dataset.writeData (data, start, block);
+
+    if (!dataset.requiresConversion<double>()) ++nofFailedTests;
+    /* Conversion is reported, but carried out */
+    if (!dataset.readData (buffer, start, block)) ++nofFailedTests;
+    if (buffer[15] != 15) ++nofFailedTests;
+    /* Conversion is rejected */
+    dataset.setConversionPolicy (DAL::HDF5Dataset::RejectConversion);
+    if (dataset.readData (buffer, start, block)) ++nofFailedTests;
+  } catch (std::string message) {
+    std::cerr << message << endl;
+    ++nofFailedTests;
+  }
+
+  H5Fclose (fileID);
+
+  return nofFailedTests;
+}
+
 //_______________________________________________________________________________
 //                                                                           main
 
@@ -149,5 +301,11 @@ int main ()
   // Test static functions
   nofFailedTests += test_static_functions ();
 
+  // Test mapping of C++ types onto HDF5 datatypes
+  nofFailedTests += test_traits ();
+
+  // Test typed access to a dataset
+  nofFailedTests += test_dataset ();
+
   return nofFailedTests;
 }
@@ -0,0 +1,361 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include <core/HDF5Filter.h>
+#include <core/HDF5Dataset.h>
+#include <core/dalShortArray.h>
+#include <core/dalTable.h>
+
+// Namespace usage
+using std::cerr;
+using std::cout;
+using std::endl;
+using DAL::HDF5Dataset;
+using DAL::HDF5Filter;
+
+/*!
+  \file tHDF5Filter.cc
+
+  \ingroup DAL
+  \ingroup core
+
+  \brief A collection of test routines for the DAL::HDF5Filter class
+
+  \author agent
+
+  \date 2026/10/18
+*/
+
+//_______________________________________________________________________________
+//                                                                 datasetFilter
+
+/*!
+  \brief Get the filter pipeline attached to a dataset
+
+  \param location -- Identifier of the object to which the dataset is attached.
+  \param name     -- Name of the dataset.
+  \return filter  -- Filter pipeline of the dataset.
+*/
+HDF5Filter datasetFilter (hid_t const &location,
+			  std::string const &name)
+{
+  hid_t datasetID = H5Dopen (location, name.c_str(), H5P_DEFAULT);
+  hid_t plistID   = H5Dget_create_plist (datasetID);
+  HDF5Filter filter (plistID);
+
+  H5Pclose (plistID);
+  H5Dclose (datasetID);
+
+  return filter;
+}
+
+//_______________________________________________________________________________
+//                                                              test_constructors
+
+/*!
+  \brief Test constructors for a new HDF5Filter object
+
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_constructors ()
+{
+  cout << "\n[tHDF5Filter::test_constructors]\n" << endl;
+
+  int nofFailedTests (0);
+
+  cout << "[1] Testing default constructor ..." << endl;
+  try {
+    HDF5Filter filter;
+    //
+    filter.summary();
+    if (!filter.empty()) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing construction of a pipeline ..." << endl;
+  try {
+    HDF5Filter filter;
+    filter.addScaleOffset ();
+    filter.addShuffle ();
+    filter.addDeflate (4);
+    filter.addFletcher32 ();
+    //
+    filter.summary();
+    if (filter.nofFilters() != 4) ++nofFailedTests;
+    if (!filter.hasFilter(H5Z_FILTER_DEFLATE)) ++nofFailedTests;
+    if (filter.names()[3] != "fletcher32") ++nofFailedTests;
+    /* Invalid compression level is rejected */
+    if (filter.addDeflate (10)) ++nofFailedTests;
+    if (filter.nofFilters() != 4) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Testing copy constructor ..." << endl;
+  try {
+    HDF5Filter filter = HDF5Filter::shuffleDeflate (2);
+    HDF5Filter other (filter);
+    //
+    other.summary();
+    if (other.nofFilters() != 2) ++nofFailedTests;
+    if (other.filters()[0] != H5Z_FILTER_SHUFFLE) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[4] Testing available(filter) ..." << endl;
+  try {
+    cout << "-- shuffle    = " << HDF5Filter::available (H5Z_FILTER_SHUFFLE)    << endl;
+    cout << "-- deflate    = " << HDF5Filter::available (H5Z_FILTER_DEFLATE)    << endl;
+    cout << "-- lz4        = " << HDF5Filter::available (HDF5Filter::LZ4)        << endl;
+    cout << "-- bitshuffle = " << HDF5Filter::available (HDF5Filter::Bitshuffle) << endl;
+    if (!HDF5Filter::available (H5Z_FILTER_SHUFFLE)) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                  test_datasets
+
+/*!
+  \brief Test creation of compressed datasets via HDF5Dataset
+
+  \param fileID          -- Identifier of the file, to which the datasets are
+         attached.
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_datasets (hid_t const &fileID)
+{
+  cout << "\n[tHDF5Filter::test_datasets]\n" << endl;
+
+  int nofFailedTests (0);
+  std::vector<hsize_t> shape (2);
+  std::vector<hsize_t> chunk (2);
+  std::vector<int> start (2,0);
+  std::vector<int> block (2);
+
+  shape[0] = block[0] = 8;
+  shape[1] = block[1] = 4096;
+  chunk[0] = 1;
+  chunk[1] = 4096;
+
+  unsigned int nofDatapoints = shape[0]*shape[1];
+  short *data                = new short [nofDatapoints];
+  short *buffer              = new short [nofDatapoints];
+
+  for (unsigned int n(0); n<nofDatapoints; ++n) {
+    data[n] = short(n%97) - 48;
+  }
+
+  cout << "[1] Testing shuffle+deflate on short data ..." << endl;
+  try {
+    HDF5Dataset dataset;
+    dataset.setFilter (HDF5Filter::shuffleDeflate (4));
+    dataset.open (fileID, "ShuffleDeflate", shape, chunk, H5T_NATIVE_SHORT);
+    dataset.writeData (data, start, block);
+    dataset.readData (buffer, start, block);
+
+    for (unsigned int n(0); n<nofDatapoints; ++n) {
+      if (buffer[n] != data[n]) {
+	++nofFailedTests;
+	break;
+      }
+    }
+
+    hsize_t storage = H5Dget_storage_size (dataset.objectID());
+    cout << "-- Raw data [Bytes] = " << nofDatapoints*sizeof(short) << endl;
+    cout << "-- Stored   [Bytes] = " << storage << endl;
+    if (storage >= nofDatapoints*sizeof(short)) ++nofFailedTests;
+
+    HDF5Filter filter = datasetFilter (fileID, "ShuffleDeflate");
+    filter.summary();
+    if (!filter.hasFilter(H5Z_FILTER_SHUFFLE)) ++nofFailedTests;
+    if (!filter.hasFilter(H5Z_FILTER_DEFLATE)) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing scaleoffset+fletcher32 on short data ..." << endl;
+  try {
+    HDF5Filter filter;
+    filter.addScaleOffset (H5Z_SO_INT);
+    filter.addFletcher32 ();
+
+    HDF5Dataset dataset;
+    dataset.setFilter (filter);
+    dataset.open (fileID, "ScaleOffset", shape, chunk, H5T_NATIVE_SHORT);
+    dataset.writeData (data, start, block);
+    dataset.readData (buffer, start, block);
+
+    for (unsigned int n(0); n<nofDatapoints; ++n) {
+      if (buffer[n] != data[n]) {
+	++nofFailedTests;
+	break;
+      }
+    }
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Testing pipeline retrieved when opening dataset ..." << endl;
+  try {
+    HDF5Dataset dataset (fileID, "ScaleOffset");
+    HDF5Filter filter = dataset.filter();
+    //
+    dataset.summary();
+    if (!filter.hasFilter(H5Z_FILTER_SCALEOFFSET)) ++nofFailedTests;
+    if (!filter.hasFilter(H5Z_FILTER_FLETCHER32))  ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[4] Testing optional dynamically loaded filter ..." << endl;
+  try {
+    HDF5Filter filter;
+    filter.addBitshuffle (true);
+    filter.addLZ4 ();
+
+    HDF5Dataset dataset;
+    dataset.setFilter (filter);
+    dataset.open (fileID, "Bitshuffle", shape, chunk, H5T_NATIVE_SHORT);
+    dataset.writeData (data, start, block);
+    dataset.readData (buffer, start, block);
+
+    if (buffer[nofDatapoints-1] != data[nofDatapoints-1]) ++nofFailedTests;
+
+    /* Unavailable filters have been skipped */
+    filter = datasetFilter (fileID, "Bitshuffle");
+    filter.summary();
+    if (filter.hasFilter(HDF5Filter::LZ4) != HDF5Filter::available(HDF5Filter::LZ4)) {
+      ++nofFailedTests;
+    }
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  delete [] data;
+  delete [] buffer;
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                           test_arrays_tables
+
+/*!
+  \brief Test creation of compressed arrays and tables
+
+  \param fileID          -- Identifier of the file, to which the objects are
+         attached.
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_arrays_tables (hid_t fileID)
+{
+  cout << "\n[tHDF5Filter::test_arrays_tables]\n" << endl;
+
+  int nofFailedTests (0);
+  HDF5Filter filter = HDF5Filter::shuffleDeflate (4);
+
+  cout << "[1] Testing dalShortArray with filter ..." << endl;
+  try {
+    std::vector<int> dims (1,10000);
+    std::vector<int> cdims (1,1000);
+    short *data = new short [dims[0]];
+
+    for (int n(0); n<dims[0]; ++n) {
+      data[n] = short(n%100);
+    }
+
+    DAL::dalShortArray array (fileID, "ShortArray", dims, data, cdims, filter);
+    array.close();
+
+    if (!datasetFilter(fileID,"ShortArray").hasFilter(H5Z_FILTER_DEFLATE)) {
+      ++nofFailedTests;
+    }
+
+    delete [] data;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing dalTable with filter ..." << endl;
+  try {
+    DAL::dalTable table (DAL::dalFileType::HDF5);
+    table.createTable (&fileID, "Table", "/", filter);
+    table.addColumn ("Time", DAL::dal_INT);
+    table.addColumn ("Value", DAL::dal_FLOAT);
+
+    HDF5Filter tableFilter = datasetFilter (fileID, "Table");
+    tableFilter.summary();
+    if (!tableFilter.hasFilter(H5Z_FILTER_DEFLATE)) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                           main
+
+int main ()
+{
+  int nofFailedTests (0);
+  std::string filename ("tHDF5Filter.h5");
+
+  // Test for the constructor(s)
+  nofFailedTests += test_constructors ();
+
+  hid_t fileID = H5Fcreate (filename.c_str(),
+			    H5F_ACC_TRUNC,
+			    H5P_DEFAULT,
+			    H5P_DEFAULT);
+
+  if (H5Iis_valid(fileID)) {
+    // Test creation of compressed datasets
+    nofFailedTests += test_datasets (fileID);
+    // Test creation of compressed arrays and tables
+    nofFailedTests += test_arrays_tables (fileID);
+  } else {
+    cerr << "-- ERROR: Failed to create file " << filename << endl;
+    return -1;
+  }
+
+  H5Fclose (fileID);
+
+  return nofFailedTests;
+}
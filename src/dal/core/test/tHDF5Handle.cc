@@ -0,0 +1,274 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include <core/HDF5Handle.h>
+#include <core/HDF5Dataset.h>
+
+// Namespace usage
+using std::cerr;
+using std::cout;
+using std::endl;
+using DAL::HDF5Attribute;
+using DAL::HDF5Dataset;
+using DAL::HDF5Handle;
+using DAL::HDF5Object;
+
+/*!
+  \file tHDF5Handle.cc
+
+  \ingroup DAL
+  \ingroup core
+
+  \brief A collection of test routines for the DAL::HDF5Handle class
+
+  \author agent
+
+  \date 2026/10/18
+*/
+
+//_______________________________________________________________________________
+//                                                                nofIdentifiers
+
+//! Get the total number of identifiers, both open within files and held by handles
+unsigned int nofIdentifiers ()
+{
+  return HDF5Handle::nofIdentifiers (H5I_DATASET)
+    + HDF5Handle::nofIdentifiers (H5I_ATTR)
+    + HDF5Handle::nofLiveHandles (H5I_DATASPACE)
+    + HDF5Handle::nofLiveHandles (H5I_DATATYPE)
+    + HDF5Handle::nofLiveHandles (H5I_ATTR);
+}
+
+//_______________________________________________________________________________
+//                                                              test_constructors
+
+/*!
+  \brief Test constructors, copying and ownership transfer
+
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_constructors ()
+{
+  cout << "\n[tHDF5Handle::test_constructors]\n" << endl;
+
+  int nofFailedTests (0);
+  hsize_t dims[1] = { 10 };
+
+  cout << "[1] Testing default constructor ..." << endl;
+  try {
+    HDF5Handle handle;
+    //
+    handle.summary();
+    if (handle.isValid())                ++nofFailedTests;
+    if (handle.type() != H5I_BADID)      ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing HDF5Handle(hid_t) ..." << endl;
+  try {
+    {
+      HDF5Handle handle (H5Screate_simple (1, dims, NULL));
+      //
+      handle.summary();
+      if (!handle.isValid())                           ++nofFailedTests;
+      if (handle.type() != H5I_DATASPACE)              ++nofFailedTests;
+      if (HDF5Handle::nofLiveHandles(H5I_DATASPACE) != 1) ++nofFailedTests;
+      HDF5Handle::liveHandlesSummary();
+    }
+    /* The dataspace is closed along with the handle */
+    if (HDF5Handle::nofLiveHandles(H5I_DATASPACE) != 0)      ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Testing HDF5Handle(HDF5Handle) ..." << endl;
+  try {
+    hid_t id;
+    {
+      HDF5Handle handle (H5Screate_simple (1, dims, NULL));
+      id = handle.id();
+      {
+	HDF5Handle other (handle);
+	/* Both handles share the identifier */
+	if (other.id() != id)                               ++nofFailedTests;
+	if (H5Iget_ref(id) != 2)                            ++nofFailedTests;
+	if (HDF5Handle::nofLiveHandles(H5I_DATASPACE) != 2) ++nofFailedTests;
+      }
+      /* Destruction of the copy leaves the identifier intact */
+      if (!handle.isValid())                                ++nofFailedTests;
+      if (H5Iget_ref(id) != 1)                              ++nofFailedTests;
+    }
+    if (H5Iis_valid(id) > 0)                                ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[4] Testing operator= ..." << endl;
+  try {
+    HDF5Handle first (H5Screate_simple (1, dims, NULL));
+    HDF5Handle second (H5Screate_simple (1, dims, NULL));
+    hid_t id = second.id();
+    //
+    second = first;
+    /* The identifier previously held by the second handle is released */
+    if (H5Iis_valid(id) > 0)                              ++nofFailedTests;
+    if (second.id() != first.id())                        ++nofFailedTests;
+    if (HDF5Handle::nofLiveHandles(H5I_DATASPACE) != 2)   ++nofFailedTests;
+    /* Self-assignment */
+    second = second;
+    if (!second.isValid())                                ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[5] Testing release() and reset() ..." << endl;
+  try {
+    HDF5Handle handle (H5Screate_simple (1, dims, NULL));
+    hid_t id = handle.release();
+    //
+    if (handle.isValid())                                 ++nofFailedTests;
+    if (HDF5Handle::nofLiveHandles(H5I_DATASPACE) != 0)   ++nofFailedTests;
+    /* The released identifier is no longer managed by the handle */
+    if (H5Iis_valid(id) <= 0)                             ++nofFailedTests;
+    /* Hand it back and replace it by a datatype */
+    handle.reset (id);
+    handle.reset (H5Tcopy (H5T_NATIVE_INT));
+    if (H5Iis_valid(id) > 0)                              ++nofFailedTests;
+    if (handle.type() != H5I_DATATYPE)                    ++nofFailedTests;
+    if (HDF5Handle::nofLiveHandles(H5I_DATATYPE) != 1)    ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  /* No handles must be left over */
+  if (!HDF5Handle::nofLiveHandles().empty()) {
+    HDF5Handle::liveHandlesSummary();
+    ++nofFailedTests;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                     test_leaks
+
+/*!
+  \brief Check that I/O operations do not leak object identifiers
+
+  \param fileID          -- Identifier of the file, within which the test
+         objects are created.
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_leaks (hid_t const &fileID)
+{
+  cout << "\n[tHDF5Handle::test_leaks]\n" << endl;
+
+  int nofFailedTests (0);
+  unsigned int nofPasses (100);
+  std::vector<hsize_t> shape (2, 16);
+  std::vector<int> start (2, 0);
+  std::vector<int> block (2, 4);
+  std::vector<float> data (16, 1.0);
+
+  cout << "[1] Testing HDF5Dataset::readData / writeData ..." << endl;
+  try {
+    HDF5Dataset dataset (fileID, "Data", shape, H5T_NATIVE_FLOAT);
+    unsigned int before = nofIdentifiers();
+    //
+    for (unsigned int n(0); n<nofPasses; ++n) {
+      if (!dataset.writeData (&data[0], start, block)) ++nofFailedTests;
+      if (!dataset.readData (&data[0], start, block))  ++nofFailedTests;
+    }
+    cout << "-- nof. identifiers before = " << before           << endl;
+    cout << "-- nof. identifiers after  = " << nofIdentifiers() << endl;
+    if (nofIdentifiers() != before) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing HDF5Attribute::read / write ..." << endl;
+  try {
+    std::vector<std::string> names (3, "LOFAR");
+    std::vector<std::string> namesRead;
+    std::vector<double> values (4, 0.5);
+    std::vector<double> valuesRead;
+    unsigned int before = nofIdentifiers();
+    //
+    for (unsigned int n(0); n<nofPasses; ++n) {
+      HDF5Attribute::write (fileID, "NAMES", names);
+      HDF5Attribute::write (fileID, "VALUES", values);
+      HDF5Attribute::read (fileID, "NAMES", namesRead);
+      HDF5Attribute::read (fileID, "VALUES", valuesRead);
+    }
+    /* Failing reads release the identifiers as well */
+    HDF5Attribute::read (fileID, "MISSING", valuesRead);
+    HDF5Object::objectType (fileID, "NAMES");
+    HDF5Object::objectType (fileID, "Data");
+
+    cout << "-- nof. identifiers before = " << before           << endl;
+    cout << "-- nof. identifiers after  = " << nofIdentifiers() << endl;
+    if (nofIdentifiers() != before)                      ++nofFailedTests;
+    if (namesRead.size() != 3 || namesRead[2] != "LOFAR") ++nofFailedTests;
+    if (valuesRead.size() != 4)                          ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                           main
+
+int main ()
+{
+  int nofFailedTests (0);
+  std::string filename ("tHDF5Handle.h5");
+
+  // Test constructors, copying and ownership transfer
+  nofFailedTests += test_constructors ();
+
+  hid_t fileID = H5Fcreate (filename.c_str(),
+			    H5F_ACC_TRUNC,
+			    H5P_DEFAULT,
+			    H5P_DEFAULT);
+
+  if (H5Iis_valid(fileID)) {
+    // Check that I/O operations do not leak object identifiers
+    nofFailedTests += test_leaks (fileID);
+  } else {
+    cerr << "-- ERROR: Failed to create file " << filename << endl;
+    return -1;
+  }
+
+  H5Fclose (fileID);
+
+  return nofFailedTests;
+}
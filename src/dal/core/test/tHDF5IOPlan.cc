@@ -0,0 +1,313 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include <core/HDF5IOPlan.h>
+
+#include <sys/time.h>
+
+// Namespace usage
+using std::cerr;
+using std::cout;
+using std::endl;
+using DAL::HDF5Dataset;
+using DAL::HDF5IOPlan;
+
+/*!
+  \file tHDF5IOPlan.cc
+
+  \ingroup DAL
+  \ingroup core
+
+  \brief A collection of test routines for the DAL::HDF5IOPlan class
+
+  \author agent
+
+  \date 2026/10/18
+*/
+
+//_______________________________________________________________________________
+//                                                                       seconds
+
+//! Get the current wall-clock time in seconds
+double seconds ()
+{
+  struct timeval tv;
+  gettimeofday (&tv, NULL);
+  return tv.tv_sec + 1e-6*tv.tv_usec;
+}
+
+//_______________________________________________________________________________
+//                                                              test_constructors
+
+/*!
+  \brief Test constructors for a new HDF5IOPlan object
+
+  \param fileID          -- Identifier of the file, to which the datasets are
+         attached.
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_constructors (hid_t const &fileID)
+{
+  cout << "\n[tHDF5IOPlan::test_constructors]\n" << endl;
+
+  int nofFailedTests (0);
+  std::vector<hsize_t> shape (2);
+  std::vector<hsize_t> block (2);
+
+  shape[0] = 16;
+  shape[1] = 128;
+  block[0] = 1;
+  block[1] = 128;
+
+  HDF5Dataset dataset (fileID, "Spectrum", shape, H5T_NATIVE_FLOAT);
+
+  cout << "[1] Testing default constructor ..." << endl;
+  try {
+    HDF5IOPlan plan;
+    //
+    plan.summary();
+    if (plan.isValid()) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing HDF5IOPlan(HDF5Dataset,vector<hsize_t>,hid_t) ..." << endl;
+  try {
+    HDF5IOPlan plan (dataset, block, H5T_NATIVE_FLOAT);
+    //
+    plan.summary();
+    if (!plan.isValid())              ++nofFailedTests;
+    if (plan.rank() != 2)             ++nofFailedTests;
+    if (plan.nofDatapoints() != 128)  ++nofFailedTests;
+    if (plan.shape() != shape)        ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Testing rejection of block with mismatching rank ..." << endl;
+  try {
+    HDF5IOPlan plan (dataset.objectID(),
+		     std::vector<hsize_t>(1,128),
+		     H5T_NATIVE_FLOAT);
+    //
+    if (plan.isValid()) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[4] Testing copy constructor ..." << endl;
+  try {
+    HDF5IOPlan plan (dataset, block, H5T_NATIVE_FLOAT);
+    HDF5IOPlan other (plan);
+    //
+    other.summary();
+    if (!other.isValid())          ++nofFailedTests;
+    if (other.block() != block)    ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                  test_readWrite
+
+/*!
+  \brief Test streaming read/write of blocks through a prepared plan
+
+  \param fileID          -- Identifier of the file, to which the datasets are
+         attached.
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_readWrite (hid_t const &fileID)
+{
+  cout << "\n[tHDF5IOPlan::test_readWrite]\n" << endl;
+
+  int nofFailedTests (0);
+  hsize_t nofBlocks (256);
+  std::vector<hsize_t> shape (1,1024);
+  std::vector<hsize_t> chunk (1,1024);
+  std::vector<hsize_t> block (1,1024);
+  short buffer[1024];
+  short data[1024];
+
+  cout << "[1] Testing writeBlock() extending the dataset ..." << endl;
+  try {
+    HDF5Dataset dataset (fileID, "Timeseries", shape, chunk, H5T_NATIVE_SHORT);
+    HDF5IOPlan plan (dataset, block, H5T_NATIVE_SHORT);
+
+    for (hsize_t n(0); n<nofBlocks; ++n) {
+      for (unsigned int k(0); k<1024; ++k) {
+	data[k] = short((n*1024+k)%2048) - 1024;
+      }
+      if (!plan.writeBlock (data, n)) {
+	++nofFailedTests;
+	break;
+      }
+    }
+
+    plan.summary();
+    if (plan.shape()[0] != nofBlocks*1024) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing readBlock() ..." << endl;
+  try {
+    HDF5Dataset dataset (fileID, "Timeseries");
+    HDF5IOPlan plan (dataset, block, H5T_NATIVE_SHORT);
+
+    for (hsize_t n(0); n<nofBlocks; ++n) {
+      plan.readBlock (buffer, n);
+      for (unsigned int k(0); k<1024; ++k) {
+	if (buffer[k] != short((n*1024+k)%2048) - 1024) {
+	  ++nofFailedTests;
+	  break;
+	}
+      }
+    }
+
+    /* Reading beyond the end of the dataset is rejected */
+    if (plan.readBlock (buffer, nofBlocks)) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Testing read() at arbitrary offset ..." << endl;
+  try {
+    HDF5Dataset dataset (fileID, "Timeseries");
+    HDF5IOPlan plan (dataset, std::vector<hsize_t>(1,100), H5T_NATIVE_INT);
+    std::vector<hsize_t> start (1,1500);
+    int values[100];
+
+    /* Read with conversion from short to int */
+    plan.read (values, start);
+    if (values[0]  != 1500-1024) ++nofFailedTests;
+    if (values[99] != 1599-1024) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[4] Comparing timing against HDF5Dataset::readData ..." << endl;
+  try {
+    HDF5Dataset dataset (fileID, "Timeseries");
+    HDF5IOPlan plan (dataset, block, H5T_NATIVE_SHORT);
+    std::vector<int> start (1,0);
+    std::vector<int> count (1,1024);
+    double t0, t1, t2;
+    unsigned int nofPasses (20);
+
+    t0 = seconds();
+    for (unsigned int pass(0); pass<nofPasses; ++pass) {
+      for (hsize_t n(0); n<nofBlocks; ++n) {
+	start[0] = n*1024;
+	dataset.readData (buffer, start, count);
+      }
+    }
+    t1 = seconds();
+    for (unsigned int pass(0); pass<nofPasses; ++pass) {
+      for (hsize_t n(0); n<nofBlocks; ++n) {
+	plan.readBlock (data, n);
+      }
+    }
+    t2 = seconds();
+
+    cout << "-- nof. reads               = " << nofPasses*nofBlocks << endl;
+    cout << "-- HDF5Dataset::readData [s] = " << t1-t0 << endl;
+    cout << "-- HDF5IOPlan::readBlock [s] = " << t2-t1 << endl;
+
+    for (unsigned int k(0); k<1024; ++k) {
+      if (buffer[k] != data[k]) {
+	++nofFailedTests;
+	break;
+      }
+    }
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[5] Testing two plans writing to the same dataset ..." << endl;
+  try {
+    HDF5Dataset dataset (fileID, "Shared", shape, chunk, H5T_NATIVE_SHORT);
+    HDF5IOPlan first (dataset, block, H5T_NATIVE_SHORT);
+    HDF5IOPlan second (dataset, block, H5T_NATIVE_SHORT);
+
+    for (unsigned int k(0); k<1024; ++k) {
+      data[k] = 1;
+    }
+    /* The first plan grows the dataset to 4 blocks ... */
+    if (!first.writeBlock (data, 3)) ++nofFailedTests;
+    /* ... which the second one must neither shrink nor ignore */
+    for (unsigned int k(0); k<1024; ++k) {
+      data[k] = 2;
+    }
+    if (!second.writeBlock (data, 1))  ++nofFailedTests;
+    if (second.shape()[0] != 4*1024)   ++nofFailedTests;
+    if (!second.readBlock (buffer, 3)) ++nofFailedTests;
+    if (buffer[0] != 1)                ++nofFailedTests;
+    if (!first.readBlock (buffer, 1))  ++nofFailedTests;
+    if (buffer[1023] != 2)             ++nofFailedTests;
+    if (first.shape()[0] != 4*1024)    ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                           main
+
+int main ()
+{
+  int nofFailedTests (0);
+  std::string filename ("tHDF5IOPlan.h5");
+
+  hid_t fileID = H5Fcreate (filename.c_str(),
+			    H5F_ACC_TRUNC,
+			    H5P_DEFAULT,
+			    H5P_DEFAULT);
+
+  if (H5Iis_valid(fileID)) {
+    // Test for the constructor(s)
+    nofFailedTests += test_constructors (fileID);
+    // Test streaming read/write of blocks
+    nofFailedTests += test_readWrite (fileID);
+  } else {
+    cerr << "-- ERROR: Failed to create file " << filename << endl;
+    return -1;
+  }
+
+  H5Fclose (fileID);
+
+  return nofFailedTests;
+}
@@ -0,0 +1,143 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include <core/HDF5Lock.h>
+
+#include <iostream>
+#include <vector>
+#include <pthread.h>
+
+// Namespace usage
+using std::cerr;
+using std::cout;
+using std::endl;
+using DAL::HDF5Lock;
+
+/*!
+  \file tHDF5Lock.cc
+
+  \ingroup DAL
+  \ingroup core
+
+  \brief A collection of test routines for the DAL::HDF5Lock class
+
+  \author agent
+
+  \date 2026/10/18
+*/
+
+//! Number of threads competing for the lock
+const unsigned int nofThreads    = 4;
+//! Number of times each of the threads acquires the lock
+const unsigned int nofIterations = 10000;
+
+//! Counter modified by the threads, holding the lock
+unsigned long counter = 0;
+//! Number of times a thread found another one inside the locked section
+unsigned long collisions = 0;
+//! Is a thread inside the locked section?
+volatile bool inside = false;
+
+//_______________________________________________________________________________
+//                                                                     increment
+
+//! Increment the counter, holding the (recursively acquired) lock
+void * increment (void *)
+{
+  for (unsigned int n(0); n<nofIterations; ++n) {
+    HDF5Lock lock;
+    if (inside) ++collisions;
+    inside = true;
+    {
+      HDF5Lock nested;
+      ++counter;
+    }
+    inside = false;
+  }
+
+  return NULL;
+}
+
+//_______________________________________________________________________________
+//                                                                     test_lock
+
+/*!
+  \brief Test acquiring and releasing the lock
+
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_lock ()
+{
+  cout << "\n[tHDF5Lock::test_lock]\n" << endl;
+
+  int nofFailedTests (0);
+
+  cout << "[1] Testing recursive locking within a thread ..." << endl;
+  try {
+    HDF5Lock outer;
+    HDF5Lock::lock ();
+    {
+      HDF5Lock inner;
+    }
+    HDF5Lock::unlock ();
+    /* Still holding the outer lock, HDF5 calls may be made */
+    if (H5Tget_size (H5T_NATIVE_INT) != sizeof(int)) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing mutual exclusion of threads ..." << endl;
+  try {
+    std::vector<pthread_t> threads (nofThreads);
+
+    for (unsigned int n(0); n<nofThreads; ++n) {
+      pthread_create (&threads[n], NULL, increment, NULL);
+    }
+    for (unsigned int n(0); n<nofThreads; ++n) {
+      pthread_join (threads[n], NULL);
+    }
+
+    cout << "-- counter    = " << counter    << endl;
+    cout << "-- collisions = " << collisions << endl;
+
+    if (counter != nofThreads*nofIterations) ++nofFailedTests;
+    if (collisions != 0)                     ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                           main
+
+int main ()
+{
+  int nofFailedTests (0);
+
+  // Test acquiring and releasing the lock
+  nofFailedTests += test_lock ();
+
+  return nofFailedTests;
+}
@@ -19,9 +19,12 @@
  ***************************************************************************/
 
 #include <core/HDF5Property.h>
+#include <core/HDF5Object.h>
 
 // Namespace usage
+using DAL::HDF5Object;
 using DAL::HDF5Property;
+using DAL::IO_Mode;
 
 /*!
   \file tHDF5Property.cc
@@ -56,11 +59,143 @@ int test_constructors ()
     HDF5Property newObject;
     //
     newObject.summary(); 
+    if (newObject.fileCreationList() != H5P_DEFAULT) ++nofFailedTests;
+    if (newObject.fileAccessList() != H5P_DEFAULT)   ++nofFailedTests;
   } catch (std::string message) {
     std::cerr << message << std::endl;
     nofFailedTests++;
   }
   
+  std::cout << "[2] Testing copy constructor ..." << std::endl;
+  try {
+    HDF5Property prop;
+    prop.setFileSpaceStrategy (HDF5Property::PagedAggregation);
+    prop.setAlignment (4096, 1024);
+    //
+    HDF5Property other (prop);
+    other.summary(); 
+    if (other.fileSpaceStrategy() != HDF5Property::PagedAggregation) ++nofFailedTests;
+    if (other.alignment() != 4096)          ++nofFailedTests;
+    if (other.alignmentThreshold() != 1024) ++nofFailedTests;
+  } catch (std::string message) {
+    std::cerr << message << std::endl;
+    nofFailedTests++;
+  }
+  
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                           test_propertyLists
+
+/*!
+  \brief Test creation of the file-creation and file-access property lists
+
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_propertyLists ()
+{
+  std::cout << "\n[tHDF5Property::test_propertyLists]\n" << std::endl;
+
+  int nofFailedTests (0);
+  HDF5Property prop;
+
+  prop.setFileSpaceStrategy (HDF5Property::PagedAggregation);
+  prop.setPageSize (65536);
+  prop.setPageBufferSize (1048576);
+  prop.setAlignment (4096, 2048);
+  prop.setMetadataCacheSize (4194304);
+  prop.setLatestFormat (true);
+  
+  std::cout << "[1] Testing fileCreationList() ..." << std::endl;
+  try {
+    hid_t fcpl = prop.fileCreationList();
+    H5F_fspace_strategy_t strategy;
+    hbool_t persist;
+    hsize_t threshold;
+    hsize_t pageSize;
+
+    H5Pget_file_space_strategy (fcpl, &strategy, &persist, &threshold);
+    H5Pget_file_space_page_size (fcpl, &pageSize);
+
+    if (strategy != H5F_FSPACE_STRATEGY_PAGE) ++nofFailedTests;
+    if (pageSize != 65536)                    ++nofFailedTests;
+
+    HDF5Property::close (fcpl);
+  } catch (std::string message) {
+    std::cerr << message << std::endl;
+    nofFailedTests++;
+  }
+
+  std::cout << "[2] Testing fileAccessList() ..." << std::endl;
+  try {
+    hid_t fapl = prop.fileAccessList(IO_Mode(IO_Mode::Create|IO_Mode::InMemory));
+    hsize_t threshold;
+    hsize_t alignment;
+    H5F_libver_t low;
+    H5F_libver_t high;
+    H5AC_cache_config_t config;
+    config.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+
+    H5Pget_alignment (fapl, &threshold, &alignment);
+    H5Pget_libver_bounds (fapl, &low, &high);
+    H5Pget_mdc_config (fapl, &config);
+
+    if (alignment != 4096)                 ++nofFailedTests;
+    if (threshold != 2048)                 ++nofFailedTests;
+    if (low != H5F_LIBVER_LATEST)          ++nofFailedTests;
+    if (config.initial_size != 4194304)    ++nofFailedTests;
+    if (H5Pget_driver(fapl) != H5FD_CORE)  ++nofFailedTests;
+
+    HDF5Property::close (fapl);
+  } catch (std::string message) {
+    std::cerr << message << std::endl;
+    nofFailedTests++;
+  }
+
+  std::cout << "[3] Testing creation of file with paged aggregation ..." << std::endl;
+  try {
+    std::string filename ("tHDF5Property.h5");
+    std::vector<hsize_t> shape (1,10000);
+    std::vector<int> data (10000,1);
+    haddr_t offset;
+
+    hid_t fileID = HDF5Object::openFile (filename,
+					 IO_Mode(IO_Mode::Create),
+					 prop);
+    if (!H5Iis_valid(fileID)) ++nofFailedTests;
+    /* Contiguous dataset, larger than the alignment threshold */
+    hid_t spaceID   = H5Screate_simple (1, &shape[0], NULL);
+    hid_t datasetID = H5Dcreate (fileID, "Data", H5T_NATIVE_INT, spaceID,
+				 H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    H5Dwrite (datasetID, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &data[0]);
+    offset = H5Dget_offset (datasetID);
+    H5Dclose (datasetID);
+    H5Sclose (spaceID);
+    H5Fclose (fileID);
+
+    std::cout << "-- Offset of dataset = " << offset << std::endl;
+    if (offset%4096 != 0) ++nofFailedTests;
+
+    /* Re-open with page buffer */
+    fileID = HDF5Object::openFile (filename, IO_Mode(IO_Mode::Open), prop);
+    if (!H5Iis_valid(fileID)) ++nofFailedTests;
+    if (!H5Lexists (fileID, "Data", H5P_DEFAULT)) ++nofFailedTests;
+
+    hid_t fcpl = H5Fget_create_plist (fileID);
+    H5F_fspace_strategy_t strategy;
+    hbool_t persist;
+    hsize_t threshold;
+    H5Pget_file_space_strategy (fcpl, &strategy, &persist, &threshold);
+    if (strategy != H5F_FSPACE_STRATEGY_PAGE) ++nofFailedTests;
+    H5Pclose (fcpl);
+    H5Fclose (fileID);
+  } catch (std::string message) {
+    std::cerr << message << std::endl;
+    nofFailedTests++;
+  }
+
   return nofFailedTests;
 }
 
@@ -73,6 +208,8 @@ int main ()
 
   // Test for the constructor(s)
   nofFailedTests += test_constructors ();
+  // Test creation of property lists
+  nofFailedTests += test_propertyLists ();
 
   return nofFailedTests;
 }
@@ -19,8 +19,14 @@
  ***************************************************************************/
 
 #include <core/IO_Mode.h>
+#include <core/HDF5Dataset.h>
+
+#include <cstdio>
+#include <fstream>
 
 // Namespace usage
+using DAL::HDF5Dataset;
+using DAL::HDF5Object;
 using DAL::IO_Mode;
 
 /*!
@@ -154,6 +160,129 @@ int test_constructors ()
   return nofFailedTests;
 }
 
+//_______________________________________________________________________________
+//                                                                  test_inMemory
+
+//! Check if a file of the given name exists on disk
+bool fileExists (std::string const &filename)
+{
+  std::ifstream infile (filename.c_str(), std::ifstream::in);
+  return infile.is_open();
+}
+
+/*!
+  \brief Test in-memory files (core file driver) and file images
+
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_inMemory ()
+{
+  std::cout << "\n[tIO_Mode::test_inMemory]\n" << std::endl;
+
+  int nofFailedTests (0);
+  std::string filename ("tIO_Mode.h5");
+  std::vector<hsize_t> shape (1,1000);
+  std::vector<char> image;
+  std::vector<int> data (1000);
+  hid_t fileID;
+
+  for (unsigned int n(0); n<data.size(); ++n) {
+    data[n] = n;
+  }
+
+  std::remove (filename.c_str());
+
+  std::cout << "[1] Testing file access property list ..." << std::endl;
+  try {
+    IO_Mode mode (IO_Mode::Create|IO_Mode::InMemory);
+    mode.setIncrement (65536);
+    mode.summary();
+
+    hid_t fapl = mode.fileAccessList();
+    if (H5Pget_driver(fapl) != H5FD_CORE) ++nofFailedTests;
+    H5Pclose (fapl);
+
+    IO_Mode copy (mode);
+    if (copy.increment() != 65536) ++nofFailedTests;
+    if (copy.backingStore())       ++nofFailedTests;
+
+    IO_Mode other (IO_Mode::Create);
+    if (other.fileAccessList() != H5P_DEFAULT) ++nofFailedTests;
+  } catch (std::string message) {
+    std::cerr << message << std::endl;
+    nofFailedTests++;
+  }
+
+  std::cout << "[2] Testing file without backing store ..." << std::endl;
+  try {
+    fileID = HDF5Object::openFile (filename,
+				   IO_Mode(IO_Mode::Create|IO_Mode::InMemory));
+    if (!H5Iis_valid(fileID)) ++nofFailedTests;
+    {
+      HDF5Dataset dataset (fileID, "Data", shape, H5T_NATIVE_INT);
+      dataset.writeData (&data[0], std::vector<int>(1,0), std::vector<int>(1,1000));
+    }
+    /* Export the image of the file */
+    if (!HDF5Object::fileImage (image, fileID)) ++nofFailedTests;
+    H5Fclose (fileID);
+
+    std::cout << "-- Image size [Bytes] = " << image.size() << std::endl;
+    if (image.empty())          ++nofFailedTests;
+    if (fileExists (filename))  ++nofFailedTests;
+  } catch (std::string message) {
+    std::cerr << message << std::endl;
+    nofFailedTests++;
+  }
+
+  std::cout << "[3] Testing opening a file image ..." << std::endl;
+  try {
+    std::vector<int> buffer (1000);
+
+    fileID = HDF5Object::openFileImage (image, IO_Mode(IO_Mode::ReadWrite));
+    if (!H5Iis_valid(fileID)) ++nofFailedTests;
+    {
+      HDF5Dataset dataset (fileID, "Data");
+      dataset.readData (&buffer[0], std::vector<int>(1,0), std::vector<int>(1,1000));
+      if (buffer != data) ++nofFailedTests;
+    }
+    /* A second image is a separate file */
+    hid_t otherID = HDF5Object::openFileImage (image);
+    if (!H5Iis_valid(otherID)) ++nofFailedTests;
+    if (otherID == fileID)     ++nofFailedTests;
+    H5Fclose (otherID);
+    H5Fclose (fileID);
+  } catch (std::string message) {
+    std::cerr << message << std::endl;
+    nofFailedTests++;
+  }
+
+  std::cout << "[4] Testing file with backing store ..." << std::endl;
+  try {
+    IO_Mode mode (IO_Mode::Create|IO_Mode::InMemory);
+    mode.setBackingStore (true);
+
+    fileID = HDF5Object::openFile (filename, mode);
+    {
+      HDF5Dataset dataset (fileID, "Data", shape, H5T_NATIVE_INT);
+      dataset.writeData (&data[0], std::vector<int>(1,0), std::vector<int>(1,1000));
+    }
+    H5Fclose (fileID);
+
+    if (!fileExists (filename)) ++nofFailedTests;
+
+    /* Re-open from disk */
+    fileID = HDF5Object::openFile (filename, IO_Mode(IO_Mode::Open));
+    if (!H5Lexists (fileID, "Data", H5P_DEFAULT)) ++nofFailedTests;
+    H5Fclose (fileID);
+  } catch (std::string message) {
+    std::cerr << message << std::endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
 //_______________________________________________________________________________
 //                                                                           main
 
@@ -173,5 +302,8 @@ int main ()
   // Test for the constructor(s)
   nofFailedTests += test_constructors ();
 
+  // Test for in-memory files
+  nofFailedTests += test_inMemory ();
+
   return nofFailedTests;
 }
@@ -0,0 +1,282 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include <core/dalColumnReader.h>
+#include <core/dalTableAppender.h>
+
+// Namespace usage
+using std::cerr;
+using std::cout;
+using std::endl;
+using DAL::dalColumnReader;
+using DAL::dalTable;
+using DAL::dalTableAppender;
+
+/*!
+  \file tdalColumnReader.cc
+
+  \ingroup DAL
+  \ingroup core
+
+  \brief A collection of test routines for the DAL::dalColumnReader class
+
+  \author agent
+
+  \date 2026/10/18
+*/
+
+//! Layout of the rows of the test table
+struct Row {
+  //! Column "Time"
+  int time;
+  //! Column "Flux"
+  float flux;
+  //! Column "Phase"
+  double phase;
+};
+
+//! Number of rows in the test table
+const int nofRows = 10000;
+
+//_______________________________________________________________________________
+//                                                                   createTable
+
+//! Create and fill a table with columns "Time", "Flux" and "Phase"
+void createTable (hid_t &fileID)
+{
+  dalTable table (DAL::dalFileType::HDF5);
+  table.createTable (&fileID, "Table", "/");
+  table.addColumn ("Time", DAL::dal_INT);
+  table.addColumn ("Flux", DAL::dal_FLOAT);
+  table.addColumn ("Phase", DAL::dal_DOUBLE);
+
+  dalTableAppender appender (table, 1000);
+  Row row;
+
+  for (int n(0); n<nofRows; ++n) {
+    row.time  = n;
+    row.flux  = 0.5*n;
+    row.phase = 0.25*n;
+    appender.append (&row);
+  }
+}
+
+//_______________________________________________________________________________
+//                                                             test_constructors
+
+/*!
+  \brief Test the various constructors for an object of this type
+
+  \param fileID          -- Identifier of the file containing the test table.
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_constructors (hid_t &fileID)
+{
+  cout << "\n[tdalColumnReader::test_constructors]\n" << endl;
+
+  int nofFailedTests (0);
+  std::vector<std::string> columns;
+  columns.push_back ("Phase");
+  columns.push_back ("Time");
+
+  cout << "[1] Testing dalColumnReader() ..." << endl;
+  try {
+    dalColumnReader reader;
+    reader.summary();
+    if (reader.isValid()) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing dalColumnReader(hid_t,string,vector<string>,hsize_t) ..." << endl;
+  try {
+    dalColumnReader reader (fileID, "Table", columns, 1000);
+    reader.summary();
+    if (!reader.isValid())                       ++nofFailedTests;
+    if (reader.nofRows() != hsize_t(nofRows))    ++nofFailedTests;
+    if (reader.rowSize() != sizeof(double)+sizeof(int)) ++nofFailedTests;
+    if (reader.offset(1) != sizeof(double))      ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Testing dalColumnReader(dalTable,vector<string>,hsize_t) ..." << endl;
+  try {
+    dalTable table (DAL::dalFileType::HDF5);
+    table.openTable (&fileID, "Table", "/");
+    dalColumnReader reader (table, columns);
+    reader.summary();
+    if (!reader.isValid()) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[4] Testing selection of non-existing column ..." << endl;
+  try {
+    columns.push_back ("Missing");
+    dalColumnReader reader (fileID, "Table", columns);
+    if (reader.isValid()) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                     test_read
+
+/*!
+  \brief Test reading of selected columns in batches
+
+  \param fileID          -- Identifier of the file containing the test table.
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_read (hid_t &fileID)
+{
+  cout << "\n[tdalColumnReader::test_read]\n" << endl;
+
+  int nofFailedTests (0);
+  hsize_t batchSize (768);
+  std::vector<std::string> columns;
+  columns.push_back ("Phase");
+  columns.push_back ("Time");
+
+  cout << "[1] Testing next(void*) with packed rows ..." << endl;
+  try {
+    dalColumnReader reader (fileID, "Table", columns, batchSize);
+    std::vector<char> buffer (batchSize*reader.rowSize());
+    hsize_t nofRead;
+    hsize_t row (0);
+    unsigned int nofBatches (0);
+
+    while ((nofRead = reader.next (&buffer[0]))) {
+      for (hsize_t n(0); n<nofRead; ++n, ++row) {
+	char *rec = &buffer[n*reader.rowSize()];
+	double phase = *reinterpret_cast<double *>(rec+reader.offset(0));
+	int time     = *reinterpret_cast<int *>(rec+reader.offset(1));
+	if (time != int(row) || phase != 0.25*row) {
+	  ++nofFailedTests;
+	}
+      }
+      ++nofBatches;
+    }
+
+    cout << "-- nof. rows read = " << row << " in " << nofBatches << " batches" << endl;
+    if (row != hsize_t(nofRows))  ++nofFailedTests;
+    if (nofBatches != 14)         ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing next(vector<void*>) over a range of rows ..." << endl;
+  try {
+    dalColumnReader reader (fileID, "Table", columns, batchSize);
+    std::vector<double> phase (batchSize);
+    std::vector<int> time (batchSize);
+    std::vector<void *> buffers;
+    buffers.push_back (&phase[0]);
+    buffers.push_back (&time[0]);
+    hsize_t nofRead;
+    hsize_t row (1000);
+
+    reader.setRange (1000, 2500);
+
+    while ((nofRead = reader.next (buffers))) {
+      for (hsize_t n(0); n<nofRead; ++n, ++row) {
+	if (time[n] != int(row) || phase[n] != 0.25*row) {
+	  ++nofFailedTests;
+	}
+      }
+    }
+
+    cout << "-- last row read = " << row-1 << endl;
+    if (row != 3500) ++nofFailedTests;
+
+    /* A range reaching beyond the table is clipped */
+    reader.setRange (9900, 1000);
+    if (reader.end() != hsize_t(nofRows)) ++nofFailedTests;
+    if (reader.next (buffers) != 100)     ++nofFailedTests;
+    if (time[99] != nofRows-1)            ++nofFailedTests;
+    if (reader.next (buffers) != 0)       ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Testing read(vector<void*>,hsize_t,hsize_t) ..." << endl;
+  try {
+    std::vector<std::string> flux (1, "Flux");
+    dalColumnReader reader (fileID, "Table", flux, batchSize);
+    std::vector<float> data (nofRows);
+    std::vector<void *> buffers (1, &data[0]);
+
+    if (!reader.read (buffers, 0, nofRows)) ++nofFailedTests;
+    for (int n(0); n<nofRows; ++n) {
+      if (data[n] != float(0.5*n)) {
+	++nofFailedTests;
+	break;
+      }
+    }
+    /* Reading beyond the end of the table fails */
+    if (reader.read (buffers, nofRows-10, 20)) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                           main
+
+int main ()
+{
+  int nofFailedTests (0);
+  std::string filename ("tdalColumnReader.h5");
+
+  hid_t fileID = H5Fcreate (filename.c_str(),
+			    H5F_ACC_TRUNC,
+			    H5P_DEFAULT,
+			    H5P_DEFAULT);
+
+  if (H5Iis_valid(fileID)) {
+    createTable (fileID);
+    // Test for the constructor(s)
+    nofFailedTests += test_constructors (fileID);
+    // Test reading of selected columns
+    nofFailedTests += test_read (fileID);
+  } else {
+    cerr << "-- ERROR: Failed to create file " << filename << endl;
+    return -1;
+  }
+
+  H5Fclose (fileID);
+
+  return nofFailedTests;
+}
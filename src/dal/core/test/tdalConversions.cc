@@ -227,6 +227,94 @@ int test_convertVector ()
   return nofFailedTests;
 }
 
+//_______________________________________________________________________________
+//                                                            test_convertSamples
+
+/*!
+  \brief Test conversion of raw 16-bit samples to floating point values
+
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_convertSamples ()
+{
+  cout << "\n[tdalConversions::test_convertSamples]\n" << endl;
+
+  int nofFailedTests (0);
+  /* Not a multiple of 8, such that the scalar tail is exercised as well */
+  size_t nelem (101);
+  std::vector<short> samples (nelem);
+
+  for (size_t n(0); n<nelem; ++n) {
+    samples[n] = (n%2) ? -short(n*300) : short(n*300);
+  }
+  samples[0] = -32768;
+  samples[1] = 32767;
+
+  cout << "[1] Testing convertSamples(float*,short*,size_t,float) ..." << endl;
+  try {
+    std::vector<float> out (nelem);
+
+    DAL::convertSamples (&out[0], &samples[0], nelem);
+    for (size_t n(0); n<nelem; ++n) {
+      if (out[n] != float(samples[n])) {
+	++nofFailedTests;
+	break;
+      }
+    }
+
+    DAL::convertSamples (&out[0], &samples[0], nelem, 0.5f);
+    for (size_t n(0); n<nelem; ++n) {
+      if (out[n] != 0.5f*samples[n]) {
+	++nofFailedTests;
+	break;
+      }
+    }
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing convertSamples(double*,short*,size_t,double) ..." << endl;
+  try {
+    std::vector<double> out (nelem);
+
+    DAL::convertSamples (&out[0], &samples[0], nelem, -2.0);
+    for (size_t n(0); n<nelem; ++n) {
+      if (out[n] != -2.0*samples[n]) {
+	++nofFailedTests;
+	break;
+      }
+    }
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Testing convertSamples with a gain per block ..." << endl;
+  try {
+    std::vector<double> out (100);
+    std::vector<double> gains (2);
+
+    gains[0] = 1.0;
+    gains[1] = 4.0;
+
+    DAL::convertSamples (&out[0], &samples[0], 4, 25, gains);
+    for (size_t n(0); n<out.size(); ++n) {
+      double gain = (n/25 < gains.size()) ? gains[n/25] : 1.0;
+      if (out[n] != gain*samples[n]) {
+	++nofFailedTests;
+	break;
+      }
+    }
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
 //_______________________________________________________________________________
 //                                                                           main
 
@@ -240,6 +328,8 @@ int main ()
   nofFailedTests += test_convertTime ();
   // Test conversion between different types of vectors
   nofFailedTests += test_convertVector ();
+  // Test conversion of raw samples to floating point values
+  nofFailedTests += test_convertSamples ();
 
   return nofFailedTests;
 }
@@ -0,0 +1,269 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include <core/dalDataView.h>
+
+#include <cstdlib>
+#include <sys/time.h>
+
+// Namespace usage
+using std::cerr;
+using std::cout;
+using std::endl;
+using DAL::dalData;
+using DAL::dalDataView;
+
+/*!
+  \file tdalDataView.cc
+
+  \ingroup DAL
+  \ingroup core
+
+  \brief A collection of test routines for the DAL::dalDataView class
+
+  \author agent
+
+  \date 2026/10/18
+*/
+
+//_______________________________________________________________________________
+//                                                                       seconds
+
+//! Get the current wall-clock time in seconds
+double seconds ()
+{
+  struct timeval tv;
+  gettimeofday (&tv, NULL);
+  return tv.tv_sec + 1e-6*tv.tv_usec;
+}
+
+//_______________________________________________________________________________
+//                                                                  createData
+
+//! Create a data object holding a float array of the given shape
+dalData * createData (DAL::dalFileType::Type const &filetype,
+		      std::vector<int> const &shape)
+{
+  long nofElements (1);
+  for (unsigned int n(0); n<shape.size(); ++n) {
+    nofElements *= shape[n];
+  }
+
+  dalData *data = new dalData (filetype, DAL::dal_FLOAT, shape, shape[0]);
+  float *buffer = (float *) malloc (nofElements*sizeof(float));
+  for (long n(0); n<nofElements; ++n) {
+    buffer[n] = n;
+  }
+  data->data = buffer;
+
+  return data;
+}
+
+//_______________________________________________________________________________
+//                                                             test_constructors
+
+/*!
+  \brief Test the various constructors for an object of this type
+
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_constructors ()
+{
+  cout << "\n[tdalDataView::test_constructors]\n" << endl;
+
+  int nofFailedTests (0);
+  std::vector<int> shape (3);
+  shape[0] = 4;
+  shape[1] = 5;
+  shape[2] = 6;
+
+  cout << "[1] Testing dalDataView() ..." << endl;
+  try {
+    dalDataView<float> view;
+    view.summary();
+    if (view.isValid()) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing dalDataView(T*,vector<int>,Order) ..." << endl;
+  try {
+    std::vector<float> buffer (120);
+    dalDataView<float> viewC (&buffer[0], shape);
+    dalDataView<float> viewF (&buffer[0], shape, dalDataView<float>::Fortran);
+    viewC.summary();
+    viewF.summary();
+    if (viewC.stride(0) != 30 || viewC.stride(2) != 1)  ++nofFailedTests;
+    if (viewF.stride(0) != 1 || viewF.stride(2) != 20)  ++nofFailedTests;
+    if (viewC.size() != 120)                            ++nofFailedTests;
+    if (!viewC.isContiguous() || !viewF.isContiguous()) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Testing dalDataView(dalData) ..." << endl;
+  try {
+    dalData *dataHDF5 = createData (DAL::dalFileType::HDF5, shape);
+    dalData *dataCASA = createData (DAL::dalFileType::CASA_MS, shape);
+    dalDataView<float> viewHDF5 (*dataHDF5);
+    dalDataView<float> viewCASA (*dataCASA);
+    viewHDF5.summary();
+    viewCASA.summary();
+    /* Indexing must agree with dalData::get */
+    for (long i(0); i<shape[0]; ++i) {
+      for (long j(0); j<shape[1]; ++j) {
+	for (long k(0); k<shape[2]; ++k) {
+	  if (&viewHDF5(i,j,k) != dataHDF5->get(i,j,k)) ++nofFailedTests;
+	  if (&viewCASA(i,j,k) != dataCASA->get(i,j,k)) ++nofFailedTests;
+	}
+      }
+    }
+    /* Type of the view must match the datatype */
+    dalDataView<int> viewInt (*dataHDF5);
+    if (viewInt.isValid()) ++nofFailedTests;
+    delete dataHDF5;
+    delete dataCASA;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                  test_methods
+
+/*!
+  \brief Test rows and slices
+
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_methods ()
+{
+  cout << "\n[tdalDataView::test_methods]\n" << endl;
+
+  int nofFailedTests (0);
+  std::vector<int> shape (3);
+  shape[0] = 4;
+  shape[1] = 5;
+  shape[2] = 6;
+  std::vector<float> buffer (120);
+
+  for (unsigned int n(0); n<buffer.size(); ++n) {
+    buffer[n] = n;
+  }
+
+  cout << "[1] Testing rowBegin() and rowEnd() ..." << endl;
+  try {
+    dalDataView<float> viewC (&buffer[0], shape);
+    dalDataView<float> viewF (&buffer[0], shape, dalDataView<float>::Fortran);
+    float expected (0);
+    if (viewC.nofRows() != 20 || viewC.rowLength() != 6) ++nofFailedTests;
+    if (viewF.nofRows() != 30 || viewF.rowLength() != 4) ++nofFailedTests;
+    /* Rows traverse the buffer in storage order */
+    for (long row(0); row<viewC.nofRows(); ++row) {
+      for (float *it=viewC.rowBegin(row); it!=viewC.rowEnd(row); ++it) {
+	if (*it != expected++) ++nofFailedTests;
+      }
+    }
+    expected = 0;
+    for (long row(0); row<viewF.nofRows(); ++row) {
+      for (float *it=viewF.rowBegin(row); it!=viewF.rowEnd(row); ++it) {
+	if (*it != expected++) ++nofFailedTests;
+      }
+    }
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing slice() ..." << endl;
+  try {
+    dalDataView<float> view (&buffer[0], shape);
+    dalDataView<float> plane  = view.slice (1, 2);
+    dalDataView<float> column = plane.slice (1, 3);
+    plane.summary();
+    if (plane.rank() != 2 || plane.shape(1) != 6) ++nofFailedTests;
+    if (plane.isContiguous())                     ++nofFailedTests;
+    if (column.rank() != 1 || column.shape(0) != 4) ++nofFailedTests;
+    for (long i(0); i<4; ++i) {
+      if (column(i) != view(i,2,3)) ++nofFailedTests;
+    }
+    /* Writing through the view */
+    column(1) = -1;
+    if (buffer[1*30+2*6+3] != -1) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Comparing access time against dalData::get ..." << endl;
+  try {
+    std::vector<int> shapeData (2);
+    shapeData[0] = 2000;
+    shapeData[1] = 500;
+    dalData *data = createData (DAL::dalFileType::HDF5, shapeData);
+    dalDataView<float> view (*data);
+    double sumGet (0);
+    double sumView (0);
+    double t0 = seconds();
+    for (long i(0); i<shapeData[0]; ++i) {
+      for (long j(0); j<shapeData[1]; ++j) {
+	sumGet += *(float *)data->get(i,j);
+      }
+    }
+    double t1 = seconds();
+    for (long i(0); i<view.shape(0); ++i) {
+      for (long j(0); j<view.shape(1); ++j) {
+	sumView += view(i,j);
+      }
+    }
+    double t2 = seconds();
+    cout << "-- dalData::get     [s] = " << t1-t0 << endl;
+    cout << "-- dalDataView      [s] = " << t2-t1 << endl;
+    if (sumGet != sumView) ++nofFailedTests;
+    delete data;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                           main
+
+int main ()
+{
+  int nofFailedTests (0);
+
+  // Test for the constructor(s)
+  nofFailedTests += test_constructors ();
+  // Test rows and slices
+  nofFailedTests += test_methods ();
+
+  return nofFailedTests;
+}
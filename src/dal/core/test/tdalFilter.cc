@@ -32,6 +32,20 @@
 */
 
 #include <core/dalFilter.h>
+#include <core/dalTableAppender.h>
+
+//! Layout of the rows of the test table
+struct Row {
+  //! Column "TIME"
+  double time;
+  //! Column "ANTENNA1"
+  int antenna;
+  //! Column "DATA"
+  float data;
+};
+
+//! Number of rows in the test table
+const int nofRows = 20000;
 
 //_______________________________________________________________________________
 //                                                              test_constructors
@@ -114,16 +128,135 @@ int test_constructors ()
 /*!
   \brief Test the various public methods
 
+  \param filename       -- Name of the HDF5 file used for testing.
   \return nofFailedTests -- The number of failed tests encountered within this
           function
 */
-int test_methods ()
+int test_methods (std::string const &filename)
 {
   std::cout << "\n[tdalDataset::test_methods]" << std::endl;
   
   int nofFailedTests (0);
   std::string columns ("DATA");
-  
+  hid_t fileID = H5Fcreate (filename.c_str(),
+			    H5F_ACC_TRUNC,
+			    H5P_DEFAULT,
+			    H5P_DEFAULT);
+
+  /* Create a table with columns TIME, ANTENNA1 and DATA */
+  {
+    DAL::dalTable table (DAL::dalFileType::HDF5);
+    table.createTable (&fileID, "Table", "/");
+    table.addColumn ("TIME", DAL::dal_DOUBLE);
+    table.addColumn ("ANTENNA1", DAL::dal_INT);
+    table.addColumn ("DATA", DAL::dal_FLOAT);
+    DAL::dalTableAppender appender (table);
+    Row row;
+    for (int n(0); n<nofRows; ++n) {
+      row.time    = n;
+      row.antenna = n%10;
+      row.data    = 0.5*n;
+      appender.append (&row);
+    }
+  }
+
+  std::cout << "\n[1] Testing parsing of conditions ..." << std::endl;
+  try {
+    DAL::dalFilter filter (DAL::dalFileType::HDF5,
+			   "DATA, TIME",
+			   "TIME >= 1000 AND ANTENNA1=3 and TIME<1.5e3");
+    filter.summary();
+    if (!filter.isSet())                  ++nofFailedTests;
+    if (filter.columns().size() != 2)     ++nofFailedTests;
+    if (filter.nofConditions() != 3)      ++nofFailedTests;
+    if (filter.conditions()[2].op != DAL::dalFilter::Less) ++nofFailedTests;
+    if (filter.conditions()[2].value != 1500)              ++nofFailedTests;
+    /* Invalid conditions */
+    DAL::dalFilter filterOr (DAL::dalFileType::HDF5, "DATA", "TIME > 1 OR TIME < 0");
+    if (filterOr.isSet()) ++nofFailedTests;
+    DAL::dalFilter filterOp (DAL::dalFileType::HDF5, "DATA", "TIME ~ 1");
+    if (filterOp.isSet()) ++nofFailedTests;
+  }
+  catch (std::string& message) {
+    std::cerr << message << std::endl;
+    nofFailedTests++;
+  }
+
+  std::cout << "\n[2] Testing selectRows() ..." << std::endl;
+  try {
+    DAL::dalFilter filter (DAL::dalFileType::HDF5,
+			   columns,
+			   "TIME >= 1000 AND ANTENNA1 = 3 AND TIME < 1500");
+    std::vector<hsize_t> rows;
+    if (!filter.selectRows (fileID, "Table", rows, 333)) ++nofFailedTests;
+    std::cout << "-- nof. selected rows = " << rows.size() << std::endl;
+    if (rows.size() != 50) {
+      ++nofFailedTests;
+    } else {
+      for (unsigned int n(0); n<rows.size(); ++n) {
+	if (rows[n] != 1003+10*n) {
+	  ++nofFailedTests;
+	  break;
+	}
+      }
+    }
+    /* Condition on a missing column */
+    DAL::dalFilter filterMissing (DAL::dalFileType::HDF5, columns, "FLAG = 1");
+    if (filterMissing.selectRows (fileID, "Table", rows)) ++nofFailedTests;
+  }
+  catch (std::string& message) {
+    std::cerr << message << std::endl;
+    nofFailedTests++;
+  }
+
+  std::cout << "\n[3] Testing readRows() ..." << std::endl;
+  try {
+    DAL::dalFilter filter (DAL::dalFileType::HDF5,
+			   "DATA,ANTENNA1",
+			   "TIME > 19990");
+    std::vector<char> data;
+    std::vector<hsize_t> rows;
+    if (!filter.readRows (fileID, "Table", data, rows)) ++nofFailedTests;
+    /* Packed rows of DATA (float) and ANTENNA1 (int) */
+    size_t rowSize = sizeof(float)+sizeof(int);
+    if (rows.size() != 9 || data.size() != 9*rowSize) {
+      ++nofFailedTests;
+    } else {
+      for (unsigned int n(0); n<rows.size(); ++n) {
+	float value;
+	int antenna;
+	memcpy (&value, &data[n*rowSize], sizeof(float));
+	memcpy (&antenna, &data[n*rowSize+sizeof(float)], sizeof(int));
+	if (value != float(0.5*rows[n]) || antenna != int(rows[n]%10)) {
+	  ++nofFailedTests;
+	}
+      }
+    }
+  }
+  catch (std::string& message) {
+    std::cerr << message << std::endl;
+    nofFailedTests++;
+  }
+
+  std::cout << "\n[4] Testing dalTable::selectRows() ..." << std::endl;
+  try {
+    DAL::dalTable table (DAL::dalFileType::HDF5);
+    table.openTable (&fileID, "Table", "/");
+    table.setFilter ("*", "ANTENNA1 != 0");
+    std::vector<char> data;
+    std::vector<hsize_t> rows;
+    if (!table.selectRows (rows))    ++nofFailedTests;
+    if (rows.size() != 18000)        ++nofFailedTests;
+    if (!table.readRows (data, rows)) ++nofFailedTests;
+    if (data.size() != 18000*(sizeof(double)+sizeof(int)+sizeof(float))) ++nofFailedTests;
+  }
+  catch (std::string& message) {
+    std::cerr << message << std::endl;
+    nofFailedTests++;
+  }
+
+  H5Fclose (fileID);
+
   return nofFailedTests;
 }
 
@@ -148,7 +281,7 @@ int main (int argc, char *argv[])
   // Run the tests
 
   nofFailedTests += test_constructors ();
-  nofFailedTests += test_methods ();
+  nofFailedTests += test_methods (filename);
 
   return nofFailedTests;
 }
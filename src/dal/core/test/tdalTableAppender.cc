@@ -0,0 +1,451 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include <core/dalTableAppender.h>
+#include <core/HDF5Lock.h>
+
+#include <algorithm>
+#include <sys/time.h>
+#include <unistd.h>
+
+// Namespace usage
+using std::cerr;
+using std::cout;
+using std::endl;
+using DAL::dalTable;
+using DAL::dalTableAppender;
+using DAL::HDF5Lock;
+
+/*!
+  \file tdalTableAppender.cc
+
+  \ingroup DAL
+  \ingroup core
+
+  \brief A collection of test routines for the DAL::dalTableAppender class
+
+  \author agent
+
+  \date 2026/10/18
+*/
+
+//! Layout of the rows of the test tables
+struct Row {
+  //! Column "Time"
+  int time;
+  //! Column "Value"
+  float value;
+};
+
+//! Number of producer threads in test_threads
+const int nofThreads = 4;
+//! Number of rows appended by each producer thread
+const int nofRowsPerThread = 2500;
+
+//_______________________________________________________________________________
+//                                                                       seconds
+
+//! Get the current wall-clock time in seconds
+double seconds ()
+{
+  struct timeval tv;
+  gettimeofday (&tv, NULL);
+  return tv.tv_sec + 1e-6*tv.tv_usec;
+}
+
+//_______________________________________________________________________________
+//                                                                   createTable
+
+//! Create a table with columns "Time" and "Value"
+void createTable (dalTable &table,
+		  hid_t &fileID,
+		  std::string const &name)
+{
+  table.createTable (&fileID, name, "/");
+  table.addColumn ("Time", DAL::dal_INT);
+  table.addColumn ("Value", DAL::dal_FLOAT);
+}
+
+//_______________________________________________________________________________
+//                                                                      readRows
+
+//! Read back the rows of the table \c name
+std::vector<Row> readRows (hid_t const &fileID,
+			   std::string const &name)
+{
+  hsize_t nofFields (0);
+  hsize_t nofRecords (0);
+  std::vector<Row> rows;
+  std::string path = "//" + name;
+
+  H5TBget_table_info (fileID, path.c_str(), &nofFields, &nofRecords);
+
+  if (nofRecords > 0) {
+    size_t offsets[2] = { HOFFSET(Row,time), HOFFSET(Row,value) };
+    size_t sizes[2]   = { sizeof(int), sizeof(float) };
+    rows.resize (nofRecords);
+    H5TBread_table (fileID, path.c_str(), sizeof(Row), offsets, sizes, &rows[0]);
+  }
+
+  return rows;
+}
+
+//_______________________________________________________________________________
+//                                                                   test_append
+
+/*!
+  \brief Test buffering and writing of rows
+
+  \param fileID          -- Identifier of the file, within which the tables are
+         created.
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_append (hid_t &fileID)
+{
+  cout << "\n[tdalTableAppender::test_append]\n" << endl;
+
+  int nofFailedTests (0);
+
+  cout << "[1] Testing construction ..." << endl;
+  try {
+    dalTable table (DAL::dalFileType::HDF5);
+    createTable (table, fileID, "Construction");
+    //
+    dalTableAppender appender (table, 100);
+    appender.summary();
+    if (appender.recordSize() != sizeof(Row))  ++nofFailedTests;
+    if (appender.capacity() != 100)            ++nofFailedTests;
+    if (appender.nofBuffered() != 0)           ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing append() of single rows ..." << endl;
+  try {
+    dalTable table (DAL::dalFileType::HDF5);
+    createTable (table, fileID, "Single");
+    Row row;
+    {
+      dalTableAppender appender (table, 100);
+      //
+      for (int n(0); n<1050; ++n) {
+	row.time  = n;
+	row.value = 0.5*n;
+	if (!appender.append (&row)) ++nofFailedTests;
+      }
+      appender.summary();
+      if (appender.nofWrites() != 10)     ++nofFailedTests;
+      if (appender.nofBuffered() != 50)   ++nofFailedTests;
+      if (appender.nofWritten() != 1000)  ++nofFailedTests;
+      /* The remaining rows are written by the destructor */
+    }
+    std::vector<Row> rows = readRows (fileID, "Single");
+    cout << "-- nof. rows in table = " << rows.size() << endl;
+    if (rows.size() != 1050) {
+      ++nofFailedTests;
+    } else {
+      for (int n(0); n<1050; ++n) {
+	if (rows[n].time != n || rows[n].value != float(0.5*n)) {
+	  ++nofFailedTests;
+	  break;
+	}
+      }
+    }
+    if (table.nofRecords() != 1050) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Testing append() of blocks of rows ..." << endl;
+  try {
+    dalTable table (DAL::dalFileType::HDF5);
+    createTable (table, fileID, "Blocks");
+    std::vector<Row> block (250);
+    dalTableAppender appender (table, 100);
+    //
+    for (int n(0); n<250; ++n) {
+      block[n].time  = n;
+      block[n].value = n;
+    }
+    /* Partially fills the buffer */
+    appender.append (&block[0], 30);
+    /* Completes the buffer, the remainder is written directly */
+    appender.append (&block[30], 220);
+    if (appender.nofBuffered() != 0)    ++nofFailedTests;
+    if (appender.nofWritten() != 250)   ++nofFailedTests;
+    appender.flush();
+
+    std::vector<Row> rows = readRows (fileID, "Blocks");
+    if (rows.size() != 250 || rows[249].time != 249) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[4] Testing writing on time threshold ..." << endl;
+  try {
+    dalTable table (DAL::dalFileType::HDF5);
+    createTable (table, fileID, "Interval");
+    Row row = { 1, 1.0 };
+    dalTableAppender appender (table, 100, 0.05);
+    //
+    appender.append (&row);
+    if (appender.nofBuffered() != 1)   ++nofFailedTests;
+    usleep (100000);
+    appender.append (&row);
+    /* The interval has passed, hence both rows have been written */
+    if (appender.nofBuffered() != 0)   ++nofFailedTests;
+    if (appender.nofWritten() != 2)    ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                      producer
+
+//! Parameters passed to a producer thread
+struct Producer {
+  //! Appender shared between the threads
+  dalTableAppender *appender;
+  //! Number of the thread
+  int id;
+  //! Number of failed appends
+  int nofFailed;
+};
+
+//! Append rows from within a separate thread
+void * producer (void *arg)
+{
+  Producer *p = static_cast<Producer *>(arg);
+  Row row;
+
+  for (int n(0); n<nofRowsPerThread; ++n) {
+    row.time  = p->id*nofRowsPerThread + n;
+    row.value = p->id;
+    if (!p->appender->append (&row)) {
+      ++p->nofFailed;
+    }
+  }
+
+  return NULL;
+}
+
+//_______________________________________________________________________________
+//                                                                       monitor
+
+//! Parameters passed to the monitor thread
+struct Monitor {
+  //! Identifier of the file holding the table
+  hid_t fileID;
+  //! Set once the producers have finished
+  volatile bool done;
+  //! Number of failed queries
+  int nofFailed;
+};
+
+//! Query the table from within a separate thread, holding the HDF5 lock
+void * monitor (void *arg)
+{
+  Monitor *m = static_cast<Monitor *>(arg);
+  hsize_t nofFields (0);
+  hsize_t nofRecords (0);
+
+  while (!m->done) {
+    {
+      HDF5Lock lock;
+      if (H5TBget_table_info (m->fileID, "//Threads", &nofFields, &nofRecords) < 0) {
+	++m->nofFailed;
+      }
+    }
+    usleep (100);
+  }
+
+  return NULL;
+}
+
+//_______________________________________________________________________________
+//                                                                  test_threads
+
+/*!
+  \brief Test appending rows from multiple threads concurrently
+
+  \param fileID          -- Identifier of the file, within which the tables are
+         created.
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_threads (hid_t &fileID)
+{
+  cout << "\n[tdalTableAppender::test_threads]\n" << endl;
+
+  int nofFailedTests (0);
+
+  try {
+    dalTable table (DAL::dalFileType::HDF5);
+    createTable (table, fileID, "Threads");
+    dalTableAppender appender (table, 512);
+    pthread_t threads[nofThreads];
+    Producer producers[nofThreads];
+    pthread_t monitorThread;
+    Monitor monitorParams;
+
+    /* Another thread accesses the file alongside the producers */
+    monitorParams.fileID    = fileID;
+    monitorParams.done      = false;
+    monitorParams.nofFailed = 0;
+    pthread_create (&monitorThread, NULL, monitor, &monitorParams);
+
+    for (int n(0); n<nofThreads; ++n) {
+      producers[n].appender  = &appender;
+      producers[n].id        = n;
+      producers[n].nofFailed = 0;
+      pthread_create (&threads[n], NULL, producer, &producers[n]);
+    }
+    for (int n(0); n<nofThreads; ++n) {
+      pthread_join (threads[n], NULL);
+      nofFailedTests += producers[n].nofFailed;
+    }
+    appender.flush();
+
+    monitorParams.done = true;
+    pthread_join (monitorThread, NULL);
+    cout << "-- nof. failed queries = " << monitorParams.nofFailed << endl;
+    nofFailedTests += monitorParams.nofFailed;
+
+    /* Each row must have been written exactly once */
+    std::vector<Row> rows = readRows (fileID, "Threads");
+    std::vector<int> times (rows.size());
+    for (unsigned int n(0); n<rows.size(); ++n) {
+      times[n] = rows[n].time;
+    }
+    std::sort (times.begin(), times.end());
+
+    cout << "-- nof. rows in table = " << rows.size() << endl;
+    if (times.size() != (unsigned int)(nofThreads*nofRowsPerThread)) {
+      ++nofFailedTests;
+    } else {
+      for (unsigned int n(0); n<times.size(); ++n) {
+	if (times[n] != int(n)) {
+	  ++nofFailedTests;
+	  break;
+	}
+      }
+    }
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                   test_timing
+
+/*!
+  \brief Compare dalTable::appendRow against the buffered appender
+
+  \param fileID          -- Identifier of the file, within which the tables are
+         created.
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_timing (hid_t &fileID)
+{
+  cout << "\n[tdalTableAppender::test_timing]\n" << endl;
+
+  int nofFailedTests (0);
+  int nofRows (20000);
+  Row row;
+  double t0, t1, t2;
+
+  try {
+    dalTable tableRow (DAL::dalFileType::HDF5);
+    dalTable tableAppender (DAL::dalFileType::HDF5);
+    createTable (tableRow, fileID, "TimingRow");
+    createTable (tableAppender, fileID, "TimingAppender");
+
+    t0 = seconds();
+    for (int n(0); n<nofRows; ++n) {
+      row.time  = n;
+      row.value = n;
+      tableRow.appendRow (&row);
+    }
+    t1 = seconds();
+    {
+      dalTableAppender appender (tableAppender, 4096);
+      for (int n(0); n<nofRows; ++n) {
+	row.time  = n;
+	row.value = n;
+	appender.append (&row);
+      }
+    }
+    t2 = seconds();
+
+    cout << "-- nof. rows                  = " << nofRows << endl;
+    cout << "-- dalTable::appendRow    [s] = " << t1-t0 << endl;
+    cout << "-- dalTableAppender       [s] = " << t2-t1 << endl;
+
+    if (readRows (fileID, "TimingRow").size() != (unsigned int)nofRows)      ++nofFailedTests;
+    if (readRows (fileID, "TimingAppender").size() != (unsigned int)nofRows) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                           main
+
+int main ()
+{
+  int nofFailedTests (0);
+  std::string filename ("tdalTableAppender.h5");
+
+  hid_t fileID = H5Fcreate (filename.c_str(),
+			    H5F_ACC_TRUNC,
+			    H5P_DEFAULT,
+			    H5P_DEFAULT);
+
+  if (H5Iis_valid(fileID)) {
+    // Test buffering and writing of rows
+    nofFailedTests += test_append (fileID);
+    // Test appending rows from multiple threads
+    nofFailedTests += test_threads (fileID);
+    // Compare against dalTable::appendRow
+    nofFailedTests += test_timing (fileID);
+  } else {
+    cerr << "-- ERROR: Failed to create file " << filename << endl;
+    return -1;
+  }
+
+  H5Fclose (fileID);
+
+  return nofFailedTests;
+}
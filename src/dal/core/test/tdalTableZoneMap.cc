@@ -0,0 +1,346 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include <core/dalTableZoneMap.h>
+#include <core/dalTableAppender.h>
+
+// Namespace usage
+using std::cerr;
+using std::cout;
+using std::endl;
+using DAL::dalFilter;
+using DAL::dalTable;
+using DAL::dalTableAppender;
+using DAL::dalTableZoneMap;
+
+/*!
+  \file tdalTableZoneMap.cc
+
+  \ingroup DAL
+  \ingroup core
+
+  \brief A collection of test routines for the DAL::dalTableZoneMap class
+
+  \author agent
+
+  \date 2026/10/18
+*/
+
+//! Layout of the rows of the test tables
+struct Row {
+  //! Column "TIME"
+  double time;
+  //! Column "ANTENNA"
+  int antenna;
+};
+
+//_______________________________________________________________________________
+//                                                                   createTable
+
+//! Create a table with columns "TIME" and "ANTENNA"
+void createTable (dalTable &table,
+		  hid_t &fileID,
+		  std::string const &name)
+{
+  table.createTable (&fileID, name, "/");
+  table.addColumn ("TIME", DAL::dal_DOUBLE);
+  table.addColumn ("ANTENNA", DAL::dal_INT);
+}
+
+//_______________________________________________________________________________
+//                                                                    test_build
+
+/*!
+  \brief Test creating the zone map of an existing table
+
+  \param fileID          -- Identifier of the file, within which the tables are
+         created.
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_build (hid_t &fileID)
+{
+  cout << "\n[tdalTableZoneMap::test_build]\n" << endl;
+
+  int nofFailedTests (0);
+  int nofRows (100000);
+
+  /* Table without zone map */
+  {
+    dalTable table (DAL::dalFileType::HDF5);
+    createTable (table, fileID, "Build");
+    dalTableAppender appender (table);
+    Row row;
+    for (int n(0); n<nofRows; ++n) {
+      row.time    = n;
+      row.antenna = n%7;
+      appender.append (&row);
+    }
+  }
+
+  cout << "[1] Testing dalTableZoneMap(hid_t,string,hsize_t) ..." << endl;
+  try {
+    if (dalTableZoneMap::exists (fileID, "Build")) ++nofFailedTests;
+    dalTableZoneMap zoneMap (fileID, "Build", 1000);
+    zoneMap.summary();
+    if (!zoneMap.isValid())           ++nofFailedTests;
+    if (zoneMap.columns().size() != 2) ++nofFailedTests;
+    if (zoneMap.nofZones() != 0)      ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing build() ..." << endl;
+  try {
+    dalTableZoneMap zoneMap (fileID, "Build", 1000);
+    if (!zoneMap.build (4096))         ++nofFailedTests;
+    zoneMap.summary();
+    if (zoneMap.nofZones() != 100)     ++nofFailedTests;
+    if (zoneMap.nofRows() != hsize_t(nofRows)) ++nofFailedTests;
+    if (zoneMap.nofRows(5) != 1000)    ++nofFailedTests;
+    if (zoneMap.min(5,0) != 5000)      ++nofFailedTests;
+    if (zoneMap.max(5,0) != 5999)      ++nofFailedTests;
+    if (zoneMap.min(5,1) != 0)         ++nofFailedTests;
+    if (zoneMap.max(5,1) != 6)         ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Testing reading the zone map back from file ..." << endl;
+  try {
+    if (!dalTableZoneMap::exists (fileID, "Build")) ++nofFailedTests;
+    /* The zone size is taken from the file */
+    dalTableZoneMap zoneMap (fileID, "Build", 10);
+    zoneMap.summary();
+    if (zoneMap.zoneSize() != 1000)    ++nofFailedTests;
+    if (zoneMap.nofZones() != 100)     ++nofFailedTests;
+    if (zoneMap.max(99,0) != nofRows-1) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[4] Testing candidates() ..." << endl;
+  try {
+    dalTableZoneMap zoneMap (fileID, "Build");
+    dalFilter filter (DAL::dalFileType::HDF5, "TIME", "TIME >= 20500 AND TIME < 22000");
+    std::vector<std::pair<hsize_t,hsize_t> > ranges;
+    zoneMap.candidates (filter.conditions(), nofRows, ranges);
+    if (ranges.size() != 1
+	|| ranges[0].first != 20000
+	|| ranges[0].second != 22000) {
+      ++nofFailedTests;
+    }
+    /* A condition on the antenna cannot exclude any of the zones */
+    filter.setFilter ("TIME", "ANTENNA = 3");
+    zoneMap.candidates (filter.conditions(), nofRows, ranges);
+    if (ranges.size() != 1 || ranges[0].second != hsize_t(nofRows)) ++nofFailedTests;
+    /* Nor can rows not described by the zone map */
+    filter.setFilter ("TIME", "TIME < 0");
+    zoneMap.candidates (filter.conditions(), nofRows+10, ranges);
+    if (ranges.size() != 1
+	|| ranges[0].first != hsize_t(nofRows)
+	|| ranges[0].second != hsize_t(nofRows+10)) {
+      ++nofFailedTests;
+    }
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                   test_update
+
+/*!
+  \brief Test updating the zone map while appending rows, and its use by filters
+
+  \param fileID          -- Identifier of the file, within which the tables are
+         created.
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_update (hid_t &fileID)
+{
+  cout << "\n[tdalTableZoneMap::test_update]\n" << endl;
+
+  int nofFailedTests (0);
+  int nofRows (50000);
+  dalTable table (DAL::dalFileType::HDF5);
+  Row row;
+
+  createTable (table, fileID, "Update");
+
+  cout << "[1] Testing dalTableAppender::enableZoneMap() ..." << endl;
+  try {
+    dalTableAppender appender (table, 777);
+    if (!appender.enableZoneMap (1000)) ++nofFailedTests;
+    if (!appender.hasZoneMap())         ++nofFailedTests;
+    for (int n(0); n<nofRows; ++n) {
+      row.time    = n;
+      row.antenna = n%7;
+      appender.append (&row);
+    }
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing zone map written by the appender ..." << endl;
+  try {
+    dalTableZoneMap zoneMap (fileID, "Update");
+    zoneMap.summary();
+    if (zoneMap.nofZones() != 50)            ++nofFailedTests;
+    if (zoneMap.nofRows() != hsize_t(nofRows)) ++nofFailedTests;
+    for (hsize_t zone(1); zone<zoneMap.nofZones(); ++zone) {
+      if (zoneMap.nofRows(zone) != 1000
+	  || zoneMap.min(zone,0) != 1000.0*zone
+	  || zoneMap.max(zone,0) != 1000.0*zone+999) {
+	++nofFailedTests;
+	break;
+      }
+    }
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Testing filter making use of the zone map ..." << endl;
+  try {
+    dalFilter filter (DAL::dalFileType::HDF5, "TIME", "TIME >= 20000 AND TIME < 21500");
+    std::vector<hsize_t> rows;
+    filter.selectRows (fileID, "Update", rows);
+    cout << "-- nof. selected rows = " << rows.size() << endl;
+    cout << "-- nof. scanned rows  = " << filter.nofScannedRows() << endl;
+    if (rows.size() != 1500 || rows[0] != 20000) ++nofFailedTests;
+    if (filter.nofScannedRows() != 2000)         ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[4] Testing rows appended without updating the zone map ..." << endl;
+  try {
+    for (int n(nofRows); n<nofRows+100; ++n) {
+      row.time    = n;
+      row.antenna = n%7;
+      table.appendRow (&row);
+    }
+    dalFilter filter (DAL::dalFileType::HDF5, "TIME", "TIME >= 50050");
+    std::vector<hsize_t> rows;
+    filter.selectRows (fileID, "Update", rows);
+    cout << "-- nof. selected rows = " << rows.size() << endl;
+    cout << "-- nof. scanned rows  = " << filter.nofScannedRows() << endl;
+    if (rows.size() != 50)               ++nofFailedTests;
+    if (filter.nofScannedRows() != 100)  ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[5] Testing appender catching up with rows appended outside ..." << endl;
+  try {
+    int n (nofRows+100);
+    dalTableAppender appender (table, 10);
+    if (!appender.enableZoneMap ()) ++nofFailedTests;
+    for (int k(0); k<10; ++k, ++n) {
+      row.time    = n;
+      row.antenna = n%7;
+      if (!appender.append (&row)) ++nofFailedTests;
+    }
+    for (int k(0); k<5; ++k, ++n) {
+      row.time    = n;
+      row.antenna = n%7;
+      table.appendRow (&row);
+    }
+    for (int k(0); k<10; ++k, ++n) {
+      row.time    = n;
+      row.antenna = n%7;
+      if (!appender.append (&row)) ++nofFailedTests;
+    }
+    dalTableZoneMap zoneMap (fileID, "Update");
+    hsize_t last = zoneMap.nofZones()-1;
+    cout << "-- nof. rows covered  = " << zoneMap.nofRows() << endl;
+    if (zoneMap.nofRows() != hsize_t(n))           ++nofFailedTests;
+    if (zoneMap.nofRows(last) != hsize_t(n)%1000)  ++nofFailedTests;
+    if (zoneMap.max(last,0) != n-1)                ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[6] Testing rows overwritten by dalTable::writeDataByColNum ..." << endl;
+  try {
+    std::vector<double> times (10, -5.0);
+    table.writeDataByColNum (&times[0], 0, 20000, times.size());
+    dalTableZoneMap zoneMap (fileID, "Update");
+    cout << "-- Range of zone 20   = [" << zoneMap.min(20,0)
+	 << "," << zoneMap.max(20,0) << "]" << endl;
+    if (zoneMap.min(20,0) != -5.0 || zoneMap.max(20,0) != 20999) ++nofFailedTests;
+    dalFilter filter (DAL::dalFileType::HDF5, "TIME", "TIME < 0");
+    std::vector<hsize_t> rows;
+    filter.selectRows (fileID, "Update", rows);
+    if (rows.size() != 10 || rows[0] != 20000) ++nofFailedTests;
+    /* Restoring the values narrows the range of the zone again */
+    for (unsigned int k(0); k<times.size(); ++k) {
+      times[k] = 20000+k;
+    }
+    table.writeDataByColNum (&times[0], 0, 20000, times.size());
+    zoneMap.open (fileID, "Update");
+    if (zoneMap.min(20,0) != 20000.0 || zoneMap.max(20,0) != 20999) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                           main
+
+int main ()
+{
+  int nofFailedTests (0);
+  std::string filename ("tdalTableZoneMap.h5");
+
+  hid_t fileID = H5Fcreate (filename.c_str(),
+			    H5F_ACC_TRUNC,
+			    H5P_DEFAULT,
+			    H5P_DEFAULT);
+
+  if (H5Iis_valid(fileID)) {
+    // Test creating the zone map of an existing table
+    nofFailedTests += test_build (fileID);
+    // Test updating the zone map while appending rows
+    nofFailedTests += test_update (fileID);
+  } else {
+    cerr << "-- ERROR: Failed to create file " << filename << endl;
+    return -1;
+  }
+
+  H5Fclose (fileID);
+
+  return nofFailedTests;
+}
@@ -442,51 +442,53 @@ namespace DAL { // Namespace DAL -- begin
   bool CommonAttributes::h5read (hid_t const &location)
   {
     bool status (true);
+    /* Load all attributes attached to the group in a single pass */
+    HDF5AttributeCache attributes (location);
 
-    HDF5Attribute::read (location, "GROUPTYPE",      itsGroupType );
-    HDF5Attribute::read (location, "FILENAME",       itsFilename );
-    HDF5Attribute::read (location, "FILETYPE",       itsFiletype );
-    HDF5Attribute::read (location, "FILEDATE",       itsFiledate );
-    HDF5Attribute::read (location, "TELESCOPE",      itsTelescope );
-    HDF5Attribute::read (location, "OBSERVER",       itsObserver );
+    attributes.get ("GROUPTYPE",      itsGroupType );
+    attributes.get ("FILENAME",       itsFilename );
+    attributes.get ("FILETYPE",       itsFiletype );
+    attributes.get ("FILEDATE",       itsFiledate );
+    attributes.get ("TELESCOPE",      itsTelescope );
+    attributes.get ("OBSERVER",       itsObserver );
     /*________________________________________________________________
       Common LOFAR attributes for description of project 
     */
-    HDF5Attribute::read (location, "PROJECT_ID",      itsProjectID );
-    HDF5Attribute::read (location, "PROJECT_TITLE",   itsProjectTitle );
-    HDF5Attribute::read (location, "PROJECT_PI",      itsProjectPI );
-    HDF5Attribute::read (location, "PROJECT_CO_I",    itsProjectCoI );
-    HDF5Attribute::read (location, "PROJECT_CONTACT", itsProjectContact );
+    attributes.get ("PROJECT_ID",      itsProjectID );
+    attributes.get ("PROJECT_TITLE",   itsProjectTitle );
+    attributes.get ("PROJECT_PI",      itsProjectPI );
+    attributes.get ("PROJECT_CO_I",    itsProjectCoI );
+    attributes.get ("PROJECT_CONTACT", itsProjectContact );
     /*________________________________________________________________
       Common LOFAR attributes for description of observation
     */
-    HDF5Attribute::read (location, "OBSERVATION_ID",               itsObservationID);
-    HDF5Attribute::read (location, "OBSERVATION_START_MJD",        itsStartMJD);
-    HDF5Attribute::read (location, "OBSERVATION_START_TAI",        itsStartTAI);
-    HDF5Attribute::read (location, "OBSERVATION_START_UTC",        itsStartUTC);
-    HDF5Attribute::read (location, "OBSERVATION_END_MJD",          itsEndMJD);
-    HDF5Attribute::read (location, "OBSERVATION_END_TAI",          itsEndTAI);
-    HDF5Attribute::read (location, "OBSERVATION_END_UTC",          itsEndUTC);
-    HDF5Attribute::read (location, "OBSERVATION_NOF_STATIONS",     itsNofStations);
-    HDF5Attribute::read (location, "OBSERVATION_STATIONS_LIST",    itsStationsList);
-    HDF5Attribute::read (location, "OBSERVATION_FREQUENCY_MIN",    itsFrequencyMin);
-    HDF5Attribute::read (location, "OBSERVATION_FREQUENCY_MAX",    itsFrequencyMax);
-    HDF5Attribute::read (location, "OBSERVATION_FREQUENCY_CENTER", itsFrequencyCenter);
-    HDF5Attribute::read (location, "OBSERVATION_FREQUENCY_UNIT",   itsFrequencyUnit);
-    HDF5Attribute::read (location, "OBSERVATION_NOF_BITS_PER_SAMPLE", itsNofBitsPerSample);
+    attributes.get ("OBSERVATION_ID",               itsObservationID);
+    attributes.get ("OBSERVATION_START_MJD",        itsStartMJD);
+    attributes.get ("OBSERVATION_START_TAI",        itsStartTAI);
+    attributes.get ("OBSERVATION_START_UTC",        itsStartUTC);
+    attributes.get ("OBSERVATION_END_MJD",          itsEndMJD);
+    attributes.get ("OBSERVATION_END_TAI",          itsEndTAI);
+    attributes.get ("OBSERVATION_END_UTC",          itsEndUTC);
+    attributes.get ("OBSERVATION_NOF_STATIONS",     itsNofStations);
+    attributes.get ("OBSERVATION_STATIONS_LIST",    itsStationsList);
+    attributes.get ("OBSERVATION_FREQUENCY_MIN",    itsFrequencyMin);
+    attributes.get ("OBSERVATION_FREQUENCY_MAX",    itsFrequencyMax);
+    attributes.get ("OBSERVATION_FREQUENCY_CENTER", itsFrequencyCenter);
+    attributes.get ("OBSERVATION_FREQUENCY_UNIT",   itsFrequencyUnit);
+    attributes.get ("OBSERVATION_NOF_BITS_PER_SAMPLE", itsNofBitsPerSample);
     /*________________________________________________________________
      */
-    HDF5Attribute::read (location, "ANTENNA_SET",           itsAntennaSet );
-    HDF5Attribute::read (location, "FILTER_SELECTION",      itsFilterSelection );
-    HDF5Attribute::read (location, "CLOCK_FREQUENCY",       itsClockFrequency );
-    HDF5Attribute::read (location, "CLOCK_FREQUENCY_UNIT",  itsClockFrequencyUnit );
-    HDF5Attribute::read (location, "TARGET",                itsTarget );
-    HDF5Attribute::read (location, "SYSTEM_VERSION",        itsSystemVersion );
-    HDF5Attribute::read (location, "PIPELINE_NAME",         itsPipelineName );
-    HDF5Attribute::read (location, "PIPELINE_VERSION",      itsPipelineVersion );
-    HDF5Attribute::read (location, "ICD_NUMBER",            itsIcdNumber       );
-    HDF5Attribute::read (location, "ICD_VERSION",           itsIcdVersion      );
-    HDF5Attribute::read (location, "NOTES",                 itsNotes           );
+    attributes.get ("ANTENNA_SET",           itsAntennaSet );
+    attributes.get ("FILTER_SELECTION",      itsFilterSelection );
+    attributes.get ("CLOCK_FREQUENCY",       itsClockFrequency );
+    attributes.get ("CLOCK_FREQUENCY_UNIT",  itsClockFrequencyUnit );
+    attributes.get ("TARGET",                itsTarget );
+    attributes.get ("SYSTEM_VERSION",        itsSystemVersion );
+    attributes.get ("PIPELINE_NAME",         itsPipelineName );
+    attributes.get ("PIPELINE_VERSION",      itsPipelineVersion );
+    attributes.get ("ICD_NUMBER",            itsIcdNumber       );
+    attributes.get ("ICD_VERSION",           itsIcdVersion      );
+    attributes.get ("NOTES",                 itsNotes           );
 
     return status;
   }
@@ -31,6 +31,7 @@
 // DAL header files
 #include <core/dalCommon.h>
 #include <core/HDF5Attribute.h>
+#include <core/HDF5AttributeCache.h>
 #include <data_common/Filename.h>
 
 namespace DAL { // Namespace DAL -- begin
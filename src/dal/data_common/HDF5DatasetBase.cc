@@ -116,6 +116,7 @@ namespace DAL { // Namespace DAL -- begin
   HDF5DatasetBase& HDF5DatasetBase::operator= (HDF5DatasetBase const &other)
   {
     if (this != &other) {
+      HDF5Dataset::operator= (other);
       destroy ();
       copy (other);
     }
@@ -22,6 +22,13 @@
 
 namespace DAL { // Namespace DAL -- begin
 
+  /*!
+    Embedded objects (sub-array pointings, beams, Stokes datasets) are opened
+    on first access; beyond this number the least recently used ones are
+    closed again (see HDF5HandleCache). A value of 0 disables the limit.
+  */
+  unsigned int HDF5GroupBase::itsHandleLimit = 64;
+
   // ============================================================================
   //
   //  Destruction
@@ -70,9 +77,25 @@ namespace DAL { // Namespace DAL -- begin
     location_p   = other.location_p;
     attributes_p = other.attributes_p;
     itsGroupType = other.itsGroupType;
+    // Share the attribute cache, such that writes through one object are
+    // seen by the other one
+    ++other.itsAttributeCache->nofReferences;
+    releaseAttributeCache ();
+    itsAttributeCache = other.itsAttributeCache;
     // Book-keeping
     incrementRefCount ();
   }
+
+  //_____________________________________________________________________________
+  //                                                        releaseAttributeCache
+
+  void HDF5GroupBase::releaseAttributeCache ()
+  {
+    if (itsAttributeCache != 0 && --itsAttributeCache->nofReferences == 0) {
+      delete itsAttributeCache;
+    }
+    itsAttributeCache = 0;
+  }
   
   // ============================================================================
   //
@@ -33,9 +33,11 @@
 // DAL header files
 #include <core/dalCommon.h>
 #include <core/HDF5Attribute.h>
+#include <core/HDF5AttributeCache.h>
 #include <core/HDF5Object.h>
 #include <core/IO_Mode.h>
 #include <data_common/CommonAttributes.h>
+#include <data_common/HDF5HandleCache.h>
 
 namespace DAL { // Namespace DAL -- begin
   
@@ -76,6 +78,15 @@ namespace DAL { // Namespace DAL -- begin
     std::set<std::string> attributes_p;
     \endcode
 
+    The values of the attributes are kept in an HDF5AttributeCache, which is
+    shared between an object and its copies: an attribute written through
+    setAttribute() is re-read by all objects referring to the same structure.
+
+    Structures embedded within the current one are not opened right away by
+    openEmbedded(), but kept in an HDF5HandleCache: their names are enumerated
+    and they are opened on first access, keeping at most handleLimit() of them
+    open at a time.
+
     <h3>Requirements for derived classes</h3>
 
     The HDF5GroupBase requires derived classes to implement the following
@@ -197,6 +208,17 @@ namespace DAL { // Namespace DAL -- begin
     std::string itsGroupType;
     //! I/O mode flags
     IO_Mode itsFlags;
+    //! Attribute cache shared between an object and its copies
+    struct SharedAttributeCache {
+      //! Values of the attributes, loaded on first access
+      HDF5AttributeCache cache;
+      //! Number of objects referring to the cache
+      unsigned int nofReferences;
+    };
+    //! Values of the attributes attached to the structure, loaded on first access
+    SharedAttributeCache *itsAttributeCache;
+    //! Maximum number of embedded objects kept open per structure
+    static unsigned int itsHandleLimit;
 
     /* === Protected functions which define basic interface === */
 
@@ -219,7 +241,16 @@ namespace DAL { // Namespace DAL -- begin
 
     //! Argumented constructor
     HDF5GroupBase (IO_Mode const &flags=IO_Mode()) {
-      itsFlags = flags;
+      itsFlags          = flags;
+      itsAttributeCache = new SharedAttributeCache;
+      itsAttributeCache->nofReferences = 1;
+    }
+
+    //! Copy constructor, sharing the identifier and attribute cache of the other object
+    HDF5GroupBase (HDF5GroupBase const &other) {
+      itsFlags          = other.itsFlags;
+      itsAttributeCache = 0;
+      copy (other);
     }
     
     // === Destruction ==========================================================
@@ -228,6 +259,7 @@ namespace DAL { // Namespace DAL -- begin
     virtual ~HDF5GroupBase () {
       attributes_p.clear();
       destroy();
+      releaseAttributeCache();
     };
 
     // === Operators ============================================================
@@ -283,6 +315,16 @@ namespace DAL { // Namespace DAL -- begin
     //! Provide a summary of the internal status
     void summary (std::ostream &os);    
 
+    //! Get the maximum number of embedded objects kept open per structure
+    static inline unsigned int handleLimit () {
+      return itsHandleLimit;
+    }
+
+    //! Set the maximum number of embedded objects kept open per structure
+    static inline void setHandleLimit (unsigned int const &limit) {
+      itsHandleLimit = limit;
+    }
+
     // === Public methods =======================================================
 
     //! Verify the ID so it can be passed into an H5I C function.
@@ -335,7 +377,11 @@ namespace DAL { // Namespace DAL -- begin
 	if (location_p > 0) {
 	  /* Check if the attribute name is valid */
 	  if (haveAttribute(name)) {
-	    /* Forward the function call to perform the actual retrieval */
+	    /* Serve the value from the attribute cache, if possible ... */
+	    if (itsAttributeCache->cache.read (location_p, name, val)) {
+	      return true;
+	    }
+	    /* ... otherwise forward the function call to perform the actual retrieval */
 	    return HDF5Attribute::read (location_p,
 					 name,
 					 val);
@@ -370,7 +416,11 @@ namespace DAL { // Namespace DAL -- begin
 	if (location_p > 0) {
 	  /* Check if the attribute name is valid */
 	  if (haveAttribute(name)) {
-	    /* Forward the function call to perform the actual retrieval */
+	    /* Serve the values from the attribute cache, if possible ... */
+	    if (itsAttributeCache->cache.read (location_p, name, val)) {
+	      return true;
+	    }
+	    /* ... otherwise forward the function call to perform the actual retrieval */
 	    return HDF5Attribute::read(location_p,
 					name,
 					val);
@@ -438,6 +488,7 @@ namespace DAL { // Namespace DAL -- begin
       inline bool setAttribute (std::string const &name,
 				T const &val)
       {
+	itsAttributeCache->cache.invalidate (name);
 	return HDF5Attribute::write (location_p,
 					    name,
 					    val);
@@ -456,6 +507,7 @@ namespace DAL { // Namespace DAL -- begin
       inline bool setAttribute (std::string const &name,
 				std::vector<T> const &val)
       {
+	itsAttributeCache->cache.invalidate (name);
 	return HDF5Attribute::write (location_p,
 				     name,
 				     &val[0],
@@ -476,6 +528,7 @@ namespace DAL { // Namespace DAL -- begin
       inline bool setAttribute (std::string const &name,
 				casa::Vector<T> const &val)
       {
+	itsAttributeCache->cache.invalidate (name);
 	return HDF5Attribute::write (location_p,
 				     name,
 				     val);
@@ -501,6 +554,9 @@ namespace DAL { // Namespace DAL -- begin
     //! Increment the reference count for a HDF5 object
     void incrementRefCount ();
 
+    //! Drop the reference to the attribute cache, deleting it if unused
+    void releaseAttributeCache ();
+
     //! Unconditional copying
     void copy (HDF5GroupBase const &other);
     
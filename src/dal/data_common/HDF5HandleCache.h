@@ -0,0 +1,301 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#ifndef HDF5HANDLECACHE_H
+#define HDF5HANDLECACHE_H
+
+// Standard library header files
+#include <iostream>
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+
+// DAL header files
+#include <core/dalCommon.h>
+
+namespace DAL { // Namespace DAL -- begin
+
+  /*!
+    \class HDF5HandleCache
+
+    \ingroup DAL
+    \ingroup data_common
+
+    \brief Open the objects embedded within a group on first access
+
+    \author agent
+
+    \date 2026/10/18
+
+    \test tHDF5HandleCache.cc
+
+    <h3>Prerequisite</h3>
+
+    <ul type="square">
+      <li>DAL::HDF5GroupBase
+    </ul>
+
+    <h3>Synopsis</h3>
+
+    When opening a group, the high-level classes (e.g. BF_RootGroup) used to
+    open all groups and datasets below it right away, such that the time to
+    open a file grows with the total number of objects in it -- even if only a
+    single beam is going to be accessed. An HDF5HandleCache instead only
+    enumerates the names of the embedded objects (see enumerate()); an object
+    is opened the first time it is requested through find().
+
+    The number of objects kept open is bounded by limit(): once exceeded, the
+    least recently used object is dropped from the cache, which releases its
+    HDF5 handle (and the handles of the objects below it); it is re-opened
+    transparently upon the next request. A limit of 0 disables the bound.
+
+    The template parameter \c T is the class representing the embedded objects;
+    it must provide a default constructor, a copy constructor and an
+    argumented constructor <tt>T (hid_t const &location, std::string const
+    &name)</tt> which opens the object \c name attached to \c location.
+
+    <b>Note:</b> a pointer returned by find() or insert() remains valid until
+    the object is evicted, i.e. until the next call opening another object;
+    keep a copy of the object rather than the pointer for longer use.
+
+    <h3>Example(s)</h3>
+
+    <ol>
+      <li>Enumerate the beam groups within a sub-array pointing group, keeping
+      at most 16 of them open at any time:
+      \code
+      DAL::HDF5HandleCache<BF_BeamGroup> beams;
+
+      beams.enumerate (location_p, H5G_GROUP, 16);
+      \endcode
+      <li>Access a beam group, opening it if required:
+      \code
+      BF_BeamGroup *beam = beams.find ("Beam000");
+
+      if (beam != NULL) {
+        beam->summary();
+      }
+      \endcode
+    </ol>
+  */
+  template <class T> class HDF5HandleCache {
+
+    //! Identifier of the group to which the objects are attached
+    hid_t itsLocation;
+    //! Maximum number of objects kept open; 0 for no limit
+    unsigned int itsLimit;
+    //! Names of the embedded objects
+    std::set<std::string> itsNames;
+    //! Objects which currently are open
+    std::map<std::string,T> itsObjects;
+    //! Names of the open objects, most recently used first
+    std::list<std::string> itsUsage;
+
+  public:
+
+    // === Construction =========================================================
+
+    //! Default constructor
+    HDF5HandleCache (unsigned int const &limit=0)
+      : itsLocation (0),
+      itsLimit (limit)
+      {
+      }
+
+    // === Parameter access =====================================================
+
+    //! Identifier of the group to which the objects are attached
+    inline hid_t location () const {
+      return itsLocation;
+    }
+
+    //! Maximum number of objects kept open; 0 for no limit
+    inline unsigned int limit () const {
+      return itsLimit;
+    }
+
+    //! Set the maximum number of objects kept open; 0 for no limit
+    inline void setLimit (unsigned int const &limit) {
+      itsLimit = limit;
+      evict ();
+    }
+
+    //! Names of the embedded objects
+    inline std::set<std::string> names () const {
+      return itsNames;
+    }
+
+    //! Number of embedded objects, whether open or not
+    inline unsigned int size () const {
+      return itsNames.size();
+    }
+
+    //! Number of objects which currently are open
+    inline unsigned int nofOpen () const {
+      return itsObjects.size();
+    }
+
+    //! Is there an embedded object \c name?
+    inline bool contains (std::string const &name) const {
+      return itsNames.find(name) != itsNames.end();
+    }
+
+    //! Is the embedded object \c name currently open?
+    inline bool isOpen (std::string const &name) const {
+      return itsObjects.find(name) != itsObjects.end();
+    }
+
+    /*!
+      \brief Get the name of the class
+      \return className -- The name of the class, HDF5HandleCache.
+    */
+    inline std::string className () const {
+      return "HDF5HandleCache";
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    inline void summary () {
+      summary (std::cout);
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    void summary (std::ostream &os)
+    {
+      os << "[HDF5HandleCache] Summary of internal parameters." << std::endl;
+      os << "-- Location ID        = " << itsLocation     << std::endl;
+      os << "-- Limit              = " << itsLimit        << std::endl;
+      os << "-- nof. objects       = " << itsNames.size() << std::endl;
+      os << "-- nof. open objects  = " << itsObjects.size() << std::endl;
+      os << "-- Names of objects   = " << itsNames        << std::endl;
+    }
+
+    // === Methods ==============================================================
+
+    /*!
+      \brief Enumerate the objects attached to \c location, without opening them
+      \param location -- Identifier of the group to which the objects are
+             attached.
+      \param type     -- Type of the objects, e.g. \c H5G_GROUP or
+             \c H5G_DATASET.
+      \param limit    -- Maximum number of objects kept open; 0 for no limit.
+      \return status  -- Returns \e false if the names could not be retrieved.
+    */
+    bool enumerate (hid_t const &location,
+		    H5G_obj_t const &type,
+		    unsigned int const &limit=0)
+    {
+      clear ();
+
+      itsLocation = location;
+      itsLimit    = limit;
+
+      return h5get_names (itsNames, location, type);
+    }
+
+    /*!
+      \brief Get the embedded object \c name, opening it if required
+      \param name    -- Name of the object.
+      \return object -- Pointer to the object; \c NULL if there is no embedded
+              object of this name.
+    */
+    T * find (std::string const &name)
+    {
+      typename std::map<std::string,T>::iterator it = itsObjects.find(name);
+
+      if (it == itsObjects.end()) {
+	if (!contains(name)) {
+	  return NULL;
+	}
+	itsObjects[name] = T (itsLocation, name);
+	touch (name);
+	evict ();
+	it = itsObjects.find(name);
+      } else {
+	touch (name);
+      }
+
+      return &(it->second);
+    }
+
+    /*!
+      \brief Add an object which has been opened or created by the caller
+      \param name    -- Name of the object.
+      \param object  -- The object itself.
+      \return object -- Pointer to the object held in the cache.
+    */
+    T * insert (std::string const &name,
+		T const &object)
+    {
+      itsNames.insert (name);
+      itsObjects[name] = object;
+      touch (name);
+      evict ();
+
+      return &(itsObjects.find(name)->second);
+    }
+
+    //! Remove the object \c name, e.g. after it has been deleted from the file
+    bool erase (std::string const &name)
+    {
+      itsObjects.erase (name);
+      itsUsage.remove (name);
+      return itsNames.erase (name);
+    }
+
+    //! Close all objects, keeping their names
+    void close ()
+    {
+      itsObjects.clear();
+      itsUsage.clear();
+    }
+
+    //! Close all objects and forget about their names
+    void clear ()
+    {
+      close ();
+      itsNames.clear();
+    }
+
+  private:
+
+    //! Mark the object \c name as most recently used
+    void touch (std::string const &name)
+    {
+      itsUsage.remove (name);
+      itsUsage.push_front (name);
+    }
+
+    //! Close the least recently used objects, until the limit is met
+    void evict ()
+    {
+      if (itsLimit > 0) {
+	while (itsObjects.size() > itsLimit) {
+	  itsObjects.erase (itsUsage.back());
+	  itsUsage.pop_back();
+	}
+      }
+    }
+
+  }; // Class HDF5HandleCache -- end
+
+} // Namespace DAL -- end
+
+#endif /* HDF5HANDLECACHE_H */
@@ -0,0 +1,264 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include <core/HDF5Dataset.h>
+#include <data_common/HDF5HandleCache.h>
+
+#include <sstream>
+
+// Namespace usage
+using std::cerr;
+using std::cout;
+using std::endl;
+using DAL::HDF5Dataset;
+using DAL::HDF5HandleCache;
+
+/*!
+  \file tHDF5HandleCache.cc
+
+  \ingroup DAL
+  \ingroup data_common
+
+  \brief A collection of test routines for the DAL::HDF5HandleCache class
+
+  \author agent
+
+  \date 2026/10/18
+*/
+
+//! Number of datasets created for the tests
+const unsigned int nofDatasets = 10;
+
+//_______________________________________________________________________________
+//                                                                   datasetName
+
+//! Get the name of the n-th test dataset
+std::string datasetName (unsigned int const &n)
+{
+  std::ostringstream name;
+  name << "Data" << n;
+  return name.str();
+}
+
+//_______________________________________________________________________________
+//                                                               nofOpenDatasets
+
+//! Get the number of datasets currently open within the file
+ssize_t nofOpenDatasets (hid_t const &fileID)
+{
+  return H5Fget_obj_count (fileID, H5F_OBJ_DATASET);
+}
+
+//_______________________________________________________________________________
+//                                                                     test_lazy
+
+/*!
+  \brief Test enumeration of objects and opening them on first access
+
+  \param fileID          -- Identifier of the file, to which the datasets are
+         attached.
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_lazy (hid_t const &fileID)
+{
+  cout << "\n[tHDF5HandleCache::test_lazy]\n" << endl;
+
+  int nofFailedTests (0);
+
+  cout << "[1] Testing default constructor ..." << endl;
+  try {
+    HDF5HandleCache<HDF5Dataset> cache;
+    //
+    cache.summary();
+    if (cache.size() != 0)    ++nofFailedTests;
+    if (cache.limit() != 0)   ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing enumerate() ..." << endl;
+  try {
+    HDF5HandleCache<HDF5Dataset> cache;
+    //
+    if (!cache.enumerate (fileID, H5G_DATASET)) ++nofFailedTests;
+    cache.summary();
+    if (cache.size() != nofDatasets)   ++nofFailedTests;
+    if (cache.nofOpen() != 0)          ++nofFailedTests;
+    if (!cache.contains ("Data3"))     ++nofFailedTests;
+    /* No dataset has been opened yet */
+    if (nofOpenDatasets(fileID) != 0)  ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Testing find() ..." << endl;
+  try {
+    HDF5HandleCache<HDF5Dataset> cache;
+    cache.enumerate (fileID, H5G_DATASET);
+    //
+    HDF5Dataset *dataset = cache.find ("Data3");
+
+    if (dataset == NULL) {
+      ++nofFailedTests;
+    } else {
+      if (dataset->shape()[0] != 4)     ++nofFailedTests;
+    }
+    if (cache.nofOpen() != 1)           ++nofFailedTests;
+    if (!cache.isOpen ("Data3"))        ++nofFailedTests;
+    if (nofOpenDatasets(fileID) != 1)   ++nofFailedTests;
+    /* Repeated access does not open the dataset again */
+    if (cache.find ("Data3") != dataset) ++nofFailedTests;
+    /* Unknown objects are not opened */
+    if (cache.find ("Missing") != NULL)  ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  /* All handles are released once the cache goes out of scope */
+  if (nofOpenDatasets(fileID) != 0) ++nofFailedTests;
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                    test_limit
+
+/*!
+  \brief Test bounding the number of open objects
+
+  \param fileID          -- Identifier of the file, to which the datasets are
+         attached.
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_limit (hid_t const &fileID)
+{
+  cout << "\n[tHDF5HandleCache::test_limit]\n" << endl;
+
+  int nofFailedTests (0);
+
+  cout << "[1] Testing eviction of the least recently used objects ..." << endl;
+  try {
+    HDF5HandleCache<HDF5Dataset> cache;
+    cache.enumerate (fileID, H5G_DATASET, 3);
+    //
+    cache.find ("Data0");
+    cache.find ("Data1");
+    cache.find ("Data2");
+    /* Touch Data0, such that Data1 is the least recently used one */
+    cache.find ("Data0");
+    cache.find ("Data3");
+
+    cache.summary();
+    if (cache.nofOpen() != 3)          ++nofFailedTests;
+    if (!cache.isOpen ("Data0"))       ++nofFailedTests;
+    if (cache.isOpen ("Data1"))        ++nofFailedTests;
+    if (nofOpenDatasets(fileID) != 3)  ++nofFailedTests;
+    /* Evicted objects are re-opened transparently */
+    HDF5Dataset *dataset = cache.find ("Data1");
+    if (dataset == NULL || dataset->shape()[0] != 2) ++nofFailedTests;
+    if (cache.size() != nofDatasets)   ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing setLimit() ..." << endl;
+  try {
+    HDF5HandleCache<HDF5Dataset> cache;
+    cache.enumerate (fileID, H5G_DATASET);
+    //
+    for (unsigned int n(0); n<nofDatasets; ++n) {
+      cache.find (datasetName(n));
+    }
+    if (nofOpenDatasets(fileID) != nofDatasets) ++nofFailedTests;
+
+    cache.setLimit (2);
+    if (cache.nofOpen() != 2)           ++nofFailedTests;
+    if (!cache.isOpen ("Data9"))        ++nofFailedTests;
+    if (nofOpenDatasets(fileID) != 2)   ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Testing insert() and erase() ..." << endl;
+  try {
+    HDF5HandleCache<HDF5Dataset> cache;
+    cache.enumerate (fileID, H5G_DATASET, 2);
+    //
+    HDF5Dataset *dataset = cache.insert ("Extra",
+					 HDF5Dataset (fileID,
+						      "Extra",
+						      std::vector<hsize_t>(1,16)));
+    if (dataset == NULL)                 ++nofFailedTests;
+    if (cache.size() != nofDatasets+1)   ++nofFailedTests;
+    if (!cache.isOpen ("Extra"))         ++nofFailedTests;
+
+    if (!cache.erase ("Extra"))          ++nofFailedTests;
+    if (cache.contains ("Extra"))        ++nofFailedTests;
+    if (cache.size() != nofDatasets)     ++nofFailedTests;
+    H5Ldelete (fileID, "Extra", H5P_DEFAULT);
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                           main
+
+int main ()
+{
+  int nofFailedTests (0);
+  std::string filename ("tHDF5HandleCache.h5");
+
+  hid_t fileID = H5Fcreate (filename.c_str(),
+			    H5F_ACC_TRUNC,
+			    H5P_DEFAULT,
+			    H5P_DEFAULT);
+
+  if (H5Iis_valid(fileID)) {
+    /* Create the datasets used in the tests; dataset n has n+1 elements */
+    for (unsigned int n(0); n<nofDatasets; ++n) {
+      HDF5Dataset dataset (fileID,
+			   datasetName(n),
+			   std::vector<hsize_t>(1,n+1));
+    }
+
+    // Test opening objects on first access
+    nofFailedTests += test_lazy (fileID);
+    // Test bounding the number of open objects
+    nofFailedTests += test_limit (fileID);
+  } else {
+    cerr << "-- ERROR: Failed to create file " << filename << endl;
+    return -1;
+  }
+
+  H5Fclose (fileID);
+
+  return nofFailedTests;
+}
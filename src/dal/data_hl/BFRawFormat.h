@@ -28,6 +28,8 @@
 #include <sys/types.h>
 #include <complex>
 
+#include <core/HDF5TypeTraits.h>
+
 /*!
   \file BFRawFormat.h
   
@@ -160,4 +162,27 @@ class BFRawFormat {
   }
   
 };
+
+namespace DAL { // Namespace DAL -- begin
+
+  /// @cond TEMPLATE_SPECIALIZATIONS
+
+  //! Native HDF5 datatype for a BFRaw sample: the complex voltages of X and Y
+  template <> struct HDF5TypeTraits<BFRawFormat::Sample> {
+    static hid_t type () {
+      static hid_t id = -1;
+      if (!H5Iis_valid(id)) {
+	hid_t complexType = HDF5TypeTraits<std::complex<int16_t> >::type();
+	id = H5Tcreate (H5T_COMPOUND, sizeof(BFRawFormat::Sample));
+	H5Tinsert (id, "xx", HOFFSET(BFRawFormat::Sample,xx), complexType);
+	H5Tinsert (id, "yy", HOFFSET(BFRawFormat::Sample,yy), complexType);
+      }
+      return id;
+    }
+  };
+
+  /// @endcond
+
+} // Namespace DAL -- end
+
 #endif  // BFRAWFORMAT_H
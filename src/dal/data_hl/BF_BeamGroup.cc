@@ -258,19 +258,16 @@ namespace DAL { // Namespace DAL -- begin
   bool BF_BeamGroup::openStokesDataset (std::string const &name)
   {
     bool status (true);
-    std::map<std::string,BF_StokesDataset>::iterator it;
-
-    it = itsStokesDatasets.find(name);
 
     /*
-     *  Check internal book-keeping; if the dataset has been opened already, we
-     *  can skip the additional tests.
+     *  Check internal book-keeping; if the dataset is known already, it is
+     *  opened on first access and we can skip the additional tests.
      */
-    if (it==itsStokesDatasets.end()) {
+    if (!itsStokesDatasets.contains(name)) {
       /* Dataset not yet opened */
       if (H5Lexists (location_p, name.c_str(), H5P_DEFAULT)) {
 	/* Dataset exists, but not yet has been opened */
-	itsStokesDatasets[name] = BF_StokesDataset (location_p, name);
+	itsStokesDatasets.insert (name, BF_StokesDataset (location_p, name));
       } else {
 	/* Dataset does not exist */
 	status = false;
@@ -338,7 +335,6 @@ namespace DAL { // Namespace DAL -- begin
   {
     bool status = true;
     std::string name = BF_StokesDataset::getName(stokesID);
-    std::map<std::string,BF_StokesDataset>::iterator it = itsStokesDatasets.find(name);
     
     /*________________________________________________________________
       Check input parameters.
@@ -358,7 +354,7 @@ namespace DAL { // Namespace DAL -- begin
       error.
     */
 
-    if (it==itsStokesDatasets.end()) {
+    if (!itsStokesDatasets.contains(name)) {
       /* Dataset not yet opened */
       status = true;
     } else {
@@ -366,7 +362,7 @@ namespace DAL { // Namespace DAL -- begin
 	   (flags.flags() & IO_Mode::Create) ||
 	   (flags.flags() & IO_Mode::Truncate) ) {
 	/* Removing dataset from internal book-keeping */
-	itsStokesDatasets.erase(it);
+	itsStokesDatasets.erase(name);
 	/* Delete dataset */
 	H5Ldelete (location_p,
 		   name.c_str(),
@@ -382,12 +378,13 @@ namespace DAL { // Namespace DAL -- begin
       Create new Stokes dataset.
     */    
     
-    itsStokesDatasets[name] = BF_StokesDataset (location_p,
+    itsStokesDatasets.insert (name,
+			      BF_StokesDataset (location_p,
 						stokesID,
 						nofSamples,
 						nofChannels,
 						component,
-						datatype);
+						datatype));
     
     /*________________________________________________________________
       Check if creation of dataset was successful; is this was not the
@@ -412,12 +409,10 @@ namespace DAL { // Namespace DAL -- begin
 
     if (H5Iis_valid(location_p)) {
       std::string name = BF_StokesDataset::getName (stokesID);
-      std::map<std::string,BF_StokesDataset>::iterator it;
-      
-      it = itsStokesDatasets.find(name);
+      BF_StokesDataset *dataset = itsStokesDatasets.find(name);
 
-      if (it != itsStokesDatasets.end()) {
-	return BF_StokesDataset(it->second);
+      if (dataset != NULL) {
+	return BF_StokesDataset(*dataset);
       } else {
 	std::cerr << "[BF_BeamGroup::getStokesDataset] No such dataset "
 		  << "\"" << name << "\""
@@ -449,14 +444,14 @@ namespace DAL { // Namespace DAL -- begin
     /* Convert ID to name */
     std::string name = BF_StokesDataset::getName (stokesID);
     /* Search for requested dataset */
-    std::map<std::string,BF_StokesDataset>::iterator it = itsStokesDatasets.find(name);
+    BF_StokesDataset *match = itsStokesDatasets.find(name);
     
-    if (it==itsStokesDatasets.end()) {
+    if (match==NULL) {
       std::cerr << "[BF_BeamGroup::getStokesDataset]"
 		<< " Unable to find Stokes dataset " << name << std::endl;
       return false;
     } else {
-      dataset = &(it->second);
+      dataset = match;
       return true;
     }
   }
@@ -493,18 +488,14 @@ namespace DAL { // Namespace DAL -- begin
   bool BF_BeamGroup::openEmbedded (IO_Mode const &flags)
   {
     bool status = true;
-    std::set<std::string>::iterator it;
     std::set<std::string> groups;
-    std::set<std::string> datasets;
     
     /*________________________________________________________________
-      Extract the names of the groups and datasets attached to this 
-      beam group.
+      Extract the names of the groups attached to this beam group.
     */
     
     if (H5Iis_valid(location_p)) {
       status = h5get_names (groups,   location_p, H5G_GROUP   );
-      status = h5get_names (datasets, location_p, H5G_DATASET );
     } else {
       std::cerr << "[BF_BeamGroup::openEmbedded]"
 		<< " No connection to valid HDF5 object!"
@@ -522,12 +513,12 @@ namespace DAL { // Namespace DAL -- begin
     }
 
     /*________________________________________________________________
-      Open Stokes datasets.
+      Enumerate Stokes datasets; they are opened on first access.
     */
 
-    for (it=datasets.begin(); it!=datasets.end(); ++it) {
-      status *= openStokesDataset (*it);
-    }
+    status = itsStokesDatasets.enumerate (location_p,
+					  H5G_DATASET,
+					  handleLimit()) && status;
     
     return status;
   }
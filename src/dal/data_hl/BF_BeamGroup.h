@@ -103,8 +103,8 @@ namespace DAL { // Namespace DAL -- begin
     std::map<std::string,BF_ProcessingHistory> itsProcessingHistory;
     //! Coordinates group
     std::map<std::string,CoordinatesGroup> itsCoordinates;
-    //! Stokes datasets
-    std::map<std::string,BF_StokesDataset> itsStokesDatasets;
+    //! Stokes datasets, opened on first access
+    HDF5HandleCache<BF_StokesDataset> itsStokesDatasets;
 
   public:
     
@@ -209,7 +209,7 @@ namespace DAL { // Namespace DAL -- begin
       {
 	bool status      = true;
 	std::string name = getName (index);
-	std::map<std::string,BF_StokesDataset>::iterator it;
+	BF_StokesDataset *dataset;
 
 	/*____________________________________________________________
 	  Check if the Stokes dataset exists and is available; if this
@@ -217,8 +217,8 @@ namespace DAL { // Namespace DAL -- begin
 	  data.
 	*/
 
-	it = itsStokesDatasets.find(name);
-	if (it==itsStokesDatasets.end()) {
+	dataset = itsStokesDatasets.find(name);
+	if (dataset==NULL) {
 	  std::cerr << "[BF_BeamGroup::writeData] No such dataset "
 		    << name 
 		    << " - unable to write data!"
@@ -226,7 +226,7 @@ namespace DAL { // Namespace DAL -- begin
 	  status = false;
 	} else {
 	  /* write the data through BF_StokesDataset::writeData() */
-	  status = it->second.writeData(data,start,block);
+	  status = dataset->writeData(data,start,block);
 	}
 
 	return status;
@@ -48,13 +48,17 @@ namespace DAL { // Namespace DAL -- begin
   //                                                                 BF_RootGroup
   
   /*!
-    \param filename -- Filename object from which the actual file name of the
+    \param filename   -- Filename object from which the actual file name of the
            dataset is derived.
-    \param flags    -- I/O mode flags.
+    \param flags      -- I/O mode flags.
+    \param properties -- Settings for the HDF5 file-creation and file-access
+           property lists.
   */
   BF_RootGroup::BF_RootGroup (DAL::Filename &infile,
-			      IO_Mode const &flags)
-    : HDF5GroupBase(flags)
+			      IO_Mode const &flags,
+			      HDF5Property const &properties)
+    : HDF5GroupBase(flags),
+      itsFileProperties(properties)
   {
     if (!open (0,infile.filename(),itsFlags)) {
       std::cerr << "[BF_RootGroup::BF_RootGroup] Failed to open file "
@@ -70,10 +74,14 @@ namespace DAL { // Namespace DAL -- begin
     \param attributes -- CommonAttributes object from which the actual file name
            of the dataset is extracted.
     \param flags      -- I/O mode flags.
+    \param properties -- Settings for the HDF5 file-creation and file-access
+           property lists.
   */
   BF_RootGroup::BF_RootGroup (CommonAttributes const &attributes,
-			      IO_Mode const &flags)
-    : HDF5GroupBase(flags)
+			      IO_Mode const &flags,
+			      HDF5Property const &properties)
+    : HDF5GroupBase(flags),
+      itsFileProperties(properties)
   {
     if (!open (0,attributes.filename(),itsFlags)) {
       std::cerr << "[BF_RootGroup::BF_RootGroup] Failed to open file "
@@ -252,7 +260,8 @@ namespace DAL { // Namespace DAL -- begin
 
     bool fileTruncated = HDF5Object::openFile (location_p,
 					       name,
-					       itsFlags);
+					       itsFlags,
+					       itsFileProperties);
 
     // Set attributes ______________________________________
     
@@ -307,23 +316,14 @@ namespace DAL { // Namespace DAL -- begin
 
     if (H5Iis_valid(location_p)) {
 
-      std::set<std::string> groups;
-      std::set<std::string>::iterator it;
-
-      /* Retrieve the names of the groups attached to the root group */
-      status = h5get_names (groups,
-			    location_p,
-			    H5G_GROUP);
-      
-      /* Open system log group ... */
+      /* Open system log group */
       status = openSysLog ();
-      /* ... and remove its name from the previously retrieved list */
-      groups.erase("SysLog");
-      
-      /* Open the SubArrayPointingDirection groups */
-      for (it=groups.begin(); it!=groups.end(); ++it) {
-	status *= openSubArrayPointing (*it);
-      }
+
+      /* Enumerate the SubArrayPointing groups; they are opened on first access */
+      status = itsSubarrayPointings.enumerate (location_p,
+					       H5G_GROUP,
+					       handleLimit());
+      itsSubarrayPointings.erase (SysLog::getName());
       
     } else {
       status = false;
@@ -363,11 +363,12 @@ namespace DAL { // Namespace DAL -- begin
       Check if the group has been opened already.
     */
 
-    if ( itsSubarrayPointings.find(name) == itsSubarrayPointings.end() ) {
+    if ( !itsSubarrayPointings.contains(name) ) {
       // open/create group
-      itsSubarrayPointings[name] = BF_SubArrayPointing (location_p,
+      itsSubarrayPointings.insert (name,
+				   BF_SubArrayPointing (location_p,
 							pointingID,
-							flags);
+							flags));
       // internal book-keeping
       int nofPrimaryBeams = itsSubarrayPointings.size();
       HDF5Attribute::write (location_p,
@@ -392,10 +393,11 @@ namespace DAL { // Namespace DAL -- begin
       Check if the group has been opened already.
     */
 
-    if ( itsSubarrayPointings.find(name) == itsSubarrayPointings.end() ) {
+    if ( !itsSubarrayPointings.contains(name) ) {
       // open/create group
-      itsSubarrayPointings[name] = BF_SubArrayPointing (location_p,
-							name);
+      itsSubarrayPointings.insert (name,
+				   BF_SubArrayPointing (location_p,
+							name));
       // internal book-keeping
       int nofPrimaryBeams = itsSubarrayPointings.size();
       HDF5Attribute::write (location_p,
@@ -419,7 +421,7 @@ namespace DAL { // Namespace DAL -- begin
 			       unsigned int const &beamID,
 			       IO_Mode const &flags)
   {
-    std::map<std::string,BF_SubArrayPointing>::iterator it;
+    BF_SubArrayPointing *pointing;
     
     /*______________________________________________________
       Open/Create primary array pointing group
@@ -434,15 +436,15 @@ namespace DAL { // Namespace DAL -- begin
       hierarchical level structure.
     */
 
-    it = itsSubarrayPointings.find(name);
+    pointing = itsSubarrayPointings.find(name);
     
-    if (it==itsSubarrayPointings.end()) {
+    if (pointing==NULL) {
       std::cerr << "[BF_RootGroup::openBeam]"
 		<< " Unable to open sub-array direction group " << name
 		<< std::endl;
       status = false;
     } else {
-      it->second.openBeam (beamID, flags);
+      pointing->openBeam (beamID, flags);
     }
 
     return true;
@@ -460,12 +462,10 @@ namespace DAL { // Namespace DAL -- begin
 
     if (H5Iis_valid(location_p)) {
       std::string name = BF_SubArrayPointing::getName (pointingID);
-      std::map<std::string,BF_SubArrayPointing>::iterator it;
-      
-      it   = itsSubarrayPointings.find(name);
+      BF_SubArrayPointing *group = itsSubarrayPointings.find(name);
 
-      if (it != itsSubarrayPointings.end()) {
-	return it->second;
+      if (group != NULL) {
+	return *group;
       } else {
 	std::cerr << "[BF_RootGroup::primaryPointing] No such group "
 		  << "\"" << name << "\""
@@ -513,15 +513,15 @@ namespace DAL { // Namespace DAL -- begin
     */
     
     std::string name;
-    std::map<std::string,BF_SubArrayPointing>::iterator it;
+    BF_SubArrayPointing *pointing;
     
     name = BF_SubArrayPointing::getName (pointingID);
-    it   = itsSubarrayPointings.find(name);
+    pointing = itsSubarrayPointings.find(name);
     
-    if (it==itsSubarrayPointings.end()) {
+    if (pointing==NULL) {
       status = false;
     } else {
-      it->second.openStokesDataset (beamID, stokesID);
+      pointing->openStokesDataset (beamID, stokesID);
     }
 
     return status;
@@ -603,15 +603,15 @@ namespace DAL { // Namespace DAL -- begin
     */
     
     std::string name;
-    std::map<std::string,BF_SubArrayPointing>::iterator it;
+    BF_SubArrayPointing *pointing;
     
     name = BF_SubArrayPointing::getName (pointingID);
-    it   = itsSubarrayPointings.find(name);
+    pointing = itsSubarrayPointings.find(name);
     
-    if (it==itsSubarrayPointings.end()) {
+    if (pointing==NULL) {
       status = false;
     } else {
-      status = it->second.openStokesDataset (beamID,
+      status = pointing->openStokesDataset (beamID,
 					     stokesID,
 					     nofSamples,
 					     nofChannels,
@@ -168,8 +168,10 @@ namespace DAL { // Namespace DAL -- begin
     std::string itsFilename;
     //! LOFAR common attributes attached to the root group of the dataset
     CommonAttributes itsCommonAttributes;
-    //! Sub-array pointing directions
-    std::map<std::string,BF_SubArrayPointing> itsSubarrayPointings;
+    //! Settings for the HDF5 file-creation and file-access property lists
+    HDF5Property itsFileProperties;
+    //! Sub-array pointing directions, opened on first access
+    HDF5HandleCache<BF_SubArrayPointing> itsSubarrayPointings;
     //! Container for system-wide logs
     std::map<std::string,SysLog> itsSystemLog;
 
@@ -182,11 +184,13 @@ namespace DAL { // Namespace DAL -- begin
     
     //! Argumented constructor
     BF_RootGroup (DAL::Filename &infile,
-		  IO_Mode const &flags=IO_Mode(IO_Mode::OpenOrCreate));
+		  IO_Mode const &flags=IO_Mode(IO_Mode::OpenOrCreate),
+		  HDF5Property const &properties=HDF5Property());
     
     //! Argumented constructor
     BF_RootGroup (CommonAttributes const &attributes,
-		  IO_Mode const &flags=IO_Mode(IO_Mode::OpenOrCreate));
+		  IO_Mode const &flags=IO_Mode(IO_Mode::OpenOrCreate),
+		  HDF5Property const &properties=HDF5Property());
     
     // === Destruction ==========================================================
     
@@ -201,6 +205,16 @@ namespace DAL { // Namespace DAL -- begin
     //! Set the set of common attributes attached to the root group of the file
     bool setCommonAttributes (CommonAttributes const &attributes);
 
+    //! Get the settings for the HDF5 file-creation and file-access property lists
+    inline HDF5Property fileProperties () const {
+      return itsFileProperties;
+    }
+
+    //! Set the settings for the HDF5 property lists, used by the next open()
+    inline void setFileProperties (HDF5Property const &properties) {
+      itsFileProperties = properties;
+    }
+
     /*!
       \brief Get the name of the class
       
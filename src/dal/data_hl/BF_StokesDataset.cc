@@ -203,13 +203,8 @@ namespace DAL { // Namespace DAL -- begin
   BF_StokesDataset::BF_StokesDataset (BF_StokesDataset const &other)
     : HDF5DatasetBase (other)
   {
-    *this = other;
-
-    itsNofChannels.clear();
-    itsNofChannels = other.itsNofChannels;
-
-    itsAttributes.clear();
-    itsAttributes = other.itsAttributes;
+    itsStokesComponent = other.itsStokesComponent;
+    itsNofChannels     = other.itsNofChannels;
   }
   
   // ============================================================================
@@ -243,9 +238,11 @@ namespace DAL { // Namespace DAL -- begin
   BF_StokesDataset& BF_StokesDataset::operator= (BF_StokesDataset const &other)
   {
     if (this != &other) {
+      HDF5DatasetBase::operator= (other);
       destroy ();
       /* Copy internal parameters */
       itsStokesComponent = other.itsStokesComponent;
+      itsNofChannels     = other.itsNofChannels;
     }
     return *this;
   }
@@ -65,10 +65,7 @@ namespace DAL { // Namespace DAL -- begin
   BF_SubArrayPointing::BF_SubArrayPointing (BF_SubArrayPointing const &other)
     : HDF5GroupBase (other)
   {
-    if (!other.itsBeams.empty()) {
-      itsBeams.clear();
-      itsBeams = other.itsBeams;
-    }
+    itsBeams = other.itsBeams;
   }
   
   // ============================================================================
@@ -92,6 +89,30 @@ namespace DAL { // Namespace DAL -- begin
     }
   }
   
+  // ============================================================================
+  //
+  //  Operators
+  //
+  // ============================================================================
+  
+  //_____________________________________________________________________________
+  //                                                                    operator=
+  
+  /*!
+    \param other -- Another BF_SubArrayPointing object from which to make a
+           copy.
+  */
+  BF_SubArrayPointing& BF_SubArrayPointing::operator= (BF_SubArrayPointing const &other)
+  {
+    if (this != &other) {
+      // embedded objects are released before the group itself
+      itsBeams.clear();
+      HDF5GroupBase::operator= (other);
+      itsBeams = other.itsBeams;
+    }
+    return *this;
+  }
+  
   // ============================================================================
   //
   //  Parameters
@@ -232,19 +253,11 @@ namespace DAL { // Namespace DAL -- begin
   bool BF_SubArrayPointing::openEmbedded (IO_Mode const &flags)
   {
     bool status = flags.flags();
-    std::set<std::string> groupnames;
-    std::set<std::string>::iterator it;
-    
-    /* Retrieve the names of the groups attached to the sub-array pointing group */
-    status = h5get_names (groupnames,
-			  location_p,
-			  H5G_GROUP);
     
-    if (groupnames.size() > 0) {
-      for (it=groupnames.begin(); it!=groupnames.end(); ++it) {
-	itsBeams[*it] = BF_BeamGroup (location_p,*it);
-      }
-    }
+    /* Enumerate the beam groups; they are opened on first access */
+    status = itsBeams.enumerate (location_p,
+				 H5G_GROUP,
+				 handleLimit());
     
     return status;
   }
@@ -267,11 +280,12 @@ namespace DAL { // Namespace DAL -- begin
       Check if the group has been opened already.
     */
 
-    if ( itsBeams.find(name) == itsBeams.end() ) {
+    if ( !itsBeams.contains(name) ) {
       // open/create group
-      itsBeams[name] = BF_BeamGroup (location_p,
+      itsBeams.insert (name,
+		       BF_BeamGroup (location_p,
 				     beamID,
-				     flags);
+				     flags));
       // internal book-keeping
       int nofBeams = itsBeams.size();
       HDF5Attribute::write (location_p,
@@ -291,10 +305,10 @@ namespace DAL { // Namespace DAL -- begin
 
     if (H5Iis_valid(location_p)) {
       std::string name = BF_BeamGroup::getName (beamID);
-      std::map<std::string,BF_BeamGroup>::iterator it = itsBeams.find(name);
+      BF_BeamGroup *group = itsBeams.find(name);
 
-      if (it != itsBeams.end()) {
-	return it->second;
+      if (group != NULL) {
+	return *group;
       } else {
 	std::cerr << "[BF_SubArrayPointing::getBeamGroup] No such group "
 		  << "\"" << name << "\""
@@ -316,14 +330,14 @@ namespace DAL { // Namespace DAL -- begin
 					  unsigned int const &beamID)
   {
     std::string name = BF_BeamGroup::getName (beamID);
-    std::map<std::string,BF_BeamGroup>::iterator it = itsBeams.find(name);
+    BF_BeamGroup *group = itsBeams.find(name);
 
-    if (it==itsBeams.end()) {
+    if (group==NULL) {
       std::cerr << "[BF_SubArrayPointing::getBeamGroup]"
 		<< " Unable to find Beam group " << name << std::endl;
       return false;
     } else {
-      beam = &(it->second);
+      beam = group;
       return true;
     }
   }
@@ -356,15 +370,15 @@ namespace DAL { // Namespace DAL -- begin
     */
     
     std::string name;
-    std::map<std::string,BF_BeamGroup>::iterator it;
+    BF_BeamGroup *group;
     
     name = BF_BeamGroup::getName (beamID);
-    it   = itsBeams.find(name);
+    group = itsBeams.find(name);
     
-    if (it==itsBeams.end()) {
+    if (group==NULL) {
       status = false;
     } else {
-      it->second.openStokesDataset (stokesID);
+      group->openStokesDataset (stokesID);
     }
 
     return status;
@@ -441,15 +455,15 @@ namespace DAL { // Namespace DAL -- begin
     */
     
     std::string name;
-    std::map<std::string,BF_BeamGroup>::iterator it;
+    BF_BeamGroup *group;
     
     name = BF_BeamGroup::getName (beamID);
-    it   = itsBeams.find(name);
+    group = itsBeams.find(name);
     
-    if (it==itsBeams.end()) {
+    if (group==NULL) {
       status = false;
     } else {
-      status = it->second.openStokesDataset (stokesID,
+      status = group->openStokesDataset (stokesID,
 					     nofSamples,
 					     nofChannels,
 					     component,
@@ -467,14 +481,14 @@ namespace DAL { // Namespace DAL -- begin
 							  unsigned int const &stokesID)
   {
     std::string name = BF_BeamGroup::getName (beamID);
-    std::map<std::string,BF_BeamGroup>::iterator it = itsBeams.find(name);
+    BF_BeamGroup *group = itsBeams.find(name);
     
-    if (it==itsBeams.end()) {
+    if (group==NULL) {
       std::cerr << "[BF_SubArrayPointing::getStokesDataset]"
 		<< " Unable to find Beam group " << name << std::endl;
       return BF_StokesDataset();
     } else {
-      return it->second.getStokesDataset(stokesID);
+      return group->getStokesDataset(stokesID);
     }
   }
   
@@ -486,14 +500,14 @@ namespace DAL { // Namespace DAL -- begin
 					      unsigned int const &stokesID)
   {
     std::string name = BF_BeamGroup::getName (beamID);
-    std::map<std::string,BF_BeamGroup>::iterator it = itsBeams.find(name);
+    BF_BeamGroup *group = itsBeams.find(name);
 
-    if (it==itsBeams.end()) {
+    if (group==NULL) {
       std::cerr << "[BF_SubArrayPointing::getStokesDataset]"
 		<< " Unable to find Beam group " << name << std::endl;
       return false;
     } else {
-      return it->second.getStokesDataset(dataset,stokesID);
+      return group->getStokesDataset(dataset,stokesID);
     }
   }
   
@@ -84,8 +84,8 @@ namespace DAL { // Namespace DAL -- begin
   */  
   class BF_SubArrayPointing : public HDF5GroupBase {
     
-    //! Station beams
-    std::map<std::string,BF_BeamGroup> itsBeams;
+    //! Beam groups, opened on first access
+    HDF5HandleCache<BF_BeamGroup> itsBeams;
     
   public:
     
@@ -112,6 +112,11 @@ namespace DAL { // Namespace DAL -- begin
     //! Default destructor
     ~BF_SubArrayPointing ();
     
+    // === Operators ============================================================
+    
+    //! Overloading of the copy operator
+    BF_SubArrayPointing& operator= (BF_SubArrayPointing const &other);
+    
     // --------------------------------------------------------------- Parameters
     
     /*!
@@ -0,0 +1,366 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "TBB_BlockIterator.h"
+
+#include <cmath>
+#include <core/HDF5Attribute.h>
+
+namespace DAL { // Namespace DAL -- begin
+
+  // ============================================================================
+  //
+  //  Construction
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                            TBB_BlockIterator
+
+  /*!
+    \param datasets    -- Identifiers of the dipole datasets.
+    \param blockLength -- Number of samples per dipole within a block.
+    \param memoryType  -- Datatype of the samples in memory.
+    \param nofBuffers  -- Number of buffers in the ring (at least 2), i.e. the
+           I/O thread reads up to <tt>nofBuffers-1</tt> blocks ahead.
+  */
+  TBB_BlockIterator::TBB_BlockIterator (std::vector<hid_t> const &datasets,
+					hsize_t const &blockLength,
+					hid_t const &memoryType,
+					unsigned int const &nofBuffers)
+    : HDF5BlockIterator ()
+  {
+    std::vector<hsize_t> offsets;
+    bool status;
+
+    {
+      HDF5Lock lock;
+      alignment (offsets, datasets);
+      status = setup (datasets, offsets, blockLength, memoryType, nofBuffers);
+    }
+
+    if (status) {
+      start ();
+    }
+  }
+
+  //_____________________________________________________________________________
+  //                                                            TBB_BlockIterator
+
+  /*!
+    \param datasets    -- Identifiers of the dipole datasets.
+    \param offsets     -- Offsets of the first sample to consider within each
+           of the dipole datasets.
+    \param blockLength -- Number of samples per dipole within a block.
+    \param memoryType  -- Datatype of the samples in memory.
+    \param nofBuffers  -- Number of buffers in the ring (at least 2), i.e. the
+           I/O thread reads up to <tt>nofBuffers-1</tt> blocks ahead.
+  */
+  TBB_BlockIterator::TBB_BlockIterator (std::vector<hid_t> const &datasets,
+					std::vector<hsize_t> const &offsets,
+					hsize_t const &blockLength,
+					hid_t const &memoryType,
+					unsigned int const &nofBuffers)
+    : HDF5BlockIterator ()
+  {
+    bool status;
+
+    {
+      HDF5Lock lock;
+      status = setup (datasets, offsets, blockLength, memoryType, nofBuffers);
+    }
+
+    if (status) {
+      start ();
+    }
+  }
+
+  // ============================================================================
+  //
+  //  Destruction
+  //
+  // ============================================================================
+
+  TBB_BlockIterator::~TBB_BlockIterator ()
+  {
+    /* The I/O thread reads through the plans of this object */
+    stop ();
+
+    HDF5Lock lock;
+    itsPlans.clear();
+    itsTailPlans.clear();
+  }
+
+  // ============================================================================
+  //
+  //  Parameters
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                   nofSamples
+
+  hsize_t TBB_BlockIterator::nofSamples () const
+  {
+    if (lastBlock() && itsLength%itsBlockLength > 0) {
+      return itsLength%itsBlockLength;
+    } else {
+      return itsBlockLength;
+    }
+  }
+
+  //_____________________________________________________________________________
+  //                                                                   blockShape
+
+  std::vector<hsize_t> TBB_BlockIterator::blockShape () const
+  {
+    std::vector<hsize_t> shape (2);
+
+    shape[0] = itsPlans.size();
+    shape[1] = nofSamples();
+
+    return shape;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                nofDatapoints
+
+  hsize_t TBB_BlockIterator::nofDatapoints () const
+  {
+    return itsPlans.size()*nofSamples();
+  }
+
+  //_____________________________________________________________________________
+  //                                                                      summary
+
+  /*!
+    \param os -- Output stream to which the summary is written.
+  */
+  void TBB_BlockIterator::summary (std::ostream &os)
+  {
+    os << "[TBB_BlockIterator] Summary of internal parameters." << std::endl;
+    os << "-- nof. dipoles         = " << itsPlans.size()  << std::endl;
+    os << "-- Offsets              = " << itsOffsets       << std::endl;
+    os << "-- Block length         = " << itsBlockLength   << std::endl;
+    os << "-- Aligned length       = " << itsLength        << std::endl;
+    os << "-- nof. blocks          = " << nofBlocks()      << std::endl;
+    os << "-- nof. buffers         = " << nofBuffers()     << std::endl;
+    os << "-- Error encountered    = " << error()          << std::endl;
+  }
+
+  // ============================================================================
+  //
+  //  Methods
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                    alignment
+
+  /*!
+    \retval offsets -- Offset of the first aligned sample within each of the
+            dipole datasets, i.e. the number of samples a dipole has recorded
+            before the dipole starting last began recording.
+    \param datasets -- Identifiers of the dipole datasets.
+    \return status  -- Status of the operation; returns \e false in case the
+            attributes could not be read or the sample frequencies of the
+            dipoles differ.
+  */
+  bool TBB_BlockIterator::alignment (std::vector<hsize_t> &offsets,
+				     std::vector<hid_t> const &datasets)
+  {
+    unsigned int nofDatasets = datasets.size();
+    std::vector<unsigned long long> first (nofDatasets);
+    unsigned long long latest = 0;
+    double frequency          = 0;
+
+    offsets.assign (nofDatasets, 0);
+
+    for (unsigned int n(0); n<nofDatasets; ++n) {
+      uint time         = 0;
+      uint sampleNumber = 0;
+      double value      = 0;
+      std::string unit;
+
+      if (!HDF5Attribute::read (datasets[n], "TIME", time)
+	  || !HDF5Attribute::read (datasets[n], "SAMPLE_NUMBER", sampleNumber)
+	  || !HDF5Attribute::read (datasets[n], "SAMPLE_FREQUENCY_VALUE", value)
+	  || !HDF5Attribute::read (datasets[n], "SAMPLE_FREQUENCY_UNIT", unit)) {
+	std::cerr << "[TBB_BlockIterator::alignment]"
+		  << " Failed to read time attributes of dataset " << n << "!"
+		  << std::endl;
+	return false;
+      }
+
+      /* Sample frequency in Hz */
+      if (unit == "GHz") {
+	value *= 1e9;
+      } else if (unit == "MHz") {
+	value *= 1e6;
+      } else if (unit == "kHz") {
+	value *= 1e3;
+      }
+
+      if (n == 0) {
+	frequency = value;
+      } else if (fabs(value-frequency) > 1e-9*frequency) {
+	std::cerr << "[TBB_BlockIterator::alignment]"
+		  << " Sample frequency of dataset " << n
+		  << " differs from the one of dataset 0!" << std::endl;
+	return false;
+      }
+
+      /* Number of the first sample, counted from the start of the epoch */
+      first[n] = (unsigned long long)(time)*(unsigned long long)(frequency+0.5)
+	+ sampleNumber;
+
+      if (first[n] > latest) {
+	latest = first[n];
+      }
+    }
+
+    for (unsigned int n(0); n<nofDatasets; ++n) {
+      offsets[n] = latest-first[n];
+    }
+
+    return true;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                        setup
+
+  /*!
+    \return status -- Status of the operation; returns \e false in case an error
+            was encountered.
+  */
+  bool TBB_BlockIterator::setup (std::vector<hid_t> const &datasets,
+				 std::vector<hsize_t> const &offsets,
+				 hsize_t const &blockLength,
+				 hid_t const &memoryType,
+				 unsigned int const &nofBuffers)
+  {
+    unsigned int nofDatasets = datasets.size();
+
+    itsPlans.clear();
+    itsTailPlans.clear();
+    itsOffsets     = offsets;
+    itsBlockLength = blockLength;
+    itsLength      = 0;
+    itsElementSize = 0;
+
+    if (nofDatasets == 0 || blockLength == 0) {
+      std::cerr << "[TBB_BlockIterator::setup] Empty selection of dipoles or"
+		<< " zero block length!" << std::endl;
+      return false;
+    }
+
+    if (offsets.size() != nofDatasets) {
+      std::cerr << "[TBB_BlockIterator::setup] Number of offsets does not"
+		<< " match the number of dipoles!" << std::endl;
+      return false;
+    }
+
+    /* Set up the read plans; the iteration ends with the dipole ending first */
+
+    std::vector<hsize_t> block (1, blockLength);
+
+    itsPlans.resize (nofDatasets);
+
+    for (unsigned int n(0); n<nofDatasets; ++n) {
+      if (!itsPlans[n].setup (datasets[n], block, memoryType)
+	  || itsPlans[n].rank() != 1) {
+	std::cerr << "[TBB_BlockIterator::setup] Failed to set up read plan"
+		  << " for dataset " << n << "!" << std::endl;
+	itsPlans.clear();
+	return false;
+      }
+
+      hsize_t length = itsPlans[n].shape()[0];
+      length         = length > offsets[n] ? length-offsets[n] : 0;
+
+      if (n == 0 || length < itsLength) {
+	itsLength = length;
+      }
+    }
+
+    if (itsLength == 0) {
+      std::cerr << "[TBB_BlockIterator::setup] Dipoles have no samples in"
+		<< " common!" << std::endl;
+      itsPlans.clear();
+      return false;
+    }
+
+    /* Number of blocks; set up separate plans for a shorter last block */
+
+    hsize_t remainder = itsLength%blockLength;
+    hsize_t nofBlocks = itsLength/blockLength;
+
+    if (remainder > 0) {
+      block[0] = remainder;
+      itsTailPlans.resize (nofDatasets);
+      for (unsigned int n(0); n<nofDatasets; ++n) {
+	itsTailPlans[n].setup (datasets[n], block, memoryType);
+      }
+      ++nofBlocks;
+    }
+
+    /* Allocate the ring of buffers */
+
+    itsElementSize = H5Tget_size (memoryType);
+
+    return setupRing (nofBlocks,
+		      nofDatasets*blockLength*itsElementSize,
+		      nofBuffers);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                    readBlock
+
+  /*!
+    \retval buffer -- Buffer of shape [nofDipoles,nofSamples] receiving the
+            samples of the block.
+    \param index   -- Number of the block.
+    \return status -- Status of the operation.
+  */
+  bool TBB_BlockIterator::readBlock (void *buffer,
+				     hsize_t const &index)
+  {
+    bool tail      = index+1 == nofBlocks() && !itsTailPlans.empty();
+    size_t rowSize = (tail ? itsLength%itsBlockLength : itsBlockLength)*itsElementSize;
+    char *row      = static_cast<char *> (buffer);
+    hsize_t start;
+
+    for (unsigned int n(0); n<itsPlans.size(); ++n, row+=rowSize) {
+      start = itsOffsets[n] + index*itsBlockLength;
+      if (tail) {
+	if (!itsTailPlans[n].read (row, &start)) {
+	  return false;
+	}
+      } else {
+	if (!itsPlans[n].read (row, &start)) {
+	  return false;
+	}
+      }
+    }
+
+    return true;
+  }
+
+} // Namespace DAL -- end
@@ -0,0 +1,214 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#ifndef TBB_BLOCKITERATOR_H
+#define TBB_BLOCKITERATOR_H
+
+// Standard library header files
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <core/HDF5BlockIterator.h>
+
+namespace DAL { // Namespace DAL -- begin
+
+  /*!
+    \class TBB_BlockIterator
+
+    \ingroup DAL
+    \ingroup data_hl
+
+    \brief Iterate over time-aligned blocks of a set of TBB dipole datasets
+
+    \author agent
+
+    \date 2026/10/18
+
+    \test tTBB_BlockIterator.cc
+
+    <h3>Prerequisite</h3>
+
+    <ul type="square">
+      <li>DAL::TBB_DipoleDataset
+      <li>DAL::HDF5IOPlan
+      <li>DAL::HDF5BlockIterator
+    </ul>
+
+    <h3>Synopsis</h3>
+
+    The dipole datasets of a TBB dump in general do not start at the same
+    instant of time, nor do they have the same length. A TBB_BlockIterator
+    steps through a selection of dipole datasets in blocks of blockLength()
+    samples, such that block \e k holds, for every dipole, the samples taken at
+    the same instants of time: a block is a 2-dimensional array of shape
+    <tt>[nofDipoles,blockLength]</tt>, with the samples of a dipole stored
+    contiguously.
+
+    The alignment is derived from the attributes \c TIME, \c SAMPLE_NUMBER and
+    \c SAMPLE_FREQUENCY_VALUE/\c SAMPLE_FREQUENCY_UNIT of the dipole datasets:
+    the first sample of every dipole within the first block is the one recorded
+    at the time the dipole starting last began recording (see offsets()). The
+    iteration ends with the dipole ending first, i.e. all blocks hold valid
+    samples for all dipoles; the last block may be shorter (see nofSamples()).
+
+    The class derives from HDF5BlockIterator, which provides the I/O thread
+    and the ring of \c nofBuffers buffers, allocated once, such that iterating
+    over a dump of arbitrary length requires a fixed amount of memory; next()
+    hands out a pointer into the ring, which remains valid until the following
+    call to next(). TBB_BlockIterator only adds reading a block from the
+    selected dipole datasets.
+
+    <b>Note:</b> as for HDF5BlockIterator, all HDF5 calls of the iterator are
+    made holding the process-wide DAL::HDF5Lock. While the iterator is
+    running, the consumer has to hold that lock for HDF5 calls of its own, but
+    must not hold it while calling next().
+
+    <h3>Example(s)</h3>
+
+    <ol>
+      <li>Process all dipoles of a station in blocks of 65536 samples:
+      \code
+      std::vector<hid_t> dipoles;
+      std::vector<TBB_DipoleDataset> selection = station.dipoleSelection();
+      for (unsigned int n=0; n<selection.size(); ++n) {
+        dipoles.push_back (selection[n].locationID());
+      }
+
+      DAL::TBB_BlockIterator blocks (dipoles, 65536);
+      short const *block;
+
+      while ((block = blocks.next<short>())) {
+        process (block, blocks.nofDipoles(), blocks.nofSamples());
+      }
+      \endcode
+    </ol>
+  */
+  class TBB_BlockIterator : public HDF5BlockIterator {
+
+    //! Plans for reading a full block, one per dipole
+    std::vector<HDF5IOPlan> itsPlans;
+    //! Plans for reading the last (shorter) block, one per dipole
+    std::vector<HDF5IOPlan> itsTailPlans;
+    //! Offset of the first aligned sample within each of the dipole datasets
+    std::vector<hsize_t> itsOffsets;
+    //! Number of samples per dipole within a (full) block
+    hsize_t itsBlockLength;
+    //! Number of samples per dipole covered by the iteration
+    hsize_t itsLength;
+    //! Size of an element in memory, [Bytes]
+    size_t itsElementSize;
+
+  public:
+
+    // === Construction =========================================================
+
+    //! Argumented constructor, aligning the dipoles by their time attributes
+    TBB_BlockIterator (std::vector<hid_t> const &datasets,
+		       hsize_t const &blockLength,
+		       hid_t const &memoryType=H5T_NATIVE_SHORT,
+		       unsigned int const &nofBuffers=3);
+
+    //! Argumented constructor, for given offsets of the first samples
+    TBB_BlockIterator (std::vector<hid_t> const &datasets,
+		       std::vector<hsize_t> const &offsets,
+		       hsize_t const &blockLength,
+		       hid_t const &memoryType=H5T_NATIVE_SHORT,
+		       unsigned int const &nofBuffers=3);
+
+    // === Destruction ==========================================================
+
+    //! Destructor
+    ~TBB_BlockIterator ();
+
+    // === Parameter access =====================================================
+
+    //! Get the number of dipoles
+    inline unsigned int nofDipoles () const {
+      return itsPlans.size();
+    }
+
+    //! Get the offsets of the first aligned sample within the dipole datasets
+    inline std::vector<hsize_t> offsets () const {
+      return itsOffsets;
+    }
+
+    //! Get the number of samples per dipole within a (full) block
+    inline hsize_t blockLength () const {
+      return itsBlockLength;
+    }
+
+    //! Get the number of samples per dipole covered by the iteration
+    inline hsize_t length () const {
+      return itsLength;
+    }
+
+    //! Get the number of samples per dipole in the block handed out last
+    hsize_t nofSamples () const;
+
+    //! Get the shape [nofDipoles,nofSamples] of the block handed out last
+    std::vector<hsize_t> blockShape () const;
+
+    //! Get the number of elements in the block handed out last by next()
+    hsize_t nofDatapoints () const;
+
+    /*!
+      \brief Get the name of the class
+
+      \return className -- The name of the class, TBB_BlockIterator.
+    */
+    inline std::string className () const {
+      return "TBB_BlockIterator";
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    inline void summary () {
+      summary (std::cout);
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    void summary (std::ostream &os);
+
+    // === Static methods =======================================================
+
+    //! Get the offsets aligning the dipole datasets in time
+    static bool alignment (std::vector<hsize_t> &offsets,
+			   std::vector<hid_t> const &datasets);
+
+  protected:
+
+    //! Read block \c index of all dipoles into \c buffer
+    bool readBlock (void *buffer,
+		    hsize_t const &index);
+
+  private:
+
+    //! Set up the iterator
+    bool setup (std::vector<hid_t> const &datasets,
+		std::vector<hsize_t> const &offsets,
+		hsize_t const &blockLength,
+		hid_t const &memoryType,
+		unsigned int const &nofBuffers);
+
+  }; // Class TBB_BlockIterator -- end
+
+} // Namespace DAL -- end
+
+#endif /* TBB_BLOCKITERATOR_H */
@@ -19,6 +19,7 @@
  ***************************************************************************/
 
 #include <data_hl/TBB_DipoleDataset.h>
+#include <core/HDF5Handle.h>
 
 using std::cerr;
 using std::cout;
@@ -107,6 +108,20 @@ namespace DAL {  // Namespace DAL -- begin
 	  datatype);
   }
   
+  //_____________________________________________________________________________
+  //                                                            TBB_DipoleDataset
+  
+  /*!
+    \param other -- Another TBB_DipoleDataset object from which to create this
+           new one; both objects share the HDF5 identifiers.
+  */
+  TBB_DipoleDataset::TBB_DipoleDataset (TBB_DipoleDataset const &other)
+    : HDF5GroupBase ()
+  {
+    init ();
+    copy (other);
+  }
+
   // ============================================================================
   //
   //  Destruction
@@ -168,11 +183,20 @@ namespace DAL {  // Namespace DAL -- begin
   */
   void TBB_DipoleDataset::copy (TBB_DipoleDataset const &other)
   {
-    location_p  = other.location_p;
+    /* Share the identifiers of the other object rather than re-opening the
+       dataset through its file */
+    HDF5GroupBase::operator= (other);
+
     datatype_p  = other.datatype_p;
     dataspace_p = other.dataspace_p;
+    itsShape    = other.itsShape;
 
-    open (other.location_p);
+    if (datatype_p > 0 && H5Iis_valid(datatype_p)) {
+      H5Iinc_ref (datatype_p);
+    }
+    if (dataspace_p > 0 && H5Iis_valid(dataspace_p)) {
+      H5Iinc_ref (dataspace_p);
+    }
   }
   
   // ============================================================================
@@ -780,9 +804,9 @@ namespace DAL {  // Namespace DAL -- begin
     if (location_p > 0) {
       int rank          = 0;
       herr_t h5error    = 0;
-      hid_t dataspaceID = H5Dget_space(location_p);
+      HDF5Handle dataspace (H5Dget_space(location_p));
       
-      if (dataspaceID < 0) {
+      if (!dataspace.isValid()) {
 	cerr << "[TBB_DipoleDataset::readData]"
 	     << " Error retrieving filespace of dataset!" << endl;
 	return false;
@@ -790,7 +814,7 @@ namespace DAL {  // Namespace DAL -- begin
       
       /* Retrieve the rank of the dataspace asssociated with the dataset */
       
-      rank = H5Sget_simple_extent_ndims(dataspaceID);
+      rank = H5Sget_simple_extent_ndims(dataspace.id());
       
       if (rank < 0) {
 	cerr << "[TBB_DipoleDataset::readData]"
@@ -801,7 +825,7 @@ namespace DAL {  // Namespace DAL -- begin
       /* Retrieve the dimension of the dataspace, i.e. the number of samples */
       
       hsize_t shape[1];
-      h5error = H5Sget_simple_extent_dims (dataspaceID,
+      h5error = H5Sget_simple_extent_dims (dataspace.id(),
 					   shape,
 					   NULL);
       if (h5error < 0) {
@@ -815,12 +839,12 @@ namespace DAL {  // Namespace DAL -- begin
       
       /* Set up memory space to retrieve the data read from the file */
       
-      hid_t memspaceID = H5Screate_simple (rank,
-					   shape,
-					   shape);
+      HDF5Handle memspace (H5Screate_simple (rank,
+					     shape,
+					     shape));
       hsize_t offset[1];
       
-      if (dataspaceID < 0) {
+      if (!memspace.isValid()) {
 	cerr << "[TBB_DipoleDataset::readData]"
 	     << " Error creating memory space for reading in data!"
 	     << endl;
@@ -831,7 +855,7 @@ namespace DAL {  // Namespace DAL -- begin
       }
       
       /* Select the hyperslab through the data volume */
-      h5error = H5Sselect_hyperslab (dataspaceID,
+      h5error = H5Sselect_hyperslab (dataspace.id(),
 				     H5S_SELECT_SET,
 				     offset,
 				     NULL,
@@ -853,8 +877,8 @@ namespace DAL {  // Namespace DAL -- begin
       // Retrieve the actual data from the file ...
       h5error = H5Dread (location_p,
 			 H5T_NATIVE_SHORT,
-			 memspaceID,
-			 dataspaceID,
+			 memspace.id(),
+			 dataspace.id(),
 			 H5P_DEFAULT,
 			 data);
       // ... and indicate if there was an error during that procedure
@@ -864,9 +888,7 @@ namespace DAL {  // Namespace DAL -- begin
 	     << endl;
 	status = false;
       }
-      /* release HDF5 handlers */
-      h5error = H5Sclose (dataspaceID);
-      h5error = H5Sclose (memspaceID);
+      /* The HDF5 handles are released when going out of scope */
     }
     else {
       cerr << "[TBB_DipoleDataset::readData]"
@@ -923,9 +945,10 @@ namespace DAL {  // Namespace DAL -- begin
       value.push_back(static_cast<double>(pos.getValue()(1)));
       value.push_back(static_cast<double>(pos.getValue()(2)));
 
-      HDF5Attribute::write (location_p,"ANTENNA_POSITION_VALUE", value);
-      HDF5Attribute::write (location_p,"ANTENNA_POSITION_UNIT", std::vector<std::string>(3, unit));
-      HDF5Attribute::write (location_p,"ANTENNA_POSITION_FRAME", frame);
+      /* Go through setAttribute, such that the cached values are dropped */
+      setAttribute ("ANTENNA_POSITION_VALUE", value);
+      setAttribute ("ANTENNA_POSITION_UNIT", std::vector<std::string>(3, unit));
+      setAttribute ("ANTENNA_POSITION_FRAME", frame);
     } else {
 #ifdef DAL_DEBUGGING_MESSAGES
       std::cerr << "[TBB_DipoleDataset::set_antenna_position] Failed to write to group." << std::endl;
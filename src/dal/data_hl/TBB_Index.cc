@@ -0,0 +1,928 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "TBB_Index.h"
+#include <core/HDF5Attribute.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <sstream>
+#include <dirent.h>
+#include <poll.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace DAL { // Namespace DAL -- begin
+
+  //_____________________________________________________________________________
+  //                                                                  lessByStart
+
+  //! Order entries by the time of their first sample
+  static bool lessByStart (TBB_IndexEntry const &lhs,
+			   TBB_IndexEntry const &rhs)
+  {
+    return lhs.start() < rhs.start();
+  }
+
+  //_____________________________________________________________________________
+  //                                                                  startsAfter
+
+  //! Does an entry start after the given time?
+  static bool startsAfter (double const &time,
+			   TBB_IndexEntry const &entry)
+  {
+    return time < entry.start();
+  }
+
+  //_____________________________________________________________________________
+  //                                                                    entryType
+
+  //! Create the compound datatype describing a TBB_IndexEntry in memory
+  static hid_t entryType ()
+  {
+    hid_t datatype = H5Tcreate (H5T_COMPOUND, sizeof(TBB_IndexEntry));
+
+    H5Tinsert (datatype, "FILE",             HOFFSET(TBB_IndexEntry,file),            H5T_NATIVE_UINT);
+    H5Tinsert (datatype, "STATION_ID",       HOFFSET(TBB_IndexEntry,station),         H5T_NATIVE_UINT);
+    H5Tinsert (datatype, "RSP_ID",           HOFFSET(TBB_IndexEntry,rsp),             H5T_NATIVE_UINT);
+    H5Tinsert (datatype, "RCU_ID",           HOFFSET(TBB_IndexEntry,rcu),             H5T_NATIVE_UINT);
+    H5Tinsert (datatype, "TIME",             HOFFSET(TBB_IndexEntry,time),            H5T_NATIVE_UINT);
+    H5Tinsert (datatype, "SAMPLE_NUMBER",    HOFFSET(TBB_IndexEntry,sampleNumber),    H5T_NATIVE_UINT);
+    H5Tinsert (datatype, "SAMPLE_FREQUENCY", HOFFSET(TBB_IndexEntry,sampleFrequency), H5T_NATIVE_DOUBLE);
+    H5Tinsert (datatype, "DATA_LENGTH",      HOFFSET(TBB_IndexEntry,length),          H5T_NATIVE_ULLONG);
+
+    return datatype;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                    listFiles
+
+  /*!
+    \retval names    -- Names of the files found, including the path.
+    \param directory -- Directory to search, including its sub-directories.
+    \param suffix    -- Suffix of the names of the files to collect.
+    \return status   -- Returns \e false if the directory could not be opened.
+  */
+  static bool listFiles (std::vector<std::string> &names,
+			 std::string const &directory,
+			 std::string const &suffix)
+  {
+    DIR *dir = opendir (directory.c_str());
+
+    if (dir == NULL) {
+      return false;
+    }
+
+    struct dirent *entry;
+    struct stat status;
+
+    while ((entry = readdir (dir)) != NULL) {
+      std::string name (entry->d_name);
+
+      if (name == "." || name == "..") {
+	continue;
+      }
+
+      std::string path = directory + "/" + name;
+
+      if (stat (path.c_str(), &status) != 0) {
+	continue;
+      }
+
+      if (S_ISDIR(status.st_mode)) {
+	listFiles (names, path, suffix);
+      } else if (name.size() >= suffix.size()
+		 && name.compare (name.size()-suffix.size(), suffix.size(), suffix) == 0) {
+	names.push_back (path);
+      }
+    }
+
+    closedir (dir);
+
+    return true;
+  }
+
+  // ============================================================================
+  //
+  //  Construction
+  //
+  // ============================================================================
+
+  TBB_Index::TBB_Index ()
+  {
+    itsMaxDuration = 0;
+    itsNofScanned  = 0;
+    itsNofFailed   = 0;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                    TBB_Index
+
+  /*!
+    \param filename -- Name of the file, from which to load the index.
+  */
+  TBB_Index::TBB_Index (std::string const &filename)
+  {
+    itsMaxDuration = 0;
+    itsNofScanned  = 0;
+    itsNofFailed   = 0;
+
+    load (filename);
+  }
+
+  // ============================================================================
+  //
+  //  Parameters
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                      summary
+
+  /*!
+    \param os -- Output stream to which the summary is written.
+  */
+  void TBB_Index::summary (std::ostream &os)
+  {
+    os << "[TBB_Index] Summary of internal parameters." << std::endl;
+    os << "-- nof. files            = " << itsFiles.size()   << std::endl;
+    os << "-- nof. dipole datasets  = " << itsEntries.size() << std::endl;
+    os << "-- nof. files scanned    = " << itsNofScanned     << std::endl;
+    os << "-- nof. files failed     = " << itsNofFailed      << std::endl;
+
+    if (!itsEntries.empty()) {
+      double last = itsEntries[0].end();
+      for (unsigned int n(1); n<itsEntries.size(); ++n) {
+	last = std::max (last, itsEntries[n].end());
+      }
+      os.precision (15);
+      os << "-- Start of first dataset = " << itsEntries.front().start() << std::endl;
+      os << "-- End of last dataset    = " << last                       << std::endl;
+    }
+  }
+
+  // ============================================================================
+  //
+  //  Methods
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                         load
+
+  /*!
+    \param filename -- Name of the file, from which to load the index.
+    \return status  -- Status of the operation; returns \e false in case an error
+            was encountered, in which case the index is left empty.
+  */
+  bool TBB_Index::load (std::string const &filename)
+  {
+    itsFiles.clear();
+    itsEntries.clear();
+    itsMaxDuration = 0;
+
+    hid_t fileID = H5Fopen (filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+
+    if (fileID < 0) {
+      std::cerr << "[TBB_Index::load] Failed to open file " << filename
+		<< std::endl;
+      return false;
+    }
+
+    bool status (true);
+    hid_t files    = H5Dopen (fileID, "FILES",      H5P_DEFAULT);
+    hid_t sizes    = H5Dopen (fileID, "FILE_SIZE",  H5P_DEFAULT);
+    hid_t mtimes   = H5Dopen (fileID, "FILE_MTIME", H5P_DEFAULT);
+    hid_t dipoles  = H5Dopen (fileID, "DIPOLES",    H5P_DEFAULT);
+
+    if (files < 0 || sizes < 0 || mtimes < 0 || dipoles < 0) {
+      std::cerr << "[TBB_Index::load] File " << filename
+		<< " does not contain a TBB index!" << std::endl;
+      status = false;
+    }
+
+    // Files _______________________________________________
+
+    if (status) {
+      hid_t dataspace = H5Dget_space (files);
+      hssize_t nofFiles = H5Sget_simple_extent_npoints (dataspace);
+
+      if (nofFiles > 0) {
+	std::vector<char *> names (nofFiles);
+	std::vector<long long> size (nofFiles);
+	std::vector<long long> mtime (nofFiles);
+	hid_t stringType = H5Tcopy (H5T_C_S1);
+	H5Tset_size (stringType, H5T_VARIABLE);
+
+	status = H5Dread (files,  stringType,       H5S_ALL, H5S_ALL, H5P_DEFAULT, &names[0]) >= 0
+	  &&     H5Dread (sizes,  H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, &size[0])  >= 0
+	  &&     H5Dread (mtimes, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, &mtime[0]) >= 0;
+
+	if (status) {
+	  itsFiles.resize (nofFiles);
+	  for (hssize_t n(0); n<nofFiles; ++n) {
+	    itsFiles[n].name  = names[n];
+	    itsFiles[n].size  = size[n];
+	    itsFiles[n].mtime = mtime[n];
+	  }
+	  H5Dvlen_reclaim (stringType, dataspace, H5P_DEFAULT, &names[0]);
+	}
+
+	H5Tclose (stringType);
+      }
+
+      H5Sclose (dataspace);
+    }
+
+    // Dipole datasets _____________________________________
+
+    if (status) {
+      hid_t dataspace     = H5Dget_space (dipoles);
+      hssize_t nofEntries = H5Sget_simple_extent_npoints (dataspace);
+
+      if (nofEntries > 0) {
+	hid_t datatype = entryType ();
+
+	itsEntries.resize (nofEntries);
+	status = H5Dread (dipoles,
+			  datatype,
+			  H5S_ALL,
+			  H5S_ALL,
+			  H5P_DEFAULT,
+			  &itsEntries[0]) >= 0;
+
+	H5Tclose (datatype);
+      }
+
+      H5Sclose (dataspace);
+    }
+
+    if (dipoles >= 0) H5Dclose (dipoles);
+    if (mtimes >= 0)  H5Dclose (mtimes);
+    if (sizes >= 0)   H5Dclose (sizes);
+    if (files >= 0)   H5Dclose (files);
+    H5Fclose (fileID);
+
+    if (status) {
+      sort ();
+    } else {
+      std::cerr << "[TBB_Index::load] Failed to read index from " << filename
+		<< std::endl;
+      itsFiles.clear();
+      itsEntries.clear();
+    }
+
+    return status;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                         save
+
+  /*!
+    \param filename -- Name of the file, to which the index is written; an
+           existing file is overwritten.
+    \return status  -- Status of the operation; returns \e false in case an error
+            was encountered.
+  */
+  bool TBB_Index::save (std::string const &filename) const
+  {
+    hid_t fileID = H5Fcreate (filename.c_str(),
+			      H5F_ACC_TRUNC,
+			      H5P_DEFAULT,
+			      H5P_DEFAULT);
+
+    if (fileID < 0) {
+      std::cerr << "[TBB_Index::save] Failed to create file " << filename
+		<< std::endl;
+      return false;
+    }
+
+    bool status (true);
+    hsize_t nofFiles   = itsFiles.size();
+    hsize_t nofEntries = itsEntries.size();
+    std::vector<char const *> names (nofFiles);
+    std::vector<long long> size (nofFiles);
+    std::vector<long long> mtime (nofFiles);
+
+    for (hsize_t n(0); n<nofFiles; ++n) {
+      names[n] = itsFiles[n].name.c_str();
+      size[n]  = itsFiles[n].size;
+      mtime[n] = itsFiles[n].mtime;
+    }
+
+    hid_t stringType  = H5Tcopy (H5T_C_S1);
+    hid_t datatype    = entryType ();
+    hid_t filespace   = H5Screate_simple (1, &nofFiles, NULL);
+    hid_t dipolespace = H5Screate_simple (1, &nofEntries, NULL);
+
+    H5Tset_size (stringType, H5T_VARIABLE);
+
+    hid_t files   = H5Dcreate (fileID, "FILES",      stringType,     filespace,   H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    hid_t sizes   = H5Dcreate (fileID, "FILE_SIZE",  H5T_STD_I64LE,  filespace,   H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    hid_t mtimes  = H5Dcreate (fileID, "FILE_MTIME", H5T_STD_I64LE,  filespace,   H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    hid_t dipoles = H5Dcreate (fileID, "DIPOLES",    datatype,       dipolespace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+
+    if (files < 0 || sizes < 0 || mtimes < 0 || dipoles < 0) {
+      status = false;
+    }
+
+    if (status && nofFiles > 0) {
+      status = H5Dwrite (files,  stringType,       H5S_ALL, H5S_ALL, H5P_DEFAULT, &names[0]) >= 0
+	&&     H5Dwrite (sizes,  H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, &size[0])  >= 0
+	&&     H5Dwrite (mtimes, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, &mtime[0]) >= 0;
+    }
+
+    if (status && nofEntries > 0) {
+      status = H5Dwrite (dipoles,
+			 datatype,
+			 H5S_ALL,
+			 H5S_ALL,
+			 H5P_DEFAULT,
+			 &itsEntries[0]) >= 0;
+    }
+
+    if (!status) {
+      std::cerr << "[TBB_Index::save] Failed to write index to " << filename
+		<< std::endl;
+    }
+
+    if (dipoles >= 0) H5Dclose (dipoles);
+    if (mtimes >= 0)  H5Dclose (mtimes);
+    if (sizes >= 0)   H5Dclose (sizes);
+    if (files >= 0)   H5Dclose (files);
+    H5Sclose (dipolespace);
+    H5Sclose (filespace);
+    H5Tclose (datatype);
+    H5Tclose (stringType);
+    H5Fclose (fileID);
+
+    return status;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                       update
+
+  /*!
+    \param directory  -- Directory holding the TBB dumps; sub-directories are
+           searched as well.
+    \param nofWorkers -- Number of worker processes scanning the files; if set
+           to 0 the number is derived from the number of available processors.
+    \param suffix     -- Suffix of the names of the files to index.
+    \return status    -- Status of the operation; returns \e false in case the
+            directory could not be read.
+
+    Files found within the directory are scanned if they are not yet part of
+    the index, or if their size or modification time has changed since they
+    were indexed. Files which were indexed from within the directory but no
+    longer are found are removed from the index; files from other directories
+    are left untouched. Files which cannot be scanned are not registered
+    within the index.
+  */
+  bool TBB_Index::update (std::string const &directory,
+			  unsigned int const &nofWorkers,
+			  std::string const &suffix)
+  {
+    std::string path (directory);
+    std::vector<std::string> names;
+
+    while (path.size() > 1 && path[path.size()-1] == '/') {
+      path.erase (path.size()-1);
+    }
+
+    if (!listFiles (names, path, suffix)) {
+      std::cerr << "[TBB_Index::update] Failed to read directory " << directory
+		<< std::endl;
+      return false;
+    }
+
+    std::sort (names.begin(), names.end());
+
+    // Sort out which files need to be scanned _____________
+
+    std::string prefix = path + "/";
+    std::map<std::string,unsigned int> known;
+    std::vector<TBB_IndexFile> files;
+    std::vector<int> previous;
+    std::vector<std::string> pending;
+    std::vector<unsigned int> pendingIndex;
+
+    for (unsigned int n(0); n<itsFiles.size(); ++n) {
+      if (itsFiles[n].name.compare (0, prefix.size(), prefix) == 0) {
+	known[itsFiles[n].name] = n;
+      } else {
+	/* Keep files from outside the directory as they are */
+	files.push_back (itsFiles[n]);
+	previous.push_back (n);
+      }
+    }
+
+    for (unsigned int n(0); n<names.size(); ++n) {
+      struct stat status;
+      TBB_IndexFile file;
+
+      if (stat (names[n].c_str(), &status) != 0) {
+	continue;
+      }
+
+      file.name  = names[n];
+      file.size  = status.st_size;
+      file.mtime = status.st_mtime;
+
+      std::map<std::string,unsigned int>::iterator it = known.find (names[n]);
+
+      if (it != known.end()
+	  && itsFiles[it->second].size  == file.size
+	  && itsFiles[it->second].mtime == file.mtime) {
+	previous.push_back (it->second);
+      } else {
+	previous.push_back (-1);
+	pending.push_back (file.name);
+	pendingIndex.push_back (files.size());
+      }
+
+      files.push_back (file);
+    }
+
+    // Scan the new and changed files ______________________
+
+    std::vector<std::vector<TBB_IndexEntry> > results;
+    std::vector<bool> scanned;
+
+    scan (results, scanned, pending, nofWorkers);
+
+    /* Files which could not be scanned are dropped */
+    std::vector<bool> keep (files.size(), true);
+    unsigned int nofFailed (0);
+
+    for (unsigned int n(0); n<pending.size(); ++n) {
+      if (!scanned[n]) {
+	std::cerr << "[TBB_Index::update] Failed to scan file " << pending[n]
+		  << std::endl;
+	keep[pendingIndex[n]] = false;
+	++nofFailed;
+      }
+    }
+
+    // Rebuild the list of entries _________________________
+
+    std::vector<int> remap (itsFiles.size(), -1);
+    std::vector<int> position (files.size(), -1);
+    std::vector<TBB_IndexFile> kept;
+    std::vector<TBB_IndexEntry> entries;
+
+    for (unsigned int n(0); n<files.size(); ++n) {
+      if (keep[n]) {
+	position[n] = kept.size();
+	kept.push_back (files[n]);
+	if (previous[n] >= 0) {
+	  remap[previous[n]] = position[n];
+	}
+      }
+    }
+
+    for (unsigned int n(0); n<itsEntries.size(); ++n) {
+      if (remap[itsEntries[n].file] >= 0) {
+	entries.push_back (itsEntries[n]);
+	entries.back().file = remap[itsEntries[n].file];
+      }
+    }
+
+    for (unsigned int n(0); n<results.size(); ++n) {
+      if (!scanned[n]) {
+	continue;
+      }
+      for (unsigned int k(0); k<results[n].size(); ++k) {
+	entries.push_back (results[n][k]);
+	entries.back().file = position[pendingIndex[n]];
+      }
+    }
+
+    itsFiles.swap (kept);
+    itsEntries.swap (entries);
+    itsNofScanned = pending.size()-nofFailed;
+    itsNofFailed  = nofFailed;
+
+    sort ();
+
+    return true;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                        query
+
+  /*!
+    \param start    -- Start of the window of time, [s].
+    \param end      -- End of the window of time, [s].
+    \param stations -- Stations to consider; if empty, all stations are
+           considered.
+    \return entries -- Dipole datasets holding data within the window
+            <tt>[start,end]</tt>, sorted by the time of their first sample.
+  */
+  std::vector<TBB_IndexEntry> TBB_Index::query (double const &start,
+						double const &end,
+						std::set<unsigned int> const &stations) const
+  {
+    std::vector<TBB_IndexEntry> result;
+
+    if (end < start || itsEntries.empty()) {
+      return result;
+    }
+
+    /* Entries starting after the end of the window cannot overlap; going
+       back from there, the search ends once even the longest dataset would
+       end before the start of the window. */
+    std::vector<TBB_IndexEntry>::const_iterator it = std::upper_bound (itsEntries.begin(),
+									 itsEntries.end(),
+									 end,
+									 startsAfter);
+
+    while (it != itsEntries.begin()) {
+      --it;
+      if (it->start() + itsMaxDuration < start) {
+	break;
+      }
+      if (it->end() > start
+	  && (stations.empty() || stations.count (it->station))) {
+	result.push_back (*it);
+      }
+    }
+
+    std::reverse (result.begin(), result.end());
+
+    return result;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                         gaps
+
+  /*!
+    \param station -- Station ID.
+    \param start   -- Start of the window of time, [s].
+    \param end     -- End of the window of time, [s].
+    \return gaps   -- Periods within the window <tt>[start,end]</tt> for which
+            none of the dipole datasets of the station holds data.
+  */
+  std::vector<std::pair<double,double> > TBB_Index::gaps (unsigned int const &station,
+							  double const &start,
+							  double const &end) const
+  {
+    std::vector<std::pair<double,double> > result;
+    std::set<unsigned int> stations;
+
+    stations.insert (station);
+
+    std::vector<TBB_IndexEntry> entries = query (start, end, stations);
+    double covered = start;
+
+    for (unsigned int n(0); n<entries.size(); ++n) {
+      if (entries[n].start() > covered) {
+	result.push_back (std::make_pair (covered, std::min (entries[n].start(), end)));
+      }
+      covered = std::max (covered, entries[n].end());
+    }
+
+    if (covered < end) {
+      result.push_back (std::make_pair (covered, end));
+    }
+
+    return result;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                         sort
+
+  void TBB_Index::sort ()
+  {
+    std::stable_sort (itsEntries.begin(), itsEntries.end(), lessByStart);
+
+    itsMaxDuration = 0;
+    for (unsigned int n(0); n<itsEntries.size(); ++n) {
+      itsMaxDuration = std::max (itsMaxDuration,
+				 itsEntries[n].end()-itsEntries[n].start());
+    }
+  }
+
+  //_____________________________________________________________________________
+  //                                                                         scan
+
+  /*!
+    \retval entries   -- Parameters of the dipole datasets, one vector per file.
+    \retval scanned   -- For each of the files, whether it has been scanned
+            successfully.
+    \param filenames  -- Names of the files to scan.
+    \param nofWorkers -- Number of worker processes; if set to 0 the number is
+           derived from the number of available processors.
+
+    The files are distributed round-robin over the worker processes, each of
+    which reports the parameters of the dipole datasets back through a pipe:
+    one line per dataset (tag \c E), followed by a line with the outcome of
+    the scan (tag \c F) once a file is done. Only files reported as done are
+    taken over from a worker. Files assigned to a worker which could not be
+    started, or which were not reached by a worker terminating abnormally,
+    are scanned by the calling process; the file a worker was scanning when
+    it terminated is considered to have failed, as scanning it in the calling
+    process might bring that one down as well.
+  */
+  void TBB_Index::scan (std::vector<std::vector<TBB_IndexEntry> > &entries,
+			std::vector<bool> &scanned,
+			std::vector<std::string> const &filenames,
+			unsigned int const &nofWorkers)
+  {
+    unsigned int nofFiles = filenames.size();
+    unsigned int workers  = nofWorkers;
+
+    entries.assign (nofFiles, std::vector<TBB_IndexEntry>());
+    scanned.assign (nofFiles, false);
+
+    if (workers == 0) {
+      long nofProcessors = sysconf (_SC_NPROCESSORS_ONLN);
+      workers = nofProcessors > 0 ? nofProcessors : 1;
+    }
+    if (workers > nofFiles) {
+      workers = nofFiles;
+    }
+
+    // Start the worker processes __________________________
+
+    std::vector<pid_t> pids;
+    std::vector<int> pipes;
+
+    if (workers > 1) {
+      /* Output buffered so far otherwise would be written by every worker */
+      std::cout.flush();
+      std::cerr.flush();
+      fflush (NULL);
+
+      for (unsigned int worker(0); worker<workers; ++worker) {
+	int fd[2];
+
+	if (pipe (fd) != 0) {
+	  break;
+	}
+
+	pid_t pid = fork ();
+
+	if (pid == 0) {
+	  close (fd[0]);
+	  FILE *out = fdopen (fd[1], "w");
+
+	  for (unsigned int n(worker); n<nofFiles; n+=workers) {
+	    std::vector<TBB_IndexEntry> result;
+	    bool status = scan (result, filenames[n]);
+	    for (unsigned int k(0); status && k<result.size(); ++k) {
+	      fprintf (out, "E %u %u %u %u %u %u %.17g %llu\n",
+		       n,
+		       result[k].station,
+		       result[k].rsp,
+		       result[k].rcu,
+		       result[k].time,
+		       result[k].sampleNumber,
+		       result[k].sampleFrequency,
+		       result[k].length);
+	    }
+	    fprintf (out, "F %u %d\n", n, status ? 1 : 0);
+	    /* Files done are known to the parent, should the worker fail later */
+	    fflush (out);
+	  }
+
+	  fclose (out);
+	  /* Leave without running the exit handlers of the parent's HDF5 */
+	  _exit (0);
+	} else if (pid > 0) {
+	  close (fd[1]);
+	  pids.push_back (pid);
+	  pipes.push_back (fd[0]);
+	} else {
+	  close (fd[0]);
+	  close (fd[1]);
+	  break;
+	}
+      }
+    }
+
+    // Collect the results of the workers __________________
+
+    std::vector<std::string> output (pipes.size());
+    std::vector<struct pollfd> fds (pipes.size());
+    unsigned int nofOpen = pipes.size();
+    char buffer[4096];
+
+    for (unsigned int n(0); n<pipes.size(); ++n) {
+      fds[n].fd     = pipes[n];
+      fds[n].events = POLLIN;
+    }
+
+    while (nofOpen > 0) {
+      if (poll (&fds[0], fds.size(), -1) < 0) {
+	break;
+      }
+      for (unsigned int n(0); n<fds.size(); ++n) {
+	if (fds[n].fd >= 0 && fds[n].revents) {
+	  ssize_t nbytes = read (fds[n].fd, buffer, sizeof(buffer));
+	  if (nbytes > 0) {
+	    output[n].append (buffer, nbytes);
+	  } else {
+	    close (fds[n].fd);
+	    fds[n].fd = -1;
+	    --nofOpen;
+	  }
+	}
+      }
+    }
+
+    std::vector<bool> exited (pids.size(), false);
+
+    for (unsigned int n(0); n<pids.size(); ++n) {
+      int status (0);
+      exited[n] = waitpid (pids[n], &status, 0) == pids[n]
+	&& WIFEXITED(status)
+	&& WEXITSTATUS(status) == 0;
+      if (!exited[n]) {
+	std::cerr << "[TBB_Index::scan] Worker process " << pids[n]
+		  << " terminated abnormally" << std::endl;
+      }
+    }
+
+    std::vector<bool> done (nofFiles, false);
+
+    for (unsigned int n(0); n<output.size(); ++n) {
+      std::istringstream lines (output[n]);
+      std::vector<std::vector<TBB_IndexEntry> > pending (nofFiles);
+      std::string line;
+
+      /* An incomplete last line, if any, is not taken over */
+      while (std::getline (lines, line) && !lines.eof()) {
+	std::istringstream fields (line);
+	std::string tag;
+	unsigned int file;
+	TBB_IndexEntry entry;
+	int status;
+
+	entry.file = 0;
+	if (!(fields >> tag >> file) || file >= nofFiles) {
+	  continue;
+	}
+	if (tag == "E"
+	    && fields >> entry.station
+	    >> entry.rsp
+	    >> entry.rcu
+	    >> entry.time
+	    >> entry.sampleNumber
+	    >> entry.sampleFrequency
+	    >> entry.length) {
+	  pending[file].push_back (entry);
+	} else if (tag == "F" && fields >> status) {
+	  entries[file].swap (pending[file]);
+	  scanned[file] = status != 0;
+	  done[file]    = true;
+	}
+      }
+    }
+
+    // Scan the files left over ____________________________
+
+    unsigned int nofStarted = pids.size();
+
+    for (unsigned int n(0); n<nofFiles; ++n) {
+      if (done[n]) {
+	continue;
+      }
+      if (workers > 1 && n%workers < nofStarted && !exited[n%workers]) {
+	/* First file not done by a failed worker is the one it failed on */
+	bool failedOn (true);
+	for (unsigned int k(n%workers); k<n; k+=workers) {
+	  if (!done[k]) {
+	    failedOn = false;
+	    break;
+	  }
+	}
+	if (failedOn) {
+	  continue;
+	}
+      }
+      scanned[n] = scan (entries[n], filenames[n]);
+    }
+  }
+
+  // ============================================================================
+  //
+  //  Static methods
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                         scan
+
+  /*!
+    \retval entries  -- Parameters of the dipole datasets contained in the file;
+            the file number of the entries is set to 0.
+    \param filename  -- Name of the TBB time-series file.
+    \return status   -- Status of the operation; returns \e false if the file
+            could not be opened.
+
+    Only the time attributes and the shape of the dipole datasets are read;
+    dipole datasets lacking the time attributes are skipped. The station, RSP
+    and RCU ID are taken from the name of the dataset (see
+    TBB_DipoleDataset::dipoleName), falling back to the attributes if the
+    name does not follow the convention.
+  */
+  bool TBB_Index::scan (std::vector<TBB_IndexEntry> &entries,
+			std::string const &filename)
+  {
+    entries.clear();
+
+    hid_t fileID = H5Fopen (filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+
+    if (fileID < 0) {
+      std::cerr << "[TBB_Index::scan] Failed to open file " << filename
+		<< std::endl;
+      return false;
+    }
+
+    std::set<std::string> groups;
+    std::set<std::string>::iterator group;
+
+    h5get_names (groups, fileID, H5G_GROUP);
+
+    for (group=groups.begin(); group!=groups.end(); ++group) {
+      if (group->compare (0, 7, "Station") != 0) {
+	continue;
+      }
+
+      hid_t groupID = H5Gopen (fileID, group->c_str(), H5P_DEFAULT);
+      std::set<std::string> datasets;
+      std::set<std::string>::iterator dataset;
+
+      h5get_names (datasets, groupID, H5G_DATASET);
+
+      for (dataset=datasets.begin(); dataset!=datasets.end(); ++dataset) {
+	hid_t datasetID = H5Dopen (groupID, dataset->c_str(), H5P_DEFAULT);
+	TBB_IndexEntry entry;
+	std::string unit;
+	bool status (true);
+
+	entry.file = 0;
+
+	if (dataset->size() != 9
+	    || sscanf (dataset->c_str(), "%3u%3u%3u",
+		       &entry.station, &entry.rsp, &entry.rcu) != 3) {
+	  status = HDF5Attribute::read (datasetID, "STATION_ID", entry.station)
+	    && HDF5Attribute::read (datasetID, "RSP_ID", entry.rsp)
+	    && HDF5Attribute::read (datasetID, "RCU_ID", entry.rcu);
+	}
+
+	status = status
+	  && HDF5Attribute::read (datasetID, "TIME", entry.time)
+	  && HDF5Attribute::read (datasetID, "SAMPLE_NUMBER", entry.sampleNumber)
+	  && HDF5Attribute::read (datasetID, "SAMPLE_FREQUENCY_VALUE", entry.sampleFrequency)
+	  && HDF5Attribute::read (datasetID, "SAMPLE_FREQUENCY_UNIT", unit);
+
+	if (status) {
+	  /* Sample frequency in Hz */
+	  if (unit == "GHz") {
+	    entry.sampleFrequency *= 1e9;
+	  } else if (unit == "MHz") {
+	    entry.sampleFrequency *= 1e6;
+	  } else if (unit == "kHz") {
+	    entry.sampleFrequency *= 1e3;
+	  }
+
+	  hid_t dataspace = H5Dget_space (datasetID);
+	  entry.length    = H5Sget_simple_extent_npoints (dataspace);
+	  H5Sclose (dataspace);
+
+	  entries.push_back (entry);
+	}
+
+	H5Dclose (datasetID);
+      }
+
+      H5Gclose (groupID);
+    }
+
+    H5Fclose (fileID);
+
+    return true;
+  }
+
+} // Namespace DAL -- end
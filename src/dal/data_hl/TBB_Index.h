@@ -0,0 +1,273 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#ifndef TBB_INDEX_H
+#define TBB_INDEX_H
+
+// Standard library header files
+#include <iostream>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <core/dalCommon.h>
+
+namespace DAL { // Namespace DAL -- begin
+
+  /*!
+    \brief Entry of a TBB_Index, describing a single dipole dataset
+  */
+  struct TBB_IndexEntry {
+    //! Number of the file within the index, see TBB_Index::files()
+    unsigned int file;
+    //! Station ID
+    unsigned int station;
+    //! RSP ID
+    unsigned int rsp;
+    //! RCU ID
+    unsigned int rcu;
+    //! Time of the first sample, full seconds (attribute \c TIME)
+    unsigned int time;
+    //! Number of the first sample within the second (\c SAMPLE_NUMBER)
+    unsigned int sampleNumber;
+    //! Sample frequency, [Hz]
+    double sampleFrequency;
+    //! Number of samples
+    unsigned long long length;
+
+    //! Time of the first sample, [s]
+    inline double start () const {
+      return time + (sampleFrequency > 0 ? sampleNumber/sampleFrequency : 0.0);
+    }
+
+    //! Time just after the last sample, [s]
+    inline double end () const {
+      return start() + (sampleFrequency > 0 ? length/sampleFrequency : 0.0);
+    }
+  };
+
+  /*!
+    \brief File registered within a TBB_Index
+  */
+  struct TBB_IndexFile {
+    //! Name of the file, including the path
+    std::string name;
+    //! Size of the file at the time it was indexed, [Bytes]
+    long long size;
+    //! Modification time of the file at the time it was indexed
+    long long mtime;
+  };
+
+  /*!
+    \class TBB_Index
+
+    \ingroup DAL
+    \ingroup data_hl
+
+    \brief Catalogue of the dipole datasets contained in an archive of TBB dumps
+
+    \author agent
+
+    \date 2026/10/18
+
+    \test tTBB_Index.cc
+
+    <h3>Prerequisite</h3>
+
+    <ul type="square">
+      <li>DAL::TBB_Timeseries
+      <li>DAL::TBB_StationGroup
+      <li>DAL::TBB_DipoleDataset
+    </ul>
+
+    <h3>Synopsis</h3>
+
+    In order to find out which of the files of an archive of TBB dumps hold
+    data of a given station within a given window of time, every file would
+    have to be opened and the time attributes of all of its dipole datasets
+    would have to be read. A TBB_Index collects these parameters -- station,
+    RSP and RCU ID, time of the first sample, sample frequency and number of
+    samples -- for all dipole datasets of all files into a compact catalogue,
+    which is kept in memory sorted by time and can be stored to and loaded
+    from disk:
+
+    \verbatim
+    /                             ... Root group
+    |-- FILES                     ... Names of the indexed files
+    |-- FILE_SIZE                 ... Size of the files when indexed
+    |-- FILE_MTIME                ... Modification time of the files
+    `-- DIPOLES                   ... Table of TBB_IndexEntry records
+    \endverbatim
+
+    update() walks an archive directory and (re-)scans only the files which
+    are new or have changed since they were indexed last, and drops files
+    which have disappeared; an index therefore is kept up to date by calling
+    update() whenever new dumps have arrived. As the HDF5 library in general
+    is not built thread-safe, the files are scanned by a number of worker
+    processes rather than threads, each of them running its own instance of
+    the library. Files which cannot be scanned (e.g. corrupted dumps) are not
+    registered within the index, such that they are tried again by the next
+    update(); see nofFailed().
+
+    query() returns the dipole datasets overlapping with a window of time,
+    optionally restricted to a set of stations; gaps() returns the periods
+    within a window of time not covered by any dataset of a station.
+
+    <h3>Example(s)</h3>
+
+    <ol>
+      <li>Bring the index of an archive up to date and store it:
+      \code
+      DAL::TBB_Index index ("archive.idx");
+      index.update ("/data/tbb");
+      index.save ("archive.idx");
+      \endcode
+      <li>Find the datasets of stations 2 and 5 covering a given time window:
+      \code
+      std::set<unsigned int> stations;
+      stations.insert (2);
+      stations.insert (5);
+
+      std::vector<DAL::TBB_IndexEntry> result = index.query (t0, t1, stations);
+
+      for (unsigned int n=0; n<result.size(); ++n) {
+        std::cout << index.files()[result[n].file].name << std::endl;
+      }
+      \endcode
+    </ol>
+  */
+  class TBB_Index {
+
+    //! Files registered within the index
+    std::vector<TBB_IndexFile> itsFiles;
+    //! Dipole datasets, sorted by the time of their first sample
+    std::vector<TBB_IndexEntry> itsEntries;
+    //! Longest duration of any of the datasets, [s]
+    double itsMaxDuration;
+    //! Number of files scanned by the last call to update()
+    unsigned int itsNofScanned;
+    //! Number of files which could not be scanned by the last call to update()
+    unsigned int itsNofFailed;
+
+  public:
+
+    // === Construction =========================================================
+
+    //! Default constructor
+    TBB_Index ();
+
+    //! Argumented constructor, loading an index from disk
+    TBB_Index (std::string const &filename);
+
+    // === Parameter access =====================================================
+
+    //! Get the number of files registered within the index
+    inline unsigned int nofFiles () const {
+      return itsFiles.size();
+    }
+
+    //! Get the number of dipole datasets registered within the index
+    inline unsigned int nofEntries () const {
+      return itsEntries.size();
+    }
+
+    //! Get the files registered within the index
+    inline std::vector<TBB_IndexFile> const & files () const {
+      return itsFiles;
+    }
+
+    //! Get the dipole datasets, sorted by the time of their first sample
+    inline std::vector<TBB_IndexEntry> const & entries () const {
+      return itsEntries;
+    }
+
+    //! Get the number of files scanned by the last call to update()
+    inline unsigned int nofScanned () const {
+      return itsNofScanned;
+    }
+
+    //! Get the number of files which could not be scanned by the last update()
+    inline unsigned int nofFailed () const {
+      return itsNofFailed;
+    }
+
+    /*!
+      \brief Get the name of the class
+
+      \return className -- The name of the class, TBB_Index.
+    */
+    inline std::string className () const {
+      return "TBB_Index";
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    inline void summary () {
+      summary (std::cout);
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    void summary (std::ostream &os);
+
+    // === Methods ==============================================================
+
+    //! Load the index from disk
+    bool load (std::string const &filename);
+
+    //! Store the index on disk
+    bool save (std::string const &filename) const;
+
+    //! Bring the index up to date with the files found within a directory
+    bool update (std::string const &directory,
+		 unsigned int const &nofWorkers=0,
+		 std::string const &suffix="_tbb.h5");
+
+    //! Get the dipole datasets overlapping with a window of time
+    std::vector<TBB_IndexEntry> query (double const &start,
+				       double const &end,
+				       std::set<unsigned int> const &stations=std::set<unsigned int>()) const;
+
+    //! Get the periods within a window of time not covered by a station
+    std::vector<std::pair<double,double> > gaps (unsigned int const &station,
+						 double const &start,
+						 double const &end) const;
+
+    // === Static methods =======================================================
+
+    //! Collect the parameters of the dipole datasets contained in a file
+    static bool scan (std::vector<TBB_IndexEntry> &entries,
+		      std::string const &filename);
+
+  private:
+
+    //! Scan a list of files, using a number of worker processes
+    void scan (std::vector<std::vector<TBB_IndexEntry> > &entries,
+	       std::vector<bool> &scanned,
+	       std::vector<std::string> const &filenames,
+	       unsigned int const &nofWorkers);
+
+    //! Sort the entries and update the longest duration of the datasets
+    void sort ();
+
+  }; // Class TBB_Index -- end
+
+} // Namespace DAL -- end
+
+#endif /* TBB_INDEX_H */
@@ -84,6 +84,21 @@ namespace DAL {  // Namespace DAL -- begin
     open (groupID);
   }
   
+  //_____________________________________________________________________________
+  //                                                             TBB_StationGroup
+  
+  /*!
+    \param other -- Another TBB_StationGroup object from which to create this
+           new one; both objects share the HDF5 identifier of the group.
+  */
+  TBB_StationGroup::TBB_StationGroup (TBB_StationGroup const &other)
+    : HDF5GroupBase ()
+  {
+    location_p             = 0;
+    nofTriggeredAntennas_p = 0;
+    copy (other);
+  }
+  
   // ============================================================================
   //
   //  Destruction
@@ -105,6 +120,8 @@ namespace DAL {  // Namespace DAL -- begin
   {
     herr_t h5error;
     H5I_type_t object_type = H5Iget_type(location_p);
+    // embedded objects are released before the group itself
+    datasets_p.clear();
     // release HDF5 object
     if (object_type == H5I_GROUP && H5Iis_valid(location_p)) {
       h5error = H5Gclose(location_p);
@@ -145,9 +162,15 @@ namespace DAL {  // Namespace DAL -- begin
   */
   void TBB_StationGroup::copy (TBB_StationGroup const &other)
   {
-    location_p  = other.location_p;
-
-    open (other.location_p);
+    /* Share the identifier of the other object rather than re-opening the
+       group through its file */
+    HDF5GroupBase::operator= (other);
+
+    stationID_p            = other.stationID_p;
+    stationTrigger_p       = other.stationTrigger_p;
+    nofTriggeredAntennas_p = other.nofTriggeredAntennas_p;
+    datasets_p             = other.datasets_p;
+    selectedDatasets_p     = other.selectedDatasets_p;
   }
   
   // ============================================================================
@@ -319,35 +342,22 @@ namespace DAL {  // Namespace DAL -- begin
     bool status = true;
 
     if (H5Iis_valid(location_p)) {
-      std::set<std::string> groups;
-      std::set<std::string> datasets;
-      std::set<std::string>::iterator it;
-
-      h5get_names (groups,location_p,H5G_GROUP);
-      h5get_names (datasets,location_p,H5G_DATASET);
-
       // Open station calibration group ____________________
 
       // Open station trigger group ________________________
 
-      it = groups.find(TBB_StationTrigger::getName());
-
       stationTrigger_p = TBB_StationTrigger (location_p,
 					     TBB_StationTrigger::getName(),
 					     flags);
 
-      // Open dipole datasets ______________________________
+      // Enumerate dipole datasets; they are opened on first access
 
-      if (datasets.size() > 0) {
-	datasets_p.clear();
-	for (it=datasets.begin(); it!=datasets.end(); ++it) {
-	  datasets_p[*it] = TBB_DipoleDataset(location_p,*it,flags);
-	}
-      } else {
-	status = false;
-      }
+      status = datasets_p.enumerate (location_p,
+				     H5G_DATASET,
+				     handleLimit())
+	&& datasets_p.size() > 0;
 
-      status *= selectAllDipoles ();
+      status = selectAllDipoles () && status;
 
     } else {
       std::cerr << "[TBB_StationGroup::setDipoleDatasets]"
@@ -431,14 +441,50 @@ namespace DAL {  // Namespace DAL -- begin
   */
   std::set<std::string> TBB_StationGroup::selectedDipoles ()
   {
-    std::set<std::string> selection;
-    std::map<std::string,iterDipoleDataset>::iterator it;
-    
+    return selectedDatasets_p;
+  }
+
+  //_____________________________________________________________________________
+  //                                                              dipoleSelection
+  
+  /*!
+    \return datasets -- The selected dipole datasets, ordered by their names;
+            the objects share the HDF5 identifiers with the datasets held by
+            the station group, keeping them open for as long as they exist.
+  */
+  std::vector<TBB_DipoleDataset> TBB_StationGroup::dipoleSelection ()
+  {
+    std::vector<TBB_DipoleDataset> datasets;
+    std::set<std::string>::iterator it;
+
     for (it=selectedDatasets_p.begin(); it!=selectedDatasets_p.end(); ++it) {
-      selection.insert(it->first);
-    }    
+      datasets.push_back (dipoleDataset (*it));
+    }
+
+    return datasets;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                dipoleDataset
+  
+  /*!
+    \param name -- Name of the dipole dataset.
+    \return dataset -- The dipole dataset, sharing its HDF5 identifier with the
+            one held by the station group; if there is no dataset of this name
+            an empty object is returned.
+  */
+  TBB_DipoleDataset TBB_StationGroup::dipoleDataset (std::string const &name)
+  {
+    TBB_DipoleDataset *dataset = datasets_p.find(name);
 
-    return selection;
+    if (dataset != NULL) {
+      return *dataset;
+    } else {
+      std::cerr << "[TBB_StationGroup::dipoleDataset]"
+		<< " No such dipole dataset " << name
+		<< std::endl;
+      return TBB_DipoleDataset();
+    }
   }
   
   //_____________________________________________________________________________
@@ -462,15 +508,12 @@ namespace DAL {  // Namespace DAL -- begin
     
     bool status (true);
     std::set<std::string>::iterator iterInput;
-    std::map<std::string,iterDipoleDataset> tmpSelection;
-    iterDipoleDataset iterSelection;
+    std::set<std::string> tmpSelection;
     
     for (iterInput=selection.begin(); iterInput!=selection.end(); ++iterInput) {
-      /* Get pointer to the selected dataset. */
-      iterSelection = datasets_p.find(*iterInput);
       /* If the selection is valid, accept it. */
-      if (iterSelection!=datasets_p.end()) {
-	tmpSelection[*iterInput] = iterSelection;
+      if (datasets_p.contains(*iterInput)) {
+	tmpSelection.insert(*iterInput);
       }
     }
 
@@ -501,12 +544,7 @@ namespace DAL {  // Namespace DAL -- begin
   bool TBB_StationGroup::selectAllDipoles ()
   {
     bool status (true);
-    std::map<std::string,iterDipoleDataset> selection;
-    iterDipoleDataset it;
-
-    for (it=datasets_p.begin(); it!=datasets_p.end(); ++it) {
-      selection[it->first] = it;
-    }
+    std::set<std::string> selection = datasets_p.names();
 
     if (!selection.empty()) {
       selectedDatasets_p.clear();
@@ -615,11 +653,15 @@ namespace DAL {  // Namespace DAL -- begin
   casa::Vector<casa::MPosition> TBB_StationGroup::antenna_position ()
   {
     uint n (0);
-    std::map<std::string,iterDipoleDataset>::iterator it;
+    TBB_DipoleDataset *dataset;
+    std::set<std::string>::iterator it;
     casa::Vector<casa::MPosition> position (selectedDatasets_p.size());
 
     for (it=selectedDatasets_p.begin(); it!=selectedDatasets_p.end(); ++it) {
-      position(n) = (it->second)->second.antenna_position();
+      dataset = datasets_p.find(*it);
+      if (dataset != NULL) {
+	position(n) = dataset->antenna_position();
+      }
       ++n;
     }
     
@@ -632,12 +674,17 @@ namespace DAL {  // Namespace DAL -- begin
   
   std::vector<std::string> TBB_StationGroup::dipoleNames ()
   {
-    std::vector<std::string> names (datasets_p.size());
-    std::map<std::string,TBB_DipoleDataset>::iterator it;
+    std::set<std::string> datasets = datasets_p.names();
+    std::vector<std::string> names (datasets.size());
+    std::set<std::string>::iterator it;
+    TBB_DipoleDataset *dataset;
     unsigned int n (0);
 
-    for (it=datasets_p.begin(); it!=datasets_p.end(); ++it) {
-      names[n] = it->second.dipoleName();
+    for (it=datasets.begin(); it!=datasets.end(); ++it) {
+      dataset = datasets_p.find(*it);
+      if (dataset != NULL) {
+	names[n] = dataset->dipoleName();
+      }
       ++n;
     }
 
@@ -650,10 +697,12 @@ namespace DAL {  // Namespace DAL -- begin
   std::vector<int> TBB_StationGroup::dipoleNumbers ()
   {
     std::vector<int> numbers;
-    std::map<std::string,iterDipoleDataset>::iterator it;
+    TBB_DipoleDataset *dataset;
+    std::set<std::string>::iterator it;
 
     for (it=selectedDatasets_p.begin(); it!=selectedDatasets_p.end(); ++it) {
-      numbers.push_back((it->second)->second.dipoleNumber());
+      dataset = datasets_p.find(*it);
+      numbers.push_back(dataset != NULL ? dataset->dipoleNumber() : 0);
     }
 
     return numbers;
@@ -665,16 +714,24 @@ namespace DAL {  // Namespace DAL -- begin
   /*!
     \return dataset_ids -- Vector with a list of the identifiers to the
             HDF5 dataset objects within this station group.
+
+    <b>Note:</b> the identifiers remain valid only as long as the datasets are
+    kept open; with more datasets than HDF5GroupBase::handleLimit() the first
+    ones already have been closed again. Use dipoleSelection() to obtain
+    objects keeping the datasets open.
   */
 #ifdef DAL_WITH_CASA
   casa::Vector<hid_t> TBB_StationGroup::datasetIDs ()
   {
     uint n (0);
-    std::map<std::string,TBB_DipoleDataset>::iterator it;
-    casa::Vector<hid_t> id (datasets_p.size());
-
-    for (it=datasets_p.begin(); it!=datasets_p.end(); ++it) {
-      id(n) = it->second.locationID();
+    std::set<std::string> names = datasets_p.names();
+    std::set<std::string>::iterator it;
+    TBB_DipoleDataset *dataset;
+    casa::Vector<hid_t> id (names.size());
+
+    for (it=names.begin(); it!=names.end(); ++it) {
+      dataset = datasets_p.find(*it);
+      id(n)   = dataset != NULL ? dataset->locationID() : 0;
       ++n;
     }
     
@@ -684,11 +741,14 @@ namespace DAL {  // Namespace DAL -- begin
   std::vector<hid_t> TBB_StationGroup::datasetIDs ()
   {
     uint n (0);
-    std::map<std::string,TBB_DipoleDataset>::iterator it;
-    std::vector<hid_t> id (datasets_p.size());
-
-    for (it=datasets_p.begin(); it!=datasets_p.end(); ++it) {
-      id[n] = it->second.locationID();
+    std::set<std::string> names = datasets_p.names();
+    std::set<std::string>::iterator it;
+    TBB_DipoleDataset *dataset;
+    std::vector<hid_t> id (names.size());
+
+    for (it=names.begin(); it!=names.end(); ++it) {
+      dataset = datasets_p.find(*it);
+      id[n]   = dataset != NULL ? dataset->locationID() : 0;
       ++n;
     }
     
@@ -746,12 +806,19 @@ namespace DAL {  // Namespace DAL -- begin
     bool status (true);
     uint n (0);
     casa::Vector<double> tmp (nofSamples);
-    std::map<std::string,iterDipoleDataset>::iterator it;
+    TBB_DipoleDataset *dataset;
+    std::set<std::string>::iterator it;
     
     /* Iterate over the selected dipoles */
     for (it=selectedDatasets_p.begin(); it!=selectedDatasets_p.end(); ++it) {
       /* Retrieve dipole data */
-      tmp = (it->second)->second.readData(start(n),nofSamples);
+      dataset = datasets_p.find(*it);
+      if (dataset != NULL) {
+	tmp = dataset->readData(start(n),nofSamples);
+      } else {
+	tmp    = 0.0;
+	status = false;
+      }
       /* Copy the data to the returned array */
       data.column(n) = tmp;
       /* Increment data array column counter */
@@ -816,14 +883,18 @@ namespace DAL {  // Namespace DAL -- begin
   */
   casa::Matrix<double> TBB_StationGroup::antenna_position_value ()
   {
-    unsigned int nofDipoles = datasets_p.size();
-    casa::Matrix<double> positionValues (nofDipoles,3);
+    std::set<std::string> names = datasets_p.names();
+    casa::Matrix<double> positionValues (names.size(),3);
     casa::Vector<double> tmp;
-    std::map<std::string,TBB_DipoleDataset>::iterator it;
+    std::set<std::string>::iterator it;
+    TBB_DipoleDataset *dataset;
     uint n (0);
 
-    for (it=datasets_p.begin(); it!=datasets_p.end(); ++it) {
-      it->second.getAttribute("ANTENNA_POSITION_VALUE",tmp);
+    for (it=names.begin(); it!=names.end(); ++it) {
+      dataset = datasets_p.find(*it);
+      if (dataset != NULL) {
+	dataset->getAttribute("ANTENNA_POSITION_VALUE",tmp);
+      }
       positionValues.row(n) = tmp;
       ++n;
     }
@@ -840,14 +911,18 @@ namespace DAL {  // Namespace DAL -- begin
   */
   casa::Matrix<casa::String> TBB_StationGroup::antenna_position_unit ()
   {
-    unsigned int nofDipoles = datasets_p.size();
-    casa::Matrix<casa::String> antennaPositionUnits (nofDipoles,3);
+    std::set<std::string> names = datasets_p.names();
+    casa::Matrix<casa::String> antennaPositionUnits (names.size(),3);
     casa::Vector<casa::String> tmp;
-    std::map<std::string,TBB_DipoleDataset>::iterator it;
+    std::set<std::string>::iterator it;
+    TBB_DipoleDataset *dataset;
     uint n (0);
 
-    for (it=datasets_p.begin(); it!=datasets_p.end(); ++it) {
-      it->second.getAttribute("ANTENNA_POSITION_UNIT",tmp);
+    for (it=names.begin(); it!=names.end(); ++it) {
+      dataset = datasets_p.find(*it);
+      if (dataset != NULL) {
+	dataset->getAttribute("ANTENNA_POSITION_UNIT",tmp);
+      }
       antennaPositionUnits.row(n) = tmp;
       ++n;
     }
@@ -861,13 +936,16 @@ namespace DAL {  // Namespace DAL -- begin
   bool TBB_StationGroup::sample_frequency (casa::Vector<casa::MFrequency> &freq)
   {
     bool status (true);
-    std::map<std::string,TBB_DipoleDataset>::iterator it;
+    std::set<std::string> names = datasets_p.names();
+    std::set<std::string>::iterator it;
+    TBB_DipoleDataset *dataset;
     uint n (0);
     
-    freq.resize (datasets_p.size());
+    freq.resize (names.size());
 
-    for (it=datasets_p.begin(); it!=datasets_p.end(); ++it) {
-      status *= it->second.sample_frequency(freq(n));
+    for (it=names.begin(); it!=names.end(); ++it) {
+      dataset = datasets_p.find(*it);
+      status  = dataset != NULL && dataset->sample_frequency(freq(n)) && status;
       ++n;
     }
     
@@ -955,13 +1033,19 @@ namespace DAL {  // Namespace DAL -- begin
     if (recursive) {
       std::string name;
       casa::Record recordDipole;
-      std::map<std::string,TBB_DipoleDataset>::iterator it;
+      std::set<std::string> names = datasets_p.names();
+      std::set<std::string>::iterator it;
+      TBB_DipoleDataset *dataset;
       uint n (0);
       
-      for (it=datasets_p.begin(); it!=datasets_p.end(); ++it) {
-	name = it->second.dipoleName();
+      for (it=names.begin(); it!=names.end(); ++it) {
+	dataset = datasets_p.find(*it);
+	if (dataset == NULL) {
+	  continue;
+	}
+	name = dataset->dipoleName();
 	// retrieve the attributes for the dipole data-set as record
-	it->second.getAttributes(recordDipole);
+	dataset->getAttributes(recordDipole);
 	// ... and add it to the existing record
 	rec.defineRecord (name,recordDipole);
 	// increment counter
@@ -23,8 +23,9 @@
 
 // Standard library header files
 #include <iostream>
-#include <map>
+#include <set>
 #include <string>
+#include <vector>
 
 #ifdef DAL_WITH_CASA
 #include <casa/Arrays/ArrayIO.h>
@@ -61,6 +62,14 @@ namespace DAL {   // Namespace DAL -- begin
       <li>DAL::TBB_DipoleDataset
     </ul>
 
+    <h3>Synopsis</h3>
+
+    Opening a station group only enumerates the names of the dipole datasets
+    within it; a dataset is opened the first time it is accessed, keeping at
+    most HDF5GroupBase::handleLimit() of them open (see DAL::HDF5HandleCache).
+    The dipole selection is kept by the names of the datasets, such that it is
+    not affected by datasets being closed and re-opened.
+
     <h3>Example(s)</h3>
 
     <ol>
@@ -99,19 +108,16 @@ namespace DAL {   // Namespace DAL -- begin
   */
   class TBB_StationGroup : public HDF5GroupBase {
     
-    //! Typedef for the iterator on the map holding the TBB_DipoleDataset
-    typedef std::map<std::string,TBB_DipoleDataset>::iterator iterDipoleDataset;
-    
     //! Station identifier
     unsigned int stationID_p;
     //! Station trigger group
     TBB_StationTrigger stationTrigger_p;
     //! Number of triggered antennas at this station
     uint nofTriggeredAntennas_p;
-    //! Datasets contained within this group
-    std::map<std::string,TBB_DipoleDataset> datasets_p;
-    //! Selected dipoles
-    std::map<std::string,iterDipoleDataset> selectedDatasets_p;
+    //! Dipole datasets contained within this group, opened on first access
+    HDF5HandleCache<TBB_DipoleDataset> datasets_p;
+    //! Names of the selected dipole datasets
+    std::set<std::string> selectedDatasets_p;
     
   public:
     
@@ -132,6 +138,9 @@ namespace DAL {   // Namespace DAL -- begin
     
     //! Argumented constructor
     TBB_StationGroup (hid_t const &groupID);
+
+    //! Copy constructor, sharing the identifiers of the other object
+    TBB_StationGroup (TBB_StationGroup const &other);
     
     // === Destruction ==========================================================
 
@@ -151,10 +160,11 @@ namespace DAL {   // Namespace DAL -- begin
     //! Get the set of selected dipoles
     std::set<std::string> selectedDipoles ();
 
-    //! Get the map constaining the actual dipole dataset selection
-    inline std::map<std::string,iterDipoleDataset> dipoleSelection () const {
-      return selectedDatasets_p;
-    }
+    //! Get the selected dipole datasets
+    std::vector<TBB_DipoleDataset> dipoleSelection ();
+
+    //! Get the dipole dataset <tt>name</tt>, opening it if required
+    TBB_DipoleDataset dipoleDataset (std::string const &name);
     
     //! Set the set of selected dipoles
     bool selectDipoles (std::set<std::string> const &selection);
@@ -234,13 +244,15 @@ namespace DAL {   // Namespace DAL -- begin
 
 	if (location_p > 0) {
 	  T tmp;
-	  std::map<std::string,iterDipoleDataset>::iterator it;
+	  TBB_DipoleDataset *dataset;
+	  std::set<std::string>::iterator it;
 	  
     // Clear output vector
     result.clear();
 	  
 	  for (it=selectedDatasets_p.begin(); it!=selectedDatasets_p.end(); ++it) {
-	    if (it->second->second.getAttribute(name,tmp) == false)
+	    dataset = datasets_p.find(*it);
+	    if (dataset == NULL || dataset->getAttribute(name,tmp) == false)
       {
         status = false;
       }
@@ -264,12 +276,16 @@ namespace DAL {   // Namespace DAL -- begin
 	if (location_p > 0) {
 	  uint n(0);
 	  T tmp;
-	  std::map<std::string,iterDipoleDataset>::iterator it;
+	  TBB_DipoleDataset *dataset;
+	  std::set<std::string>::iterator it;
 	  
 	  result.resize(selectedDatasets_p.size());
 	  
 	  for (it=selectedDatasets_p.begin(); it!=selectedDatasets_p.end(); ++it) {
-	    it->second->second.getAttribute(name,tmp);
+	    dataset = datasets_p.find(*it);
+	    if (dataset != NULL) {
+	      dataset->getAttribute(name,tmp);
+	    }
 	    result(n) = tmp;
 	    ++n;
 	  }
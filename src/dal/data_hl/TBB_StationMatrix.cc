@@ -0,0 +1,668 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "TBB_StationMatrix.h"
+#include <core/HDF5Attribute.h>
+#include <core/HDF5Dataset.h>
+#include <core/HDF5IOPlan.h>
+#include <core/HDF5Lock.h>
+#include <data_hl/TBB_BlockIterator.h>
+
+#include <algorithm>
+#include <pthread.h>
+#include <unistd.h>
+#include <zlib.h>
+
+namespace DAL { // Namespace DAL -- begin
+
+  // ============================================================================
+  //
+  //  Construction
+  //
+  // ============================================================================
+
+  TBB_StationMatrix::TBB_StationMatrix ()
+  {
+    init ();
+  }
+
+  //_____________________________________________________________________________
+  //                                                            TBB_StationMatrix
+
+  /*!
+    \param location -- Identifier of the object, to which the dataset is
+           attached.
+    \param name     -- Name of the dataset holding the station matrix.
+  */
+  TBB_StationMatrix::TBB_StationMatrix (hid_t const &location,
+					std::string const &name)
+  {
+    init ();
+    open (location, name);
+  }
+
+  //_____________________________________________________________________________
+  //                                                                         init
+
+  void TBB_StationMatrix::init ()
+  {
+    itsDataset         = 0;
+    itsNofDipoles      = 0;
+    itsLength          = 0;
+    itsTime            = 0;
+    itsSampleNumber    = 0;
+    itsSampleFrequency = 0;
+
+    itsDipoleNames.clear();
+    itsOffsets.clear();
+    itsLengths.clear();
+  }
+
+  // ============================================================================
+  //
+  //  Destruction
+  //
+  // ============================================================================
+
+  TBB_StationMatrix::~TBB_StationMatrix ()
+  {
+    destroy ();
+  }
+
+  //_____________________________________________________________________________
+  //                                                                      destroy
+
+  void TBB_StationMatrix::destroy ()
+  {
+    if (itsDataset > 0) {
+      H5Dclose (itsDataset);
+    }
+
+    init ();
+  }
+
+  // ============================================================================
+  //
+  //  Parameters
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                   validRange
+
+  /*!
+    \retval start  -- First column for which all dipoles hold valid samples.
+    \retval end    -- Column just after the last one for which all dipoles hold
+            valid samples.
+    \return status -- Returns \e false if there is no column for which all
+            dipoles hold valid samples.
+  */
+  bool TBB_StationMatrix::validRange (hsize_t &start,
+				      hsize_t &end) const
+  {
+    start = 0;
+    end   = itsLength;
+
+    for (hsize_t n(0); n<itsNofDipoles; ++n) {
+      start = std::max (start, itsOffsets[n]);
+      end   = std::min (end, itsOffsets[n]+itsLengths[n]);
+    }
+
+    if (start >= end) {
+      start = end = 0;
+      return false;
+    }
+
+    return isValid();
+  }
+
+  //_____________________________________________________________________________
+  //                                                                      summary
+
+  /*!
+    \param os -- Output stream to which the summary is written.
+  */
+  void TBB_StationMatrix::summary (std::ostream &os)
+  {
+    hsize_t start;
+    hsize_t end;
+
+    validRange (start, end);
+
+    os << "[TBB_StationMatrix] Summary of internal parameters." << std::endl;
+    os << "-- Dataset ID            = " << itsDataset         << std::endl;
+    os << "-- nof. dipoles          = " << itsNofDipoles      << std::endl;
+    os << "-- nof. samples          = " << itsLength          << std::endl;
+    os << "-- Time                  = " << itsTime            << std::endl;
+    os << "-- Sample number         = " << itsSampleNumber    << std::endl;
+    os << "-- Sample frequency [Hz] = " << itsSampleFrequency << std::endl;
+    os << "-- Dipole offsets        = " << itsOffsets         << std::endl;
+    os << "-- Dipole data lengths   = " << itsLengths         << std::endl;
+    os << "-- Common valid range    = [" << start << "," << end << ")" << std::endl;
+  }
+
+  // ============================================================================
+  //
+  //  Methods
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                                         open
+
+  /*!
+    \param location -- Identifier of the object, to which the dataset is
+           attached.
+    \param name     -- Name of the dataset holding the station matrix.
+    \return status  -- Status of the operation; returns \e false in case the
+            dataset could not be opened or is not a station matrix.
+  */
+  bool TBB_StationMatrix::open (hid_t const &location,
+				std::string const &name)
+  {
+    destroy ();
+
+    if (!H5Iis_valid(location) || H5Lexists (location, name.c_str(), H5P_DEFAULT) <= 0) {
+      std::cerr << "[TBB_StationMatrix::open] No dataset " << name
+		<< " found at location!" << std::endl;
+      return false;
+    }
+
+    itsDataset = H5Dopen (location, name.c_str(), H5P_DEFAULT);
+
+    if (itsDataset < 0) {
+      std::cerr << "[TBB_StationMatrix::open] Failed to open dataset " << name
+		<< std::endl;
+      itsDataset = 0;
+      return false;
+    }
+
+    // Shape of the matrix _________________________________
+
+    hid_t dataspace = H5Dget_space (itsDataset);
+    hsize_t shape[2];
+    bool status = H5Sget_simple_extent_ndims (dataspace) == 2;
+
+    if (status) {
+      H5Sget_simple_extent_dims (dataspace, shape, NULL);
+      itsNofDipoles = shape[0];
+      itsLength     = shape[1];
+    }
+
+    H5Sclose (dataspace);
+
+    // Attributes __________________________________________
+
+    std::string unit;
+
+    status = status
+      && HDF5Attribute::read (itsDataset, "DIPOLE_OFFSET", itsOffsets)
+      && HDF5Attribute::read (itsDataset, "DATA_LENGTH", itsLengths)
+      && HDF5Attribute::read (itsDataset, "TIME", itsTime)
+      && HDF5Attribute::read (itsDataset, "SAMPLE_NUMBER", itsSampleNumber)
+      && HDF5Attribute::read (itsDataset, "SAMPLE_FREQUENCY_VALUE", itsSampleFrequency)
+      && HDF5Attribute::read (itsDataset, "SAMPLE_FREQUENCY_UNIT", unit)
+      && itsOffsets.size() == itsNofDipoles
+      && itsLengths.size() == itsNofDipoles;
+
+    if (!status) {
+      std::cerr << "[TBB_StationMatrix::open] Dataset " << name
+		<< " is not a station matrix!" << std::endl;
+      destroy ();
+      return false;
+    }
+
+    HDF5Attribute::read (itsDataset, "DIPOLE_NAMES", itsDipoleNames);
+
+    /* Sample frequency in Hz */
+    if (unit == "GHz") {
+      itsSampleFrequency *= 1e9;
+    } else if (unit == "MHz") {
+      itsSampleFrequency *= 1e6;
+    } else if (unit == "kHz") {
+      itsSampleFrequency *= 1e3;
+    }
+
+    return true;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                     readData
+
+  /*!
+    \retval data       -- [nofDipoles,nofSamples] Array with the samples, with
+            the samples of a dipole stored contiguously.
+    \param firstDipole -- Row of the first dipole to read.
+    \param nofDipoles  -- Number of dipoles to read.
+    \param start       -- Column of the first sample to read.
+    \param nofSamples  -- Number of samples to read per dipole.
+    \param memoryType  -- Datatype of the samples in memory.
+    \return status     -- Status of the operation; returns \e false in case an
+            error was encountered.
+
+    All samples are retrieved by a single hyperslab read from the dataset.
+  */
+  bool TBB_StationMatrix::readData (void *data,
+				    hsize_t const &firstDipole,
+				    hsize_t const &nofDipoles,
+				    hsize_t const &start,
+				    hsize_t const &nofSamples,
+				    hid_t const &memoryType)
+  {
+    if (!isValid() || data == NULL) {
+      std::cerr << "[TBB_StationMatrix::readData] No valid station matrix!"
+		<< std::endl;
+      return false;
+    }
+
+    if (nofDipoles == 0
+	|| nofSamples == 0
+	|| firstDipole+nofDipoles > itsNofDipoles
+	|| start+nofSamples > itsLength) {
+      std::cerr << "[TBB_StationMatrix::readData] Selection exceeds the matrix!"
+		<< std::endl;
+      return false;
+    }
+
+    std::vector<hsize_t> block (2);
+    std::vector<hsize_t> offset (2);
+
+    block[0]  = nofDipoles;
+    block[1]  = nofSamples;
+    offset[0] = firstDipole;
+    offset[1] = start;
+
+    HDF5IOPlan plan (itsDataset, block, memoryType);
+
+    return plan.read (data, offset);
+  }
+
+  // ============================================================================
+  //
+  //  Static methods
+  //
+  // ============================================================================
+
+  //_____________________________________________________________________________
+  //                                                              MatrixBuildTask
+
+  /*!
+    \brief Work shared between the threads assembling the chunks of a matrix
+  */
+  struct MatrixBuildTask {
+    //! The dipole datasets, per row
+    std::vector<hid_t> dipoles;
+    //! Column holding the first sample of each of the dipoles
+    std::vector<hsize_t> offsets;
+    //! Number of samples of each of the dipoles
+    std::vector<hsize_t> lengths;
+    //! Number of columns per chunk
+    hsize_t chunkLength;
+    //! Number of chunks
+    hsize_t nofChunks;
+    //! Deflate compression level, 0 if the chunks are stored uncompressed
+    unsigned int compression;
+    //! The dataset holding the matrix
+    HDF5Dataset *dataset;
+    //! Index of the next chunk to be picked up by a thread
+    hsize_t next;
+    //! Status of the operation, \e false once a read or write has failed
+    bool status;
+    //! Lock protecting the shared state of the task
+    pthread_mutex_t mutex;
+  };
+
+  //_____________________________________________________________________________
+  //                                                                  readSegment
+
+  /*!
+    \brief Read a contiguous range of samples of a dipole dataset
+
+    The samples are returned as little-endian 16 bit integers, i.e. in the
+    representation of the station matrix within the file.
+  */
+  static bool readSegment (hid_t const &dipole,
+			   hsize_t const &start,
+			   hsize_t const &count,
+			   short *data)
+  {
+    hid_t filespace   = H5Dget_space (dipole);
+    hid_t memoryspace = H5Screate_simple (1, &count, NULL);
+    herr_t h5error    = H5Sselect_hyperslab (filespace,
+					     H5S_SELECT_SET,
+					     &start,
+					     NULL,
+					     &count,
+					     NULL);
+
+    if (h5error >= 0) {
+      h5error = H5Dread (dipole,
+			 H5T_STD_I16LE,
+			 memoryspace,
+			 filespace,
+			 H5P_DEFAULT,
+			 data);
+    }
+
+    H5Sclose (memoryspace);
+    H5Sclose (filespace);
+
+    return h5error >= 0;
+  }
+
+  //_____________________________________________________________________________
+  //                                                            buildMatrixChunks
+
+  /*!
+    Picks up one chunk after another until all of them have been handled: the
+    samples of all dipoles falling into the columns of the chunk are read into
+    a buffer owned by the thread, the buffer is compressed -- applying the
+    shuffle and deflate filters the way the HDF5 library does -- and then
+    written as-is using HDF5Dataset::writeChunk. Reading and writing are done
+    holding the process-wide HDF5Lock, such that the compression of a chunk
+    overlaps with the I/O of the other threads.
+
+    \param task -- Pointer to the MatrixBuildTask shared by the threads.
+  */
+  static void * buildMatrixChunks (void *task)
+  {
+    MatrixBuildTask *t      = static_cast<MatrixBuildTask *> (task);
+    hsize_t nofDipoles      = t->dipoles.size();
+    hsize_t width           = t->chunkLength;
+    size_t nbytes           = nofDipoles*width*sizeof(short);
+    std::vector<short> buffer (nofDipoles*width);
+    std::vector<unsigned char> shuffled;
+    std::vector<unsigned char> compressed;
+    std::vector<hsize_t> offset (2, 0);
+    hsize_t n;
+    bool status;
+
+    if (t->compression > 0) {
+      shuffled.resize (nbytes);
+      compressed.resize (compressBound (nbytes));
+    }
+
+    while (true) {
+      std::fill (buffer.begin(), buffer.end(), short(0));
+
+      // Read the samples of the chunk _____________________
+
+      pthread_mutex_lock (&t->mutex);
+      n      = t->next++;
+      status = t->status;
+      pthread_mutex_unlock (&t->mutex);
+
+      if (n >= t->nofChunks || !status) {
+	break;
+      }
+
+      hsize_t first = n*width;
+
+      HDF5Lock::lock ();
+      for (hsize_t row(0); row<nofDipoles && status; ++row) {
+	hsize_t begin = std::max (first, t->offsets[row]);
+	hsize_t end   = std::min (first+width, t->offsets[row]+t->lengths[row]);
+	if (begin < end) {
+	  status = readSegment (t->dipoles[row],
+				begin-t->offsets[row],
+				end-begin,
+				&buffer[row*width+begin-first]);
+	}
+      }
+      HDF5Lock::unlock ();
+
+      if (!status) {
+	pthread_mutex_lock (&t->mutex);
+	t->status = false;
+	pthread_mutex_unlock (&t->mutex);
+	break;
+      }
+
+      // Compress the chunk ________________________________
+
+      void const *data = &buffer[0];
+      size_t size      = nbytes;
+      uint32_t mask    = 0;
+
+      if (t->compression > 0) {
+	unsigned char const *bytes = reinterpret_cast<unsigned char const *> (&buffer[0]);
+	size_t nofElements         = buffer.size();
+	uLongf length              = compressed.size();
+
+	/* Shuffle: low bytes of all elements first, then the high bytes */
+	for (size_t k(0); k<nofElements; ++k) {
+	  shuffled[k]             = bytes[2*k];
+	  shuffled[nofElements+k] = bytes[2*k+1];
+	}
+
+	if (compress2 (&compressed[0], &length, &shuffled[0], nbytes, t->compression) == Z_OK
+	    && length < nbytes) {
+	  data = &compressed[0];
+	  size = length;
+	} else {
+	  /* Store the shuffled data, marking the deflate stage as skipped */
+	  data = &shuffled[0];
+	  mask = 0x2;
+	}
+      }
+
+      // Write the chunk ___________________________________
+
+      offset[1] = n*width;
+
+      HDF5Lock::lock ();
+      status = t->dataset->writeChunk (data, size, offset, mask);
+      HDF5Lock::unlock ();
+
+      if (!status) {
+	pthread_mutex_lock (&t->mutex);
+	t->status = false;
+	pthread_mutex_unlock (&t->mutex);
+      }
+    }
+
+    return NULL;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                       create
+
+  /*!
+    \param location    -- Identifier of the object, to which the dataset holding
+           the station matrix is attached.
+    \param name        -- Name of the dataset holding the station matrix.
+    \param dipoles     -- Identifiers of the dipole datasets, one per row.
+    \param names       -- Names of the dipole datasets, one per row.
+    \param nofThreads  -- Number of threads assembling the matrix; if set to 0
+           the number is derived from the number of available processors.
+    \param chunkLength -- Number of columns per chunk; if set to 0, chunks of
+           about 1 MB are used.
+    \param compression -- Deflate compression level; if set to 0, the matrix
+           is stored uncompressed.
+    \return status     -- Status of the operation; returns \e false in case an
+            error was encountered.
+
+    All HDF5 calls -- on the calling thread as well as on the threads
+    assembling the matrix -- are made holding the process-wide HDF5Lock; as
+    the calling thread waits for the other threads, it must not hold that lock
+    when calling this function.
+  */
+  bool TBB_StationMatrix::create (hid_t const &location,
+				  std::string const &name,
+				  std::vector<hid_t> const &dipoles,
+				  std::vector<std::string> const &names,
+				  unsigned int const &nofThreads,
+				  hsize_t const &chunkLength,
+				  unsigned int const &compression)
+  {
+    hsize_t nofDipoles = dipoles.size();
+
+    // Check input parameters ______________________________
+
+    if (nofDipoles == 0 || names.size() != nofDipoles) {
+      std::cerr << "[TBB_StationMatrix::create]"
+		<< " Mismatching number of dipoles and names!" << std::endl;
+      return false;
+    }
+
+    if (compression > 9) {
+      std::cerr << "[TBB_StationMatrix::create]"
+		<< " Compression level must be within [0,9]!" << std::endl;
+      return false;
+    }
+
+    // Alignment of the dipoles ____________________________
+
+    HDF5Lock lock;
+    std::vector<hsize_t> alignment;
+    std::vector<hsize_t> offsets (nofDipoles);
+    std::vector<hsize_t> lengths (nofDipoles);
+    hsize_t reference = 0;
+    hsize_t length    = 0;
+
+    if (!TBB_BlockIterator::alignment (alignment, dipoles)) {
+      return false;
+    }
+
+    /* The dipole starting first defines column 0 */
+    for (hsize_t n(0); n<nofDipoles; ++n) {
+      if (alignment[n] > alignment[reference]) {
+	reference = n;
+      }
+    }
+
+    for (hsize_t n(0); n<nofDipoles; ++n) {
+      hid_t dataspace = H5Dget_space (dipoles[n]);
+      lengths[n]      = H5Sget_simple_extent_npoints (dataspace);
+      offsets[n]      = alignment[reference]-alignment[n];
+      length          = std::max (length, offsets[n]+lengths[n]);
+      H5Sclose (dataspace);
+    }
+
+    if (length == 0) {
+      std::cerr << "[TBB_StationMatrix::create] Dipole datasets are empty!"
+		<< std::endl;
+      return false;
+    }
+
+    // Create the dataset __________________________________
+
+    std::vector<hsize_t> shape (2);
+    std::vector<hsize_t> chunk (2);
+
+    shape[0] = nofDipoles;
+    shape[1] = length;
+    chunk[0] = nofDipoles;
+    chunk[1] = chunkLength;
+
+    if (chunk[1] == 0) {
+      chunk[1] = std::max (hsize_t(1), hsize_t(1048576/(nofDipoles*sizeof(short))));
+    }
+    chunk[1] = std::min (chunk[1], length);
+
+    HDF5Dataset dataset;
+
+    if (compression > 0) {
+      dataset.setFilter (HDF5Filter::shuffleDeflate (compression));
+    }
+
+    if (!dataset.open (location, name, shape, chunk, H5T_STD_I16LE)
+	|| dataset.chunking() != chunk) {
+      std::cerr << "[TBB_StationMatrix::create] Failed to create dataset "
+		<< name << std::endl;
+      return false;
+    }
+
+    // Assemble the matrix _________________________________
+
+    MatrixBuildTask task;
+
+    task.dipoles     = dipoles;
+    task.offsets     = offsets;
+    task.lengths     = lengths;
+    task.chunkLength = chunk[1];
+    task.nofChunks   = (length+chunk[1]-1)/chunk[1];
+    task.compression = compression;
+    task.dataset     = &dataset;
+    task.next        = 0;
+    task.status      = true;
+    pthread_mutex_init (&task.mutex, NULL);
+
+    unsigned int nofWorkers = nofThreads;
+
+    if (nofWorkers == 0) {
+      long nofProcessors = sysconf (_SC_NPROCESSORS_ONLN);
+      nofWorkers = nofProcessors > 0 ? nofProcessors : 1;
+    }
+    if (nofWorkers > task.nofChunks) {
+      nofWorkers = task.nofChunks;
+    }
+
+    /* The calling thread is one of the workers, taking turns on the HDF5
+       library with the others */
+    std::vector<pthread_t> threads;
+    pthread_t thread;
+
+    HDF5Lock::unlock ();
+
+    for (unsigned int n(1); n<nofWorkers; ++n) {
+      if (pthread_create (&thread, NULL, buildMatrixChunks, &task) == 0) {
+	threads.push_back (thread);
+      }
+    }
+
+    buildMatrixChunks (&task);
+
+    for (unsigned int n(0); n<threads.size(); ++n) {
+      pthread_join (threads[n], NULL);
+    }
+
+    HDF5Lock::lock ();
+    pthread_mutex_destroy (&task.mutex);
+
+    if (!task.status) {
+      std::cerr << "[TBB_StationMatrix::create] Failed to assemble matrix "
+		<< name << std::endl;
+      return false;
+    }
+
+    // Attributes __________________________________________
+
+    hid_t datasetID = dataset.objectID();
+    uint time       = 0;
+    uint sample     = 0;
+    double value    = 0;
+    std::string unit;
+
+    HDF5Attribute::read (dipoles[reference], "TIME", time);
+    HDF5Attribute::read (dipoles[reference], "SAMPLE_NUMBER", sample);
+    HDF5Attribute::read (dipoles[reference], "SAMPLE_FREQUENCY_VALUE", value);
+    HDF5Attribute::read (dipoles[reference], "SAMPLE_FREQUENCY_UNIT", unit);
+
+    return HDF5Attribute::write (datasetID, "TIME", time)
+      && HDF5Attribute::write (datasetID, "SAMPLE_NUMBER", sample)
+      && HDF5Attribute::write (datasetID, "SAMPLE_FREQUENCY_VALUE", value)
+      && HDF5Attribute::write (datasetID, "SAMPLE_FREQUENCY_UNIT", unit)
+      && HDF5Attribute::write (datasetID, "DIPOLE_NAMES", names)
+      && HDF5Attribute::write (datasetID, "DIPOLE_OFFSET", offsets)
+      && HDF5Attribute::write (datasetID, "DATA_LENGTH", lengths);
+  }
+
+} // Namespace DAL -- end
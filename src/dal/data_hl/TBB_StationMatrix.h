@@ -0,0 +1,297 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#ifndef TBB_STATIONMATRIX_H
+#define TBB_STATIONMATRIX_H
+
+// Standard library header files
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <core/dalCommon.h>
+#include <core/HDF5TypeTraits.h>
+
+namespace DAL { // Namespace DAL -- begin
+
+  /*!
+    \class TBB_StationMatrix
+
+    \ingroup DAL
+    \ingroup data_hl
+
+    \brief Time-aligned 2-dimensional matrix of the dipole data of a TBB dump
+
+    \author agent
+
+    \date 2026/10/18
+
+    \test tTBB_StationMatrix.cc
+
+    <h3>Prerequisite</h3>
+
+    <ul type="square">
+      <li>DAL::TBB_BlockIterator
+      <li>DAL::HDF5Dataset
+      <li>DAL::HDF5Filter
+      <li>DAL::HDF5IOPlan
+      <li>DAL::HDF5Lock
+    </ul>
+
+    <h3>Synopsis</h3>
+
+    Within a TBB dump the samples of every dipole are stored in a 1-dimensional
+    dataset of its own, starting at an instant of time given by the attributes
+    \c TIME and \c SAMPLE_NUMBER. Reading the samples of a set of dipoles for
+    the same window of time therefore requires opening every dataset, working
+    out the offset of the window within it, and issuing a read per dipole.
+
+    A station matrix holds the samples of a set of dipoles -- the dipoles of a
+    station, or of all stations within a file -- in a single 2-dimensional
+    dataset of shape <tt>[dipole,sample]</tt>, in which column \e k holds the
+    samples taken at the same instant of time for all dipoles. The dataset is
+    stored as 16 bit integers, chunked in blocks of columns spanning all
+    dipoles (and optionally compressed using the shuffle and deflate filters),
+    such that the samples of all dipoles for a window of time are retrieved by
+    a single hyperslab read. The matrix covers the full period recorded by any
+    of the dipoles; samples outside the period recorded by a dipole are set to
+    zero.
+
+    \verbatim
+    Station002                    ... [dipole,sample] Dataset of type int16
+    |-- TIME                      ... Time of column 0, full seconds
+    |-- SAMPLE_NUMBER             ... Sample number of column 0
+    |-- SAMPLE_FREQUENCY_VALUE
+    |-- SAMPLE_FREQUENCY_UNIT
+    |-- DIPOLE_NAMES              ... Names of the dipole datasets, per row
+    |-- DIPOLE_OFFSET             ... Column holding the first sample, per row
+    `-- DATA_LENGTH               ... Number of valid samples, per row
+    \endverbatim
+
+    create() builds a station matrix from a set of dipole datasets, aligning
+    them as TBB_BlockIterator::alignment does. The matrix is assembled chunk
+    by chunk by a number of threads: as the HDF5 library must not be entered
+    by more than one thread at a time, reading the dipole samples and storing
+    the finished chunks (through HDF5Dataset::writeChunk) is done holding the
+    process-wide DAL::HDF5Lock, while assembling and compressing a chunk is
+    done in parallel.
+
+    <h3>Example(s)</h3>
+
+    <ol>
+      <li>Repack the dipoles of a station:
+      \code
+      std::vector<hid_t> dipoles;
+      std::vector<std::string> names;
+      // ... open the dipole datasets of the station
+
+      DAL::TBB_StationMatrix::create (outfileID, "Station002", dipoles, names);
+      \endcode
+      <li>Read 1024 samples for all dipoles, starting at the first sample for
+      which all of them hold data:
+      \code
+      DAL::TBB_StationMatrix matrix (fileID, "Station002");
+      hsize_t start;
+      hsize_t end;
+
+      if (matrix.validRange (start, end)) {
+        std::vector<short> data (matrix.nofDipoles()*1024);
+        matrix.readData (&data[0], start, 1024);
+      }
+      \endcode
+    </ol>
+  */
+  class TBB_StationMatrix {
+
+    //! Identifier of the dataset
+    hid_t itsDataset;
+    //! Number of dipoles, i.e. rows of the matrix
+    hsize_t itsNofDipoles;
+    //! Number of samples per dipole, i.e. columns of the matrix
+    hsize_t itsLength;
+    //! Names of the dipole datasets, per row
+    std::vector<std::string> itsDipoleNames;
+    //! Column holding the first sample of each of the dipoles
+    std::vector<hsize_t> itsOffsets;
+    //! Number of valid samples of each of the dipoles
+    std::vector<hsize_t> itsLengths;
+    //! Time of the first column, full seconds
+    uint itsTime;
+    //! Sample number of the first column
+    uint itsSampleNumber;
+    //! Sample frequency, [Hz]
+    double itsSampleFrequency;
+
+  public:
+
+    // === Construction =========================================================
+
+    //! Default constructor
+    TBB_StationMatrix ();
+
+    //! Argumented constructor, opening an existing station matrix
+    TBB_StationMatrix (hid_t const &location,
+		       std::string const &name);
+
+    // === Destruction ==========================================================
+
+    //! Destructor
+    ~TBB_StationMatrix ();
+
+    // === Parameter access =====================================================
+
+    //! Is the object attached to a valid station matrix?
+    inline bool isValid () const {
+      return itsDataset > 0;
+    }
+
+    //! Get the number of dipoles, i.e. rows of the matrix
+    inline hsize_t nofDipoles () const {
+      return itsNofDipoles;
+    }
+
+    //! Get the number of samples per dipole, i.e. columns of the matrix
+    inline hsize_t length () const {
+      return itsLength;
+    }
+
+    //! Get the names of the dipole datasets, per row
+    inline std::vector<std::string> dipoleNames () const {
+      return itsDipoleNames;
+    }
+
+    //! Get the column holding the first sample of each of the dipoles
+    inline std::vector<hsize_t> offsets () const {
+      return itsOffsets;
+    }
+
+    //! Get the number of valid samples of each of the dipoles
+    inline std::vector<hsize_t> lengths () const {
+      return itsLengths;
+    }
+
+    //! Get the time of the first column, full seconds
+    inline uint time () const {
+      return itsTime;
+    }
+
+    //! Get the sample number of the first column
+    inline uint sampleNumber () const {
+      return itsSampleNumber;
+    }
+
+    //! Get the sample frequency, [Hz]
+    inline double sampleFrequency () const {
+      return itsSampleFrequency;
+    }
+
+    //! Get the range of columns for which all dipoles hold valid samples
+    bool validRange (hsize_t &start,
+		     hsize_t &end) const;
+
+    /*!
+      \brief Get the name of the class
+
+      \return className -- The name of the class, TBB_StationMatrix.
+    */
+    inline std::string className () const {
+      return "TBB_StationMatrix";
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    inline void summary () {
+      summary (std::cout);
+    }
+
+    //! Provide a summary of the object's internal parameters and status
+    void summary (std::ostream &os);
+
+    // === Methods ==============================================================
+
+    //! Open an existing station matrix
+    bool open (hid_t const &location,
+	       std::string const &name);
+
+    //! Read a block of samples for a range of dipoles
+    bool readData (void *data,
+		   hsize_t const &firstDipole,
+		   hsize_t const &nofDipoles,
+		   hsize_t const &start,
+		   hsize_t const &nofSamples,
+		   hid_t const &memoryType);
+
+    //! Read a block of samples for a range of dipoles, as elements of type \c T
+    template <class T>
+      inline bool readData (T *data,
+			    hsize_t const &firstDipole,
+			    hsize_t const &nofDipoles,
+			    hsize_t const &start,
+			    hsize_t const &nofSamples) {
+      return readData (data,
+		       firstDipole,
+		       nofDipoles,
+		       start,
+		       nofSamples,
+		       HDF5TypeTraits<T>::type());
+    }
+
+    //! Read a block of samples for all dipoles, as elements of type \c T
+    template <class T>
+      inline bool readData (T *data,
+			    hsize_t const &start,
+			    hsize_t const &nofSamples) {
+      return readData (data,
+		       0,
+		       itsNofDipoles,
+		       start,
+		       nofSamples,
+		       HDF5TypeTraits<T>::type());
+    }
+
+    // === Static methods =======================================================
+
+    //! Create a station matrix from a set of dipole datasets
+    static bool create (hid_t const &location,
+			std::string const &name,
+			std::vector<hid_t> const &dipoles,
+			std::vector<std::string> const &names,
+			unsigned int const &nofThreads=0,
+			hsize_t const &chunkLength=0,
+			unsigned int const &compression=0);
+
+  private:
+
+    //! Initialize the internal parameters
+    void init ();
+
+    //! Release the dataset
+    void destroy ();
+
+    //! Copying is not supported, as the object owns the dataset identifier
+    TBB_StationMatrix (TBB_StationMatrix const &other);
+
+    //! Copying is not supported, as the object owns the dataset identifier
+    TBB_StationMatrix& operator= (TBB_StationMatrix const &other);
+
+  }; // Class TBB_StationMatrix -- end
+
+} // Namespace DAL -- end
+
+#endif /* TBB_STATIONMATRIX_H */
@@ -19,6 +19,11 @@
  ***************************************************************************/
 
 #include "TBB_Timeseries.h"
+#include <core/dalConversions.h>
+#include <core/HDF5Lock.h>
+
+#include <pthread.h>
+#include <unistd.h>
 
 using std::cout;
 using std::endl;
@@ -351,30 +356,23 @@ namespace DAL {  // Namespace DAL -- begin
     //________________________________________________________________
     // Local variables.
     
-    bool status (true);
-    std::string nameGroup;
-    std::set<std::string> groupnames;
+    bool status (flags.flags());
 
     //________________________________________________________________
-    // Obtain the number of objects attached to the root level of the file
+    // Enumerate the groups attached to the root level of the file; they
+    // are opened on first access
 
-    status = h5get_names (groupnames, location_p, H5G_GROUP);
-    
-    //________________________________________________________________
-    // Iterate through the list of objects attached to the root group
-    // of the file
-
-    if (groupnames.size() > 0) {
-      std::set<std::string>::iterator it;
-      for (it=groupnames.begin(); it!=groupnames.end(); ++it) {
-	stationGroups_p[*it] = DAL::TBB_StationGroup (location_p,
-						      *it, flags);
-      }
-    } else {
+    selectedDatasets_p.clear();
+
+    status = stationGroups_p.enumerate (location_p,
+					H5G_GROUP,
+					handleLimit());
+
+    if (stationGroups_p.size() == 0) {
       throw IOError("DAL error wile iterating through station groups.");
     }
 
-    status *= setSelectedDatasets ();
+    status = setSelectedDatasets () && status;
     
     return status;
   }
@@ -387,14 +385,7 @@ namespace DAL {  // Namespace DAL -- begin
   */
   std::set<std::string> TBB_Timeseries::stationGroupNames ()
   {
-    std::map<std::string,TBB_StationGroup>::iterator it;
-    std::set<std::string> names;
-
-    for (it=stationGroups_p.begin(); it!=stationGroups_p.end(); ++it) {
-      names.insert(it->first);
-    }
-
-    return names;
+    return stationGroups_p.names();
   }
   
   //_____________________________________________________________________________
@@ -427,12 +418,10 @@ namespace DAL {  // Namespace DAL -- begin
   */
   TBB_StationGroup TBB_Timeseries::stationGroup (std::string const &name)
   {
-    std::map<std::string,TBB_StationGroup>::iterator it;
+    TBB_StationGroup *group = findStationGroup (name);
 
-    it = stationGroups_p.find(name);
-
-    if (it != stationGroups_p.end()) {
-      return (*it).second;
+    if (group != NULL) {
+      return *group;
     } else {
       std::cerr << "[TBB_Timeseries::stationGroup]"
 		<< " No such station group " << name
@@ -447,10 +436,13 @@ namespace DAL {  // Namespace DAL -- begin
   uint TBB_Timeseries::nofDipoleDatasets ()
   {
     uint nofDatasets (0);
-    std::map<std::string,TBB_StationGroup>::iterator it;
+    std::set<std::string> names = stationGroups_p.names();
+    std::set<std::string>::iterator it;
+    TBB_StationGroup *group;
 
-    for (it=stationGroups_p.begin(); it!=stationGroups_p.end(); ++it) {
-      nofDatasets += it->second.nofDipoleDatasets();
+    for (it=names.begin(); it!=names.end(); ++it) {
+      group = findStationGroup (*it);
+      nofDatasets += group->nofDipoleDatasets();
     }
 
     return nofDatasets;
@@ -461,14 +453,7 @@ namespace DAL {  // Namespace DAL -- begin
 
   uint TBB_Timeseries::nofSelectedDatasets ()
   {
-    uint nofDatasets (0);
-    std::map<std::string,TBB_StationGroup>::iterator it;
-
-    for (it=stationGroups_p.begin(); it!=stationGroups_p.end(); ++it) {
-      nofDatasets += it->second.nofSelectedDatasets();
-    }
-
-    return nofDatasets;
+    return selectedDatasets_p.size();
   }
 
   //_____________________________________________________________________________
@@ -478,11 +463,14 @@ namespace DAL {  // Namespace DAL -- begin
   {
     std::vector<int> numbers;
     std::vector<int> tmp;
-    std::map<std::string,TBB_StationGroup>::iterator it;
+    std::set<std::string> names = stationGroups_p.names();
+    std::set<std::string>::iterator it;
+    TBB_StationGroup *group;
 
-    for (it = stationGroups_p.begin(); it!=stationGroups_p.end(); ++it) {
+    for (it=names.begin(); it!=names.end(); ++it) {
+      group = findStationGroup (*it);
       tmp.clear();
-      tmp = it->second.dipoleNumbers();
+      tmp = group->dipoleNumbers();
       for (unsigned int n(0); n<tmp.size(); ++n) {
 	numbers.push_back(tmp[n]);
       }
@@ -496,19 +484,22 @@ namespace DAL {  // Namespace DAL -- begin
 
   std::vector<std::string> TBB_Timeseries::dipoleNames ()
   {
-    std::vector<std::string> names;
+    std::vector<std::string> dipoles;
     std::vector<std::string> tmp;
-    std::map<std::string,TBB_StationGroup>::iterator it;
+    std::set<std::string> names = stationGroups_p.names();
+    std::set<std::string>::iterator it;
+    TBB_StationGroup *group;
 
-    for (it = stationGroups_p.begin(); it!=stationGroups_p.end(); ++it) {
+    for (it=names.begin(); it!=names.end(); ++it) {
+      group = findStationGroup (*it);
       tmp.clear();
-      tmp = it->second.dipoleNames();
+      tmp = group->dipoleNames();
       for (unsigned int n(0); n<tmp.size(); ++n) {
-	names.push_back(tmp[n]);
+	dipoles.push_back(tmp[n]);
       }
     }
 
-    return names;
+    return dipoles;
   }
   
   //_____________________________________________________________________________
@@ -520,7 +511,7 @@ namespace DAL {  // Namespace DAL -- begin
   std::set<std::string> TBB_Timeseries::selectedDipoles ()
   {
     std::set<std::string> selection;
-    std::map<std::string,iterDipoleDataset>::iterator it;
+    std::map<std::string,std::string>::iterator it;
 
     for (it=selectedDatasets_p.begin(); it!=selectedDatasets_p.end(); ++it) {
       selection.insert(it->first);
@@ -528,6 +519,32 @@ namespace DAL {  // Namespace DAL -- begin
 
     return selection;
   }
+
+  //_____________________________________________________________________________
+  //                                                              dipoleSelection
+
+  /*!
+    \return datasets -- The selected dipole datasets, ordered by their names;
+            the objects share the HDF5 identifiers with the datasets held by
+            the station groups, keeping them open for as long as they exist.
+  */
+  std::vector<TBB_DipoleDataset> TBB_Timeseries::dipoleSelection ()
+  {
+    std::vector<TBB_DipoleDataset> datasets;
+    std::map<std::string,std::string>::iterator it;
+    TBB_StationGroup *group;
+
+    for (it=selectedDatasets_p.begin(); it!=selectedDatasets_p.end(); ++it) {
+      group = findStationGroup (it->second);
+      if (group != NULL) {
+	datasets.push_back (group->dipoleDataset (it->first));
+      } else {
+	datasets.push_back (TBB_DipoleDataset());
+      }
+    }
+
+    return datasets;
+  }
   
 
   //_____________________________________________________________________________
@@ -539,16 +556,18 @@ namespace DAL {  // Namespace DAL -- begin
   bool TBB_Timeseries::selectDipoles (std::set<std::string> const &selection)
   {
     bool status (true);
-    std::map<std::string,TBB_StationGroup>::iterator it;
+    std::set<std::string> names = stationGroups_p.names();
+    std::set<std::string>::iterator it;
+    TBB_StationGroup *group;
     
     /* Forward selection instruction to the underlying station groups */
-    for (it = stationGroups_p.begin(); it!=stationGroups_p.end(); ++it) {
-      status *= it->second.selectDipoles(selection);
+    for (it=names.begin(); it!=names.end(); ++it) {
+      group = findStationGroup (*it);
+      status *= group->selectDipoles(selection);
+      /* Local book-keeping, before the group may be closed again */
+      setSelectedDatasets (*it, group);
     }
     
-    /* Local book-keeping */
-    status *= setSelectedDatasets ();
-    
     return status;
   }
   
@@ -558,15 +577,17 @@ namespace DAL {  // Namespace DAL -- begin
   bool TBB_Timeseries::selectAllDipoles ()
   {
     bool status (true);
-    std::map<std::string,TBB_StationGroup>::iterator it;
+    std::set<std::string> names = stationGroups_p.names();
+    std::set<std::string>::iterator it;
+    TBB_StationGroup *group;
 
     /* Forward selection instruction to the underlying station groups */
-    for (it = stationGroups_p.begin(); it!=stationGroups_p.end(); ++it) {
-      status *= it->second.selectAllDipoles();
+    for (it=names.begin(); it!=names.end(); ++it) {
+      group = findStationGroup (*it);
+      status *= group->selectAllDipoles();
+      /* Local book-keeping, before the group may be closed again */
+      setSelectedDatasets (*it, group);
     }
-    
-    /* Local book-keeping */
-    status *= setSelectedDatasets ();
 
     return status;
   }
@@ -577,26 +598,92 @@ namespace DAL {  // Namespace DAL -- begin
   bool TBB_Timeseries::setSelectedDatasets ()
   {
     bool status (true);
-    std::map<std::string,TBB_StationGroup>::iterator iterStation;
-    std::map<std::string,iterDipoleDataset> tmp;
-    std::map<std::string,iterDipoleDataset>::iterator it;
+    std::set<std::string> names = stationGroups_p.names();
+    std::set<std::string>::iterator it;
 
-    selectedDatasets_p.clear();
+    for (it=names.begin(); it!=names.end(); ++it) {
+      status = setSelectedDatasets (*it, findStationGroup(*it)) && status;
+    }
 
-    for (iterStation=stationGroups_p.begin();
-	 iterStation!=stationGroups_p.end();
-	 ++iterStation) {
-      /* Clear temporary map */
-      tmp.clear();
-      /* Get selection from the current station group */
-      tmp = iterStation->second.dipoleSelection();
-      /* Add the elements from the selection for the station */
-      for (it=tmp.begin(); it!=tmp.end(); ++it) {
-	selectedDatasets_p[it->first] = it->second;
+    return status;
+  }
+
+  //_____________________________________________________________________________
+  //                                                          setSelectedDatasets
+
+  /*!
+    \param name  -- Name of the station group.
+    \param group -- The opened station group, as returned by findStationGroup().
+    eturn status -- Returns \e false if the station group is not available.
+
+    The selection has to be recorded while the station group is open, since
+    it is lost once the group gets closed to stay within the handle limit.
+  */
+  bool TBB_Timeseries::setSelectedDatasets (std::string const &name,
+					    TBB_StationGroup *group)
+  {
+    std::map<std::string,std::string>::iterator it = selectedDatasets_p.begin();
+
+    /* Remove the previous selection for the station */
+    while (it != selectedDatasets_p.end()) {
+      if (it->second == name) {
+	selectedDatasets_p.erase(it++);
+      } else {
+	++it;
       }
     }
 
-    return status;
+    if (group == NULL) {
+      return false;
+    }
+
+    /* Add the elements from the selection for the station */
+    std::set<std::string> selection = group->selectedDipoles();
+    std::set<std::string>::iterator iterSelection;
+
+    for (iterSelection=selection.begin();
+	 iterSelection!=selection.end();
+	 ++iterSelection) {
+      selectedDatasets_p[*iterSelection] = name;
+    }
+
+    return true;
+  }
+
+  //_____________________________________________________________________________
+  //                                                             findStationGroup
+
+  /*!
+    \param name -- Name of the station group.
+    \return group -- Pointer to the station group held in the cache, opening
+            the group if required; \c NULL if there is no such group. The
+            pointer remains valid until the next station group is opened.
+
+    A station group opened again, after it had been closed to stay within
+    the handle limit, starts out with all of its dipoles selected; the
+    selection kept by the time-series object is applied to it again.
+  */
+  TBB_StationGroup * TBB_Timeseries::findStationGroup (std::string const &name)
+  {
+    bool reopened           = !stationGroups_p.isOpen(name);
+    TBB_StationGroup *group = stationGroups_p.find(name);
+
+    if (group != NULL && reopened && !selectedDatasets_p.empty()) {
+      std::set<std::string> selection;
+      std::map<std::string,std::string>::iterator it;
+
+      for (it=selectedDatasets_p.begin(); it!=selectedDatasets_p.end(); ++it) {
+	if (it->second == name) {
+	  selection.insert (it->first);
+	}
+      }
+
+      if (!selection.empty()) {
+	group->selectDipoles (selection);
+      }
+    }
+
+    return group;
   }
   
   // ============================================================================
@@ -614,11 +701,14 @@ namespace DAL {  // Namespace DAL -- begin
   {
     uint nofStations = stationGroups_p.size();
     casa::Vector<casa::String> trigger (nofStations);
-    std::map<std::string,TBB_StationGroup>::iterator it;
+    std::set<std::string> names = stationGroups_p.names();
+    std::set<std::string>::iterator it;
+    TBB_StationGroup *group;
     int n (0);
 
-    for (it = stationGroups_p.begin(); it!=stationGroups_p.end(); ++it) {
-      it->second.getAttribute("TRIGGER_TYPE",trigger(n));
+    for (it=names.begin(); it!=names.end(); ++it) {
+      group = findStationGroup (*it);
+      group->getAttribute("TRIGGER_TYPE",trigger(n));
       ++n;
     }
 
@@ -629,11 +719,14 @@ namespace DAL {  // Namespace DAL -- begin
   {
     uint nofStations = stationGroups_p.size();
     std::vector<std::string> trigger (nofStations);
-    std::map<std::string,TBB_StationGroup>::iterator it;
+    std::set<std::string> names = stationGroups_p.names();
+    std::set<std::string>::iterator it;
+    TBB_StationGroup *group;
     int n (0);
 
-    for (it = stationGroups_p.begin(); it!=stationGroups_p.end(); ++it) {
-      it->second.getAttribute("TRIGGER_TYPE",trigger[n]);
+    for (it=names.begin(); it!=names.end(); ++it) {
+      group = findStationGroup (*it);
+      group->getAttribute("TRIGGER_TYPE",trigger[n]);
       ++n;
     }
 
@@ -649,11 +742,14 @@ namespace DAL {  // Namespace DAL -- begin
   {
     uint nofStations = nofStationGroups();
     casa::Vector<double> trigger (nofStations);
-    std::map<std::string,TBB_StationGroup>::iterator it;
+    std::set<std::string> names = stationGroups_p.names();
+    std::set<std::string>::iterator it;
+    TBB_StationGroup *group;
     int n (0);
 
-    for (it = stationGroups_p.begin(); it!=stationGroups_p.end(); ++it) {
-      it->second.getAttribute("TRIGGER_OFFSET",trigger(n));
+    for (it=names.begin(); it!=names.end(); ++it) {
+      group = findStationGroup (*it);
+      group->getAttribute("TRIGGER_OFFSET",trigger(n));
       ++n;
     }
 
@@ -664,11 +760,14 @@ namespace DAL {  // Namespace DAL -- begin
   {
     uint nofStations = nofStationGroups();
     std::vector<double> trigger (nofStations);
-    std::map<std::string,TBB_StationGroup>::iterator it;
+    std::set<std::string> names = stationGroups_p.names();
+    std::set<std::string>::iterator it;
+    TBB_StationGroup *group;
     int n (0);
 
-    for (it = stationGroups_p.begin(); it!=stationGroups_p.end(); ++it) {
-      it->second.getAttribute("TRIGGER_OFFSET",trigger[n]);
+    for (it=names.begin(); it!=names.end(); ++it) {
+      group = findStationGroup (*it);
+      group->getAttribute("TRIGGER_OFFSET",trigger[n]);
       ++n;
     }
 
@@ -686,11 +785,14 @@ namespace DAL {  // Namespace DAL -- begin
     uint nofStations = nofStationGroups();
     casa::Vector<double> tmp;
     casa::Matrix<double> values (nofStations,3);
-    std::map<std::string,TBB_StationGroup>::iterator it;
+    std::set<std::string> names = stationGroups_p.names();
+    std::set<std::string>::iterator it;
+    TBB_StationGroup *group;
     int n (0);
 
-    for (it = stationGroups_p.begin(); it!=stationGroups_p.end(); ++it) {
-      it->second.getAttribute("STATION_POSITION_VALUE",tmp);
+    for (it=names.begin(); it!=names.end(); ++it) {
+      group = findStationGroup (*it);
+      group->getAttribute("STATION_POSITION_VALUE",tmp);
       values.row(n) = tmp;
       ++n;
     }
@@ -706,11 +808,14 @@ namespace DAL {  // Namespace DAL -- begin
     uint nofStations = nofStationGroups();
     casa::Vector<casa::String> tmp;
     casa::Matrix<casa::String> units (nofStations,3);
-    std::map<std::string,TBB_StationGroup>::iterator it;
+    std::set<std::string> names = stationGroups_p.names();
+    std::set<std::string>::iterator it;
+    TBB_StationGroup *group;
     int n (0);
 
-    for (it = stationGroups_p.begin(); it!=stationGroups_p.end(); ++it) {
-      it->second.getAttribute("STATION_POSITION_UNIT",tmp);
+    for (it=names.begin(); it!=names.end(); ++it) {
+      group = findStationGroup (*it);
+      group->getAttribute("STATION_POSITION_UNIT",tmp);
       units.row(n) = tmp;
       ++n;
     }
@@ -725,11 +830,14 @@ namespace DAL {  // Namespace DAL -- begin
   {
     uint nofStations = nofStationGroups();
     casa::Vector<casa::MPosition> positions (nofStations);
-    std::map<std::string,TBB_StationGroup>::iterator it;
+    std::set<std::string> names = stationGroups_p.names();
+    std::set<std::string>::iterator it;
+    TBB_StationGroup *group;
     int n (0);
 
-    for (it = stationGroups_p.begin(); it!=stationGroups_p.end(); ++it) {
-      positions(n) = (*it).second.station_position();
+    for (it=names.begin(); it!=names.end(); ++it) {
+      group = findStationGroup (*it);
+      positions(n) = group->station_position();
       ++n;
     }
 
@@ -744,11 +852,14 @@ namespace DAL {  // Namespace DAL -- begin
     uint nofStations = nofStationGroups();
     casa::Vector<double> tmp;
     casa::Matrix<double> values (nofStations,2);
-    std::map<std::string,TBB_StationGroup>::iterator it;
+    std::set<std::string> names = stationGroups_p.names();
+    std::set<std::string>::iterator it;
+    TBB_StationGroup *group;
     int n (0);
 
-    for (it = stationGroups_p.begin(); it!=stationGroups_p.end(); ++it) {
-      it->second.getAttribute("BEAM_DIRECTION_VALUE",tmp);
+    for (it=names.begin(); it!=names.end(); ++it) {
+      group = findStationGroup (*it);
+      group->getAttribute("BEAM_DIRECTION_VALUE",tmp);
       values.row(n) = tmp;
       ++n;
     }
@@ -763,11 +874,14 @@ namespace DAL {  // Namespace DAL -- begin
     uint nofStations = nofStationGroups();
     casa::Vector<casa::String> tmp;
     casa::Matrix<casa::String> units (nofStations,2);
-    std::map<std::string,TBB_StationGroup>::iterator it;
+    std::set<std::string> names = stationGroups_p.names();
+    std::set<std::string>::iterator it;
+    TBB_StationGroup *group;
     int n (0);
 
-    for (it = stationGroups_p.begin(); it!=stationGroups_p.end(); ++it) {
-      it->second.getAttribute("BEAM_DIRECTION_UNIT",tmp);
+    for (it=names.begin(); it!=names.end(); ++it) {
+      group = findStationGroup (*it);
+      group->getAttribute("BEAM_DIRECTION_UNIT",tmp);
       units.row(n) = tmp;
       ++n;
     }
@@ -781,12 +895,15 @@ namespace DAL {  // Namespace DAL -- begin
   {
     uint nofStations = nofStationGroups();
     casa::Vector<casa::String> frame (nofStations);
-    std::map<std::string,TBB_StationGroup>::iterator it;
+    std::set<std::string> names = stationGroups_p.names();
+    std::set<std::string>::iterator it;
+    TBB_StationGroup *group;
     std::string tmp;
     int n (0);
 
-    for (it = stationGroups_p.begin(); it!=stationGroups_p.end(); ++it) {
-      it->second.getAttribute("BEAM_DIRECTION_FRAME",tmp);
+    for (it=names.begin(); it!=names.end(); ++it) {
+      group = findStationGroup (*it);
+      group->getAttribute("BEAM_DIRECTION_FRAME",tmp);
       frame(n) = tmp;
       ++n;
     }
@@ -801,11 +918,14 @@ namespace DAL {  // Namespace DAL -- begin
   {
     uint nofStations = nofStationGroups();
     casa::Vector<casa::MDirection> directions (nofStations);
-    std::map<std::string,TBB_StationGroup>::iterator it;
+    std::set<std::string> names = stationGroups_p.names();
+    std::set<std::string>::iterator it;
+    TBB_StationGroup *group;
     int n (0);
 
-    for (it = stationGroups_p.begin(); it!=stationGroups_p.end(); ++it) {
-      directions(n) = (*it).second.beam_direction();
+    for (it=names.begin(); it!=names.end(); ++it) {
+      group = findStationGroup (*it);
+      directions(n) = group->beam_direction();
       ++n;
     }
 
@@ -821,12 +941,15 @@ namespace DAL {  // Namespace DAL -- begin
   {
     uint nofStations = nofStationGroups();
     casa::Vector<casa::String> frame (nofStations);
-    std::map<std::string,TBB_StationGroup>::iterator it;
+    std::set<std::string> names = stationGroups_p.names();
+    std::set<std::string>::iterator it;
+    TBB_StationGroup *group;
     std::string tmp;
     int n (0);
 
-    for (it = stationGroups_p.begin(); it!=stationGroups_p.end(); ++it) {
-      it->second.getAttribute("STATION_POSITION_FRAME",tmp);
+    for (it=names.begin(); it!=names.end(); ++it) {
+      group = findStationGroup (*it);
+      group->getAttribute("STATION_POSITION_FRAME",tmp);
       frame(n) = tmp;
       ++n;
     }
@@ -838,12 +961,15 @@ namespace DAL {  // Namespace DAL -- begin
   {
     uint nofStations = nofStationGroups();
     std::vector<std::string> frame (nofStations);
-    std::map<std::string,TBB_StationGroup>::iterator it;
+    std::set<std::string> names = stationGroups_p.names();
+    std::set<std::string>::iterator it;
+    TBB_StationGroup *group;
     std::string tmp;
     int n (0);
 
-    for (it = stationGroups_p.begin(); it!=stationGroups_p.end(); ++it) {
-      it->second.getAttribute("STATION_POSITION_FRAME",tmp);
+    for (it=names.begin(); it!=names.end(); ++it) {
+      group = findStationGroup (*it);
+      group->getAttribute("STATION_POSITION_FRAME",tmp);
       frame[n] = tmp;
       ++n;
     }
@@ -871,11 +997,14 @@ namespace DAL {  // Namespace DAL -- begin
     uint nofDipoles  = nofSelectedDatasets();
     casa::Vector<casa::MPosition> positions (nofDipoles);
     casa::Vector<casa::MPosition> tmp;
-    std::map<std::string,TBB_StationGroup>::iterator it;
-
-    for (it = stationGroups_p.begin(); it!=stationGroups_p.end(); ++it) {
-      tmp        = (*it).second.antenna_position();
-      nofDipoles = (*it).second.nofSelectedDatasets();
+    std::set<std::string> names = stationGroups_p.names();
+    std::set<std::string>::iterator it;
+    TBB_StationGroup *group;
+
+    for (it=names.begin(); it!=names.end(); ++it) {
+      group = findStationGroup (*it);
+      tmp        = group->antenna_position();
+      nofDipoles = group->nofSelectedDatasets();
       // go through the dipoles from an individual station
       for (dipole=0; dipole<nofDipoles; dipole++) {
 	positions(n) = tmp[dipole];
@@ -897,7 +1026,7 @@ namespace DAL {  // Namespace DAL -- begin
   bool TBB_Timeseries::set_antenna_position (std::map<std::string, casa::MPosition> &pos)
   {
     std::map<std::string, casa::MPosition>::iterator pos_it;
-    std::map<std::string, iterDipoleDataset>::iterator ds_it;
+    std::map<std::string, std::string>::iterator ds_it;
 
     bool status = true;
 
@@ -905,7 +1034,7 @@ namespace DAL {  // Namespace DAL -- begin
       ds_it = selectedDatasets_p.find(pos_it->first);
       if (ds_it != selectedDatasets_p.end())
       {
-        if ((ds_it->second)->second.set_antenna_position(pos_it->second) == false)
+        if (findStationGroup(ds_it->second)->dipoleDataset(ds_it->first).set_antenna_position(pos_it->second) == false)
         {
           status = false;
         }
@@ -932,11 +1061,14 @@ namespace DAL {  // Namespace DAL -- begin
     uint nofDipoles  = nofSelectedDatasets();
     std::vector<int> channelIDvalues (nofDipoles);
     std::vector<int> tmp;
-    std::map<std::string,TBB_StationGroup>::iterator it;
-
-    for (it = stationGroups_p.begin(); it!=stationGroups_p.end(); ++it) {
-      tmp        = (*it).second.dipoleNumbers();
-      nofDipoles = (*it).second.nofSelectedDatasets();
+    std::set<std::string> names = stationGroups_p.names();
+    std::set<std::string>::iterator it;
+    TBB_StationGroup *group;
+
+    for (it=names.begin(); it!=names.end(); ++it) {
+      group = findStationGroup (*it);
+      tmp        = group->dipoleNumbers();
+      nofDipoles = group->nofSelectedDatasets();
       // go through the dipoles from an individual station
       for (dipole=0; dipole<nofDipoles; dipole++) {
 	channelIDvalues[n] = tmp[dipole];
@@ -1069,13 +1201,14 @@ namespace DAL {  // Namespace DAL -- begin
     return out;
   }
 
+#ifdef DAL_WITH_CASA
   //_____________________________________________________________________________
   //                                                              set_cable_delay
 
   bool TBB_Timeseries::set_cable_delay (std::map<std::string, casa::Quantity> &delay)
   {
     std::map<std::string, casa::Quantity>::iterator delay_it;
-    std::map<std::string, iterDipoleDataset>::iterator ds_it;
+    std::map<std::string, std::string>::iterator ds_it;
 
     bool status = true;
 
@@ -1083,7 +1216,7 @@ namespace DAL {  // Namespace DAL -- begin
       ds_it = selectedDatasets_p.find(delay_it->first);
       if (ds_it != selectedDatasets_p.end())
       {
-        if ((ds_it->second)->second.set_cable_delay(delay_it->second) == false)
+        if (findStationGroup(ds_it->second)->dipoleDataset(ds_it->first).set_cable_delay(delay_it->second) == false)
         {
           status = false;
         }
@@ -1096,6 +1229,7 @@ namespace DAL {  // Namespace DAL -- begin
 
     return status;
   }
+#endif
 
   //_____________________________________________________________________________
   //                                                     dipole_calibration_delay
@@ -1127,13 +1261,14 @@ namespace DAL {  // Namespace DAL -- begin
     return out;
   }
 
+#ifdef DAL_WITH_CASA
   //_____________________________________________________________________________
   //                                                 set_dipole_calibration_delay
 
   bool TBB_Timeseries::set_dipole_calibration_delay (std::map<std::string, casa::Quantity> &delay)
   {
     std::map<std::string, casa::Quantity>::iterator delay_it;
-    std::map<std::string, iterDipoleDataset>::iterator ds_it;
+    std::map<std::string, std::string>::iterator ds_it;
 
     bool status = true;
 
@@ -1141,7 +1276,7 @@ namespace DAL {  // Namespace DAL -- begin
       ds_it = selectedDatasets_p.find(delay_it->first);
       if (ds_it != selectedDatasets_p.end())
       {
-        if ((ds_it->second)->second.set_dipole_calibration_delay(delay_it->second) == false)
+        if (findStationGroup(ds_it->second)->dipoleDataset(ds_it->first).set_dipole_calibration_delay(delay_it->second) == false)
         {
           status = false;
         }
@@ -1155,7 +1290,6 @@ namespace DAL {  // Namespace DAL -- begin
     return status;
   }
 
-#ifdef DAL_WITH_CASA
   // -------------------------------------------------------------- sample_offset
 
   std::vector<int> TBB_Timeseries::sample_offset (uint const &refAntenna)
@@ -1235,6 +1369,7 @@ namespace DAL {  // Namespace DAL -- begin
     return refAntenna;
   }
 
+#ifdef DAL_WITH_CASA
   // -------------------------------------------------------------- maximum_read_length
   uint TBB_Timeseries::maximum_read_length (uint const &refAntenna)
   {
@@ -1256,6 +1391,7 @@ namespace DAL {  // Namespace DAL -- begin
 
     return maxLength;
   }
+#endif
 
   // ============================================================================
   //
@@ -1263,6 +1399,251 @@ namespace DAL {  // Namespace DAL -- begin
   //
   // ============================================================================
 
+  //_____________________________________________________________________________
+  //                                                               DipoleReadTask
+
+  /*!
+    \brief Work shared between the threads reading a block of dipole data
+  */
+  struct DipoleReadTask {
+    //! The selected dipole datasets
+    std::vector<TBB_DipoleDataset> dipoles;
+    //! Number of the sample at which to start reading, per dipole
+    std::vector<int> start;
+    //! Number of samples to read per dipole
+    int nofSamples;
+    //! Destination array, storing the samples of a dipole contiguously
+    double *data;
+    //! Index of the next dipole to be picked up by a thread
+    unsigned int next;
+    //! Status of the operation, \e false once a read has failed
+    bool status;
+    //! Lock protecting the shared state of the task
+    pthread_mutex_t mutex;
+  };
+
+  //_____________________________________________________________________________
+  //                                                               readDipoleRows
+
+  /*!
+    Picks up one dipole after another until all of them have been handled: the
+    raw samples of a dipole are read into a buffer owned by the thread and then
+    widened to \c double straight into the destination row. As the HDF5
+    library must not be entered by more than one thread at a time, the actual
+    read is done holding the process-wide HDF5Lock, such that reading the next
+    dipole overlaps with the conversion of the previous one.
+
+    \param task -- Pointer to the DipoleReadTask shared by the threads.
+  */
+  static void * readDipoleRows (void *task)
+  {
+    DipoleReadTask *t       = static_cast<DipoleReadTask *> (task);
+    unsigned int nofDipoles = t->dipoles.size();
+    std::vector<short> buffer (t->nofSamples);
+    unsigned int n;
+    bool status (true);
+
+    while (true) {
+      pthread_mutex_lock (&t->mutex);
+      n = t->next++;
+      pthread_mutex_unlock (&t->mutex);
+
+      if (n >= nofDipoles) {
+	break;
+      }
+
+      HDF5Lock::lock ();
+      status = t->dipoles[n].readData (t->start[n],
+					t->nofSamples,
+					&buffer[0]);
+      HDF5Lock::unlock ();
+
+      if (!status) {
+	pthread_mutex_lock (&t->mutex);
+	t->status = false;
+	pthread_mutex_unlock (&t->mutex);
+      }
+
+      double *row = t->data + size_t(n)*t->nofSamples;
+
+      if (status) {
+	convertSamples (row, &buffer[0], t->nofSamples);
+      } else {
+	for (int sample(0); sample<t->nofSamples; ++sample) {
+	  row[sample] = 0.0;
+	}
+      }
+    }
+
+    return NULL;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                     readData
+
+  /*!
+    \retval data -- [dipole,nofSamples] Array of raw 16-bit ADC samples, with
+            the samples of a dipole stored contiguously; the array must
+            provide space for <tt>nofSamples</tt> values for each of the
+            selected dipoles.
+    \param start      -- Number of the sample at which to start reading, for
+           each of the selected dipoles.
+    \param nofSamples -- Number of samples to read, starting from the position
+           given by <tt>start</tt>.
+    \return status -- Status of the operation; returns <tt>false</tt> in case
+            an error was encountered.
+
+    As opposed to the variant returning \c double values, the samples are
+    read straight from the file into the memory provided, which takes only a
+    quarter of the space; use DAL::convertSamples() to convert (parts of) the
+    data to floating point values and to apply calibration gains.
+  */
+  bool TBB_Timeseries::readData (short *data,
+				 std::vector<int> const &start,
+				 int const &nofSamples)
+  {
+    unsigned int sizeSelection = selectedDatasets_p.size();
+
+    // Check input parameters ______________________________
+
+    if (data == NULL || nofSamples < 1) {
+      std::cerr << "[TBB_Timeseries::readData]"
+		<< " No memory provided to store the data!"
+		<< std::endl;
+      return false;
+    }
+
+    if (start.size() != sizeSelection) {
+      std::cerr << "[TBB_Timeseries::readData]"
+		<< " Wrong length of vector with start positions!"
+		<< std::endl;
+      std::cerr << " -- size(selection) = " << sizeSelection << std::endl;
+      std::cerr << " -- size(start)     = " << start.size()  << std::endl;
+      return false;
+    }
+
+    // Retrieve data from file _____________________________
+
+    bool status (true);
+    unsigned int n (0);
+    std::vector<TBB_DipoleDataset> selection = dipoleSelection();
+
+    for (n=0; n<selection.size(); ++n) {
+      short *row = data + size_t(n)*nofSamples;
+      if (!selection[n].readData (start[n], nofSamples, row)) {
+	for (int sample(0); sample<nofSamples; ++sample) {
+	  row[sample] = 0;
+	}
+	status = false;
+      }
+    }
+
+    return status;
+  }
+
+  //_____________________________________________________________________________
+  //                                                                     readData
+
+  /*!
+    \retval data -- [dipole,nofSamples] Array of raw ADC samples representing
+            the electric field strength as function of time, with the samples
+            of a dipole stored contiguously; the array must provide space for
+            <tt>nofSamples</tt> values for each of the selected dipoles. The
+            memory layout is the one of a column-major
+            <tt>[nofSamples,dipole]</tt> matrix.
+    \param start      -- Number of the sample at which to start reading, for
+           each of the selected dipoles.
+    \param nofSamples -- Number of samples to read, starting from the position
+           given by <tt>start</tt>.
+    \param nofThreads -- Maximum number of threads to use; if set to 0 the
+           number is derived from the number of available processors.
+    \return status -- Status of the operation; returns <tt>false</tt> in case
+            an error was encountered. The rows of dipoles which could not be
+            read are set to zero.
+
+    The threads are started for the duration of the call only. As starting a
+    thread costs about as much as converting some ten thousand samples, the
+    number of threads is limited such that each of them handles at least
+    minSamplesPerThread samples; smaller blocks of data are read and converted
+    by the calling thread alone. The calls into the HDF5 library are made
+    holding the process-wide HDF5Lock, which therefore must not be held by the
+    caller.
+  */
+  bool TBB_Timeseries::readData (double *data,
+				 std::vector<int> const &start,
+				 int const &nofSamples,
+				 unsigned int const &nofThreads)
+  {
+    unsigned int sizeSelection = selectedDatasets_p.size();
+
+    // Check input parameters ______________________________
+
+    if (data == NULL || nofSamples < 1) {
+      std::cerr << "[TBB_Timeseries::readData]"
+		<< " No memory provided to store the data!"
+		<< std::endl;
+      return false;
+    }
+
+    if (start.size() != sizeSelection) {
+      std::cerr << "[TBB_Timeseries::readData]"
+		<< " Wrong length of vector with start positions!"
+		<< std::endl;
+      std::cerr << " -- size(selection) = " << sizeSelection << std::endl;
+      std::cerr << " -- size(start)     = " << start.size()  << std::endl;
+      return false;
+    }
+
+    // Set up the work to be shared by the threads _________
+
+    DipoleReadTask task;
+
+    task.dipoles    = dipoleSelection();
+    task.start      = start;
+    task.nofSamples = nofSamples;
+    task.data       = data;
+    task.next       = 0;
+    task.status     = true;
+    pthread_mutex_init (&task.mutex, NULL);
+
+    unsigned int nofWorkers = nofThreads;
+
+    if (nofWorkers == 0) {
+      long nofProcessors = sysconf (_SC_NPROCESSORS_ONLN);
+      nofWorkers = nofProcessors > 0 ? nofProcessors : 1;
+    }
+    /* Starting a thread only pays off if it has enough samples to convert */
+    size_t maxWorkers = (size_t(sizeSelection)*nofSamples)/minSamplesPerThread;
+    if (nofWorkers > maxWorkers) {
+      nofWorkers = maxWorkers;
+    }
+    if (nofWorkers > sizeSelection) {
+      nofWorkers = sizeSelection;
+    }
+
+    // Retrieve data from file _____________________________
+
+    /* The calling thread is one of the workers */
+    std::vector<pthread_t> threads;
+    pthread_t thread;
+
+    for (unsigned int n(1); n<nofWorkers; ++n) {
+      if (pthread_create (&thread, NULL, readDipoleRows, &task) == 0) {
+	threads.push_back (thread);
+      }
+    }
+
+    readDipoleRows (&task);
+
+    for (unsigned int n(0); n<threads.size(); ++n) {
+      pthread_join (threads[n], NULL);
+    }
+
+    pthread_mutex_destroy (&task.mutex);
+
+    return task.status;
+  }
+
 #ifdef DAL_WITH_CASA
 
   //_____________________________________________________________________________
@@ -1327,22 +1708,22 @@ namespace DAL {  // Namespace DAL -- begin
     }
     
     // Retrieve data from file _____________________________
-    
+
+    /* The columns of the matrix are the rows of the dipoles */
     bool status (true);
-    uint n (0);
-    casa::Vector<double> tmp (nofSamples);
-    std::map<std::string,iterDipoleDataset>::iterator it;
+    bool deleteStorage (false);
+    std::vector<int> startPositions (sizeStart);
     
-    /* Iterate over the selected dipoles */
-    for (it=selectedDatasets_p.begin(); it!=selectedDatasets_p.end(); ++it) {
-      /* Retrieve dipole data */
-      tmp = (it->second)->second.readData(start(n),nofSamples);
-      /* Copy the data to the returned array */
-      data.column(n) = tmp;
-      /* Increment data array column counter */
-      ++n;
+    for (uint n(0); n<sizeStart; ++n) {
+      startPositions[n] = start(n);
     }
 
+    double *storage = data.getStorage (deleteStorage);
+    status = readData (storage,
+		       startPositions,
+		       nofSamples);
+    data.putStorage (storage, deleteStorage);
+
     // Feedback ____________________________________________
 
 #ifdef DAL_DEBUGGING_MESSAGES
@@ -1376,13 +1757,16 @@ namespace DAL {  // Namespace DAL -- begin
     uint nofDipoles  = nofSelectedDatasets();
     casa::Vector<casa::MFrequency> freq (nofDipoles);
     casa::Vector<casa::MFrequency> tmp;
-    std::map<std::string,TBB_StationGroup>::iterator it;
+    std::set<std::string> names = stationGroups_p.names();
+    std::set<std::string>::iterator it;
+    TBB_StationGroup *group;
 
-    for (it = stationGroups_p.begin(); it!=stationGroups_p.end(); ++it) {
+    for (it=names.begin(); it!=names.end(); ++it) {
+      group = findStationGroup (*it);
       /* Retrieve sample frequencies per station */
-      status = (*it).second.sample_frequency(tmp);
+      status = group->sample_frequency(tmp);
       /* Determine number of dipoles within this station */
-      nofDipoles = (*it).second.nofSelectedDatasets();
+      nofDipoles = group->nofSelectedDatasets();
       /* Copy the data to the returned array */
       for (dipole=0; dipole<nofDipoles; dipole++) {
 	freq(n) = tmp(dipole);
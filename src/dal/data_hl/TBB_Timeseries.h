@@ -28,6 +28,7 @@
 
 #include <data_common/CommonAttributes.h>
 #include <data_common/HDF5GroupBase.h>
+#include <data_common/HDF5HandleCache.h>
 #include <data_hl/SysLog.h>
 #include <data_hl/TBB_StationGroup.h>
 #include <data_hl/TBB_StationTrigger.h>
@@ -173,19 +174,16 @@ namespace DAL {  // Namespace DAL -- begin
   */
   class TBB_Timeseries : public HDF5GroupBase {
     
-    //! Typedef for the iterator on the map holding the TBB_DipoleDataset
-    typedef std::map<std::string,TBB_DipoleDataset>::iterator iterDipoleDataset;
-    
   protected:
     
     //! Name of the data file
     std::string filename_p;
     //! Container for system-wide logs attached to the root group of the file
     std::map<std::string,SysLog> sysLog_p;
-    //! Station groups attached to the root group of the file
-    std::map<std::string,TBB_StationGroup> stationGroups_p;
-    //! Selected dipoles
-    std::map<std::string,iterDipoleDataset> selectedDatasets_p;
+    //! Station groups attached to the root group of the file, opened on demand
+    HDF5HandleCache<TBB_StationGroup> stationGroups_p;
+    //! Selected dipoles, mapped onto the name of their station group
+    std::map<std::string,std::string> selectedDatasets_p;
     
   public:
     
@@ -350,10 +348,8 @@ namespace DAL {  // Namespace DAL -- begin
     std::set<std::string> selectedDipoles ();
     //! Set the set of selected dipoles
     bool selectDipoles (std::set<std::string> const &selection);
-    //! Get the map constaining the actual dipole dataset selection
-    inline std::map<std::string,iterDipoleDataset> dipoleSelection () const {
-      return selectedDatasets_p;
-    }
+    //! Get the selected dipole datasets
+    std::vector<TBB_DipoleDataset> dipoleSelection ();
     //! Select all dipoles within the dataset
     bool selectAllDipoles ();
     
@@ -367,17 +363,25 @@ namespace DAL {  // Namespace DAL -- begin
       uint dipole      = 0;
       uint nofDipoles  = nofSelectedDatasets();
       std::vector<T> tmp;
-      std::map<std::string,TBB_StationGroup>::iterator it;
+      std::set<std::string> names = stationGroups_p.names();
+      std::set<std::string>::iterator it;
+      TBB_StationGroup *group;
 
       // Resize output vector
       out.resize(nofDipoles);
 
-      for (it = stationGroups_p.begin(); it!=stationGroups_p.end(); ++it) {
-        if (it->second.getAttributes(attr, tmp) == false)
+      for (it = names.begin(); it!=names.end(); ++it) {
+        group = findStationGroup (*it);
+        if (group == NULL)
+        {
+          status = false;
+          continue;
+        }
+        if (group->getAttributes(attr, tmp) == false)
         {
           status = false;
         }
-        nofDipoles = (*it).second.nofSelectedDatasets();
+        nofDipoles = group->nofSelectedDatasets();
 
         // go through the dipoles from an individual station
         for (dipole=0; dipole<nofDipoles; dipole++) {
@@ -410,15 +414,30 @@ namespace DAL {  // Namespace DAL -- begin
     std::vector<std::string> sample_frequency_unit ();
     //! Finds best reference antenna for data alignment (e.g. antenna that receives data last)
     uint alignment_reference_antenna ();
+#ifdef DAL_WITH_CASA
     //! Time offset between the individual antennas in units of samples
     std::vector<int> sample_offset (uint const &refAntenna);
     //! Maximum number of samples that can be read when offset with given reference antenna
     uint maximum_read_length (uint const &refAntenna);
+#endif
     //! Retrieve the list of channel IDs
     std::vector<int> channelID ();
     //! Get the Nyquist zone for the A/D conversion
     std::vector<uint> nyquist_zone ();
 
+    //! Retrieve a block of raw ADC values per dipole, into caller-provided memory
+    bool readData (short *data,
+		   std::vector<int> const &start,
+		   int const &nofSamples);
+    //! Minimum number of samples to be converted by each of the readData() threads
+    static const unsigned int minSamplesPerThread = 65536;
+
+    //! Retrieve a block of ADC values per dipole, into caller-provided memory
+    bool readData (double *data,
+		   std::vector<int> const &start,
+		   int const &nofSamples,
+		   unsigned int const &nofThreads=0);
+
 #ifdef DAL_WITH_CASA
     //! Retrieve a block of ADC values per dipole
     bool readData (casa::Matrix<double> &data,
@@ -450,6 +469,11 @@ namespace DAL {  // Namespace DAL -- begin
     bool openStationGroups (IO_Mode const &flags=IO_Mode(IO_Mode::OpenOrCreate));
     //! Set local map used for book-keeping on selected dipole datasets
     bool setSelectedDatasets ();
+    //! Record the dipole selection of a single station group
+    bool setSelectedDatasets (std::string const &name,
+			      TBB_StationGroup *group);
+    //! Get a station group, opening it if required
+    TBB_StationGroup * findStationGroup (std::string const &name);
     //! Unconditional copying
     void copy (TBB_Timeseries const &other);
     //! Unconditional deletion
@@ -40,11 +40,13 @@ namespace DAL {  // Namespace DAL -- begin
   //_____________________________________________________________________________
   //                                                                       TBBraw
   
-  TBBraw::TBBraw (CommonAttributes const &commonAttributes)
+  TBBraw::TBBraw (CommonAttributes const &commonAttributes,
+		  HDF5Property const &properties)
   {
     init();
     itsFilename         = commonAttributes.filename();
     itsCommonAttributes = commonAttributes;
+    itsFileProperties   = properties;
   }
   
   //_____________________________________________________________________________
@@ -165,7 +167,10 @@ namespace DAL {  // Namespace DAL -- begin
             destroy();
             init();
           };
-        dataset_p = new dalDataset( filename.c_str(), "HDF5" );
+        dataset_p = new dalDataset (filename.c_str(),
+				    "HDF5",
+				    IO_Mode(IO_Mode::Open),
+				    itsFileProperties);
 	/* Set the attributes attached to the root group of the file. */
         if (dataset_p != NULL) {
 	  hid_t groupID = dataset_p->getId();
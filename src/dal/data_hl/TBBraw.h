@@ -96,6 +96,8 @@ namespace DAL {  // Namespace DAL -- begin
     std::string itsFilename;
     //! LOFAR common attributes attached to the root group of the file
     CommonAttributes itsCommonAttributes;
+    //! Settings for the HDF5 file-creation and file-access property lists
+    HDF5Property itsFileProperties;
     //! Check the header-CRC
     bool do_headerCRC_p;
     //! Check the data-CRC
@@ -186,8 +188,11 @@ namespace DAL {  // Namespace DAL -- begin
 
       \param commonAttributes -- LOFAR common attribute attached to the root
              group of the file.
+      \param properties       -- Settings for the HDF5 file-creation and
+             file-access property lists used when creating the file.
     */
-    TBBraw (CommonAttributes const &commonAttributes);
+    TBBraw (CommonAttributes const &commonAttributes,
+	    HDF5Property const &properties=HDF5Property());
     
     /*!
       \brief Argumented Constructor
@@ -225,6 +230,23 @@ namespace DAL {  // Namespace DAL -- begin
       return dataset_p != NULL;
     };
     
+    //! Get the settings for the HDF5 file-creation and file-access property lists
+    inline HDF5Property fileProperties () const {
+      return itsFileProperties;
+    }
+
+    /*!
+      \brief Set the settings for the HDF5 file-creation and file-access property lists
+
+      \param properties -- Settings used when creating the output file, e.g. to
+             align the dipole datasets or enable paged aggregation; must be
+	     set before calling open_file().
+    */
+    inline void setFileProperties (HDF5Property const &properties)
+    {
+      itsFileProperties = properties;
+    };
+
     /*!
       \brief Perform CRC checking of the header, yes or no (default yes).
       
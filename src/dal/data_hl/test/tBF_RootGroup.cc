@@ -292,6 +292,81 @@ int test_methods ()
   return nofFailedTests;
 }
 
+//_______________________________________________________________________________
+//                                                                   nofOpenGroups
+
+//! Get the number of groups currently open within the file of \c location
+ssize_t nofOpenGroups (hid_t const &location)
+{
+  hid_t fileID  = H5Iget_file_id (location);
+  ssize_t count = H5Fget_obj_count (fileID, H5F_OBJ_GROUP);
+  H5Fclose (fileID);
+  return count;
+}
+
+//_______________________________________________________________________________
+//                                                               test_lazyOpening
+
+/*!
+  \brief Test opening the embedded groups on first access
+
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_lazyOpening ()
+{
+  cout << "\n[tBF_RootGroup::test_lazyOpening]\n" << endl;
+
+  int nofFailedTests (0);
+  unsigned int nofPointings (4);
+  unsigned int nofBeams (2);
+  DAL::Filename file = getFilename("123456789","lazy");
+
+  cout << "[1] Creating file with " << nofPointings << " sub-array pointings ..." << endl;
+  try {
+    BF_RootGroup bf (file, DAL::IO_Mode(DAL::IO_Mode::Create));
+    for (unsigned int pointing(0); pointing<nofPointings; ++pointing) {
+      for (unsigned int beam(0); beam<nofBeams; ++beam) {
+	bf.openBeam (pointing, beam);
+      }
+    }
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Opening the file, without opening embedded groups ..." << endl;
+  try {
+    DAL::HDF5GroupBase::setHandleLimit (2);
+    BF_RootGroup bf (file.filename());
+    ssize_t nofGroups = nofOpenGroups (bf.locationID());
+    //
+    cout << "-- nof. pointings   = " << bf.nofSubArrayPointings() << endl;
+    cout << "-- nof. open groups = " << nofGroups << endl;
+    if (bf.nofSubArrayPointings() != nofPointings) ++nofFailedTests;
+
+    /* Access a single beam */
+    DAL::BF_BeamGroup beam = bf.getBeamGroup (nofPointings-1, nofBeams-1);
+    if (!H5Iis_valid(beam.locationID())) ++nofFailedTests;
+
+    /* Visit all pointings; at most two of them are kept open */
+    for (unsigned int pointing(0); pointing<nofPointings; ++pointing) {
+      DAL::BF_BeamGroup beam = bf.getBeamGroup (pointing, 0);
+      if (!H5Iis_valid(beam.locationID())) ++nofFailedTests;
+    }
+    cout << "-- nof. open groups = " << nofOpenGroups (bf.locationID()) << endl;
+    if (nofOpenGroups (bf.locationID()) > nofGroups + 2*(1+2*nofBeams)) {
+      ++nofFailedTests;
+    }
+    DAL::HDF5GroupBase::setHandleLimit (64);
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
 //_______________________________________________________________________________
 //                                                                           main
 
@@ -319,6 +394,8 @@ int main (int argc,
   nofFailedTests += test_constructors ();
   // Test access to the attributes attached to the root group
   nofFailedTests += test_attributes ();
+  // Test opening the embedded groups on first access
+  nofFailedTests += test_lazyOpening ();
   // // Test working with the embedded groups
   // nofFailedTests += test_subGroups ();
   // // Test the various methods 
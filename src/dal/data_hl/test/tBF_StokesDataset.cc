@@ -232,6 +232,25 @@ int test_constructors (hid_t const &fileID)
     nofFailedTests++;
   }
 
+  /*_______________________________________________________________________
+    Test 9: Assignment operator
+  */
+
+  cout << "[9] Testing operator=(BF_StokesDataset) ..." << endl;
+  try {
+    index = 9;
+    BF_StokesDataset stokesOrig (groupID, index, shape);
+    BF_StokesDataset stokesAssigned;
+    // The assigned object shares the dataset of the original one
+    stokesAssigned = stokesOrig;
+    stokesAssigned.summary();
+    if (!H5Iis_valid(stokesAssigned.objectID())) ++nofFailedTests;
+    if (stokesAssigned.nofSamples() != stokesOrig.nofSamples()) ++nofFailedTests;
+  } catch (std::string message) {
+    std::cerr << message << endl;
+    nofFailedTests++;
+  }
+
   /* Release handler for HDF5 group */
 
   H5Gclose (groupID);
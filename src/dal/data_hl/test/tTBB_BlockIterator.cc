@@ -0,0 +1,299 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include <core/HDF5Attribute.h>
+#include <core/HDF5Dataset.h>
+#include <data_hl/TBB_BlockIterator.h>
+
+// Namespace usage
+using std::cerr;
+using std::cout;
+using std::endl;
+using DAL::HDF5Attribute;
+using DAL::HDF5Dataset;
+using DAL::HDF5IOPlan;
+using DAL::TBB_BlockIterator;
+
+/*!
+  \file tTBB_BlockIterator.cc
+
+  \ingroup DAL
+  \ingroup data_hl
+
+  \brief A collection of test routines for the DAL::TBB_BlockIterator class
+
+  \author agent
+
+  \date 2026/10/18
+*/
+
+//! Number of dipole datasets
+const unsigned int nofDipoles = 3;
+//! Number of samples recorded by each of the dipoles
+const hsize_t dataLength[]    = {1000, 995, 1002};
+//! Sample number of the first sample recorded by each of the dipoles
+const uint sampleNumber[]     = {0, 10, 5};
+
+//_______________________________________________________________________________
+//                                                                 open_dipoles
+
+//! Open the dipole datasets created by main()
+std::vector<hid_t> open_dipoles (hid_t const &fileID)
+{
+  std::vector<hid_t> datasets;
+
+  for (unsigned int n(0); n<nofDipoles; ++n) {
+    std::string name = "Dipole" + std::string (1, char('0'+n));
+    datasets.push_back (H5Dopen (fileID, name.c_str(), H5P_DEFAULT));
+  }
+
+  return datasets;
+}
+
+//_______________________________________________________________________________
+//                                                                 close_dipoles
+
+//! Close the dipole datasets opened by open_dipoles()
+void close_dipoles (std::vector<hid_t> const &datasets)
+{
+  for (unsigned int n(0); n<datasets.size(); ++n) {
+    H5Dclose (datasets[n]);
+  }
+}
+
+//_______________________________________________________________________________
+//                                                               test_alignment
+
+/*!
+  \brief Test alignment of the dipoles by their time attributes
+
+  \param fileID          -- Identifier of the file, to which the dipole datasets
+         are attached.
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_alignment (hid_t const &fileID)
+{
+  cout << "\n[tTBB_BlockIterator::test_alignment]\n" << endl;
+
+  int nofFailedTests (0);
+  std::vector<hid_t> datasets = open_dipoles (fileID);
+  std::vector<hsize_t> offsets;
+
+  cout << "[1] Testing alignment(offsets,datasets) ..." << endl;
+  try {
+    if (!TBB_BlockIterator::alignment (offsets, datasets)) ++nofFailedTests;
+
+    cout << "-- Offsets = " << offsets << endl;
+
+    if (offsets.size() != nofDipoles) {
+      ++nofFailedTests;
+    } else {
+      /* The second dipole starts last */
+      if (offsets[0] != 10) ++nofFailedTests;
+      if (offsets[1] != 0)  ++nofFailedTests;
+      if (offsets[2] != 5)  ++nofFailedTests;
+    }
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing rejection of differing sample frequencies ..." << endl;
+  try {
+    std::vector<hid_t> mixed (datasets);
+    mixed.push_back (H5Dopen (fileID, "Dipole160MHz", H5P_DEFAULT));
+
+    if (TBB_BlockIterator::alignment (offsets, mixed)) ++nofFailedTests;
+
+    H5Dclose (mixed.back());
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  close_dipoles (datasets);
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                               test_iteration
+
+/*!
+  \brief Test iteration over time-aligned blocks of the dipoles
+
+  \param fileID          -- Identifier of the file, to which the dipole datasets
+         are attached.
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_iteration (hid_t const &fileID)
+{
+  cout << "\n[tTBB_BlockIterator::test_iteration]\n" << endl;
+
+  int nofFailedTests (0);
+  std::vector<hid_t> datasets = open_dipoles (fileID);
+
+  cout << "[1] Testing iteration in blocks of 128 samples ..." << endl;
+  try {
+    TBB_BlockIterator it (datasets, 128);
+    short const *block;
+    hsize_t nofBlocks (0);
+    hsize_t sample (0);
+
+    it.summary();
+
+    /* The dipoles have 990 samples in common */
+    if (it.length() != 990) ++nofFailedTests;
+
+    while ((block = it.next<short>())) {
+      hsize_t nofSamples = it.nofSamples();
+      /* The shape of the block as reported through HDF5BlockIterator */
+      std::vector<hsize_t> shape = it.blockShape();
+      if (shape.size() != 2 || shape[0] != nofDipoles || shape[1] != nofSamples
+	  || it.nofDatapoints() != nofDipoles*nofSamples) {
+	++nofFailedTests;
+      }
+      /* Aligned samples carry the same value for all dipoles */
+      for (unsigned int dipole(0); dipole<nofDipoles; ++dipole) {
+	for (hsize_t n(0); n<nofSamples; ++n) {
+	  if (block[dipole*nofSamples+n] != short(10+sample+n)) {
+	    ++nofFailedTests;
+	    break;
+	  }
+	}
+      }
+      sample += nofSamples;
+      ++nofBlocks;
+    }
+
+    cout << "-- nof. blocks  = " << nofBlocks << endl;
+    cout << "-- nof. samples = " << sample << endl;
+    if (nofBlocks != 8)      ++nofFailedTests;
+    if (sample != 990)       ++nofFailedTests;
+    if (it.error())          ++nofFailedTests;
+    if (it.next() != NULL)   ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing explicit offsets, conversion to float ..." << endl;
+  try {
+    std::vector<hsize_t> offsets (nofDipoles, 0);
+    TBB_BlockIterator it (datasets, offsets, 500, H5T_NATIVE_FLOAT, 2);
+    float const *block = it.next<float>();
+
+    if (block == NULL) {
+      ++nofFailedTests;
+    } else {
+      /* Without alignment every dipole starts with its own sample number */
+      for (unsigned int dipole(0); dipole<nofDipoles; ++dipole) {
+	if (block[dipole*500] != float(sampleNumber[dipole])) ++nofFailedTests;
+      }
+    }
+    if (it.nofBlocks() != 2) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Testing rejection of invalid parameters ..." << endl;
+  try {
+    std::vector<hsize_t> offsets (nofDipoles, 2000);
+    TBB_BlockIterator it (datasets, offsets, 128);
+
+    if (it.isValid())      ++nofFailedTests;
+    if (it.next() != NULL) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  close_dipoles (datasets);
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                create_dipole
+
+//! Create a dipole dataset with its time attributes
+void create_dipole (hid_t const &fileID,
+		    std::string const &name,
+		    hsize_t const &length,
+		    uint const &first,
+		    double const &frequency)
+{
+  std::vector<hsize_t> shape (1, length);
+  std::vector<short> data (length);
+
+  for (hsize_t n(0); n<length; ++n) {
+    data[n] = first+n;
+  }
+
+  HDF5Dataset dataset (fileID, name, shape, H5T_STD_I16LE);
+  HDF5IOPlan plan (dataset, shape, H5T_NATIVE_SHORT);
+  plan.writeBlock (&data[0], 0);
+
+  HDF5Attribute::write (dataset.objectID(), "TIME",                   uint(1316000000));
+  HDF5Attribute::write (dataset.objectID(), "SAMPLE_NUMBER",          first);
+  HDF5Attribute::write (dataset.objectID(), "SAMPLE_FREQUENCY_VALUE", frequency);
+  HDF5Attribute::write (dataset.objectID(), "SAMPLE_FREQUENCY_UNIT",  std::string("MHz"));
+}
+
+//_______________________________________________________________________________
+//                                                                           main
+
+int main ()
+{
+  int nofFailedTests (0);
+  std::string filename ("tTBB_BlockIterator.h5");
+
+  hid_t fileID = H5Fcreate (filename.c_str(),
+			    H5F_ACC_TRUNC,
+			    H5P_DEFAULT,
+			    H5P_DEFAULT);
+
+  if (H5Iis_valid(fileID)) {
+    /* Create the dipole datasets used in the tests */
+    for (unsigned int n(0); n<nofDipoles; ++n) {
+      create_dipole (fileID,
+		     "Dipole" + std::string (1, char('0'+n)),
+		     dataLength[n],
+		     sampleNumber[n],
+		     200.0);
+    }
+    create_dipole (fileID, "Dipole160MHz", 1000, 0, 160.0);
+
+    // Test alignment of the dipoles by their time attributes
+    nofFailedTests += test_alignment (fileID);
+    // Test iteration over time-aligned blocks of the dipoles
+    nofFailedTests += test_iteration (fileID);
+  } else {
+    cerr << "-- ERROR: Failed to create file " << filename << endl;
+    return -1;
+  }
+
+  H5Fclose (fileID);
+
+  return nofFailedTests;
+}
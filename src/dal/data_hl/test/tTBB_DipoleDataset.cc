@@ -79,6 +79,73 @@ int test_constructors (hid_t const &fileID)
   return nofFailedTests;
 }
 
+//_______________________________________________________________________________
+//                                                            test_attributeCache
+
+/*!
+  \brief Test sharing the cached attribute values between copies of an object
+
+  \param fileID          -- HDF5 object identifier for the file.
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_attributeCache (hid_t const &fileID)
+{
+  cout << "\n[tTBB_DipoleDataset::test_attributeCache]\n" << endl;
+
+  int nofFailedTests = 0;
+  std::string name   = TBB_DipoleDataset::dipoleName (1,0,0);
+  hsize_t length     = 1024;
+
+  /* Dataset with an attribute to be cached */
+  hid_t dataspaceID = H5Screate_simple (1, &length, NULL);
+  hid_t datasetID   = H5Dcreate (fileID,
+				 name.c_str(),
+				 H5T_NATIVE_SHORT,
+				 dataspaceID,
+				 H5P_DEFAULT,
+				 H5P_DEFAULT,
+				 H5P_DEFAULT);
+  DAL::HDF5Attribute::write (datasetID, "TIME", uint(1));
+  H5Dclose (datasetID);
+  H5Sclose (dataspaceID);
+
+  cout << "[1] Testing write through one copy, read through another ..." << endl;
+  try {
+    TBB_DipoleDataset dataset (fileID,name);
+    TBB_DipoleDataset copy (dataset);
+    TBB_DipoleDataset assigned;
+    uint time (0);
+
+    assigned = dataset;
+
+    /* Load the cache through the copies */
+    copy.getAttribute ("TIME", time);
+    if (time != 1) ++nofFailedTests;
+    assigned.getAttribute ("TIME", time);
+    if (time != 1) ++nofFailedTests;
+
+    dataset.setAttribute ("TIME", uint(2));
+
+    copy.getAttribute ("TIME", time);
+    cout << "-- TIME (copy)     = " << time << endl;
+    if (time != 2) ++nofFailedTests;
+    assigned.getAttribute ("TIME", time);
+    cout << "-- TIME (assigned) = " << time << endl;
+    if (time != 2) ++nofFailedTests;
+
+    /* ... and the other way round */
+    copy.setAttribute ("TIME", uint(3));
+    dataset.getAttribute ("TIME", time);
+    if (time != 3) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
 //_______________________________________________________________________________
 //                                                              test_constructors
 
@@ -450,6 +517,10 @@ int main (int argc, char *argv[])
     
     // Test for the constructor(s)
     nofFailedTests += test_constructors (fileID);
+    // Test sharing of the attribute cache between copies
+    if (!haveDataset) {
+      nofFailedTests += test_attributeCache (fileID);
+    }
     
     if (haveDataset) {
       // Test for the constructor(s)
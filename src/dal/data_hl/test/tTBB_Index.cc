@@ -0,0 +1,463 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include <core/HDF5Attribute.h>
+#include <core/HDF5Dataset.h>
+#include <core/HDF5IOPlan.h>
+#include <data_hl/TBB_DipoleDataset.h>
+#include <data_hl/TBB_Index.h>
+#include <data_hl/TBB_StationGroup.h>
+
+#include <cstdio>
+#include <sys/stat.h>
+
+// Namespace usage
+using std::cerr;
+using std::cout;
+using std::endl;
+using DAL::HDF5Attribute;
+using DAL::HDF5Dataset;
+using DAL::HDF5IOPlan;
+using DAL::TBB_DipoleDataset;
+using DAL::TBB_Index;
+using DAL::TBB_IndexEntry;
+using DAL::TBB_StationGroup;
+
+/*!
+  \file tTBB_Index.cc
+
+  \ingroup DAL
+  \ingroup data_hl
+
+  \brief A collection of test routines for the DAL::TBB_Index class
+
+  \author agent
+
+  \date 2026/10/18
+*/
+
+//! Directory holding the files of the test archive
+const std::string archive = "tTBB_Index.d";
+
+//_______________________________________________________________________________
+//                                                                    create_file
+
+/*!
+  \brief Create a TBB file holding the dipole datasets of a single station
+
+  \param filename   -- Name of the file, relative to the archive directory.
+  \param station    -- Station ID.
+  \param nofDipoles -- Number of dipole datasets.
+  \param time       -- Time of the first sample, full seconds.
+  \param first      -- Sample number of the first sample; at a sample frequency
+         of 1 kHz, 1000 samples make up one second.
+  \param length     -- Number of samples per dipole.
+*/
+void create_file (std::string const &filename,
+		  unsigned int const &station,
+		  unsigned int const &nofDipoles,
+		  uint const &time,
+		  uint const &first,
+		  hsize_t const &length)
+{
+  std::string name = archive + "/" + filename;
+  std::vector<hsize_t> shape (1, length);
+  std::vector<short> data (length, 1);
+
+  hid_t fileID  = H5Fcreate (name.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+  hid_t groupID = H5Gcreate (fileID,
+			     TBB_StationGroup::getName(station).c_str(),
+			     H5P_DEFAULT,
+			     H5P_DEFAULT,
+			     H5P_DEFAULT);
+
+  for (unsigned int n(0); n<nofDipoles; ++n) {
+    HDF5Dataset dataset (groupID,
+			 TBB_DipoleDataset::dipoleName (station, 0, n),
+			 shape,
+			 H5T_STD_I16LE);
+    HDF5IOPlan plan (dataset, shape, H5T_NATIVE_SHORT);
+    plan.writeBlock (&data[0], 0);
+
+    HDF5Attribute::write (dataset.objectID(), "TIME",                   time);
+    HDF5Attribute::write (dataset.objectID(), "SAMPLE_NUMBER",          first);
+    HDF5Attribute::write (dataset.objectID(), "SAMPLE_FREQUENCY_VALUE", 1.0);
+    HDF5Attribute::write (dataset.objectID(), "SAMPLE_FREQUENCY_UNIT",  std::string("kHz"));
+  }
+
+  H5Gclose (groupID);
+  H5Fclose (fileID);
+}
+
+//_______________________________________________________________________________
+//                                                                 create_archive
+
+/*!
+  \brief Create the test archive
+
+  <ul>
+    <li>a_tbb.h5     -- Station 2, dipoles 0,1, <tt>[100,101)</tt>
+    <li>b_tbb.h5     -- Station 2, dipole 0, <tt>[102,103)</tt>
+    <li>c_tbb.h5     -- Station 5, dipole 0, <tt>[100.5,101.5)</tt>
+    <li>sub/d_tbb.h5 -- Station 5, dipole 0, <tt>[103,104)</tt>
+    <li>notes.h5     -- Not matching the suffix, hence not indexed
+  </ul>
+*/
+void create_archive ()
+{
+  mkdir (archive.c_str(), 0755);
+  mkdir ((archive+"/sub").c_str(), 0755);
+
+  std::remove ((archive+"/e_tbb.h5").c_str());
+
+  create_file ("a_tbb.h5",     2, 2, 100,   0, 1000);
+  create_file ("b_tbb.h5",     2, 1, 102,   0, 1000);
+  create_file ("c_tbb.h5",     5, 1, 100, 500, 1000);
+  create_file ("sub/d_tbb.h5", 5, 1, 103,   0, 1000);
+  create_file ("notes.h5",     7, 1, 100,   0, 1000);
+}
+
+//_______________________________________________________________________________
+//                                                              test_constructors
+
+/*!
+  \brief Test constructors for a new TBB_Index object
+
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_constructors ()
+{
+  cout << "\n[tTBB_Index::test_constructors]\n" << endl;
+
+  int nofFailedTests (0);
+
+  cout << "[1] Testing TBB_Index() ..." << endl;
+  try {
+    TBB_Index index;
+    index.summary();
+
+    if (index.nofFiles() != 0)   ++nofFailedTests;
+    if (index.nofEntries() != 0) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing TBB_Index(string) on missing file ..." << endl;
+  try {
+    TBB_Index index ("tTBB_Index_missing.h5");
+
+    if (index.nofEntries() != 0) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Testing scan(entries,filename) ..." << endl;
+  try {
+    std::vector<TBB_IndexEntry> entries;
+
+    if (!TBB_Index::scan (entries, archive+"/c_tbb.h5")) ++nofFailedTests;
+
+    if (entries.size() != 1) {
+      ++nofFailedTests;
+    } else {
+      if (entries[0].station != 5)            ++nofFailedTests;
+      if (entries[0].sampleFrequency != 1e3)  ++nofFailedTests;
+      if (entries[0].length != 1000)          ++nofFailedTests;
+      if (entries[0].start() != 100.5)        ++nofFailedTests;
+      if (entries[0].end() != 101.5)          ++nofFailedTests;
+    }
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                     test_query
+
+/*!
+  \brief Test building and querying the index
+
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_query ()
+{
+  cout << "\n[tTBB_Index::test_query]\n" << endl;
+
+  int nofFailedTests (0);
+  TBB_Index index;
+  std::set<unsigned int> stations;
+
+  cout << "[1] Testing update(directory,nofWorkers) ..." << endl;
+  try {
+    if (!index.update (archive, 2)) ++nofFailedTests;
+    index.summary();
+
+    if (index.nofFiles() != 4)   ++nofFailedTests;
+    if (index.nofEntries() != 5) ++nofFailedTests;
+    if (index.nofScanned() != 4) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing query(start,end) ..." << endl;
+  try {
+    std::vector<TBB_IndexEntry> result;
+
+    result = index.query (100.2, 100.3);
+    if (result.size() != 2) ++nofFailedTests;
+
+    result = index.query (100.2, 100.6);
+    if (result.size() != 3) ++nofFailedTests;
+
+    result = index.query (101.6, 101.9);
+    if (result.size() != 0) ++nofFailedTests;
+
+    result = index.query (0, 1000);
+    if (result.size() != 5) ++nofFailedTests;
+    for (unsigned int n(1); n<result.size(); ++n) {
+      if (result[n].start() < result[n-1].start()) ++nofFailedTests;
+    }
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Testing query(start,end,stations) ..." << endl;
+  try {
+    std::vector<TBB_IndexEntry> result;
+
+    stations.insert (5);
+    result = index.query (100.2, 103.5, stations);
+
+    if (result.size() != 2) {
+      ++nofFailedTests;
+    } else {
+      if (index.files()[result[0].file].name != archive+"/c_tbb.h5")     ++nofFailedTests;
+      if (index.files()[result[1].file].name != archive+"/sub/d_tbb.h5") ++nofFailedTests;
+    }
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[4] Testing gaps(station,start,end) ..." << endl;
+  try {
+    std::vector<std::pair<double,double> > result = index.gaps (2, 99, 104);
+
+    if (result.size() != 3) {
+      ++nofFailedTests;
+    } else {
+      if (result[0] != std::make_pair (99.0, 100.0))  ++nofFailedTests;
+      if (result[1] != std::make_pair (101.0, 102.0)) ++nofFailedTests;
+      if (result[2] != std::make_pair (103.0, 104.0)) ++nofFailedTests;
+    }
+
+    if (!index.gaps (5, 100.6, 101.2).empty()) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                   test_storage
+
+/*!
+  \brief Test storing, loading and incrementally updating the index
+
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_storage ()
+{
+  cout << "\n[tTBB_Index::test_storage]\n" << endl;
+
+  int nofFailedTests (0);
+  std::string filename ("tTBB_Index.h5");
+  TBB_Index index;
+
+  index.update (archive, 2);
+
+  cout << "[1] Testing save(filename) and load(filename) ..." << endl;
+  try {
+    if (!index.save (filename)) ++nofFailedTests;
+
+    TBB_Index loaded (filename);
+    loaded.summary();
+
+    if (loaded.nofFiles() != index.nofFiles()) {
+      ++nofFailedTests;
+    } else {
+      for (unsigned int n(0); n<index.nofFiles(); ++n) {
+	if (loaded.files()[n].name  != index.files()[n].name)  ++nofFailedTests;
+	if (loaded.files()[n].size  != index.files()[n].size)  ++nofFailedTests;
+	if (loaded.files()[n].mtime != index.files()[n].mtime) ++nofFailedTests;
+      }
+    }
+
+    if (loaded.nofEntries() != index.nofEntries()) {
+      ++nofFailedTests;
+    } else {
+      for (unsigned int n(0); n<index.nofEntries(); ++n) {
+	if (loaded.entries()[n].file    != index.entries()[n].file)    ++nofFailedTests;
+	if (loaded.entries()[n].rcu     != index.entries()[n].rcu)     ++nofFailedTests;
+	if (loaded.entries()[n].start() != index.entries()[n].start()) ++nofFailedTests;
+	if (loaded.entries()[n].length  != index.entries()[n].length)  ++nofFailedTests;
+      }
+    }
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing update() of unchanged archive ..." << endl;
+  try {
+    TBB_Index loaded (filename);
+
+    if (!loaded.update (archive, 2)) ++nofFailedTests;
+    if (loaded.nofScanned() != 0)    ++nofFailedTests;
+    if (loaded.nofEntries() != 5)    ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Testing update() after adding and removing files ..." << endl;
+  try {
+    TBB_Index loaded (filename);
+
+    std::remove ((archive+"/b_tbb.h5").c_str());
+    create_file ("e_tbb.h5", 9, 3, 110, 0, 500);
+
+    if (!loaded.update (archive, 2)) ++nofFailedTests;
+    loaded.summary();
+
+    if (loaded.nofScanned() != 1) ++nofFailedTests;
+    if (loaded.nofFiles() != 4)   ++nofFailedTests;
+    if (loaded.nofEntries() != 7) ++nofFailedTests;
+
+    std::vector<std::pair<double,double> > gaps = loaded.gaps (2, 99, 104);
+    if (gaps.size() != 2) ++nofFailedTests;
+
+    std::set<unsigned int> stations;
+    stations.insert (9);
+    if (loaded.query (110, 110.4, stations).size() != 3) ++nofFailedTests;
+
+    /* Entries must still refer to the right files */
+    for (unsigned int n(0); n<loaded.nofEntries(); ++n) {
+      TBB_IndexEntry const &entry = loaded.entries()[n];
+      std::string const &name     = loaded.files()[entry.file].name;
+      if (entry.station == 9 && name != archive+"/e_tbb.h5") ++nofFailedTests;
+      if (entry.station == 2 && name != archive+"/a_tbb.h5") ++nofFailedTests;
+    }
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                  test_failures
+
+/*!
+  \brief Test updating the index of an archive holding a corrupted file
+
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_failures ()
+{
+  cout << "\n[tTBB_Index::test_failures]\n" << endl;
+
+  int nofFailedTests (0);
+  std::string corrupted (archive+"/corrupted_tbb.h5");
+
+  /* A file carrying the suffix, but not holding HDF5 data */
+  FILE *file = fopen (corrupted.c_str(), "w");
+  fprintf (file, "Not an HDF5 file\n");
+  fclose (file);
+
+  unsigned int workers[2] = { 2, 1 };
+
+  for (unsigned int n(0); n<2; ++n) {
+    cout << "[" << n+1 << "] Testing update(directory," << workers[n]
+	 << ") with corrupted file ..." << endl;
+    try {
+      TBB_Index index;
+
+      if (!index.update (archive, workers[n])) ++nofFailedTests;
+      index.summary();
+
+      if (index.nofFailed() != 1)  ++nofFailedTests;
+      if (index.nofScanned() != 4) ++nofFailedTests;
+      if (index.nofFiles() != 4)   ++nofFailedTests;
+      if (index.nofEntries() != 7) ++nofFailedTests;
+
+      /* The corrupted file must not be registered */
+      for (unsigned int k(0); k<index.nofFiles(); ++k) {
+	if (index.files()[k].name == corrupted) ++nofFailedTests;
+      }
+      for (unsigned int k(0); k<index.nofEntries(); ++k) {
+	if (index.entries()[k].file >= index.nofFiles()) ++nofFailedTests;
+      }
+    } catch (std::string message) {
+      cerr << message << endl;
+      nofFailedTests++;
+    }
+  }
+
+  std::remove (corrupted.c_str());
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                           main
+
+int main ()
+{
+  int nofFailedTests (0);
+
+  /* Create the archive of TBB files used in the tests */
+  create_archive ();
+
+  // Test for the constructor(s)
+  nofFailedTests += test_constructors ();
+  // Test building and querying the index
+  nofFailedTests += test_query ();
+  // Test storing, loading and incrementally updating the index
+  nofFailedTests += test_storage ();
+  // Test files which cannot be scanned
+  nofFailedTests += test_failures ();
+
+  return nofFailedTests;
+}
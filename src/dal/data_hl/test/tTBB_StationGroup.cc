@@ -543,7 +543,6 @@ int test_parameters (std::string const &filename)
 
   // Perform the tests _____________________________________
 
-  typedef std::map<std::string,DAL::TBB_DipoleDataset>::iterator iterDipoleDataset;
   TBB_StationGroup group (fileID,groupname);
 
   cout << "[1] Testing objectName() ..." << endl;
@@ -580,26 +579,25 @@ int test_parameters (std::string const &filename)
   
   cout << "[5] Testing dipoleSelection() ..." << endl;
   try {
-    std::map<std::string,iterDipoleDataset> datasets = group.dipoleSelection();
-    std::map<std::string,iterDipoleDataset>::iterator it;
+    std::vector<DAL::TBB_DipoleDataset> datasets = group.dipoleSelection();
     //
     cout << "-- nof. selected datasets = " << datasets.size() << endl;
     //
     cout << "-- selected datasets      = [";
-    for (it=datasets.begin(); it!=datasets.end(); ++it) {
-      cout << " " << it->first;
+    for (unsigned int n(0); n<datasets.size(); ++n) {
+      cout << " " << datasets[n].dipoleName();
     }
     cout << " ]" << endl;
     //
     cout << "-- HDF5 location ID       = [";
-    for (it=datasets.begin(); it!=datasets.end(); ++it) {
-      cout << " " << (it->second)->second.locationID();
+    for (unsigned int n(0); n<datasets.size(); ++n) {
+      cout << " " << datasets[n].locationID();
     }
     cout << " ]" << endl;
     //
     cout << "-- Dipole number          = [";
-    for (it=datasets.begin(); it!=datasets.end(); ++it) {
-      cout << " " << (it->second)->second.dipoleNumber();
+    for (unsigned int n(0); n<datasets.size(); ++n) {
+      cout << " " << datasets[n].dipoleNumber();
     }
     cout << " ]" << endl;
   } catch (std::string message) {
@@ -613,6 +611,128 @@ int test_parameters (std::string const &filename)
   return nofFailedTests;
 }
 
+//_______________________________________________________________________________
+//                                                                      test_lazy
+
+/*!
+  \brief Test opening the dipole datasets on first access
+
+  The handle limit is set below the number of dipole datasets, such that
+  datasets are closed and re-opened while iterating over the selection.
+
+  \return nofFailedTests -- The number of failed tests.
+*/
+int test_lazy ()
+{
+  cout << "\n[tTBB_StationGroup::test_lazy]\n" << endl;
+
+  int nofFailedTests (0);
+  unsigned int nofDipoles (5);
+  unsigned int limit = DAL::HDF5GroupBase::handleLimit();
+  std::vector<hsize_t> shape (1,1024);
+  std::string filename ("tTBB_StationGroup_lazy.h5");
+  hid_t fileID = H5Fcreate (filename.c_str(),
+			    H5F_ACC_TRUNC,
+			    H5P_DEFAULT,
+			    H5P_DEFAULT);
+
+  if (fileID < 0) {
+    std::cerr << "ERROR : Failed to open/create file." << endl;
+    return -1;
+  }
+
+  /* Station group holding a number of dipole datasets */
+  {
+    TBB_StationGroup group (fileID, 1, DAL::IO_Mode(DAL::IO_Mode::Create));
+    hid_t dataspaceID = H5Screate_simple (1, &shape[0], NULL);
+    for (unsigned int rcu(0); rcu<nofDipoles; ++rcu) {
+      std::string name = DAL::TBB_DipoleDataset::dipoleName (1, 0, rcu);
+      hid_t datasetID  = H5Dcreate (group.locationID(),
+				    name.c_str(),
+				    H5T_NATIVE_SHORT,
+				    dataspaceID,
+				    H5P_DEFAULT,
+				    H5P_DEFAULT,
+				    H5P_DEFAULT);
+      DAL::HDF5Attribute::write (datasetID, "RCU_ID", uint(rcu));
+      H5Dclose (datasetID);
+    }
+    H5Sclose (dataspaceID);
+  }
+
+  DAL::HDF5GroupBase::setHandleLimit (2);
+
+  cout << "[1] Testing access to the dipole datasets ..." << endl;
+  try {
+    TBB_StationGroup group (fileID, "Station001");
+    std::vector<uint> rcu;
+
+    if (group.nofDipoleDatasets() != nofDipoles)   ++nofFailedTests;
+    if (group.nofSelectedDatasets() != nofDipoles) ++nofFailedTests;
+
+    group.getAttributes ("RCU_ID", rcu);
+    cout << "-- RCU_ID = " << rcu << endl;
+    if (rcu.size() != nofDipoles) {
+      ++nofFailedTests;
+    } else {
+      for (unsigned int n(0); n<nofDipoles; ++n) {
+	if (rcu[n] != n) ++nofFailedTests;
+      }
+    }
+
+    if (group.dipoleNumbers().size() != nofDipoles) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing dipoleSelection() beyond the handle limit ..." << endl;
+  try {
+    TBB_StationGroup group (fileID, "Station001");
+    std::vector<DAL::TBB_DipoleDataset> datasets = group.dipoleSelection();
+
+    if (datasets.size() != nofDipoles) ++nofFailedTests;
+
+    /* The returned datasets remain open, though evicted from the group */
+    for (unsigned int n(0); n<datasets.size(); ++n) {
+      if (H5Iis_valid(datasets[n].locationID()) <= 0) ++nofFailedTests;
+      if (datasets[n].shape() != shape)               ++nofFailedTests;
+    }
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Testing selectDipoles() and copying the selection ..." << endl;
+  try {
+    TBB_StationGroup group (fileID, "Station001");
+    std::set<std::string> selection;
+    std::vector<uint> rcu;
+
+    selection.insert (DAL::TBB_DipoleDataset::dipoleName(1,0,3));
+    selection.insert ("NoSuchDipole");
+
+    if (!group.selectDipoles (selection)) ++nofFailedTests;
+    if (group.nofSelectedDatasets() != 1) ++nofFailedTests;
+
+    group.getAttributes ("RCU_ID", rcu);
+    if (rcu.size() != 1 || rcu[0] != 3) ++nofFailedTests;
+
+    TBB_StationGroup copy (group);
+    if (copy.selectedDipoles() != group.selectedDipoles()) ++nofFailedTests;
+    if (copy.nofDipoleDatasets() != nofDipoles)            ++nofFailedTests;
+    if (copy.dipoleSelection().size() != 1)                ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  DAL::HDF5GroupBase::setHandleLimit (limit);
+  H5Fclose (fileID);
+
+  return nofFailedTests;
+}
+
 //_______________________________________________________________________________
 //                                                                      test_data
 
@@ -742,6 +862,7 @@ int main (int argc,
   // Run the tests
 
   nofFailedTests += test_constructors ();
+  nofFailedTests += test_lazy ();
 
   if (haveDataset) {
     // Test for the constructor(s)
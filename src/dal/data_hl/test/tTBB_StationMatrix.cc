@@ -0,0 +1,370 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include <core/HDF5Attribute.h>
+#include <core/HDF5Dataset.h>
+#include <core/HDF5IOPlan.h>
+#include <data_hl/TBB_StationMatrix.h>
+
+// Namespace usage
+using std::cerr;
+using std::cout;
+using std::endl;
+using DAL::HDF5Attribute;
+using DAL::HDF5Dataset;
+using DAL::HDF5IOPlan;
+using DAL::TBB_StationMatrix;
+
+/*!
+  \file tTBB_StationMatrix.cc
+
+  \ingroup DAL
+  \ingroup data_hl
+
+  \brief A collection of test routines for the DAL::TBB_StationMatrix class
+
+  \author agent
+
+  \date 2026/10/18
+*/
+
+//! Number of dipole datasets
+const unsigned int nofDipoles = 3;
+//! Number of samples recorded by each of the dipoles
+const hsize_t dataLength[]    = {1000, 995, 1002};
+//! Sample number of the first sample recorded by each of the dipoles
+const uint sampleNumber[]     = {0, 10, 5};
+//! Number of columns of the station matrix
+const hsize_t matrixLength    = 1007;
+
+//_______________________________________________________________________________
+//                                                                 dipole_names
+
+//! Names of the dipole datasets created by main()
+std::vector<std::string> dipole_names ()
+{
+  std::vector<std::string> names;
+
+  for (unsigned int n(0); n<nofDipoles; ++n) {
+    names.push_back ("Dipole" + std::string (1, char('0'+n)));
+  }
+
+  return names;
+}
+
+//_______________________________________________________________________________
+//                                                                 open_dipoles
+
+//! Open the dipole datasets created by main()
+std::vector<hid_t> open_dipoles (hid_t const &fileID)
+{
+  std::vector<std::string> names = dipole_names ();
+  std::vector<hid_t> datasets;
+
+  for (unsigned int n(0); n<nofDipoles; ++n) {
+    datasets.push_back (H5Dopen (fileID, names[n].c_str(), H5P_DEFAULT));
+  }
+
+  return datasets;
+}
+
+//_______________________________________________________________________________
+//                                                                 close_dipoles
+
+//! Close the dipole datasets opened by open_dipoles()
+void close_dipoles (std::vector<hid_t> const &datasets)
+{
+  for (unsigned int n(0); n<datasets.size(); ++n) {
+    H5Dclose (datasets[n]);
+  }
+}
+
+//_______________________________________________________________________________
+//                                                                expected_value
+
+/*!
+  \brief Get the expected value of an element of the station matrix
+
+  The sample of a dipole taken at column \e c holds the value <tt>c+1</tt>;
+  columns outside the period recorded by the dipole hold 0.
+*/
+short expected_value (unsigned int const &dipole,
+		      hsize_t const &column)
+{
+  if (column < sampleNumber[dipole]
+      || column >= sampleNumber[dipole]+dataLength[dipole]) {
+    return 0;
+  } else {
+    return short(column+1);
+  }
+}
+
+//_______________________________________________________________________________
+//                                                                    test_create
+
+/*!
+  \brief Test creation of a station matrix from a set of dipole datasets
+
+  \param fileID          -- Identifier of the file, to which the dipole datasets
+         are attached.
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_create (hid_t const &fileID)
+{
+  cout << "\n[tTBB_StationMatrix::test_create]\n" << endl;
+
+  int nofFailedTests (0);
+  std::vector<hid_t> datasets    = open_dipoles (fileID);
+  std::vector<std::string> names = dipole_names ();
+
+  cout << "[1] Testing TBB_StationMatrix() ..." << endl;
+  try {
+    TBB_StationMatrix matrix;
+    matrix.summary();
+
+    if (matrix.isValid()) ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing create() without compression ..." << endl;
+  try {
+    if (!TBB_StationMatrix::create (fileID, "Matrix", datasets, names, 2, 64)) {
+      ++nofFailedTests;
+    }
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Testing create() with compression ..." << endl;
+  try {
+    if (!TBB_StationMatrix::create (fileID, "MatrixDeflate", datasets, names, 3, 100, 6)) {
+      ++nofFailedTests;
+    }
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[4] Testing rejection of invalid input ..." << endl;
+  try {
+    std::vector<std::string> noNames;
+    std::vector<hid_t> mixed (datasets);
+    std::vector<std::string> mixedNames (names);
+
+    mixed.push_back (H5Dopen (fileID, "Dipole160MHz", H5P_DEFAULT));
+    mixedNames.push_back ("Dipole160MHz");
+
+    if (TBB_StationMatrix::create (fileID, "Rejected", datasets, noNames))         ++nofFailedTests;
+    if (TBB_StationMatrix::create (fileID, "Rejected", mixed, mixedNames))         ++nofFailedTests;
+    if (TBB_StationMatrix::create (fileID, "Rejected", datasets, names, 0, 0, 10)) ++nofFailedTests;
+
+    H5Dclose (mixed.back());
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  close_dipoles (datasets);
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                      test_read
+
+/*!
+  \brief Test reading back the station matrices created by test_create()
+
+  \param fileID          -- Identifier of the file, to which the datasets are
+         attached.
+  \return nofFailedTests -- The number of failed tests encountered within this
+          function.
+*/
+int test_read (hid_t const &fileID)
+{
+  cout << "\n[tTBB_StationMatrix::test_read]\n" << endl;
+
+  int nofFailedTests (0);
+
+  cout << "[1] Testing TBB_StationMatrix(hid_t,string) ..." << endl;
+  try {
+    TBB_StationMatrix matrix (fileID, "Matrix");
+    std::vector<hsize_t> offsets = matrix.offsets();
+    std::vector<hsize_t> lengths = matrix.lengths();
+    hsize_t start;
+    hsize_t end;
+
+    matrix.summary();
+
+    if (!matrix.isValid())                      ++nofFailedTests;
+    if (matrix.nofDipoles() != nofDipoles)      ++nofFailedTests;
+    if (matrix.length() != matrixLength)        ++nofFailedTests;
+    if (matrix.dipoleNames() != dipole_names()) ++nofFailedTests;
+    if (matrix.time() != 1316000000)            ++nofFailedTests;
+    if (matrix.sampleNumber() != 0)             ++nofFailedTests;
+    if (matrix.sampleFrequency() != 200e6)      ++nofFailedTests;
+
+    if (offsets.size() != nofDipoles || lengths.size() != nofDipoles) {
+      ++nofFailedTests;
+    } else {
+      for (unsigned int n(0); n<nofDipoles; ++n) {
+	if (offsets[n] != sampleNumber[n]) ++nofFailedTests;
+	if (lengths[n] != dataLength[n])   ++nofFailedTests;
+      }
+    }
+
+    if (!matrix.validRange (start, end)) ++nofFailedTests;
+    if (start != 10 || end != 1000)      ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing readData() of the full matrix ..." << endl;
+  try {
+    TBB_StationMatrix matrix (fileID, "Matrix");
+    std::vector<short> data (nofDipoles*matrixLength);
+
+    if (!matrix.readData (&data[0], 0, matrixLength)) ++nofFailedTests;
+
+    for (unsigned int n(0); n<nofDipoles; ++n) {
+      for (hsize_t col(0); col<matrixLength; ++col) {
+	if (data[n*matrixLength+col] != expected_value (n, col)) {
+	  ++nofFailedTests;
+	  break;
+	}
+      }
+    }
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Testing readData() of a block of the compressed matrix ..." << endl;
+  try {
+    TBB_StationMatrix matrix (fileID, "MatrixDeflate");
+    HDF5Dataset dataset (fileID, "MatrixDeflate");
+    hsize_t start      = 95;
+    hsize_t nofSamples = 300;
+    std::vector<float> data (2*nofSamples);
+
+    if (!dataset.filter().hasFilter (H5Z_FILTER_DEFLATE))    ++nofFailedTests;
+    if (!matrix.readData (&data[0], 1, 2, start, nofSamples)) ++nofFailedTests;
+
+    for (unsigned int n(0); n<2; ++n) {
+      for (hsize_t col(0); col<nofSamples; ++col) {
+	if (data[n*nofSamples+col] != float(expected_value (n+1, start+col))) {
+	  ++nofFailedTests;
+	  break;
+	}
+      }
+    }
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[4] Testing rejection of invalid selection ..." << endl;
+  try {
+    TBB_StationMatrix matrix (fileID, "Matrix");
+    TBB_StationMatrix dipole (fileID, "Dipole0");
+    std::vector<short> data (nofDipoles*matrixLength);
+
+    if (matrix.readData (&data[0], 1, matrixLength))       ++nofFailedTests;
+    if (matrix.readData (&data[0], 2, 2, 0, matrixLength)) ++nofFailedTests;
+    if (dipole.isValid())                                  ++nofFailedTests;
+  } catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                create_dipole
+
+//! Create a dipole dataset with its time attributes
+void create_dipole (hid_t const &fileID,
+		    std::string const &name,
+		    hsize_t const &length,
+		    uint const &first,
+		    double const &frequency)
+{
+  std::vector<hsize_t> shape (1, length);
+  std::vector<short> data (length);
+
+  for (hsize_t n(0); n<length; ++n) {
+    data[n] = first+n+1;
+  }
+
+  HDF5Dataset dataset (fileID, name, shape, H5T_STD_I16LE);
+  HDF5IOPlan plan (dataset, shape, H5T_NATIVE_SHORT);
+  plan.writeBlock (&data[0], 0);
+
+  HDF5Attribute::write (dataset.objectID(), "TIME",                   uint(1316000000));
+  HDF5Attribute::write (dataset.objectID(), "SAMPLE_NUMBER",          first);
+  HDF5Attribute::write (dataset.objectID(), "SAMPLE_FREQUENCY_VALUE", frequency);
+  HDF5Attribute::write (dataset.objectID(), "SAMPLE_FREQUENCY_UNIT",  std::string("MHz"));
+}
+
+//_______________________________________________________________________________
+//                                                                           main
+
+int main ()
+{
+  int nofFailedTests (0);
+  std::string filename ("tTBB_StationMatrix.h5");
+
+  hid_t fileID = H5Fcreate (filename.c_str(),
+			    H5F_ACC_TRUNC,
+			    H5P_DEFAULT,
+			    H5P_DEFAULT);
+
+  if (H5Iis_valid(fileID)) {
+    std::vector<std::string> names = dipole_names ();
+
+    /* Create the dipole datasets used in the tests */
+    for (unsigned int n(0); n<nofDipoles; ++n) {
+      create_dipole (fileID,
+		     names[n],
+		     dataLength[n],
+		     sampleNumber[n],
+		     200.0);
+    }
+    create_dipole (fileID, "Dipole160MHz", 1000, 0, 160.0);
+
+    // Test creation of station matrices
+    nofFailedTests += test_create (fileID);
+    // Test reading back the station matrices
+    nofFailedTests += test_read (fileID);
+  } else {
+    cerr << "-- ERROR: Failed to create file " << filename << endl;
+    return -1;
+  }
+
+  H5Fclose (fileID);
+
+  return nofFailedTests;
+}
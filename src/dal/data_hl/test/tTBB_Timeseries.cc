@@ -26,6 +26,8 @@
 #include <casa/HDF5/HDF5Record.h>
 #endif
 
+#include <core/HDF5Dataset.h>
+#include <core/HDF5IOPlan.h>
 #include <data_hl/TBB_Timeseries.h>
 
 using std::cerr;
@@ -97,6 +99,253 @@ int test_construction ()
   return nofFailedTests;
 }
 
+//_______________________________________________________________________________
+//                                                                  test_readData
+
+/*!
+  \brief Test reading the data of the dipoles into caller-provided memory
+
+  A file with a single station group is created, holding dipole datasets of
+  different lengths -- long enough for reads using multiple threads; the value
+  of sample \e n of dipole \e d is <tt>100*d+(n%100)</tt>.
+
+  \return nofFailedTests -- The number of failed tests.
+*/
+int test_readData ()
+{
+  cout << "\n[tTBB_Timeseries::test_readData]\n" << endl;
+
+  int nofFailedTests (0);
+  std::string filename ("tTBB_Timeseries.h5");
+  unsigned int nofDipoles (5);
+
+  /* Create the file holding the dipole datasets */
+  hid_t fileID = H5Fcreate (filename.c_str(),
+			    H5F_ACC_TRUNC,
+			    H5P_DEFAULT,
+			    H5P_DEFAULT);
+  {
+    DAL::TBB_StationGroup station (fileID,
+				   2,
+				   DAL::IO_Mode(DAL::IO_Mode::Create));
+
+    for (unsigned int dipole(0); dipole<nofDipoles; ++dipole) {
+      std::vector<hsize_t> shape (1, TBB_Timeseries::minSamplesPerThread+1000+dipole);
+      std::vector<short> samples (shape[0]);
+      for (hsize_t n(0); n<shape[0]; ++n) {
+	samples[n] = 100*dipole + n%100;
+      }
+      DAL::HDF5Dataset dataset (station.locationID(),
+				DAL::TBB_DipoleDataset::dipoleName(2,0,dipole),
+				shape,
+				H5T_STD_I16LE);
+      DAL::HDF5IOPlan plan (dataset, shape, H5T_NATIVE_SHORT);
+      plan.writeBlock (&samples[0], 0);
+    }
+  }
+  H5Fclose (fileID);
+
+  TBB_Timeseries ts (filename);
+  int nofSamples (256);
+
+  cout << "[1] Testing readData(double*,vector<int>,int) ..." << endl;
+  try {
+    std::vector<int> start (nofDipoles);
+    std::vector<double> data (nofDipoles*nofSamples, -1.0);
+
+    for (unsigned int dipole(0); dipole<nofDipoles; ++dipole) {
+      start[dipole] = 10*dipole;
+    }
+
+    if (!ts.readData (&data[0], start, nofSamples)) ++nofFailedTests;
+
+    for (unsigned int dipole(0); dipole<nofDipoles; ++dipole) {
+      for (int n(0); n<nofSamples; ++n) {
+	if (data[dipole*nofSamples+n] != 100*dipole + (start[dipole]+n)%100) {
+	  ++nofFailedTests;
+	  break;
+	}
+      }
+    }
+  }
+  catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[2] Testing readData(double*,vector<int>,int,nofThreads) ..." << endl;
+  try {
+    int nofLarge = TBB_Timeseries::minSamplesPerThread;
+    std::vector<int> start (nofDipoles, 700);
+    std::vector<double> reference (nofDipoles*nofLarge);
+    std::vector<double> data (nofDipoles*nofLarge);
+
+    /* The result must not depend on the number of threads */
+    ts.readData (&reference[0], start, nofLarge, 1);
+
+    for (unsigned int nofThreads(2); nofThreads<=nofDipoles+1; ++nofThreads) {
+      if (!ts.readData (&data[0], start, nofLarge, nofThreads)) ++nofFailedTests;
+      if (data != reference)                                    ++nofFailedTests;
+    }
+
+    /* Blocks too small to be worth a thread are read by the caller alone */
+    data.assign (nofDipoles*nofSamples, -1.0);
+    reference.resize (nofDipoles*nofSamples);
+    ts.readData (&reference[0], start, nofSamples, 1);
+    if (!ts.readData (&data[0], start, nofSamples, nofDipoles)) ++nofFailedTests;
+    if (data != reference)                                      ++nofFailedTests;
+  }
+  catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[3] Testing rejection of invalid parameters ..." << endl;
+  try {
+    std::vector<double> data (nofDipoles*nofSamples);
+    std::vector<int> start (nofDipoles-1, 0);
+
+    if (ts.readData (&data[0], start, nofSamples)) ++nofFailedTests;
+    if (ts.readData ((double *)NULL, std::vector<int>(nofDipoles,0), nofSamples)) {
+      ++nofFailedTests;
+    }
+  }
+  catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  cout << "[4] Testing readData(short*,vector<int>,int) ..." << endl;
+  try {
+    std::vector<int> start (nofDipoles, 50);
+    std::vector<short> raw (nofDipoles*nofSamples);
+    std::vector<double> data (nofDipoles*nofSamples);
+
+    if (!ts.readData (&raw[0], start, nofSamples))  ++nofFailedTests;
+    if (!ts.readData (&data[0], start, nofSamples)) ++nofFailedTests;
+
+    for (size_t n(0); n<raw.size(); ++n) {
+      if (double(raw[n]) != data[n]) {
+	++nofFailedTests;
+	break;
+      }
+    }
+  }
+  catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  return nofFailedTests;
+}
+
+//_______________________________________________________________________________
+//                                                                test_handleLimit
+
+/*!
+  \brief Test access to more station groups than may be kept open at once
+
+  A file with three station groups of two dipoles each is created; with the
+  handle limit set to a single object, every access to another station group
+  closes the previous one, which must neither affect the selection of dipoles
+  nor the data read. The value of sample \e n of dipole \e d of station \e s
+  is <tt>1000*s+100*d+(n%100)</tt>.
+
+  \return nofFailedTests -- The number of failed tests.
+*/
+int test_handleLimit ()
+{
+  cout << "\n[tTBB_Timeseries::test_handleLimit]\n" << endl;
+
+  int nofFailedTests (0);
+  std::string filename ("tTBB_Timeseries_limit.h5");
+  unsigned int nofStations (3);
+  unsigned int nofDipoles (2);
+  unsigned int limit = DAL::HDF5GroupBase::handleLimit();
+  std::vector<hsize_t> shape (1, 1024);
+
+  /* Create the file holding the station groups */
+  hid_t fileID = H5Fcreate (filename.c_str(),
+			    H5F_ACC_TRUNC,
+			    H5P_DEFAULT,
+			    H5P_DEFAULT);
+  for (unsigned int station(0); station<nofStations; ++station) {
+    DAL::TBB_StationGroup group (fileID,
+				 station,
+				 DAL::IO_Mode(DAL::IO_Mode::Create));
+
+    for (unsigned int dipole(0); dipole<nofDipoles; ++dipole) {
+      std::vector<short> samples (shape[0]);
+      for (hsize_t n(0); n<shape[0]; ++n) {
+	samples[n] = 1000*station + 100*dipole + n%100;
+      }
+      DAL::HDF5Dataset dataset (group.locationID(),
+				DAL::TBB_DipoleDataset::dipoleName(station,0,dipole),
+				shape,
+				H5T_STD_I16LE);
+      DAL::HDF5IOPlan plan (dataset, shape, H5T_NATIVE_SHORT);
+      plan.writeBlock (&samples[0], 0);
+      DAL::HDF5Attribute::write (dataset.objectID(), "RCU_ID", uint(dipole));
+    }
+  }
+  H5Fclose (fileID);
+
+  DAL::HDF5GroupBase::setHandleLimit (1);
+
+  cout << "[1] Testing selection of dipoles across station groups ..." << endl;
+  try {
+    TBB_Timeseries ts (filename);
+    std::set<std::string> selection;
+
+    if (ts.nofStationGroups() != nofStations)               ++nofFailedTests;
+    if (ts.nofSelectedDatasets() != nofStations*nofDipoles) ++nofFailedTests;
+    if (ts.dipoleNames().size() != nofStations*nofDipoles)  ++nofFailedTests;
+
+    /* Select the second dipole of each station */
+    for (unsigned int station(0); station<nofStations; ++station) {
+      selection.insert (DAL::TBB_DipoleDataset::dipoleName(station,0,1));
+    }
+    ts.selectDipoles (selection);
+
+    if (ts.selectedDipoles() != selection)     ++nofFailedTests;
+    if (ts.nofSelectedDatasets() != nofStations) ++nofFailedTests;
+
+    /* Visiting all station groups must not reset their selection */
+    std::vector<uint> rcu;
+    ts.getAttributes ("RCU_ID", rcu);
+    if (rcu != std::vector<uint>(nofStations,1)) ++nofFailedTests;
+    ts.dipoleNumbers ();
+    if (ts.selectedDipoles() != selection)       ++nofFailedTests;
+    if (ts.dipoleSelection().size() != nofStations) ++nofFailedTests;
+
+    int nofSamples (128);
+    std::vector<int> start (nofStations, 10);
+    std::vector<double> data (nofStations*nofSamples);
+
+    if (!ts.readData (&data[0], start, nofSamples, 1)) ++nofFailedTests;
+
+    for (unsigned int station(0); station<nofStations; ++station) {
+      for (int n(0); n<nofSamples; ++n) {
+	if (data[station*nofSamples+n] != 1000*station + 100 + (10+n)%100) {
+	  ++nofFailedTests;
+	  break;
+	}
+      }
+    }
+
+    ts.selectAllDipoles ();
+    if (ts.nofSelectedDatasets() != nofStations*nofDipoles) ++nofFailedTests;
+  }
+  catch (std::string message) {
+    cerr << message << endl;
+    nofFailedTests++;
+  }
+
+  DAL::HDF5GroupBase::setHandleLimit (limit);
+
+  return nofFailedTests;
+}
+
 //_______________________________________________________________________________
 //                                                              test_construction
 
@@ -420,6 +669,10 @@ int main (int argc,
   //________________________________________________________
   // Run the tests
 
+  // Test reading the data of the dipoles into caller-provided memory
+  nofFailedTests += test_readData ();
+  // Test access beyond the limit on the number of open station groups
+  nofFailedTests += test_handleLimit ();
   nofFailedTests += test_construction ();
 
   if (haveDataset) {
@@ -0,0 +1,207 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+/*!
+  \file pydal_HDF5BlockIterator.cc
+
+  \ingroup DAL
+  \ingroup pydal
+
+  \brief Python bindings for the DAL::HDF5BlockIterator class
+
+  \author agent
+*/
+
+// DAL headers
+#include <pydal.h>
+#include <core/HDF5BlockIterator.h>
+
+using DAL::HDF5BlockIterator;
+using DAL::HDF5Dataset;
+
+// ==============================================================================
+//
+//                                                     Additional Python wrappers
+//
+// ==============================================================================
+
+//_______________________________________________________________________________
+//                                                         HDF5BlockIterator_new
+
+/*!
+  \param dataset     -- Dataset over which to iterate, e.g. a BF Stokes dataset.
+  \param blockLength -- Length of a block along the direction of iteration;
+         along all other axes a block covers the full dataset.
+  \param axis        -- Axis along which to step through the dataset.
+  \param nofBuffers  -- Number of buffers in the ring, i.e. the iterator
+         prefetches up to <tt>nofBuffers-1</tt> blocks.
+  \return iterator   -- New iterator, handing out blocks as \c float32.
+*/
+HDF5BlockIterator * HDF5BlockIterator_new (HDF5Dataset &dataset,
+					   hsize_t const &blockLength,
+					   unsigned int const &axis,
+					   unsigned int const &nofBuffers)
+{
+  std::vector<hsize_t> block = dataset.shape();
+  HDF5BlockIterator *iterator = NULL;
+
+  if (axis >= block.size()) {
+    PyErr_SetString(PyExc_ValueError, "invalid axis of iteration");
+    boost::python::throw_error_already_set();
+  }
+
+  block[axis] = blockLength;
+
+  {
+    DAL::ScopedGILRelease release (false);
+    iterator = new HDF5BlockIterator (dataset,
+				      block,
+				      H5T_NATIVE_FLOAT,
+				      axis,
+				      nofBuffers);
+  }
+
+  if (!iterator->isValid()) {
+    delete iterator;
+    PyErr_SetString(PyExc_ValueError,
+		    "unable to iterate over the dataset");
+    boost::python::throw_error_already_set();
+  }
+
+  return iterator;
+}
+
+//! Iterator along the first axis, using triple buffering
+HDF5BlockIterator * HDF5BlockIterator_new1 (HDF5Dataset &dataset,
+					    hsize_t const &blockLength)
+{
+  return HDF5BlockIterator_new (dataset, blockLength, 0, 3);
+}
+
+//! Iterator along the given axis, using triple buffering
+HDF5BlockIterator * HDF5BlockIterator_new2 (HDF5Dataset &dataset,
+					    hsize_t const &blockLength,
+					    unsigned int const &axis)
+{
+  return HDF5BlockIterator_new (dataset, blockLength, axis, 3);
+}
+
+//_______________________________________________________________________________
+//                                                        HDF5BlockIterator_next
+
+/*!
+  \param self   -- The Python object wrapping the iterator.
+  \return block -- Array with the next block, as \c float32. The array is a
+          view on the ring of buffers of the iterator and is overwritten once
+          the iteration proceeds; copy the block if it is to be kept.
+
+  Raises \c StopIteration at the end of the dataset; the GIL is released while
+  waiting for the block to be read.
+*/
+boost::python::numeric::array HDF5BlockIterator_next (boost::python::object self)
+{
+  HDF5BlockIterator &iterator = boost::python::extract<HDF5BlockIterator&>(self);
+  float const *block          = NULL;
+
+  /* Not holding the HDF5 lock, which the I/O thread needs to proceed */
+  {
+    DAL::ScopedGILRelease release (false);
+    block = iterator.next<float>();
+  }
+
+  if (block == NULL) {
+    if (iterator.error()) {
+      PyErr_SetString(PyExc_IOError, "failed to read block of data");
+    } else {
+      PyErr_SetNone(PyExc_StopIteration);
+    }
+    boost::python::throw_error_already_set();
+  }
+
+  std::vector<hsize_t> shape = iterator.blockShape();
+  std::vector<int> dims (shape.begin(), shape.end());
+
+  return DAL::toNumericView (const_cast<float *>(block), dims, self);
+}
+
+//! Get the iterator itself, as required by the Python iterator protocol
+boost::python::object HDF5BlockIterator_iter (boost::python::object self)
+{
+  return self;
+}
+
+//! Restart the iteration from the first block
+bool HDF5BlockIterator_start (HDF5BlockIterator &iterator)
+{
+  DAL::ScopedGILRelease release (false);
+  return iterator.start();
+}
+
+// ==============================================================================
+//
+//                                                      Wrapper for class methods
+//
+// ==============================================================================
+
+void export_HDF5BlockIterator ()
+{
+  void (HDF5BlockIterator::*summary1)()
+    = &HDF5BlockIterator::summary;
+
+  boost::python::class_<HDF5BlockIterator, boost::noncopyable>("HDF5BlockIterator",
+							      boost::python::no_init)
+    // Construction; the iterator keeps the dataset object alive
+    .def("__init__",
+	 boost::python::make_constructor (&HDF5BlockIterator_new1,
+					   boost::python::with_custodian_and_ward<1,2>()))
+    .def("__init__",
+	 boost::python::make_constructor (&HDF5BlockIterator_new2,
+					   boost::python::with_custodian_and_ward<1,2>()))
+    .def("__init__",
+	 boost::python::make_constructor (&HDF5BlockIterator_new,
+					   boost::python::with_custodian_and_ward<1,2>()))
+    // Parameter access
+    .def("axis",
+	 &HDF5BlockIterator::axis,
+	 "Get the axis along which the iteration proceeds.")
+    .def("nofBlocks",
+	 &HDF5BlockIterator::nofBlocks,
+	 "Get the number of blocks along the direction of the iteration.")
+    .def("nofBuffers",
+	 &HDF5BlockIterator::nofBuffers,
+	 "Get the number of buffers in the ring.")
+    .def("summary",
+	 summary1,
+	 "Summary of the object's internal parameters and status.")
+    // Iteration
+    .def("__iter__",
+	 &HDF5BlockIterator_iter,
+	 "Get the iterator itself.")
+    .def("start",
+	 &HDF5BlockIterator_start,
+	 "Restart the iteration from the first block.")
+    .def("next",
+	 &HDF5BlockIterator_next,
+	 "Get the next block of data.")
+    .def("__next__",
+	 &HDF5BlockIterator_next,
+	 "Get the next block of data.")
+    ;
+}
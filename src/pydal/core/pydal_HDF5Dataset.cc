@@ -41,6 +41,116 @@ using DAL::HDF5Dataset;
 //
 // ==============================================================================
 
+//_______________________________________________________________________________
+//                                                                 readDataInPlace
+
+/*!
+  \param dataset -- Dataset from which to read the data.
+  \param out     -- Contiguous, writeable array into which the data are read;
+         its shape defines the block of data to read.
+  \param start   -- Position within the dataset at which to start reading.
+  \return status -- Status of the operation; returns \e false in case an
+          error was encountered.
+*/
+template <class T>
+bool readDataInPlace (HDF5Dataset &dataset,
+		      boost::python::numeric::array &out,
+		      std::vector<int> const &start)
+{
+  bool status (true);
+  std::vector<int> block = num_util::shape (out);
+  T *data                = DAL::numericArrayData<T> (out, num_util::size(out));
+
+  {
+    DAL::ScopedGILRelease release;
+    status = dataset.readData (data, start, block);
+  }
+
+  return status;
+}
+
+//_______________________________________________________________________________
+//                                                            HDF5Dataset_readData
+
+/*!
+  \param dataset -- Dataset from which to read the data.
+  \param out     -- Contiguous, writeable array into which the data are read;
+         its shape defines the block of data to read.
+  \param start   -- Position within the dataset at which to start reading.
+  \return status -- Status of the operation; returns \e false in case an
+          error was encountered.
+
+  The data are read by \c H5Dread straight into the memory of \c out; the
+  element type of \c out defines the memory datatype of the transfer. The
+  GIL is released while reading.
+*/
+bool HDF5Dataset_readData (HDF5Dataset &dataset,
+			   boost::python::numeric::array out,
+			   boost::python::object start)
+{
+  std::vector<int> pos;
+  int rank = num_util::rank (out);
+
+  if (rank != int(dataset.rank())) {
+    PyErr_SetString(PyExc_ValueError,
+		    "rank of output array does not match rank of dataset");
+    boost::python::throw_error_already_set();
+  }
+
+  if (start.ptr() == Py_None) {
+    pos.resize (rank, 0);
+  } else {
+    for (int n=0; n<boost::python::len(start); ++n) {
+      pos.push_back (boost::python::extract<int>(start[n]));
+    }
+    if (int(pos.size()) != rank) {
+      PyErr_SetString(PyExc_ValueError,
+		      "length of start position does not match rank of dataset");
+      boost::python::throw_error_already_set();
+    }
+  }
+
+  switch (num_util::type(out)) {
+  case PyArray_BYTE:
+    return readDataInPlace<signed char> (dataset, out, pos);
+  case PyArray_UBYTE:
+    return readDataInPlace<unsigned char> (dataset, out, pos);
+  case PyArray_SHORT:
+    return readDataInPlace<short> (dataset, out, pos);
+  case PyArray_USHORT:
+    return readDataInPlace<unsigned short> (dataset, out, pos);
+  case PyArray_INT:
+    return readDataInPlace<int> (dataset, out, pos);
+  case PyArray_UINT:
+    return readDataInPlace<unsigned int> (dataset, out, pos);
+  case PyArray_LONG:
+    return readDataInPlace<long> (dataset, out, pos);
+  case PyArray_LONGLONG:
+    return readDataInPlace<long long> (dataset, out, pos);
+  case PyArray_FLOAT:
+    return readDataInPlace<float> (dataset, out, pos);
+  case PyArray_DOUBLE:
+    return readDataInPlace<double> (dataset, out, pos);
+  case PyArray_CFLOAT:
+    return readDataInPlace<std::complex<float> > (dataset, out, pos);
+  case PyArray_CDOUBLE:
+    return readDataInPlace<std::complex<double> > (dataset, out, pos);
+  default:
+    PyErr_SetString(PyExc_TypeError,
+		    "element type of output array is not supported");
+    boost::python::throw_error_already_set();
+  }
+
+  return false;
+}
+
+//! Read the data, starting at the origin of the dataset
+bool HDF5Dataset_readData1 (HDF5Dataset &dataset,
+			    boost::python::numeric::array out)
+{
+  return HDF5Dataset_readData (dataset, out, boost::python::object());
+}
+
 // ==============================================================================
 //
 //                                                      Wrapper for class methods
@@ -53,6 +163,8 @@ void export_HDF5Dataset ()
     = &HDF5Dataset::summary;
   void (HDF5Dataset::*summary2)(std::ostream &) 
     = &HDF5Dataset::summary;
+  haddr_t (HDF5Dataset::*offset1)() 
+    = &HDF5Dataset::offset;
   
   boost::python::class_<HDF5Dataset>("HDF5Dataset")
     // Construction
@@ -110,7 +222,15 @@ void export_HDF5Dataset ()
     .def("summary",
 	 summary2,
 	 "Summary of the object's internal parameters and status.")
-    // Static Public Member Functions
-    .staticmethod("offset")
+    .def("offset",
+	 offset1,
+	 "Get the address in the file, expressed in bytes from the beginning of the file.")
+    // Read the data
+    .def("readData",
+	 &HDF5Dataset_readData1,
+	 "Read the data into the array 'out', starting at the origin; the shape of 'out' defines the block to read.")
+    .def("readData",
+	 &HDF5Dataset_readData,
+	 "Read the data into the array 'out', starting at position 'start'; the shape of 'out' defines the block to read.")
     ;
 }
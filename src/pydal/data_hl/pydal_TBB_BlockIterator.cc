@@ -0,0 +1,225 @@
+/***************************************************************************
+ *   Copyright (C) 2026                                                    *
+ *   agent <agent@local>                                                   *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+/*!
+  \file pydal_TBB_BlockIterator.cc
+
+  \ingroup DAL
+  \ingroup pydal
+
+  \brief Python bindings for the DAL::TBB_BlockIterator class
+
+  \author agent
+*/
+
+// DAL headers
+#include "pydal.h"
+#include <data_hl/TBB_BlockIterator.h>
+#include <data_hl/TBB_Timeseries.h>
+
+using DAL::TBB_BlockIterator;
+using DAL::TBB_DipoleDataset;
+using DAL::TBB_Timeseries;
+
+// ==============================================================================
+//
+//                                                     Additional Python wrappers
+//
+// ==============================================================================
+
+//_______________________________________________________________________________
+//                                                         TBB_BlockIterator_new
+
+/*!
+  \param timeseries  -- TBB time-series dataset, from which to read.
+  \param blockLength -- Number of samples per dipole within a block.
+  \param dipoles     -- Names of the dipoles to read; \c None selects all
+         dipoles of the time-series.
+  \param nofBuffers  -- Number of buffers in the ring, i.e. the iterator
+         prefetches up to <tt>nofBuffers-1</tt> blocks.
+  \return iterator   -- New iterator over the selected dipoles; the rows of a
+          block follow the (sorted) names of the selected dipoles.
+*/
+TBB_BlockIterator * TBB_BlockIterator_new (TBB_Timeseries &timeseries,
+					   hsize_t const &blockLength,
+					   boost::python::object dipoles,
+					   unsigned int const &nofBuffers)
+{
+  std::vector<hid_t> datasets;
+  /* Keeps the dataset identifiers open until the iterator holds them */
+  std::vector<TBB_DipoleDataset> selection;
+
+  if (dipoles.ptr() == Py_None) {
+    timeseries.selectAllDipoles();
+  } else {
+    std::set<std::string> names;
+    for (int n=0; n<boost::python::len(dipoles); ++n) {
+      names.insert (boost::python::extract<std::string>(dipoles[n]));
+    }
+    timeseries.selectDipoles (names);
+  }
+
+  selection = timeseries.dipoleSelection();
+
+  for (unsigned int n=0; n<selection.size(); ++n) {
+    datasets.push_back (selection[n].locationID());
+  }
+
+  TBB_BlockIterator *iterator = NULL;
+
+  {
+    DAL::ScopedGILRelease release (false);
+    iterator = new TBB_BlockIterator (datasets,
+				      blockLength,
+				      H5T_NATIVE_SHORT,
+				      nofBuffers);
+  }
+
+  if (!iterator->isValid()) {
+    delete iterator;
+    PyErr_SetString(PyExc_ValueError,
+		    "unable to iterate over the selected dipoles");
+    boost::python::throw_error_already_set();
+  }
+
+  return iterator;
+}
+
+//! Iterator over all dipoles, using triple buffering
+TBB_BlockIterator * TBB_BlockIterator_new1 (TBB_Timeseries &timeseries,
+					    hsize_t const &blockLength)
+{
+  return TBB_BlockIterator_new (timeseries,
+				blockLength,
+				boost::python::object(),
+				3);
+}
+
+//! Iterator over a selection of dipoles, using triple buffering
+TBB_BlockIterator * TBB_BlockIterator_new2 (TBB_Timeseries &timeseries,
+					    hsize_t const &blockLength,
+					    boost::python::object dipoles)
+{
+  return TBB_BlockIterator_new (timeseries,
+				blockLength,
+				dipoles,
+				3);
+}
+
+//_______________________________________________________________________________
+//                                                        TBB_BlockIterator_next
+
+/*!
+  \param self   -- The Python object wrapping the iterator.
+  \return block -- Array of shape (dipoles,samples) with the samples of the
+          next block, as \c int16. The array is a view on the ring of buffers
+          of the iterator and is overwritten once the iteration proceeds; copy
+          the block if it is to be kept.
+
+  Raises \c StopIteration at the end of the data; the GIL is released while
+  waiting for the block to be read.
+*/
+boost::python::numeric::array TBB_BlockIterator_next (boost::python::object self)
+{
+  TBB_BlockIterator &iterator = boost::python::extract<TBB_BlockIterator&>(self);
+  short const *block          = NULL;
+
+  /* Not holding the HDF5 lock, which the I/O thread needs to proceed */
+  {
+    DAL::ScopedGILRelease release (false);
+    block = iterator.next<short>();
+  }
+
+  if (block == NULL) {
+    if (iterator.error()) {
+      PyErr_SetString(PyExc_IOError, "failed to read block of dipole data");
+    } else {
+      PyErr_SetNone(PyExc_StopIteration);
+    }
+    boost::python::throw_error_already_set();
+  }
+
+  std::vector<int> dims (2);
+  dims[0] = iterator.nofDipoles();
+  dims[1] = iterator.nofSamples();
+
+  return DAL::toNumericView (const_cast<short *>(block), dims, self);
+}
+
+//! Get the iterator itself, as required by the Python iterator protocol
+boost::python::object TBB_BlockIterator_iter (boost::python::object self)
+{
+  return self;
+}
+
+//! Restart the iteration from the first block
+bool TBB_BlockIterator_start (TBB_BlockIterator &iterator)
+{
+  DAL::ScopedGILRelease release (false);
+  return iterator.start();
+}
+
+// ==============================================================================
+//
+//                                                      Wrapper for class methods
+//
+// ==============================================================================
+
+void export_TBB_BlockIterator ()
+{
+  void (TBB_BlockIterator::*summary1)()
+    = &TBB_BlockIterator::summary;
+
+  boost::python::class_<TBB_BlockIterator, boost::noncopyable>("TBB_BlockIterator",
+							      boost::python::no_init)
+    /* Construction; the iterator keeps the time-series object alive */
+    .def("__init__",
+	 boost::python::make_constructor (&TBB_BlockIterator_new1,
+					   boost::python::with_custodian_and_ward<1,2>()))
+    .def("__init__",
+	 boost::python::make_constructor (&TBB_BlockIterator_new2,
+					   boost::python::with_custodian_and_ward<1,2>()))
+    .def("__init__",
+	 boost::python::make_constructor (&TBB_BlockIterator_new,
+					   boost::python::with_custodian_and_ward<1,2>()))
+    /* Access to internal parameters */
+    .def("nofDipoles", &TBB_BlockIterator::nofDipoles,
+	 "Get the number of dipoles.")
+    .def("blockLength", &TBB_BlockIterator::blockLength,
+	 "Get the number of samples per dipole within a (full) block.")
+    .def("length", &TBB_BlockIterator::length,
+	 "Get the number of samples per dipole covered by the iteration.")
+    .def("nofBlocks", &TBB_BlockIterator::nofBlocks,
+	 "Get the number of blocks.")
+    .def("nofBuffers", &TBB_BlockIterator::nofBuffers,
+	 "Get the number of buffers in the ring.")
+    .def("summary", summary1,
+	 "Provide a summary of the internal status.")
+    /* Iteration */
+    .def("__iter__", &TBB_BlockIterator_iter,
+	 "Get the iterator itself.")
+    .def("start", &TBB_BlockIterator_start,
+	 "Restart the iteration from the first block.")
+    .def("next", &TBB_BlockIterator_next,
+	 "Get the next block of samples, of shape (dipoles,samples).")
+    .def("__next__", &TBB_BlockIterator_next,
+	 "Get the next block of samples, of shape (dipoles,samples).")
+    ;
+}
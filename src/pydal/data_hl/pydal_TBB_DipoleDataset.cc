@@ -41,6 +41,36 @@ using DAL::TBB_DipoleDataset;
 //
 // ==============================================================================
 
+//_______________________________________________________________________________
+//                                                      TBB_DipoleDataset_readData
+
+/*!
+  \param dipole -- Dipole dataset from which to read the data.
+  \param start  -- Number of the sample at which to start reading.
+  \param out    -- Contiguous, writeable array of type \c int16, into which
+         the data are read; its size defines the number of samples to read.
+  \return status -- Status of the operation; returns \e false in case an
+          error was encountered.
+
+  The samples are read straight into the memory of \c out, without
+  intermediate buffer or copy; the GIL is released while reading.
+*/
+bool TBB_DipoleDataset_readData (TBB_DipoleDataset &dipole,
+				 int const &start,
+				 boost::python::numeric::array out)
+{
+  bool status (true);
+  int nofSamples = num_util::size (out);
+  short *data    = DAL::numericArrayData<short> (out, nofSamples);
+  
+  {
+    DAL::ScopedGILRelease release;
+    status = dipole.readData (start, nofSamples, data);
+  }
+  
+  return status;
+}
+
 void export_TBB_DipoleDataset()
 {
   void (TBB_DipoleDataset::*summary1)()                = &TBB_DipoleDataset::summary;
@@ -86,6 +116,8 @@ void export_TBB_DipoleDataset()
 	  "Get the unique channel/dipole identifier." )
     .def( "getName", dipoleName1,
 	  "Get the unique channel/dipole identifier." )
+    .def( "readData", &TBB_DipoleDataset_readData,
+	  "Read samples, starting at 'start', into the int16 array 'out'." )
 //     .def( "getName", dipoleName2,
 // 	  "Get the unique channel/dipole identifier." )
     ;
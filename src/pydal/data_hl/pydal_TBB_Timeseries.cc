@@ -31,10 +31,103 @@
 
 // DAL headers
 #include "pydal.h"
+#include <core/dalConversions.h>
 #include <data_hl/TBB_Timeseries.h>
 
 using DAL::TBB_Timeseries;
 
+// ==============================================================================
+//
+//                                                     Additional Python wrappers
+//
+// ==============================================================================
+
+//_______________________________________________________________________________
+//                                                        TBB_Timeseries_readData
+
+/*!
+  \param timeseries -- TBB time-series dataset, from which to read.
+  \param out        -- Contiguous, writeable array of shape (dipoles,samples)
+         into which the data of the selected dipoles are read; the number of
+         columns defines the number of samples to read.
+  \param start      -- Number of the sample at which to start reading, either
+         a single value or one value per selected dipole.
+  \return status    -- Status of the operation; returns \e false in case an
+          error was encountered.
+
+  For an \c int16 array the raw samples are read straight into the memory of
+  \c out; for \c float64 the samples are converted while reading, and for
+  \c float32 the raw samples are converted after reading. The GIL is released
+  while reading.
+*/
+bool TBB_Timeseries_readData (TBB_Timeseries &timeseries,
+			      boost::python::numeric::array out,
+			      boost::python::object start)
+{
+  bool status (true);
+  unsigned int nofDipoles = timeseries.selectedDipoles().size();
+  std::vector<int> shape  = num_util::shape (out);
+  std::vector<int> pos;
+
+  if (shape.size() != 2 || shape[0] != int(nofDipoles)) {
+    PyErr_SetString(PyExc_ValueError,
+		    "output array must be of shape (selected dipoles,samples)");
+    boost::python::throw_error_already_set();
+  }
+
+  boost::python::extract<int> single (start);
+  if (single.check()) {
+    pos.resize (nofDipoles, single());
+  } else {
+    for (int n=0; n<boost::python::len(start); ++n) {
+      pos.push_back (boost::python::extract<int>(start[n]));
+    }
+  }
+
+  int nofSamples = shape[1];
+  int nelem      = nofDipoles*nofSamples;
+
+  switch (num_util::type(out)) {
+  case PyArray_SHORT:
+    {
+      short *data = DAL::numericArrayData<short> (out, nelem);
+      DAL::ScopedGILRelease release;
+      status = timeseries.readData (data, pos, nofSamples);
+    }
+    break;
+  case PyArray_FLOAT:
+    {
+      float *data = DAL::numericArrayData<float> (out, nelem);
+      DAL::ScopedGILRelease release;
+      std::vector<short> buffer (nelem);
+      status = timeseries.readData (&buffer[0], pos, nofSamples);
+      DAL::convertSamples (data, &buffer[0], nelem);
+    }
+    break;
+  case PyArray_DOUBLE:
+    {
+      double *data = DAL::numericArrayData<double> (out, nelem);
+      /* Reading with several threads, which take the HDF5 lock by themselves */
+      DAL::ScopedGILRelease release (false);
+      status = timeseries.readData (data, pos, nofSamples);
+    }
+    break;
+  default:
+    PyErr_SetString(PyExc_TypeError,
+		    "output array must be of type int16, float32 or float64");
+    boost::python::throw_error_already_set();
+  }
+
+  return status;
+}
+
+//! Read the data, starting at the same sample for all selected dipoles
+bool TBB_Timeseries_readData1 (TBB_Timeseries &timeseries,
+			       boost::python::numeric::array out)
+{
+  return TBB_Timeseries_readData (timeseries, out, boost::python::object(0));
+}
+
 // ==============================================================================
 //
 //                                                                 TBB_Timeseries
@@ -56,5 +149,12 @@ void export_TBB_Timeseries ()
 	  "Get the number of station groups collected into this file." )
     .def( "nofDipoleDatasets", &TBB_Timeseries::nofDipoleDatasets,
 	  "Get the number of dipole datasets collected into this file." )
+    /* Access to the data */
+    .def( "readData", &TBB_Timeseries_readData,
+	  "Read samples of the selected dipoles, starting at 'start', into the\n"
+	  "(dipoles,samples) array 'out' of type int16, float32 or float64." )
+    .def( "readData", &TBB_Timeseries_readData1,
+	  "Read samples of the selected dipoles, starting at the first sample,\n"
+	  "into the (dipoles,samples) array 'out'." )
     ;
 }
@@ -340,6 +340,20 @@ void check_contiguous(numeric::array arr)
   return;
 }
 
+bool iswriteable(numeric::array arr)
+{
+  return PyArray_ISWRITEABLE(arr.ptr());
+}
+
+void check_writeable(numeric::array arr)
+{
+  if (!iswriteable(arr)) {
+    PyErr_SetString(PyExc_RuntimeError, "expected a writeable array");
+    throw_error_already_set();
+  }
+  return;
+}
+
 void* data(numeric::array arr){
   if(!PyArray_Check(arr.ptr())){
     PyErr_SetString(PyExc_ValueError, "expected a PyArrayObject");
@@ -98,6 +98,34 @@ namespace num_util{
   }
     
 
+  /** 
+   *Function template creates an n-dimensional numpy array with dimensions dims
+   *referencing the values starting at data, without copying them. The object
+   *owner is kept alive as base of the array for as long as the array exists;
+   *it must own (or keep alive) the memory at data.
+   *@param T  C type of data
+   *@param T*  data pointer to start of data
+   *@param dims an integer vector of dimensions.
+   *@param owner the Python object owning the memory at data.
+   *@return a numpy array referencing data.
+   */
+  template <typename T> boost::python::numeric::array makeView(T * data,
+							       std::vector<int> dims,
+							       boost::python::object owner){
+    std::vector<npy_intp> shape (dims.begin(),dims.end());
+    boost::python::object obj(boost::python::handle<>(PyArray_SimpleNewFromData(shape.size(),
+										&shape[0],
+										getEnum<T>(),
+										(void*) data)));
+    Py_INCREF(owner.ptr());
+#if NPY_API_VERSION >= 0x00000007
+    PyArray_SetBaseObject((PyArrayObject*) obj.ptr(), owner.ptr());
+#else
+    PyArray_BASE((PyArrayObject*) obj.ptr()) = owner.ptr();
+#endif
+    return boost::python::extract<boost::python::numeric::array>(obj);
+  }
+
   /** 
    *Creates a numpy array from a numpy array, referencing the data.
    *@param arr a Boost/Python numeric array.
@@ -203,6 +231,20 @@ namespace num_util{
   */
   void check_contiguous(boost::python::numeric::array arr);
 
+  /** 
+   *Tests whether the data of the array may be written to.
+   *@param arr a Boost/Python numeric array.
+   *@return true if the array is writeable, false otherwise.
+  */
+  bool iswriteable(boost::python::numeric::array arr);
+
+  /** 
+   *Throws an exception if the data of the array may not be written to.
+   *@param arr a Boost/Python numeric array.
+   *@return -----
+  */
+  void check_writeable(boost::python::numeric::array arr);
+
   /** 
    *Returns a pointer to the data in the array.
    *@param arr a Boost/Python numeric array.
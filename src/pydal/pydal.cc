@@ -43,6 +43,7 @@ BOOST_PYTHON_MODULE(pydal)
     ;
   
   Py_Initialize();
+  PyEval_InitThreads();
   import_array();
   boost::python::numeric::array::set_module_and_type("numpy", "ndarray");
 
@@ -59,6 +60,8 @@ BOOST_PYTHON_MODULE(pydal)
   export_dalDataset ();
   export_dalGroup ();
   export_dalTable ();
+  export_HDF5BlockIterator ();
+  export_HDF5Dataset ();
   export_IO_Mode ();
 
   // ============================================================================
@@ -94,6 +97,7 @@ BOOST_PYTHON_MODULE(pydal)
   export_BeamFormed ();
   export_BeamGroup ();
   export_BF_BeamGroup ();
+  export_TBB_BlockIterator ();
   export_TBB_Timeseries ();
   export_TBB_StationGroup ();
   export_TBB_DipoleDataset ();  
@@ -23,6 +23,8 @@
 
 #include "num_util.h"
 
+#include <core/HDF5Lock.h>
+
 /*!
   \file pydal.h
   
@@ -64,6 +66,98 @@ namespace DAL {   //   BEGIN -- namespace DAL
       return narray;
     }
 
+  /*!
+    \brief Get the data of a numeric array to be filled in place
+
+    The array \c out must be contiguous, writeable, hold elements of type
+    \c T and consist of \c nelem elements; otherwise a Python exception is
+    raised. The returned pointer can be handed to the reading methods of the
+    library directly, such that the data are transferred from the file into
+    the array without any intermediate copy.
+  */
+  template <class T>
+    T * numericArrayData (boost::python::numeric::array &out,
+			  unsigned int const &nelem)
+    {
+      num_util::check_type (out, num_util::getEnum<T>());
+      num_util::check_contiguous (out);
+      num_util::check_writeable (out);
+      num_util::check_size (out, nelem);
+      return (T*) num_util::data (out);
+    }
+
+  //! Wrap array owned by \c owner as Boost.Python numeric array, without copy
+  template <class T>
+    boost::python::numeric::array toNumericView (T *data,
+						 std::vector<int> const &dims,
+						 boost::python::object owner)
+    {
+      return num_util::makeView (data, dims, owner);
+    }
+
+  /*!
+    \brief Release the Python GIL for the lifetime of the object
+
+    Blocking I/O and lengthy loops in the bindings should be wrapped into the
+    scope of a ScopedGILRelease, such that other Python threads (e.g. one
+    processing the previous block of data) are able to run in the meantime:
+    \code
+    {
+      DAL::ScopedGILRelease release;
+      status = dataset.readData (data, start, block);
+    }
+    \endcode
+    No Python API may be used within that scope -- in particular arrays must
+    be checked and their data pointers retrieved beforehand.
+
+    Unless \c lockHDF5 is set to \e false, the object in addition holds the
+    process-wide DAL::HDF5Lock for its lifetime, which is shared with the I/O
+    threads of the library (e.g. of an HDF5BlockIterator); the calls into the
+    HDF5 library from concurrent Python threads thus are serialized, while
+    their computations overlap. The lock is acquired after releasing the GIL,
+    such that a thread waiting for the lock does not block the interpreter.
+
+    Calls into the library which wait for one of its threads -- e.g.
+    HDF5BlockIterator::next, or TBB_Timeseries::readData reading with several
+    threads -- take the HDF5Lock by themselves where needed, and must be
+    placed into the scope of an object created with \c lockHDF5=false;
+    holding the lock while waiting would deadlock.
+  */
+  class ScopedGILRelease {
+
+    //! State of the thread, saved when releasing the GIL
+    PyThreadState *itsState;
+    //! Does the object hold the HDF5 lock?
+    bool itsLocked;
+
+  public:
+
+    //! Release the GIL (and acquire the HDF5 lock, unless \c lockHDF5=false)
+    ScopedGILRelease (bool const &lockHDF5=true) {
+      itsState  = PyEval_SaveThread();
+      itsLocked = lockHDF5;
+      if (itsLocked) {
+	HDF5Lock::lock ();
+      }
+    }
+
+    //! Release the HDF5 lock (if held) and re-acquire the GIL
+    ~ScopedGILRelease () {
+      if (itsLocked) {
+	HDF5Lock::unlock ();
+      }
+      PyEval_RestoreThread (itsState);
+    }
+
+  private:
+
+    //! Copy constructor (not implemented)
+    ScopedGILRelease (ScopedGILRelease const &);
+    //! Assignment operator (not implemented)
+    ScopedGILRelease& operator= (ScopedGILRelease const &);
+
+  };
+
 };   //   END -- namespace DAL
 
   // ============================================================================
@@ -88,6 +182,10 @@ void export_dalDataset ();
 void export_dalGroup ();
 //! Bindings for DAL::dalTable
 void export_dalTable ();
+//! Bindings for DAL::HDF5BlockIterator
+void export_HDF5BlockIterator ();
+//! Bindings for DAL::HDF5Dataset
+void export_HDF5Dataset ();
 //! Bindings for DAL::IO_Mode
 void export_IO_Mode ();
 
@@ -137,6 +235,8 @@ void export_BeamFormed();
 void export_BeamGroup();
 //! Bindings for DAL::BF_BeamGroup
 void export_BF_BeamGroup();
+//! Bindings for DAL::TBB_BlockIterator
+void export_TBB_BlockIterator();
 //! Bindings for DAL::TBB_Timeseries
 void export_TBB_Timeseries();
 //! Bindings for DAL::TBB_StationGroup
@@ -29,6 +29,9 @@
   \author Lars B&auml;hren
 */
 
+// Standard library header files
+#include <algorithm>
+
 // DAL headers
 #include "pydal.h"
 
@@ -222,6 +225,51 @@ boost::python::numeric::array DAL::dalData::get_boost3( int64_t offset, int32_t
   }
 }
 
+//_______________________________________________________________________________
+//                                                                    dalData_view
+
+/*!
+  \param self -- The Python object wrapping the dalData object.
+  \return view -- Numeric array referencing the data held by the dalData
+          object, without copying them; the array keeps the dalData object
+          alive. The axes of the array follow the layout of the data in
+          memory, i.e. for data in FORTRAN order the axes appear reversed.
+*/
+boost::python::numeric::array dalData_view (boost::python::object self)
+{
+  DAL::dalData &d = boost::python::extract<DAL::dalData&>(self);
+  std::vector<int> dims (d.itsShape);
+
+  if ("fortran" == d.arrayOrder()) {
+    std::reverse (dims.begin(), dims.end());
+  }
+  
+  if ( DAL::dal_CHAR == d.datatype() ) {
+    return DAL::toNumericView ((signed char*)d.data, dims, self);
+  }
+  else if ( DAL::dal_BOOL == d.datatype() ) {
+    return DAL::toNumericView ((unsigned char*)d.data, dims, self);
+  }
+  else if ( DAL::dal_INT == d.datatype() ) {
+    return DAL::toNumericView ((int*)d.data, dims, self);
+  }
+  else if ( DAL::dal_FLOAT == d.datatype() ) {
+    return DAL::toNumericView ((float*)d.data, dims, self);
+  }
+  else if ( DAL::dal_DOUBLE == d.datatype() ) {
+    return DAL::toNumericView ((double*)d.data, dims, self);
+  }
+  else if ( DAL::dal_COMPLEX == d.datatype() ) {
+    return DAL::toNumericView ((std::complex<float>*)d.data, dims, self);
+  }
+  
+  PyErr_SetString(PyExc_TypeError,
+		  "datatype can not be viewed without copy; use get() instead");
+  boost::python::throw_error_already_set();
+  
+  return boost::python::numeric::array (boost::python::list());
+}
+
 void export_dalData () 
 {
   boost::python::class_<dalData>("dalData")
@@ -242,6 +290,8 @@ void export_dalData ()
 	  "Get the data.")
     .def( "get", &dalData::get_boost3,
 	  "Get the data.")
+    .def( "view", &dalData_view,
+	  "Get the data as array referencing the memory of the object, without copy.")
     ;
 }
 
@@ -155,36 +155,41 @@ PyObject* dalTable::readRows_boost (int start,
     size_t * field_offsets = NULL;
     size_t * size_out      = NULL;
     
-    // retrieve the input fields needed for the append_records call
-    H5TBget_table_info ( itsFileID, itsName.c_str(), &nfields, &nofRecords_p );
+    /* Release the GIL while accessing the file */
+    {
+      DAL::ScopedGILRelease release;
+
+      // retrieve the input fields needed for the append_records call
+      H5TBget_table_info ( itsFileID, itsName.c_str(), &nfields, &nofRecords_p );
     
-    field_sizes = (size_t*)malloc( nfields * sizeof(size_t) );
-    field_offsets = (size_t*)malloc( nfields * sizeof(size_t) );
-    size_out = (size_t*)malloc( sizeof(size_t) );
-    itsFieldNames = (char**)malloc( nfields * sizeof(char*) );
-    for (unsigned int ii=0; ii<nfields; ii++) {
-      itsFieldNames[ii] = (char*)malloc(MAX_COL_NAME_SIZE*sizeof(char));
-    }
+      field_sizes = (size_t*)malloc( nfields * sizeof(size_t) );
+      field_offsets = (size_t*)malloc( nfields * sizeof(size_t) );
+      size_out = (size_t*)malloc( sizeof(size_t) );
+      itsFieldNames = (char**)malloc( nfields * sizeof(char*) );
+      for (unsigned int ii=0; ii<nfields; ii++) {
+        itsFieldNames[ii] = (char*)malloc(MAX_COL_NAME_SIZE*sizeof(char));
+      }
 
-    /* Retrieve information about table field */
-    status = H5TBget_field_info (itsFileID,
+      /* Retrieve information about table field */
+      status = H5TBget_field_info (itsFileID,
+				   itsName.c_str(),
+				   itsFieldNames,
+				   field_sizes,
+				   field_offsets,
+				   size_out);
+      /* Allocate memory to retrieve table entries */
+      data_out = (char*) realloc (data_out,
+				  (*size_out)*nrecs);
+      /* Read record entries from the table */
+      status = H5TBread_records( itsFileID,
 				 itsName.c_str(),
-				 itsFieldNames,
-				 field_sizes,
+				 start,
+				 nrecs,
+				 size_out[0],
 				 field_offsets,
-				 size_out);
-    /* Allocate memory to retrieve table entries */
-    data_out = (char*) realloc (data_out,
-				(*size_out)*nrecs);
-    /* Read record entries from the table */
-    status = H5TBread_records( itsFileID,
-			       itsName.c_str(),
-			       start,
-			       nrecs,
-			       size_out[0],
-			       field_offsets,
-			       field_sizes,
-			       data_out);
+				 field_sizes,
+				 data_out);
+    }
     
     for (int rec_idx=0; rec_idx<nrecs; rec_idx++) {
       for (unsigned int field_idx=0; field_idx<nfields; field_idx++) {